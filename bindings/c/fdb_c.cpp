@@ -63,6 +63,7 @@ int g_api_version = 0;
 /* This must be true so that we can return the data pointer of a
    Standalone<RangeResultRef> as an array of FDBKeyValue. */
 static_assert(sizeof(FDBKeyValue) == sizeof(KeyValueRef), "FDBKeyValue / KeyValueRef size mismatch");
+static_assert(sizeof(FDBKey) == sizeof(KeyRef), "FDBKey / KeyRef size mismatch");
 static_assert(sizeof(FDBBGMutation) == sizeof(GranuleMutationRef), "FDBBGMutation / GranuleMutationRef size mismatch");
 static_assert(static_cast<int>(FDB_BG_MUTATION_TYPE_SET_VALUE) == static_cast<int>(MutationRef::Type::SetValue),
               "FDB_BG_MUTATION_TYPE_SET_VALUE enum value mismatch");
@@ -944,6 +945,13 @@ FDBFuture* fdb_transaction_get_v13(FDBTransaction* tr, uint8_t const* key_name,
 	return fdb_transaction_get_impl(tr, key_name, key_name_length, 0);
 }
 
+extern "C" DLLEXPORT FDBFuture* fdb_transaction_get_batch(FDBTransaction* tr,
+                                                          FDBKey const* keys,
+                                                          int key_count,
+                                                          fdb_bool_t snapshot) {
+	return (FDBFuture*)(TXN(tr)->getBatch(VectorRef<KeyRef>((KeyRef*)keys, key_count), snapshot).extractPtr());
+}
+
 FDBFuture* fdb_transaction_get_key_impl(FDBTransaction* tr,
                                         uint8_t const* key_name,
                                         int key_name_length,
@@ -304,6 +304,12 @@ DLLEXPORT WARN_UNUSED_RESULT fdb_error_t fdb_future_get_uint64(FDBFuture* f, uin
 
 DLLEXPORT WARN_UNUSED_RESULT fdb_error_t fdb_future_get_double(FDBFuture* f, double* out);
 
+/* The pointers returned by the get functions below are borrowed, not copied: they
+   point directly into memory owned by the FDBFuture and remain valid until
+   fdb_future_destroy() or fdb_future_release_memory() is called on it. Range
+   results are exposed as an array of FDBKeyValue {pointer, length} pairs over
+   the same owned memory, so rows can be parsed in place without copying. */
+
 DLLEXPORT WARN_UNUSED_RESULT fdb_error_t fdb_future_get_key(FDBFuture* f, uint8_t const** out_key, int* out_key_length);
 
 DLLEXPORT WARN_UNUSED_RESULT fdb_error_t fdb_future_get_value(FDBFuture* f,
@@ -550,6 +556,18 @@ DLLEXPORT WARN_UNUSED_RESULT FDBFuture* fdb_transaction_get(FDBTransaction* tr,
                                                             fdb_bool_t snapshot);
 #endif
 
+/*
+ * Reads every key in the `keys` array at the same version with a single API
+ * call. The future will be set to an FDBKeyValue array containing one entry
+ * per key that is present in the database, in the same order as the request;
+ * keys that are not present are omitted. Read the result with
+ * fdb_future_get_keyvalue_array().
+ */
+DLLEXPORT WARN_UNUSED_RESULT FDBFuture* fdb_transaction_get_batch(FDBTransaction* tr,
+                                                                  FDBKey const* keys,
+                                                                  int key_count,
+                                                                  fdb_bool_t snapshot);
+
 #if FDB_API_VERSION >= 14
 DLLEXPORT WARN_UNUSED_RESULT FDBFuture* fdb_transaction_get_key(FDBTransaction* tr,
                                                                 uint8_t const* key_name,
@@ -253,6 +253,15 @@ ValueFuture Transaction::get(std::string_view key, fdb_bool_t snapshot) {
 	return ValueFuture(fdb_transaction_get(tr_, (const uint8_t*)key.data(), key.size(), snapshot));
 }
 
+KeyValueArrayFuture Transaction::get_batch(const std::vector<std::string_view>& keys, fdb_bool_t snapshot) {
+	std::vector<FDBKey> ks;
+	ks.reserve(keys.size());
+	for (const auto& key : keys) {
+		ks.push_back(FDBKey{ (const uint8_t*)key.data(), (int)key.size() });
+	}
+	return KeyValueArrayFuture(fdb_transaction_get_batch(tr_, ks.data(), ks.size(), snapshot));
+}
+
 KeyFuture Transaction::get_key(const uint8_t* key_name,
                                int key_name_length,
                                fdb_bool_t or_equal,
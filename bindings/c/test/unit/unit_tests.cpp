@@ -522,6 +522,39 @@ TEST_CASE("fdb_future_get_value") {
 	}
 }
 
+TEST_CASE("fdb_transaction_get_batch") {
+	insert_data(db, create_data({ { "a", "1" }, { "c", "3" } }));
+
+	fdb::Transaction tr(db);
+	while (1) {
+		std::string a = key("a");
+		std::string b = key("b");
+		std::string c = key("c");
+		fdb::KeyValueArrayFuture f1 = tr.get_batch({ a, b, c }, /* snapshot */ false);
+
+		fdb_error_t err = wait_future(f1);
+		if (err) {
+			fdb::EmptyFuture f2 = tr.on_error(err);
+			fdb_check(wait_future(f2));
+			continue;
+		}
+
+		FDBKeyValue const* out_kv;
+		int out_count;
+		int out_more;
+		fdb_check(f1.get(&out_kv, &out_count, &out_more));
+
+		// Absent keys are omitted and present keys come back in request order.
+		CHECK(out_count == 2);
+		CHECK(!out_more);
+		CHECK(std::string((const char*)out_kv[0].key, out_kv[0].key_length) == a);
+		CHECK(std::string((const char*)out_kv[0].value, out_kv[0].value_length) == "1");
+		CHECK(std::string((const char*)out_kv[1].key, out_kv[1].key_length) == c);
+		CHECK(std::string((const char*)out_kv[1].value, out_kv[1].value_length) == "3");
+		break;
+	}
+}
+
 TEST_CASE("fdb_future_get_string_array") {
 	insert_data(db, create_data({ { "foo", "bar" } }));
 
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+#
+# binary_trace_dump.py
+#
+# This source file is part of the FoundationDB open source project
+#
+# Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Converts binary trace logs (--trace-format binary) to JSON lines.
+
+The file format is described in flow/include/flow/BinaryTraceLogFormatter.h: a
+magic line, then length-prefixed records of raw key/value bytes.
+
+Usage: binary_trace_dump.py trace.*.bin [...] > trace.json
+"""
+
+import json
+import struct
+import sys
+
+MAGIC = b"FDBTRACEBIN1\n"
+
+
+def dump_file(path, out):
+    with open(path, "rb") as f:
+        data = f.read()
+    if not data.startswith(MAGIC):
+        raise ValueError("%s: not a binary trace file" % path)
+    pos = len(MAGIC)
+    while pos < len(data):
+        if len(data) - pos < 4:
+            raise ValueError("%s: truncated record at offset %d" % (path, pos))
+        (payload_size,) = struct.unpack_from("<I", data, pos)
+        pos += 4
+        end = pos + payload_size
+        if end > len(data):
+            raise ValueError("%s: truncated record at offset %d" % (path, pos - 4))
+        (field_count,) = struct.unpack_from("<H", data, pos)
+        pos += 2
+        event = {}
+        for _ in range(field_count):
+            (key_size,) = struct.unpack_from("<H", data, pos)
+            pos += 2
+            key = data[pos : pos + key_size].decode("utf-8", "backslashreplace")
+            pos += key_size
+            (value_size,) = struct.unpack_from("<I", data, pos)
+            pos += 4
+            value = data[pos : pos + value_size].decode("utf-8", "backslashreplace")
+            pos += value_size
+            event[key] = value
+        if pos != end:
+            raise ValueError("%s: malformed record ending at offset %d" % (path, pos))
+        json.dump(event, out)
+        out.write("\n")
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.stderr.write(__doc__)
+        return 1
+    for path in sys.argv[1:]:
+        dump_file(path, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
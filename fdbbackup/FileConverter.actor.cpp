@@ -29,6 +29,7 @@
 #include "fdbclient/BackupAgent.actor.h"
 #include "fdbclient/BackupContainer.h"
 #include "fdbclient/MutationList.h"
+#include "flow/CompressionUtils.h"
 #include "flow/flow.h"
 #include "flow/serialize.h"
 #include "fdbclient/BuildFlags.h"
@@ -170,16 +171,27 @@ struct MutationFilesReadProgress : public ReferenceCounted<MutationFilesReadProg
 
 		// Decodes the block into mutations and save them if >= minVersion and < maxVersion.
 		// Returns true if new mutations has been saved.
-		bool decodeBlock(const Standalone<StringRef>& buf, int len, Version minVersion, Version maxVersion) {
+		bool decodeBlock(Standalone<StringRef>& buf, int len, Version minVersion, Version maxVersion) {
 			StringRef block(buf.begin(), len);
 			StringRefReader reader(block, restore_corrupted_data());
 			int count = 0, inserted = 0;
 			Version msgVersion = invalidVersion;
 
 			try {
-				// Read block header
-				if (reader.consume<int32_t>() != PARTITIONED_MLOG_VERSION)
+				// Read block header; compressed blocks carry [rawLen][compressedLen][zstd payload]
+				uint32_t blockVersion = reader.consume<uint32_t>();
+				if (blockVersion == COMPRESSED_PARTITIONED_MLOG_VERSION) {
+					uint32_t rawLen = reader.consume<uint32_t>();
+					uint32_t compressedLen = reader.consume<uint32_t>();
+					const uint8_t* compressedData = reader.consume(compressedLen);
+					StringRef decompressed = CompressionUtils::decompress(
+					    CompressionFilter::ZSTD, StringRef(compressedData, compressedLen), buf.arena());
+					if (decompressed.size() != rawLen)
+						throw restore_corrupted_data();
+					reader = StringRefReader(decompressed, restore_corrupted_data());
+				} else if (blockVersion != PARTITIONED_MLOG_VERSION) {
 					throw restore_unsupported_file_version();
+				}
 
 				while (1) {
 					// If eof reached or first key len bytes is 0xFF then end of block was reached.
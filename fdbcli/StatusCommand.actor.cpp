@@ -1289,6 +1289,61 @@ void printStatus(StatusObjectReader statusObj,
 	}
 }
 
+// Prints a one-line health summary from the \xff\xff/metrics/health/aggregate special key. The
+// underlying metrics are the ratekeeper-derived aggregates the GRV proxies already cache and
+// refresh continuously, so reading them costs one point read and no status generation; this is
+// what makes the summary cheap enough for once-a-second polling. With 'watch' the line is
+// reprinted every second until interrupted.
+ACTOR Future<bool> healthSummary(Reference<IDatabase> db, bool watch) {
+	loop {
+		state Reference<ITransaction> tr = db->createTransaction();
+		try {
+			state ThreadFuture<Optional<Value>> aggregateF = tr->get("\xff\xff/metrics/health/aggregate"_sr);
+			Optional<Value> aggregate = wait(safeThreadFutureToFuture(aggregateF));
+			if (!aggregate.present()) {
+				// Served only once ratekeeper metrics have flowed to the proxies
+				printf("Health metrics are not yet available\n");
+			} else {
+				json_spirit::mValue mv;
+				json_spirit::read_string(aggregate.get().toString(), mv);
+				StatusObjectReader health(mv.get_obj());
+				bool batchLimited = false;
+				double tpsLimit = 0;
+				int64_t worstStorageQueue = 0, limitingStorageQueue = 0, worstLogQueue = 0;
+				int64_t worstStorageLag = 0, limitingStorageLag = 0;
+				health.get("batch_limited", batchLimited);
+				health.get("tps_limit", tpsLimit);
+				health.get("worst_storage_queue", worstStorageQueue);
+				health.get("limiting_storage_queue", limitingStorageQueue);
+				health.get("worst_log_queue", worstLogQueue);
+				health.get("worst_storage_durability_lag", worstStorageLag);
+				health.get("limiting_storage_durability_lag", limitingStorageLag);
+				printf("tps_limit=%.0f batch_limited=%s worst_storage_queue=%lld limiting_storage_queue=%lld "
+				       "worst_log_queue=%lld worst_storage_durability_lag=%lld limiting_storage_durability_lag=%lld\n",
+				       tpsLimit,
+				       batchLimited ? "true" : "false",
+				       (long long)worstStorageQueue,
+				       (long long)limitingStorageQueue,
+				       (long long)worstLogQueue,
+				       (long long)worstStorageLag,
+				       (long long)limitingStorageLag);
+			}
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			fprintf(stderr, "Unable to fetch health metrics: %s\n", e.what());
+			if (!watch) {
+				return false;
+			}
+		}
+		if (!watch) {
+			return true;
+		}
+		wait(delay(1.0));
+	}
+}
+
 // "db" is the handler to the multiversion database
 // localDb is the native Database object
 // localDb is rarely needed except the "db" has not established a connection to the cluster where the operation will
@@ -1298,6 +1353,19 @@ ACTOR Future<bool> statusCommandActor(Reference<IDatabase> db,
                                       std::vector<StringRef> tokens,
                                       bool isExecMode) {
 
+	if (tokens.size() >= 2 && tokencmp(tokens[1], "summary")) {
+		if (tokens.size() == 2) {
+			bool result = wait(healthSummary(db, false));
+			return result;
+		} else if (tokens.size() == 3 && tokens[2] == "--watch"_sr) {
+			bool result = wait(healthSummary(db, true));
+			return result;
+		} else {
+			printUsage(tokens[0]);
+			return false;
+		}
+	}
+
 	state StatusClient::StatusLevel level;
 	if (tokens.size() == 1)
 		level = StatusClient::NORMAL;
@@ -1341,19 +1409,23 @@ void statusGenerator(const char* text,
                      std::vector<std::string>& lc,
                      std::vector<StringRef> const& tokens) {
 	if (tokens.size() == 1) {
-		const char* opts[] = { "minimal", "details", "json", nullptr };
+		const char* opts[] = { "minimal", "details", "json", "summary", nullptr };
 		arrayGenerator(text, line, opts, lc);
 	}
 }
 
 CommandFactory statusFactory(
     "status",
-    CommandHelp("status [minimal|details|json]",
+    CommandHelp("status [minimal|details|json|summary [--watch]]",
                 "get the status of a FoundationDB cluster",
                 "If the cluster is down, this command will print a diagnostic which may be useful in figuring out "
                 "what is wrong. If the cluster is running, this command will print cluster "
                 "statistics.\n\nSpecifying `minimal' will provide a minimal description of the status of your "
                 "database.\n\nSpecifying `details' will provide load information for individual "
-                "workers.\n\nSpecifying `json' will provide status information in a machine readable JSON format."),
+                "workers.\n\nSpecifying `json' will provide status information in a machine readable JSON format."
+                "\n\nSpecifying `summary' will print a one-line health summary (rate limits and worst queue depths) "
+                "from metrics the transaction system already maintains; it does not trigger full status generation "
+                "and is cheap enough for high-frequency polling. With `--watch', the summary is reprinted every "
+                "second until interrupted."),
     &statusGenerator);
 } // namespace fdb_cli
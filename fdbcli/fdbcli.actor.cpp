@@ -464,8 +464,8 @@ static void printProgramUsage(const char* name) {
 	       "                 Sets the LogGroup field with the specified value for all\n"
 	       "                 events in the trace output (defaults to `default').\n"
 	       "  --trace-format FORMAT\n"
-	       "                 Select the format of the log files. xml (the default) and json\n"
-	       "                 are supported. Has no effect unless --log is specified.\n"
+	       "                 Select the format of the log files. xml (the default), json and\n"
+	       "                 binary are supported. Has no effect unless --log is specified.\n"
 	       "  --exec CMDS    Immediately executes the semicolon separated CLI commands\n"
 	       "                 and then exits.\n"
 	       "  --no-status    Disables the initial status check done when starting\n"
@@ -531,12 +531,15 @@ void initHelp() {
 	                "fetch key/value pairs in a range of keys",
 	                "Displays up to LIMIT keys and values for keys between BEGINKEY (inclusive) and ENDKEY "
 	                "(exclusive). If ENDKEY is omitted, then the range will include all keys starting with BEGINKEY. "
-	                "LIMIT defaults to 25 if omitted." ESCAPINGK);
+	                "LIMIT defaults to 25 if omitted. If LIMIT is `all', the whole range is streamed page by page "
+	                "with progress reported on stderr; outside of a transaction each page reads at a fresh version, "
+	                "so the scan is not limited to five seconds." ESCAPINGK);
 	helpMap["getrangekeys"] = CommandHelp(
 	    "getrangekeys <BEGINKEY> [ENDKEY] [LIMIT]",
 	    "fetch keys in a range of keys",
 	    "Displays up to LIMIT keys for keys between BEGINKEY (inclusive) and ENDKEY (exclusive). If ENDKEY is omitted, "
-	    "then the range will include all keys starting with BEGINKEY. LIMIT defaults to 25 if omitted." ESCAPINGK);
+	    "then the range will include all keys starting with BEGINKEY. LIMIT defaults to 25 if omitted. If LIMIT is "
+	    "`all', the whole range is streamed page by page as described for getrange." ESCAPINGK);
 	helpMap["getversion"] =
 	    CommandHelp("getversion",
 	                "Fetch the current read version",
@@ -752,6 +755,85 @@ Reference<ITransaction> getTransaction(Reference<IDatabase> db,
 	return tr;
 }
 
+// Streams a range to stdout page by page instead of buffering the whole result, so large
+// inspection scans don't accumulate in client memory. 'limit' < 0 means scan to the end of the
+// range. Outside of a user transaction ('intrans' false) each page runs in a fresh transaction and
+// retryable errors resume from the current cursor, so scans are not bound by the five second
+// transaction limit; pages then read at different versions. Progress and the continuation cursor
+// are reported on stderr so stdout stays machine-readable.
+ACTOR Future<Void> streamingGetRange(Reference<IDatabase> db,
+                                     Reference<ITenant> tenant,
+                                     Reference<ITransaction>* tr,
+                                     FdbOptions* options,
+                                     bool intrans,
+                                     Key beginKey,
+                                     Key endKey,
+                                     int limit,
+                                     bool keysOnly) {
+	state Key cursor = beginKey;
+	state int64_t totalRows = 0;
+	state int64_t totalBytes = 0;
+	state double startTime = now();
+	if (limit >= 0) {
+		printf("\nRange limited to %d keys\n", limit);
+	}
+	loop {
+		try {
+			int rowLimit = GetRangeLimits::ROW_LIMIT_UNLIMITED;
+			if (limit >= 0) {
+				if (limit - totalRows <= 0) {
+					break;
+				}
+				rowLimit = int(limit - totalRows);
+			}
+			getTransaction(db, tenant, *tr, options, intrans);
+			state ThreadFuture<RangeResult> kvsF =
+			    (*tr)->getRange(KeyRangeRef(cursor, endKey), GetRangeLimits(rowLimit, CLIENT_KNOBS->REPLY_BYTE_LIMIT));
+			RangeResult kvs = wait(makeInterruptable(safeThreadFutureToFuture(kvsF)));
+			for (auto const& kv : kvs) {
+				if (keysOnly) {
+					printf("`%s'\n", printable(kv.key).c_str());
+				} else {
+					printf("`%s' is `%s'\n", printable(kv.key).c_str(), printable(kv.value).c_str());
+				}
+				totalBytes += kv.expectedSize();
+			}
+			totalRows += kvs.size();
+			if (!kvs.more || kvs.empty()) {
+				break;
+			}
+			cursor = keyAfter(kvs.back().key);
+			if (limit < 0) {
+				double elapsed = std::max(now() - startTime, 1e-6);
+				fprintf(stderr,
+				        "-- %lld rows, %.2f MB, %.2f MB/s, continuing at `%s'\n",
+				        (long long)totalRows,
+				        totalBytes / 1e6,
+				        totalBytes / 1e6 / elapsed,
+				        printable(cursor).c_str());
+			}
+		} catch (Error& e) {
+			if (e.code() == error_code_operation_cancelled) {
+				// interrupted by the user; report where to pick the scan back up
+				fprintf(stderr,
+				        "\nScan interrupted after %lld rows. Resume with BEGINKEY `%s'\n",
+				        (long long)totalRows,
+				        printable(cursor).c_str());
+				throw;
+			}
+			if (intrans || e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			wait(makeInterruptable(safeThreadFutureToFuture((*tr)->onError(e))));
+		}
+	}
+	printf("\n");
+	if (limit < 0) {
+		fprintf(stderr, "-- scan complete: %lld rows, %.2f MB\n", (long long)totalRows, totalBytes / 1e6);
+	}
+	return Void();
+}
+
 std::string newCompletion(const char* base, const char* name) {
 	return format("%s%s ", base, name);
 }
@@ -1720,7 +1802,10 @@ ACTOR Future<int> cli(CLIOptions opt, LineNoise* plinenoise, Reference<ClusterCo
 								continue;
 							}
 						}
-						if (tokens.size() == 4) {
+						if (tokens.size() == 4 && tokens[3] == "all"_sr) {
+							// stream the whole range, page by page
+							limit = -1;
+						} else if (tokens.size() == 4) {
 							// INT_MAX is 10 digits; rather than
 							// worrying about overflow we'll just cap
 							// limit at the (already absurd)
@@ -1763,19 +1848,15 @@ ACTOR Future<int> cli(CLIOptions opt, LineNoise* plinenoise, Reference<ClusterCo
 							endKey = strinc(tokens[1]);
 						}
 
-						getTransaction(db, tenant, tr, options, intrans);
-						state ThreadFuture<RangeResult> kvsF = tr->getRange(KeyRangeRef(tokens[1], endKey), limit);
-						RangeResult kvs = wait(makeInterruptable(safeThreadFutureToFuture(kvsF)));
-
-						printf("\nRange limited to %d keys\n", limit);
-						for (auto iter = kvs.begin(); iter < kvs.end(); iter++) {
-							if (tokencmp(tokens[0], "getrangekeys"))
-								printf("`%s'\n", printable((*iter).key).c_str());
-							else
-								printf(
-								    "`%s' is `%s'\n", printable((*iter).key).c_str(), printable((*iter).value).c_str());
-						}
-						printf("\n");
+						wait(streamingGetRange(db,
+						                       tenant,
+						                       &tr,
+						                       options,
+						                       intrans,
+						                       Key(tokens[1]),
+						                       Key(endKey),
+						                       limit,
+						                       tokencmp(tokens[0], "getrangekeys")));
 					}
 					continue;
 				}
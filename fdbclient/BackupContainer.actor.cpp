@@ -72,6 +72,11 @@ std::string IBackupContainer::ExpireProgress::toString() const {
 	std::string s = step + "...";
 	if (total > 0) {
 		s += format("%d/%d (%.2f%%)", done, total, double(done) / total * 100);
+		// Once some progress has been made, estimate time remaining from the rate so far
+		double elapsed = now() - startTime;
+		if (startTime > 0 && done > 0 && done < total && elapsed > 1.0) {
+			s += format(" ETA %ds", (int)(elapsed / done * (total - done)));
+		}
 	}
 	return s;
 }
@@ -788,18 +788,26 @@ public:
 			progress->step = "Deleting files";
 			progress->total = toDelete.size();
 			progress->done = 0;
+			progress->startTime = now();
 		}
 
 		// Delete files, but limit parallelism because the file list could use a lot of memory and the corresponding
-		// delete actor states would use even more if they all existed at the same time.
-		state std::list<Future<Void>> deleteFutures;
+		// delete actor states would use even more if they all existed at the same time.  Files are submitted in
+		// batches so that backends with a bulk delete operation can remove each batch with a single request.
+		// Each delete future yields the number of files in its batch so progress can be tracked.
+		state std::list<Future<int>> deleteFutures;
 
 		while (!toDelete.empty() || !deleteFutures.empty()) {
 
-			// While there are files to delete and budget in the deleteFutures list, start a delete
+			// While there are files to delete and budget in the deleteFutures list, start a batched delete
 			while (!toDelete.empty() && deleteFutures.size() < CLIENT_KNOBS->BACKUP_CONCURRENT_DELETES) {
-				deleteFutures.push_back(bc->deleteFile(toDelete.back()));
-				toDelete.pop_back();
+				std::vector<std::string> batch;
+				while (!toDelete.empty() && (int)batch.size() < CLIENT_KNOBS->BACKUP_DELETE_BATCH_SIZE) {
+					batch.push_back(std::move(toDelete.back()));
+					toDelete.pop_back();
+				}
+				int batchSize = batch.size();
+				deleteFutures.push_back(map(bc->deleteFiles(batch), [batchSize](Void) { return batchSize; }));
 			}
 
 			// Wait for deletes to finish until there are only targetDeletesInFlight remaining.
@@ -808,9 +816,9 @@ public:
 			state int targetFuturesSize = toDelete.empty() ? 0 : (CLIENT_KNOBS->BACKUP_CONCURRENT_DELETES - 1);
 
 			while (deleteFutures.size() > targetFuturesSize) {
-				wait(deleteFutures.front());
+				int deleted = wait(deleteFutures.front());
 				if (progress != nullptr) {
-					++progress->done;
+					progress->done += deleted;
 				}
 				deleteFutures.pop_front();
 			}
@@ -1343,6 +1351,15 @@ Future<BackupDescription> BackupContainerFileSystem::describeBackup(bool deepSca
 	    Reference<BackupContainerFileSystem>::addRef(this), deepScan, logStartVersionOverride);
 }
 
+Future<Void> BackupContainerFileSystem::deleteFiles(const std::vector<std::string>& fileNames) {
+	std::vector<Future<Void>> deletes;
+	deletes.reserve(fileNames.size());
+	for (auto& f : fileNames) {
+		deletes.push_back(deleteFile(f));
+	}
+	return waitForAll(deletes);
+}
+
 Future<Void> BackupContainerFileSystem::expireData(Version expireEndVersion,
                                                    bool force,
                                                    ExpireProgress* progress,
@@ -1361,12 +1378,24 @@ ACTOR static Future<KeyRange> getSnapshotFileKeyRange_impl(Reference<BackupConta
 	loop {
 		try {
 			state Reference<IAsyncFile> inFile = wait(bc->readFile(file.fileName));
+
+			// If the file has a trailing key-range index then its begin and end keys can be read
+			// directly from the index boundaries without scanning the data blocks.
+			Optional<fileBackup::RangeFileIndex> index = wait(fileBackup::readRangeFileIndex(inFile, file.fileSize));
+			if (index.present()) {
+				CODE_PROBE(true, "Snapshot file key range read from trailing index");
+				return KeyRange(KeyRangeRef(index.get().boundaries.front().second, index.get().boundaries.back().second));
+			}
+
 			beginKeySet = false;
 			state int64_t j = 0;
 			for (; j < file.fileSize; j += file.blockSize) {
 				int64_t len = std::min<int64_t>(file.blockSize, file.fileSize - j);
 				Standalone<VectorRef<KeyValueRef>> blockData =
 				    wait(fileBackup::decodeRangeFileBlock(inFile, j, len, cx));
+				if (blockData.empty()) {
+					continue;
+				}
 				if (!beginKeySet) {
 					beginKey = blockData.front().key;
 					beginKeySet = true;
@@ -206,6 +206,15 @@ Future<Void> BackupContainerS3BlobStore::deleteFile(const std::string& path) {
 	return m_bstore->deleteObject(m_bucket, dataPath(path));
 }
 
+Future<Void> BackupContainerS3BlobStore::deleteFiles(const std::vector<std::string>& paths) {
+	std::vector<std::string> objects;
+	objects.reserve(paths.size());
+	for (auto& path : paths) {
+		objects.push_back(dataPath(path));
+	}
+	return m_bstore->deleteObjects(m_bucket, objects);
+}
+
 Future<BackupContainerFileSystem::FilesAndSizesT> BackupContainerS3BlobStore::listFiles(
     const std::string& path,
     std::function<bool(std::string const&)> pathFilter) {
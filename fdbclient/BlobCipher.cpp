@@ -50,6 +50,7 @@
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #ifndef _WIN32
 #include <unistd.h>
@@ -61,6 +62,31 @@
 #define BLOB_CIPHER_SERIALIZATION_CHECKS false
 
 namespace {
+// Pool of idle EVP cipher contexts, one pool per thread. Every encrypted page/blob operation
+// constructs an En/DecryptBlobCipherAes256Ctr, and EVP_CIPHER_CTX_new() malloc's and zeroes a
+// fresh context each time; recycling contexts removes that allocation from the per-op path.
+// EVP_EncryptInit_ex/EVP_DecryptInit_ex rekey a recycled context in place, so reuse is safe
+// across cipher keys. Contexts are reset before pooling so key material doesn't linger.
+constexpr int MAX_POOLED_CIPHER_CTXS = 8;
+thread_local std::vector<EVP_CIPHER_CTX*> cipherCtxPool;
+
+EVP_CIPHER_CTX* acquireEvpCipherCtx() {
+	if (!cipherCtxPool.empty()) {
+		EVP_CIPHER_CTX* ctx = cipherCtxPool.back();
+		cipherCtxPool.pop_back();
+		return ctx;
+	}
+	return EVP_CIPHER_CTX_new();
+}
+
+void releaseEvpCipherCtx(EVP_CIPHER_CTX* ctx) {
+	if (cipherCtxPool.size() < MAX_POOLED_CIPHER_CTXS && EVP_CIPHER_CTX_reset(ctx) == 1) {
+		cipherCtxPool.push_back(ctx);
+	} else {
+		EVP_CIPHER_CTX_free(ctx);
+	}
+}
+
 void validateEncryptHeaderFlagVersion(const int flagsVersion) {
 	ASSERT(CLIENT_KNOBS->ENABLE_CONFIGURABLE_ENCRYPTION);
 
@@ -793,7 +819,7 @@ EncryptBlobCipherAes265Ctr::EncryptBlobCipherAes265Ctr(Reference<BlobCipherKey>
                                                        const int ivLen,
                                                        const EncryptAuthTokenMode mode,
                                                        BlobCipherMetrics::UsageType usageType)
-  : ctx(EVP_CIPHER_CTX_new()), textCipherKey(tCipherKey), headerCipherKeyOpt(hCipherKeyOpt), authTokenMode(mode),
+  : ctx(acquireEvpCipherCtx()), textCipherKey(tCipherKey), headerCipherKeyOpt(hCipherKeyOpt), authTokenMode(mode),
     usageType(usageType) {
 	ASSERT_EQ(ivLen, AES_256_IV_LENGTH);
 	authTokenAlgo = getAuthTokenAlgoFromMode(authTokenMode);
@@ -808,7 +834,7 @@ EncryptBlobCipherAes265Ctr::EncryptBlobCipherAes265Ctr(Reference<BlobCipherKey>
                                                        const EncryptAuthTokenMode mode,
                                                        const EncryptAuthTokenAlgo algo,
                                                        BlobCipherMetrics::UsageType usageType)
-  : ctx(EVP_CIPHER_CTX_new()), textCipherKey(tCipherKey), headerCipherKeyOpt(hCipherKeyOpt), authTokenMode(mode),
+  : ctx(acquireEvpCipherCtx()), textCipherKey(tCipherKey), headerCipherKeyOpt(hCipherKeyOpt), authTokenMode(mode),
     authTokenAlgo(algo), usageType(usageType) {
 	ASSERT_EQ(ivLen, AES_256_IV_LENGTH);
 	memcpy(&iv[0], cipherIV, ivLen);
@@ -819,7 +845,7 @@ EncryptBlobCipherAes265Ctr::EncryptBlobCipherAes265Ctr(Reference<BlobCipherKey>
                                                        Optional<Reference<BlobCipherKey>> hCipherKeyOpt,
                                                        const EncryptAuthTokenMode mode,
                                                        BlobCipherMetrics::UsageType usageType)
-  : ctx(EVP_CIPHER_CTX_new()), textCipherKey(tCipherKey), headerCipherKeyOpt(hCipherKeyOpt), authTokenMode(mode),
+  : ctx(acquireEvpCipherCtx()), textCipherKey(tCipherKey), headerCipherKeyOpt(hCipherKeyOpt), authTokenMode(mode),
     usageType(usageType) {
 	authTokenAlgo = getAuthTokenAlgoFromMode(authTokenMode);
 	deterministicRandom()->randomBytes(iv, AES_256_IV_LENGTH);
@@ -831,7 +857,7 @@ EncryptBlobCipherAes265Ctr::EncryptBlobCipherAes265Ctr(Reference<BlobCipherKey>
                                                        const EncryptAuthTokenMode mode,
                                                        const EncryptAuthTokenAlgo algo,
                                                        BlobCipherMetrics::UsageType usageType)
-  : ctx(EVP_CIPHER_CTX_new()), textCipherKey(tCipherKey), headerCipherKeyOpt(hCipherKeyOpt), authTokenMode(mode),
+  : ctx(acquireEvpCipherCtx()), textCipherKey(tCipherKey), headerCipherKeyOpt(hCipherKeyOpt), authTokenMode(mode),
     authTokenAlgo(algo), usageType(usageType) {
 	deterministicRandom()->randomBytes(iv, AES_256_IV_LENGTH);
 	init();
@@ -1003,6 +1029,50 @@ StringRef EncryptBlobCipherAes265Ctr::encrypt(const uint8_t* plaintext,
 	return encryptBuf.substr(0, plaintextLen);
 }
 
+void EncryptBlobCipherAes265Ctr::encryptInPlace(uint8_t* data,
+                                                const int dataLen,
+                                                BlobCipherEncryptHeaderRef* headerRef) {
+	double startTime = 0.0;
+	if (CLIENT_KNOBS->ENABLE_ENCRYPTION_CPU_TIME_LOGGING) {
+		startTime = timer_monotonic();
+	}
+
+	// AES-256-CTR is a stream cipher: EVP_EncryptUpdate supports exactly overlapping input/output
+	// buffers and produces exactly 'dataLen' ciphertext bytes, so no scratch buffer is needed.
+	int bytes{ 0 };
+	if (EVP_EncryptUpdate(ctx, data, &bytes, data, dataLen) != 1) {
+		TraceEvent(SevWarn, "BlobCipherInplaceEncryptUpdateFailed")
+		    .detail("BaseCipherId", textCipherKey->getBaseCipherId())
+		    .detail("EncryptDomainId", textCipherKey->getDomainId());
+		throw encrypt_ops_error();
+	}
+
+	uint8_t finalBuf[AES_BLOCK_SIZE];
+	int finalBytes{ 0 };
+	if (EVP_EncryptFinal_ex(ctx, finalBuf, &finalBytes) != 1) {
+		TraceEvent(SevWarn, "BlobCipherInplaceEncryptFinalFailed")
+		    .detail("BaseCipherId", textCipherKey->getBaseCipherId())
+		    .detail("EncryptDomainId", textCipherKey->getDomainId());
+		throw encrypt_ops_error();
+	}
+	if (bytes != dataLen || finalBytes != 0) {
+		TraceEvent(SevWarn, "BlobCipherInplaceEncryptUnexpectedCipherLen")
+		    .detail("PlaintextLen", dataLen)
+		    .detail("EncryptedBufLen", bytes + finalBytes);
+		throw encrypt_ops_error();
+	}
+
+	// Ensure encryption header authToken details sanity
+	ASSERT(isEncryptHeaderAuthTokenDetailsValid(authTokenMode, authTokenAlgo));
+	updateEncryptHeader(data, dataLen, headerRef);
+
+	if (CLIENT_KNOBS->ENABLE_ENCRYPTION_CPU_TIME_LOGGING) {
+		BlobCipherMetrics::counters(usageType).encryptCPUTimeNS += int64_t((timer_monotonic() - startTime) * 1e9);
+	}
+
+	CODE_PROBE(true, "ConfigurableEncryption: in-place data encryption");
+}
+
 Reference<EncryptBuf> EncryptBlobCipherAes265Ctr::encrypt(const uint8_t* plaintext,
                                                           const int plaintextLen,
                                                           BlobCipherEncryptHeader* header,
@@ -1103,9 +1173,81 @@ Reference<EncryptBuf> EncryptBlobCipherAes265Ctr::encrypt(const uint8_t* plainte
 	return encryptBuf;
 }
 
+void EncryptBlobCipherAes265Ctr::encryptInPlace(uint8_t* data, const int dataLen, BlobCipherEncryptHeader* header) {
+	double startTime = 0.0;
+	if (CLIENT_KNOBS->ENABLE_ENCRYPTION_CPU_TIME_LOGGING) {
+		startTime = timer_monotonic();
+	}
+
+	memset(reinterpret_cast<uint8_t*>(header), 0, sizeof(BlobCipherEncryptHeader));
+
+	int bytes{ 0 };
+	if (EVP_EncryptUpdate(ctx, data, &bytes, data, dataLen) != 1) {
+		TraceEvent(SevWarn, "BlobCipherInplaceEncryptUpdateFailed")
+		    .detail("BaseCipherId", textCipherKey->getBaseCipherId())
+		    .detail("EncryptDomainId", textCipherKey->getDomainId());
+		throw encrypt_ops_error();
+	}
+
+	uint8_t finalBuf[AES_BLOCK_SIZE];
+	int finalBytes{ 0 };
+	if (EVP_EncryptFinal_ex(ctx, finalBuf, &finalBytes) != 1) {
+		TraceEvent(SevWarn, "BlobCipherInplaceEncryptFinalFailed")
+		    .detail("BaseCipherId", textCipherKey->getBaseCipherId())
+		    .detail("EncryptDomainId", textCipherKey->getDomainId());
+		throw encrypt_ops_error();
+	}
+	if (bytes != dataLen || finalBytes != 0) {
+		TraceEvent(SevWarn, "BlobCipherInplaceEncryptUnexpectedCipherLen")
+		    .detail("PlaintextLen", dataLen)
+		    .detail("EncryptedBufLen", bytes + finalBytes);
+		throw encrypt_ops_error();
+	}
+
+	// Populate encryption header flags details
+	header->flags.size = sizeof(BlobCipherEncryptHeader);
+	header->flags.headerVersion = EncryptBlobCipherAes265Ctr::ENCRYPT_HEADER_VERSION;
+	header->flags.encryptMode = ENCRYPT_CIPHER_MODE_AES_256_CTR;
+	header->flags.authTokenMode = authTokenMode;
+	header->flags.authTokenAlgo = authTokenAlgo;
+
+	// Ensure encryption header authToken details sanity
+	ASSERT(isEncryptHeaderAuthTokenDetailsValid(authTokenMode, authTokenAlgo));
+
+	// Populate cipherText encryption-key details
+	header->cipherTextDetails = textCipherKey->details();
+	// Populate header encryption-key details
+	if (authTokenMode != ENCRYPT_HEADER_AUTH_TOKEN_MODE_NONE) {
+		header->cipherHeaderDetails = headerCipherKeyOpt.get()->details();
+	} else {
+		header->cipherHeaderDetails = BlobCipherDetails();
+	}
+
+	memcpy(&header->iv[0], &iv[0], AES_256_IV_LENGTH);
+
+	if (authTokenMode != EncryptAuthTokenMode::ENCRYPT_HEADER_AUTH_TOKEN_MODE_NONE) {
+		// Populate header authToken details; the ciphertext now occupies 'data'
+		ASSERT_EQ(header->flags.authTokenMode, EncryptAuthTokenMode::ENCRYPT_HEADER_AUTH_TOKEN_MODE_SINGLE);
+
+		computeAuthToken({ { data, dataLen },
+		                   { reinterpret_cast<const uint8_t*>(header), sizeof(BlobCipherEncryptHeader) } },
+		                 headerCipherKeyOpt.get()->rawCipher(),
+		                 AES_256_KEY_LENGTH,
+		                 &header->singleAuthToken.authToken[0],
+		                 (EncryptAuthTokenAlgo)header->flags.authTokenAlgo,
+		                 AUTH_TOKEN_MAX_SIZE);
+	}
+
+	if (CLIENT_KNOBS->ENABLE_ENCRYPTION_CPU_TIME_LOGGING) {
+		BlobCipherMetrics::counters(usageType).encryptCPUTimeNS += int64_t((timer_monotonic() - startTime) * 1e9);
+	}
+
+	CODE_PROBE(true, "BlobCipher in-place data encryption");
+}
+
 EncryptBlobCipherAes265Ctr::~EncryptBlobCipherAes265Ctr() {
 	if (ctx != nullptr) {
-		EVP_CIPHER_CTX_free(ctx);
+		releaseEvpCipherCtx(ctx);
 	}
 }
 
@@ -1115,7 +1257,7 @@ DecryptBlobCipherAes256Ctr::DecryptBlobCipherAes256Ctr(Reference<BlobCipherKey>
                                                        Optional<Reference<BlobCipherKey>> hCipherKeyOpt,
                                                        const uint8_t* iv,
                                                        BlobCipherMetrics::UsageType usageType)
-  : ctx(EVP_CIPHER_CTX_new()), usageType(usageType), textCipherKey(tCipherKey), headerCipherKeyOpt(hCipherKeyOpt),
+  : ctx(acquireEvpCipherCtx()), usageType(usageType), textCipherKey(tCipherKey), headerCipherKeyOpt(hCipherKeyOpt),
     authTokensValidationDone(false) {
 	if (ctx == nullptr) {
 		throw encrypt_ops_error();
@@ -1306,6 +1448,50 @@ StringRef DecryptBlobCipherAes256Ctr::decrypt(const uint8_t* ciphertext,
 	return decrypted.substr(0, ciphertextLen);
 }
 
+void DecryptBlobCipherAes256Ctr::decryptInPlace(uint8_t* data,
+                                                const int dataLen,
+                                                const BlobCipherEncryptHeaderRef& headerRef) {
+	double startTime = 0.0;
+	if (CLIENT_KNOBS->ENABLE_ENCRYPTION_CPU_TIME_LOGGING) {
+		startTime = timer_monotonic();
+	}
+
+	// Auth tokens (if any) are computed over the ciphertext, so validation must fully complete
+	// before the buffer is overwritten with the plaintext.
+	EncryptAuthTokenMode authTokenMode;
+	EncryptAuthTokenAlgo authTokenAlgo;
+	validateEncryptHeader(data, dataLen, headerRef, &authTokenMode, &authTokenAlgo);
+
+	int bytesDecrypted{ 0 };
+	if (!EVP_DecryptUpdate(ctx, data, &bytesDecrypted, data, dataLen)) {
+		TraceEvent(SevWarn, "BlobCipherInplaceDecryptUpdateFailed")
+		    .detail("BaseCipherId", textCipherKey->getBaseCipherId())
+		    .detail("EncryptDomainId", textCipherKey->getDomainId());
+		throw encrypt_ops_error();
+	}
+
+	uint8_t finalBuf[AES_BLOCK_SIZE];
+	int finalBytes{ 0 };
+	if (EVP_DecryptFinal_ex(ctx, finalBuf, &finalBytes) <= 0) {
+		TraceEvent(SevWarn, "BlobCipherInplaceDecryptFinalFailed")
+		    .detail("BaseCipherId", textCipherKey->getBaseCipherId())
+		    .detail("EncryptDomainId", textCipherKey->getDomainId());
+		throw encrypt_ops_error();
+	}
+	if (bytesDecrypted != dataLen || finalBytes != 0) {
+		TraceEvent(SevWarn, "BlobCipherInplaceDecryptUnexpectedPlaintextLen")
+		    .detail("CiphertextLen", dataLen)
+		    .detail("DecryptedBufLen", bytesDecrypted + finalBytes);
+		throw encrypt_ops_error();
+	}
+
+	if (CLIENT_KNOBS->ENABLE_ENCRYPTION_CPU_TIME_LOGGING) {
+		BlobCipherMetrics::counters(usageType).decryptCPUTimeNS += int64_t((timer_monotonic() - startTime) * 1e9);
+	}
+
+	CODE_PROBE(true, "ConfigurableEncryption: in-place data decryption");
+}
+
 void DecryptBlobCipherAes256Ctr::verifyHeaderSingleAuthToken(const uint8_t* ciphertext,
                                                              const int ciphertextLen,
                                                              const BlobCipherEncryptHeader& header) {
@@ -1440,9 +1626,61 @@ Reference<EncryptBuf> DecryptBlobCipherAes256Ctr::decrypt(const uint8_t* ciphert
 	return decrypted;
 }
 
+void DecryptBlobCipherAes256Ctr::decryptInPlace(uint8_t* data, const int dataLen, const BlobCipherEncryptHeader& header) {
+	double startTime = 0.0;
+	if (CLIENT_KNOBS->ENABLE_ENCRYPTION_CPU_TIME_LOGGING) {
+		startTime = timer_monotonic();
+	}
+
+	verifyEncryptHeaderMetadata(header);
+
+	if (header.flags.authTokenMode != EncryptAuthTokenMode::ENCRYPT_HEADER_AUTH_TOKEN_MODE_NONE &&
+	    (!headerCipherKeyOpt.present() || !headerCipherKeyOpt.get().isValid())) {
+		TraceEvent(SevWarn, "BlobCipherDecryptInvalidHeaderCipherKey")
+		    .detail("AuthTokenMode", header.flags.authTokenMode);
+		throw encrypt_ops_error();
+	}
+
+	// Auth tokens are computed over the ciphertext, so validation must fully complete before the
+	// buffer is overwritten with the plaintext.
+	if (header.flags.authTokenMode != EncryptAuthTokenMode::ENCRYPT_HEADER_AUTH_TOKEN_MODE_NONE) {
+		verifyAuthTokens(data, dataLen, header);
+		ASSERT(authTokensValidationDone);
+	}
+
+	int bytesDecrypted{ 0 };
+	if (!EVP_DecryptUpdate(ctx, data, &bytesDecrypted, data, dataLen)) {
+		TraceEvent(SevWarn, "BlobCipherInplaceDecryptUpdateFailed")
+		    .detail("BaseCipherId", header.cipherTextDetails.baseCipherId)
+		    .detail("EncryptDomainId", header.cipherTextDetails.encryptDomainId);
+		throw encrypt_ops_error();
+	}
+
+	uint8_t finalBuf[AES_BLOCK_SIZE];
+	int finalBytes{ 0 };
+	if (EVP_DecryptFinal_ex(ctx, finalBuf, &finalBytes) <= 0) {
+		TraceEvent(SevWarn, "BlobCipherInplaceDecryptFinalFailed")
+		    .detail("BaseCipherId", header.cipherTextDetails.baseCipherId)
+		    .detail("EncryptDomainId", header.cipherTextDetails.encryptDomainId);
+		throw encrypt_ops_error();
+	}
+	if (bytesDecrypted != dataLen || finalBytes != 0) {
+		TraceEvent(SevWarn, "BlobCipherInplaceDecryptUnexpectedPlaintextLen")
+		    .detail("CiphertextLen", dataLen)
+		    .detail("DecryptedBufLen", bytesDecrypted + finalBytes);
+		throw encrypt_ops_error();
+	}
+
+	if (CLIENT_KNOBS->ENABLE_ENCRYPTION_CPU_TIME_LOGGING) {
+		BlobCipherMetrics::counters(usageType).decryptCPUTimeNS += int64_t((timer_monotonic() - startTime) * 1e9);
+	}
+
+	CODE_PROBE(true, "BlobCipher in-place data decryption");
+}
+
 DecryptBlobCipherAes256Ctr::~DecryptBlobCipherAes256Ctr() {
 	if (ctx != nullptr) {
-		EVP_CIPHER_CTX_free(ctx);
+		releaseEvpCipherCtx(ctx);
 	}
 }
 
@@ -2362,6 +2600,58 @@ void testConfigurableEncryptionSingleAuthMode(const int minDomainId) {
 	TraceEvent("TestSingleAuthTokenConfigurableEncryptionEnd").detail("Mode", authAlgoStr);
 }
 
+// validate in-place encrypt followed by in-place decrypt yields the original buffer, for both
+// no-auth and single-auth token modes
+void testEncryptDecryptInPlace(const int minDomainId, const EncryptAuthTokenMode authMode) {
+	TraceEvent("BlobCipherTestEncryptDecryptInPlaceStart").detail("AuthMode", authMode);
+
+	Reference<BlobCipherKeyCache> cipherKeyCache = BlobCipherKeyCache::getInstance();
+	Reference<BlobCipherKey> cipherKey = cipherKeyCache->getLatestCipherKey(minDomainId);
+	Reference<BlobCipherKey> headerCipherKey = cipherKeyCache->getLatestCipherKey(ENCRYPT_HEADER_DOMAIN_ID);
+	const int bufLen = deterministicRandom()->randomInt(786, 2127) + 512;
+	uint8_t orgData[bufLen];
+	deterministicRandom()->randomBytes(&orgData[0], bufLen);
+	uint8_t buf[bufLen];
+	memcpy(&buf[0], &orgData[0], bufLen);
+
+	uint8_t iv[AES_256_IV_LENGTH];
+	deterministicRandom()->randomBytes(&iv[0], AES_256_IV_LENGTH);
+
+	EncryptBlobCipherAes265Ctr encryptor(
+	    cipherKey, headerCipherKey, iv, AES_256_IV_LENGTH, authMode, BlobCipherMetrics::TEST);
+	BlobCipherEncryptHeaderRef headerRef;
+	encryptor.encryptInPlace(&buf[0], bufLen, &headerRef);
+	ASSERT_NE(memcmp(&buf[0], &orgData[0], bufLen), 0);
+
+	DecryptBlobCipherAes256Ctr decryptor(cipherKey,
+	                                     authMode == ENCRYPT_HEADER_AUTH_TOKEN_MODE_NONE
+	                                         ? Optional<Reference<BlobCipherKey>>()
+	                                         : headerCipherKey,
+	                                     headerRef.getIV(),
+	                                     BlobCipherMetrics::TEST);
+	decryptor.decryptInPlace(&buf[0], bufLen, headerRef);
+	ASSERT_EQ(memcmp(&buf[0], &orgData[0], bufLen), 0);
+
+	// single-auth mode: flipping a ciphertext bit must fail auth validation before any decryption
+	if (authMode == ENCRYPT_HEADER_AUTH_TOKEN_MODE_SINGLE) {
+		EncryptBlobCipherAes265Ctr encryptor2(
+		    cipherKey, headerCipherKey, iv, AES_256_IV_LENGTH, authMode, BlobCipherMetrics::TEST);
+		BlobCipherEncryptHeaderRef headerRef2;
+		encryptor2.encryptInPlace(&buf[0], bufLen, &headerRef2);
+		buf[deterministicRandom()->randomInt(0, bufLen)] += 1;
+		try {
+			DecryptBlobCipherAes256Ctr decryptor2(
+			    cipherKey, headerCipherKey, headerRef2.getIV(), BlobCipherMetrics::TEST);
+			decryptor2.decryptInPlace(&buf[0], bufLen, headerRef2);
+			ASSERT(false); // error expected
+		} catch (Error& e) {
+			ASSERT_EQ(e.code(), error_code_encrypt_header_authtoken_mismatch);
+		}
+	}
+
+	TraceEvent("BlobCipherTestEncryptDecryptInPlaceDone").detail("AuthMode", authMode);
+}
+
 void testKeyCacheCleanup(const int minDomainId, const int maxDomainId) {
 	TraceEvent("BlobCipherTestKeyCacheCleanupStart");
 
@@ -2420,6 +2710,10 @@ TEST_CASE("/blobCipher") {
 	testConfigurableEncryptionNoAuthMode(minDomainId);
 	testConfigurableEncryptionSingleAuthMode<AesCtrWithHmacParams>(minDomainId);
 	testConfigurableEncryptionSingleAuthMode<AesCtrWithCmacParams>(minDomainId);
+
+	testEncryptDecryptInPlace(minDomainId, ENCRYPT_HEADER_AUTH_TOKEN_MODE_NONE);
+	testEncryptDecryptInPlace(minDomainId, ENCRYPT_HEADER_AUTH_TOKEN_MODE_SINGLE);
+
 	testKeyCacheCleanup(minDomainId, maxDomainId);
 
 	return Void();
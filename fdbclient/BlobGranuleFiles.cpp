@@ -1482,6 +1482,48 @@ static RangeResult mergeDeltaStreams(const BlobGranuleChunkRef& chunk,
 			// TODO: implement skipping if large clear!!
 			// if (maxClearIdx > it.streamIdx) - skip
 			it.dataIdx++;
+		}
+
+		// Run detection: if only one stream contained this key, keep consuming that stream directly while its
+		// next key still sorts strictly before every other stream's next key, skipping the heap entirely. This
+		// turns long non-overlapping runs (and the tail once all other streams are exhausted, the common case
+		// of a large snapshot with sparse deltas) into a single tight loop with one key compare per row.
+		if (cur.size() == 1) {
+			MergeStreamNext& it = cur.front();
+			const auto& stream = streams[it.streamIdx];
+			bool includesSnapshot = it.streamIdx == 0 && chunk.snapshotFile.present();
+			while (it.dataIdx < stream.size() &&
+			       (next.empty() || stream[it.dataIdx].key.compareSuffix(next.top().key, prefixLen) < 0)) {
+				const auto& v = stream[it.dataIdx];
+				if (clearActive[it.streamIdx]) {
+					clearActive[it.streamIdx] = false;
+					activeClears.erase(it.streamIdx);
+					if (it.streamIdx == maxActiveClear) {
+						maxActiveClear = activeClears.empty() ? -1 : *activeClears.begin();
+					}
+				}
+				if (!v.isNoOp()) {
+					if (v.isSet() && maxActiveClear < it.streamIdx) {
+						KeyRef finalKey =
+						    chunk.tenantPrefix.present() ? v.key.removePrefix(chunk.tenantPrefix.get()) : v.key;
+						result.push_back(result.arena(), KeyValueRef(finalKey, v.value));
+						if (!includesSnapshot) {
+							stats.rowsInserted++;
+						}
+					} else if (includesSnapshot) {
+						stats.rowsCleared++;
+					}
+				}
+				if (v.clearAfter) {
+					clearActive[it.streamIdx] = true;
+					activeClears.insert(it.streamIdx);
+					maxActiveClear = std::max(maxActiveClear, it.streamIdx);
+				}
+				it.dataIdx++;
+			}
+		}
+
+		for (auto& it : cur) {
 			if (it.dataIdx < streams[it.streamIdx].size()) {
 				it.key = streams[it.streamIdx][it.dataIdx].key;
 				next.push(it);
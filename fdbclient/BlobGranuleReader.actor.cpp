@@ -18,6 +18,7 @@
  * limitations under the License.
  */
 
+#include <deque>
 #include <map>
 #include <vector>
 
@@ -28,13 +29,27 @@
 #include "fdbclient/BlobGranuleReader.actor.h"
 #include "fdbclient/BlobWorkerCommon.h"
 #include "fdbclient/BlobWorkerInterface.h"
+#include "fdbclient/ClientKnobs.h"
 #include "fdbclient/FDBTypes.h"
 #include "flow/actorcompiler.h" // This must be the last #include.
 
-ACTOR Future<Standalone<StringRef>> readFile(Reference<BlobConnectionProvider> bstoreProvider, BlobFilePointerRef f) {
+ACTOR Future<Standalone<StringRef>> readFile(Reference<BlobConnectionProvider> bstoreProvider,
+                                             BlobFilePointerRef f,
+                                             Reference<BlobGranuleFileCache> fileCache) {
 	try {
 		state Arena arena;
 		std::string fname = f.filename.toString();
+
+		// Granule files are immutable, so a cached copy of this offset+length is always current
+		state std::string cacheKey;
+		if (fileCache.isValid()) {
+			cacheKey = fmt::format("{0}:{1}:{2}", fname, f.offset, f.length);
+			Optional<Standalone<StringRef>> cached = fileCache->get(cacheKey);
+			if (cached.present()) {
+				return cached.get();
+			}
+		}
+
 		state Reference<BackupContainerFileSystem> bstore = bstoreProvider->getForRead(fname);
 		state Reference<IAsyncFile> reader = wait(bstore->readFile(fname));
 
@@ -44,7 +59,11 @@ ACTOR Future<Standalone<StringRef>> readFile(Reference<BlobConnectionProvider> b
 		ASSERT(f.length == readSize);
 
 		StringRef dataRef(data, f.length);
-		return Standalone<StringRef>(dataRef, arena);
+		Standalone<StringRef> result(dataRef, arena);
+		if (fileCache.isValid()) {
+			fileCache->insert(cacheKey, result);
+		}
+		return result;
 	} catch (Error& e) {
 		throw e;
 	}
@@ -60,7 +79,8 @@ ACTOR Future<RangeResult> readBlobGranule(BlobGranuleChunkRef chunk,
                                           Version beginVersion,
                                           Version readVersion,
                                           Reference<BlobConnectionProvider> bstore,
-                                          Optional<BlobWorkerStats*> stats) {
+                                          Optional<BlobWorkerStats*> stats,
+                                          Reference<BlobGranuleFileCache> fileCache) {
 
 	// TODO REMOVE with early replying
 	ASSERT(readVersion == chunk.includedVersion);
@@ -70,7 +90,7 @@ ACTOR Future<RangeResult> readBlobGranule(BlobGranuleChunkRef chunk,
 	try {
 		Future<Standalone<StringRef>> readSnapshotFuture;
 		if (chunk.snapshotFile.present()) {
-			readSnapshotFuture = readFile(bstore, chunk.snapshotFile.get());
+			readSnapshotFuture = readFile(bstore, chunk.snapshotFile.get(), fileCache);
 			if (stats.present()) {
 				++stats.get()->s3GetReqs;
 			}
@@ -79,7 +99,7 @@ ACTOR Future<RangeResult> readBlobGranule(BlobGranuleChunkRef chunk,
 
 		readDeltaFutures.reserve(chunk.deltaFiles.size());
 		for (BlobFilePointerRef deltaFile : chunk.deltaFiles) {
-			readDeltaFutures.push_back(readFile(bstore, deltaFile));
+			readDeltaFutures.push_back(readFile(bstore, deltaFile, fileCache));
 			if (stats.present()) {
 				++stats.get()->s3GetReqs;
 			}
@@ -116,14 +136,30 @@ ACTOR Future<RangeResult> readBlobGranule(BlobGranuleChunkRef chunk,
 ACTOR Future<Void> readBlobGranules(BlobGranuleFileRequest request,
                                     BlobGranuleFileReply reply,
                                     Reference<BlobConnectionProvider> bstore,
-                                    PromiseStream<RangeResult> results) {
+                                    PromiseStream<RangeResult> results,
+                                    Reference<BlobGranuleFileCache> fileCache) {
 	// TODO for large amount of chunks, this should probably have some sort of buffer limit like ReplyPromiseStream.
 	// Maybe just use ReplyPromiseStream instead of PromiseStream?
 	try {
-		state int i;
-		for (i = 0; i < reply.chunks.size(); i++) {
-			RangeResult chunkResult = wait(
-			    readBlobGranule(reply.chunks[i], request.keyRange, request.beginVersion, request.readVersion, bstore));
+		// Fetch and materialize several granules at once, bounded the same way as the C API path in
+		// loadAndMaterializeBlobGranules, so a multi-granule scan overlaps blob reads with decode and merge.
+		// Waiting on the oldest outstanding granule keeps the results streaming in key order.
+		state std::deque<Future<RangeResult>> chunkResults;
+		state int nextChunk = 0;
+		while (nextChunk < reply.chunks.size() || !chunkResults.empty()) {
+			while (nextChunk < reply.chunks.size() &&
+			       (int)chunkResults.size() < CLIENT_KNOBS->BG_MAX_GRANULE_PARALLELISM) {
+				chunkResults.push_back(readBlobGranule(reply.chunks[nextChunk],
+				                                       request.keyRange,
+				                                       request.beginVersion,
+				                                       request.readVersion,
+				                                       bstore,
+				                                       Optional<BlobWorkerStats*>(),
+				                                       fileCache));
+				nextChunk++;
+			}
+			RangeResult chunkResult = wait(chunkResults.front());
+			chunkResults.pop_front();
 			results.send(std::move(chunkResult));
 		}
 		results.sendError(end_of_stream());
@@ -26,5 +26,6 @@ FDB_DEFINE_BOOLEAN_PARAM(Reverse);
 FDB_DEFINE_BOOLEAN_PARAM(Snapshot);
 FDB_DEFINE_BOOLEAN_PARAM(IsInternal);
 FDB_DEFINE_BOOLEAN_PARAM(AddConflictRange);
+FDB_DEFINE_BOOLEAN_PARAM(UseReadCache);
 FDB_DEFINE_BOOLEAN_PARAM(UseMetrics);
 FDB_DEFINE_BOOLEAN_PARAM(IsSwitchable);
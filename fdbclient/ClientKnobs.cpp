@@ -78,6 +78,10 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( VALUE_SIZE_LIMIT,                        1e5 );
 	init( SPLIT_KEY_SIZE_LIMIT,                    KEY_SIZE_LIMIT/2 );  if( randomize && BUGGIFY ) SPLIT_KEY_SIZE_LIMIT = KEY_SIZE_LIMIT - 31;//serverKeysPrefixFor(UID()).size() - 1;
 	init( METADATA_VERSION_CACHE_SIZE,            1000 );
+	init( READ_CACHE_STALENESS_BOUND,              5.0 ); if( randomize && BUGGIFY ) READ_CACHE_STALENESS_BOUND = 0.1;
+	init( READ_CACHE_MAX_BYTES,                   16e6 ); if( randomize && BUGGIFY ) READ_CACHE_MAX_BYTES = 1000;
+	init( WRITE_MAP_FLATTEN_THRESHOLD,            1000 ); if( randomize && BUGGIFY ) WRITE_MAP_FLATTEN_THRESHOLD = deterministicRandom()->coinflip() ? 1 : 16;
+	init( SPECIAL_KEY_SPACE_PARALLEL_MODULE_READS, true ); if( randomize && BUGGIFY ) SPECIAL_KEY_SPACE_PARALLEL_MODULE_READS = false;
 	init( CHANGE_FEED_LOCATION_LIMIT,            10000 );
 	init( CHANGE_FEED_CACHE_SIZE,               100000 ); if( randomize && BUGGIFY ) CHANGE_FEED_CACHE_SIZE = 1;
 	init( CHANGE_FEED_POP_TIMEOUT,                10.0 );
@@ -94,8 +98,11 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( LOCATION_CACHE_EVICTION_SIZE_SIM,         10 ); if( randomize && BUGGIFY ) LOCATION_CACHE_EVICTION_SIZE_SIM = 3;
 	init( LOCATION_CACHE_ENDPOINT_FAILURE_GRACE_PERIOD,     60 );
 	init( LOCATION_CACHE_FAILED_ENDPOINT_RETRY_INTERVAL,    60 );
+	init( LOCATION_CACHE_PERSIST_FILE,                      "" );
+	init( LOCATION_CACHE_PERSIST_INTERVAL,               300.0 );
 
 	init( GET_RANGE_SHARD_LIMIT,                     2 );
+	init( GET_RANGE_FANOUT,                          4 ); if( randomize && BUGGIFY ) GET_RANGE_FANOUT = deterministicRandom()->coinflip() ? 1 : 8;
 	init( WARM_RANGE_SHARD_LIMIT,                  100 );
 	init( STORAGE_METRICS_SHARD_LIMIT,             100 ); if( randomize && BUGGIFY ) STORAGE_METRICS_SHARD_LIMIT = 3;
 	init( SHARD_COUNT_LIMIT,                        80 ); if( randomize && BUGGIFY ) SHARD_COUNT_LIMIT = 3;
@@ -106,9 +113,13 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( MID_SHARD_SIZE_MAX_STALENESS,           10.0 );
 	init( TAG_ENCODE_KEY_SERVERS,                false ); if( randomize && BUGGIFY ) TAG_ENCODE_KEY_SERVERS = true;
 	init( RANGESTREAM_FRAGMENT_SIZE,               1e6 );
+	init( RANGESTREAM_FRAGMENT_SIZE_MIN,         125e3 ); if( randomize && BUGGIFY ) RANGESTREAM_FRAGMENT_SIZE_MIN = 1e4;
 	init( RANGESTREAM_BUFFERED_FRAGMENTS_LIMIT,     20 );
+	init( PARALLEL_STREAM_ADAPTIVE_CONCURRENCY,   true ); if( randomize && BUGGIFY ) PARALLEL_STREAM_ADAPTIVE_CONCURRENCY = false;
+	init( PARALLEL_STREAM_CONCURRENCY_ADJUST_INTERVAL, 0.5 ); if( randomize && BUGGIFY ) PARALLEL_STREAM_CONCURRENCY_ADJUST_INTERVAL = 0.01;
 	init( QUARANTINE_TSS_ON_MISMATCH,             true ); if( randomize && BUGGIFY ) QUARANTINE_TSS_ON_MISMATCH = false; // if true, a tss mismatch will put the offending tss in quarantine. If false, it will just be killed
 	init( CHANGE_FEED_EMPTY_BATCH_TIME,          0.005 );
+	init( CHANGE_FEED_EMPTY_BATCH_MAX_TIME,       0.25 ); if( randomize && BUGGIFY ) CHANGE_FEED_EMPTY_BATCH_MAX_TIME = 1.0;
 
 	//KeyRangeMap
 	init( KRM_GET_RANGE_LIMIT,                     1e5 ); if( randomize && BUGGIFY ) KRM_GET_RANGE_LIMIT = 10;
@@ -126,6 +137,7 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( LOG_RANGE_BLOCK_SIZE, CORE_VERSIONSPERSECOND );
 	init( MUTATION_BLOCK_SIZE,	            	  10000);
 	init( MAX_VERSION_CACHE_LAG,                    0.1 );
+	init( GRV_CACHE_MAX_STALENESS_LIMIT,            2.0 );
 	init( MAX_PROXY_CONTACT_LAG,                    0.2 );
 	init( DEBUG_USE_GRV_CACHE_CHANCE,              -1.0 ); // For 100% chance at 1.0, this means 0.0 is not 0%. We don't want the default to be 0. 
 	init( FORCE_GRV_CACHE_OFF,                    false );
@@ -142,10 +154,12 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( TASKBUCKET_CHECK_ACTIVE_AMOUNT,           10 );
 	init( TASKBUCKET_TIMEOUT_VERSIONS,     60*CORE_VERSIONSPERSECOND ); if( randomize && BUGGIFY ) TASKBUCKET_TIMEOUT_VERSIONS = 30*CORE_VERSIONSPERSECOND;
 	init( TASKBUCKET_MAX_TASK_KEYS,               1000 ); if( randomize && BUGGIFY ) TASKBUCKET_MAX_TASK_KEYS = 20;
+	init( TASKBUCKET_SHARD_COUNT,                    4 ); if( randomize && BUGGIFY ) TASKBUCKET_SHARD_COUNT = deterministicRandom()->randomInt(1, 9);
 
 	//Backup
 	init( BACKUP_LOCAL_FILE_WRITE_BLOCK,     1024*1024 );
 	init( BACKUP_CONCURRENT_DELETES,               100 );
+	init( BACKUP_DELETE_BATCH_SIZE,               1000 ); if( randomize && BUGGIFY ) BACKUP_DELETE_BATCH_SIZE = deterministicRandom()->randomInt(1, 5);
 	init( BACKUP_SIMULATED_LIMIT_BYTES,		       1e6 ); if( randomize && BUGGIFY ) BACKUP_SIMULATED_LIMIT_BYTES = 1000;
 	init( BACKUP_GET_RANGE_LIMIT_BYTES,		       1e6 );
 	init( BACKUP_LOCK_BYTES,                       1e8 );
@@ -170,11 +184,14 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( COPY_LOG_PREFETCH_BLOCKS,                  3 );
 	init( COPY_LOG_READ_AHEAD_BYTES,        BACKUP_LOCK_BYTES / COPY_LOG_PREFETCH_BLOCKS); // each task will use up to COPY_LOG_PREFETCH_BLOCKS * COPY_LOG_READ_AHEAD_BYTES memory
 	init( COPY_LOG_TASK_DURATION_NANOS,	      1e10 ); // 10 seconds
+	init( COPY_LOG_WRITE_PARALLELISM,                4 ); if( randomize && BUGGIFY ) COPY_LOG_WRITE_PARALLELISM = 1;
 	init( BACKUP_TASKS_PER_AGENT,                   10 );
 	init( BACKUP_POLL_PROGRESS_SECONDS,             10 );
 	init( VERSIONS_PER_SECOND,                     1e6 ); // Must be the same as SERVER_KNOBS->VERSIONS_PER_SECOND
 	init( SIM_BACKUP_TASKS_PER_AGENT,               10 );
 	init( BACKUP_RANGEFILE_BLOCK_SIZE,      1024 * 1024);
+	init( BACKUP_RANGEFILE_WRITE_INDEX,          false ); if( randomize && BUGGIFY ) BACKUP_RANGEFILE_WRITE_INDEX = true;
+	init( BACKUP_RANGE_RESPLIT_SECONDS,            300 ); if( randomize && BUGGIFY ) BACKUP_RANGE_RESPLIT_SECONDS = 2.0;
 	init( BACKUP_LOGFILE_BLOCK_SIZE,        1024 * 1024);
 	init( BACKUP_DISPATCH_ADDTASK_SIZE,             50 );
 	init( RESTORE_DISPATCH_ADDTASK_SIZE,           150 );
@@ -225,6 +242,7 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( BLOBSTORE_READ_CACHE_BLOCKS_PER_FILE,      2 );
 	init( BLOBSTORE_MULTIPART_MAX_PART_SIZE,  20000000 );
 	init( BLOBSTORE_MULTIPART_MIN_PART_SIZE,   5242880 );
+	init( BLOBSTORE_MULTIPART_PART_TARGET_SECONDS,   4 ); if( randomize && BUGGIFY ) BLOBSTORE_MULTIPART_PART_TARGET_SECONDS = deterministicRandom()->randomInt(0, 2);
 	init( BLOBSTORE_GLOBAL_CONNECTION_POOL,       true );
 	init( BLOBSTORE_ENABLE_LOGGING,               true );
 	init( BLOBSTORE_STATS_LOGGING_INTERVAL,       10.0 );
@@ -285,6 +303,7 @@ void ClientKnobs::initialize(Randomize randomize) {
 
 	// Blob granules
 	init( BG_MAX_GRANULE_PARALLELISM,                10 );
+	init( BG_FILE_CACHE_MAX_BYTES,                    0 ); if( randomize && BUGGIFY ) BG_FILE_CACHE_MAX_BYTES = deterministicRandom()->randomInt(1<<14, 1<<20);
 	init( BG_TOO_MANY_GRANULES,                   20000 );
 	init( BLOB_METADATA_REFRESH_INTERVAL,          3600 ); if ( randomize && BUGGIFY ) { BLOB_METADATA_REFRESH_INTERVAL = deterministicRandom()->randomInt(5, 120); }
 
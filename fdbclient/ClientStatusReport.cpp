@@ -18,6 +18,7 @@
  * limitations under the License.
  */
 
+#include "fdbclient/BlobGranuleCommon.h"
 #include "fdbclient/CommitProxyInterface.h"
 #include "fdbclient/CoordinationInterface.h"
 #include "fdbclient/DatabaseContext.h"
@@ -41,6 +42,7 @@ public:
 			reportClientInfo();
 			reportStorageServers();
 			reportConnections();
+			reportBlobGranuleFileCache();
 			statusObj["Healthy"] = healthy;
 		}
 		return StringRef(json_spirit::write_string(json_spirit::mValue(statusObj)));
@@ -120,6 +122,16 @@ private:
 		}
 	}
 
+	void reportBlobGranuleFileCache() {
+		if (cx.blobGranuleFileCache.isValid()) {
+			json_spirit::mObject cacheObj;
+			cacheObj["Hits"] = cx.blobGranuleFileCache->getHits();
+			cacheObj["Misses"] = cx.blobGranuleFileCache->getMisses();
+			cacheObj["CachedBytes"] = cx.blobGranuleFileCache->getCurrentBytes();
+			statusObj["BlobGranuleFileCache"] = cacheObj;
+		}
+	}
+
 	json_spirit::mObject connectionStatusReport(const NetworkAddress& address) {
 		json_spirit::mObject connStatus;
 		connStatus["Address"] = address.toString();
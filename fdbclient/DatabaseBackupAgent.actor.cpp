@@ -33,6 +33,7 @@
 #include "fdbclient/ManagementAPI.actor.h"
 #include "fdbclient/KeyBackedTypes.h"
 #include <inttypes.h>
+#include <deque>
 #include <map>
 
 #include "flow/actorcompiler.h" // has to be last include
@@ -724,8 +725,49 @@ struct CopyLogRangeTaskFunc : TaskFuncBase {
 		return _finish(tr, tb, fb, task);
 	};
 
-	// store mutation data from results until the end of stream or the timeout. If breaks on timeout returns the first
-	// uncopied version
+	// Commit one batch of mutations to the destination, retrying as needed.  Batches contain only whole
+	// versions and no version spans two batches, so concurrently committing batches write disjoint keys.
+	ACTOR static Future<Void> writeBatch(Database cx, Reference<Task> task, std::vector<RangeResult> mutations) {
+		state Transaction tr(cx);
+		loop {
+			try {
+				tr.setOption(FDBTransactionOptions::LOCK_AWARE);
+				tr.trState->options.sizeLimit = 2 * CLIENT_KNOBS->TRANSACTION_SIZE_LIMIT;
+				wait(checkDatabaseLock(
+				    &tr,
+				    BinaryReader::fromStringRef<UID>(task->params[BackupAgentBase::keyConfigLogUid], Unversioned())));
+				state int64_t bytesSet = 0;
+
+				bool first = true;
+				for (auto& m : mutations) {
+					for (auto kv : m) {
+						if (first) {
+							tr.addReadConflictRange(singleKeyRange(kv.key));
+							first = false;
+						}
+						tr.set(kv.key.removePrefix(backupLogKeys.begin)
+						           .removePrefix(task->params[BackupAgentBase::destUid])
+						           .withPrefix(task->params[BackupAgentBase::keyConfigLogUid])
+						           .withPrefix(applyLogKeys.begin),
+						       kv.value);
+						bytesSet +=
+						    kv.expectedSize() - backupLogKeys.begin.expectedSize() + applyLogKeys.begin.expectedSize();
+					}
+				}
+
+				wait(tr.commit());
+				Params.bytesWritten().set(task, Params.bytesWritten().getOrDefault(task) + bytesSet);
+				return Void();
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+	}
+
+	// Copy mutation data from results until the end of stream or the timeout.  If it breaks on timeout
+	// it returns the first uncopied version.  Batches are committed by a bounded window of concurrent
+	// writeBatch() transactions so the reader, which prefetches ranges ahead of this actor, is not
+	// stalled on individual commit latencies.
 	ACTOR static Future<Optional<Version>> dumpData(Database cx,
 	                                                Reference<Task> task,
 	                                                PromiseStream<RCGroup> results,
@@ -733,18 +775,15 @@ struct CopyLogRangeTaskFunc : TaskFuncBase {
 	                                                Reference<TaskBucket> tb,
 	                                                double breakTime) {
 		state bool endOfStream = false;
-		state Subspace conf = Subspace(databaseBackupPrefixRange.begin)
-		                          .get(BackupAgentBase::keyConfig)
-		                          .get(task->params[BackupAgentBase::keyConfigLogUid]);
 		state std::vector<RangeResult> nextMutations;
-		state bool isTimeoutOccured = false;
-		state Optional<KeyRef> lastKey;
-		state Version lastVersion;
 		state int64_t nextMutationSize = 0;
-		loop {
-			try {
-				if (endOfStream && !nextMutationSize) {
-					return Optional<Version>();
+		state Optional<Version> lastVersion;
+		state Optional<Version> nextVersionAfterBreak;
+		state std::deque<Future<Void>> commits;
+		try {
+			loop {
+				if ((endOfStream && !nextMutationSize) || nextVersionAfterBreak.present()) {
+					break;
 				}
 
 				state std::vector<RangeResult> mutations = std::move(nextMutations);
@@ -758,9 +797,17 @@ struct CopyLogRangeTaskFunc : TaskFuncBase {
 							RCGroup group = waitNext(results.getFuture());
 							lock->release(group.items.expectedSize());
 
+							// After the break time has passed, finish copying the version being read
+							// and stop at the first group of a later version, which the next run of
+							// this task will start from.
+							if (lastVersion.present() && (Version)group.groupKey > lastVersion.get()) {
+								nextVersionAfterBreak = (Version)group.groupKey;
+								break;
+							}
+							lastVersion = (Version)group.groupKey;
+
 							int vecSize = group.items.expectedSize();
 							if (mutationSize + vecSize >= CLIENT_KNOBS->BACKUP_LOG_WRITE_BATCH_MAX_SIZE) {
-
 								nextMutations.push_back(group.items);
 								nextMutationSize = vecSize;
 								break;
@@ -769,86 +816,50 @@ struct CopyLogRangeTaskFunc : TaskFuncBase {
 							mutations.push_back(group.items);
 							mutationSize += vecSize;
 						} catch (Error& e) {
-							state Error error = e;
 							if (e.code() == error_code_end_of_stream) {
 								endOfStream = true;
 								break;
 							}
-
-							throw error;
+							throw;
 						}
 					}
 				}
 
-				state Optional<Version> nextVersionAfterBreak;
-				state Transaction tr(cx);
-
-				loop {
-					try {
-						tr.setOption(FDBTransactionOptions::LOCK_AWARE);
-						tr.trState->options.sizeLimit = 2 * CLIENT_KNOBS->TRANSACTION_SIZE_LIMIT;
-						wait(checkDatabaseLock(&tr,
-						                       BinaryReader::fromStringRef<UID>(
-						                           task->params[BackupAgentBase::keyConfigLogUid], Unversioned())));
-						state int64_t bytesSet = 0;
-
-						bool first = true;
-						for (auto m : mutations) {
-							for (auto kv : m) {
-								if (isTimeoutOccured) {
-									Version newVersion = getLogKeyVersion(kv.key);
-
-									if (newVersion > lastVersion) {
-										nextVersionAfterBreak = newVersion;
-										break;
-									}
-								}
-								if (first) {
-									tr.addReadConflictRange(singleKeyRange(kv.key));
-									first = false;
-								}
-								tr.set(kv.key.removePrefix(backupLogKeys.begin)
-								           .removePrefix(task->params[BackupAgentBase::destUid])
-								           .withPrefix(task->params[BackupAgentBase::keyConfigLogUid])
-								           .withPrefix(applyLogKeys.begin),
-								       kv.value);
-								bytesSet += kv.expectedSize() - backupLogKeys.begin.expectedSize() +
-								            applyLogKeys.begin.expectedSize();
-								lastKey = kv.key;
-							}
-						}
-
-						wait(tr.commit());
-						Params.bytesWritten().set(task, Params.bytesWritten().getOrDefault(task) + bytesSet);
-						break;
-					} catch (Error& e) {
-						wait(tr.onError(e));
+				if (!mutations.empty()) {
+					commits.push_back(writeBatch(cx, task, std::move(mutations)));
+					while ((int)commits.size() >= CLIENT_KNOBS->COPY_LOG_WRITE_PARALLELISM) {
+						wait(commits.front());
+						commits.pop_front();
 					}
 				}
-				if (nextVersionAfterBreak.present()) {
-					return nextVersionAfterBreak;
-				}
-				if (!isTimeoutOccured && timer_monotonic() >= breakTime && lastKey.present()) {
-					// timeout occured
-					// continue to copy mutations with the
-					// same version before break because
-					// the next run should start from the beginning of a version > lastVersion.
-					lastVersion = getLogKeyVersion(lastKey.get());
-					isTimeoutOccured = true;
-				}
-			} catch (Error& e) {
-				if (e.code() == error_code_actor_cancelled || e.code() == error_code_backup_error)
-					throw e;
 
-				state Error err = e;
-				wait(logError(cx,
-				              Subspace(databaseBackupPrefixRange.begin)
-				                  .get(BackupAgentBase::keyErrors)
-				                  .pack(task->params[BackupAgentBase::keyConfigLogUid]),
-				              format("ERROR: Failed to dump mutations because of error %s", err.what())));
+				// Before the break time lastVersion only tracks the reader's position; afterwards it
+				// becomes the version to finish before breaking.  Batches already submitted keep
+				// draining while the remainder of the version is read.
+				if (timer_monotonic() < breakTime && !nextVersionAfterBreak.present()) {
+					lastVersion = Optional<Version>();
+				}
+			}
 
-				throw err;
+			// Wait for all outstanding commits; everything up to nextVersionAfterBreak (or the end of
+			// the stream) is then durable on the destination.
+			while (!commits.empty()) {
+				wait(commits.front());
+				commits.pop_front();
 			}
+			return nextVersionAfterBreak;
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled || e.code() == error_code_backup_error)
+				throw;
+
+			state Error err = e;
+			wait(logError(cx,
+			              Subspace(databaseBackupPrefixRange.begin)
+			                  .get(BackupAgentBase::keyErrors)
+			                  .pack(task->params[BackupAgentBase::keyConfigLogUid]),
+			              format("ERROR: Failed to dump mutations because of error %s", err.what())));
+
+			throw err;
 		}
 	}
 
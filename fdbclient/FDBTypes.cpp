@@ -226,7 +226,7 @@ std::string KeyValueStoreType::getStoreTypeStr(const StoreType& storeType) {
 	case MEMORY:
 		return "memory";
 	case MEMORY_RADIXTREE:
-		return "memory-radixtree-beta";
+		return "memory-radixtree";
 	default:
 		return "unknown";
 	}
@@ -242,6 +242,7 @@ KeyValueStoreType KeyValueStoreType::fromString(const std::string& str) {
 		                                              { "ssd-rocksdb-v1", SSD_ROCKSDB_V1 },
 		                                              { "ssd-sharded-rocksdb", SSD_SHARDED_ROCKSDB },
 		                                              { "memory", MEMORY },
+		                                              { "memory-radixtree", MEMORY_RADIXTREE },
 		                                              { "memory-radixtree-beta", MEMORY_RADIXTREE } };
 	auto it = names.find(str);
 	if (it == names.end()) {
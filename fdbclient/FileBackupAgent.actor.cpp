@@ -1006,6 +1006,9 @@ struct RangeFileWriter : public IRangeFileWriter {
 
 		// If this is NOT the first block then write duplicate stuff needed from last block
 		if (self->blockEnd > self->blockSize) {
+			if (CLIENT_KNOBS->BACKUP_RANGEFILE_WRITE_INDEX) {
+				self->indexBoundaries.emplace_back(self->blockEnd - self->blockSize, self->lastKey);
+			}
 			wait(self->file->appendStringRefWithLen(self->lastKey));
 			wait(self->file->appendStringRefWithLen(self->lastKey));
 			wait(self->file->appendStringRefWithLen(self->lastValue));
@@ -1051,13 +1054,78 @@ struct RangeFileWriter : public IRangeFileWriter {
 	ACTOR static Future<Void> writeKey_impl(RangeFileWriter* self, Key k) {
 		int toWrite = sizeof(uint32_t) + k.size();
 		wait(self->newBlockIfNeeded(toWrite));
+		if (CLIENT_KNOBS->BACKUP_RANGEFILE_WRITE_INDEX && self->indexBoundaries.empty()) {
+			self->indexBoundaries.emplace_back(0, k);
+		}
+		self->fileEndKey = k;
 		wait(self->file->appendStringRefWithLen(k));
 		return Void();
 	}
 
 	Future<Void> writeKey(Key k) { return writeKey_impl(this, k); }
 
-	Future<Void> finish() { return Void(); }
+	// Append the trailing key-range index and footer if index writing is enabled.  Index blocks begin
+	// on block size boundaries like data blocks, and space for the footer is reserved in every index
+	// block so the footer can never begin exactly on a block boundary and be mistaken for a block.
+	ACTOR static Future<Void> finish_impl(RangeFileWriter* self) {
+		if (!CLIENT_KNOBS->BACKUP_RANGEFILE_WRITE_INDEX || self->indexBoundaries.empty()) {
+			return Void();
+		}
+		CODE_PROBE(true, "Range file written with a trailing key-range index");
+
+		// Close the boundary list with a sentinel at the data end holding the file's end key, then pad
+		// the final data block so the index begins on a block boundary.
+		self->indexBoundaries.emplace_back(self->file->size(), self->fileEndKey);
+		int bytesLeft = self->blockEnd - self->file->size();
+		if (bytesLeft > 0) {
+			state Value paddingFFs = makePadding(bytesLeft);
+			wait(self->file->append(paddingFFs.begin(), bytesLeft));
+		}
+
+		state int64_t indexOffset = self->file->size();
+		state int capacity = self->blockSize - (int)(sizeof(int64_t) + sizeof(uint64_t));
+		state std::string block;
+		state int i = 0;
+		while (i < (int)self->indexBoundaries.size()) {
+			block.clear();
+			uint32_t version = BACKUP_AGENT_SNAPSHOT_FILE_INDEX_VERSION;
+			block.append((const char*)&version, sizeof(version));
+			int countPos = block.size();
+			uint32_t count = 0;
+			block.append((const char*)&count, sizeof(count));
+
+			while (i < (int)self->indexBoundaries.size()) {
+				auto& boundary = self->indexBoundaries[i];
+				int entrySize = sizeof(int64_t) + sizeof(uint32_t) + boundary.second.size();
+				ASSERT((int)(sizeof(uint32_t) * 2) + entrySize <= capacity);
+				if ((int)block.size() + entrySize > capacity)
+					break;
+				int64_t offset = (int64_t)bigEndian64(boundary.first);
+				block.append((const char*)&offset, sizeof(offset));
+				uint32_t kLen = bigEndian32((uint32_t)boundary.second.size());
+				block.append((const char*)&kLen, sizeof(kLen));
+				block.append((const char*)boundary.second.begin(), boundary.second.size());
+				++count;
+				++i;
+			}
+			count = bigEndian32(count);
+			memcpy(&block[countPos], &count, sizeof(count));
+
+			// Pad all but the final index block to the block size
+			if (i < (int)self->indexBoundaries.size()) {
+				block.resize(self->blockSize, '\xff');
+			}
+			wait(self->file->append(block.data(), block.size()));
+		}
+
+		// Footer
+		int64_t offset = (int64_t)bigEndian64(indexOffset);
+		wait(self->file->append(&offset, sizeof(offset)));
+		wait(self->file->append(&BACKUP_RANGEFILE_INDEX_FOOTER_MAGIC, sizeof(BACKUP_RANGEFILE_INDEX_FOOTER_MAGIC)));
+		return Void();
+	}
+
+	Future<Void> finish() { return finish_impl(this); }
 
 	Reference<IBackupFile> file;
 	int blockSize;
@@ -1067,6 +1135,8 @@ private:
 	uint32_t fileVersion;
 	Key lastKey;
 	Key lastValue;
+	Key fileEndKey;
+	std::vector<std::pair<int64_t, Key>> indexBoundaries;
 };
 
 ACTOR static Future<Void> decodeKVPairs(StringRefReader* reader,
@@ -1157,7 +1227,12 @@ Standalone<VectorRef<KeyValueRef>> decodeRangeFileBlock(const Standalone<StringR
 	StringRefReader reader(buf, restore_corrupted_data());
 
 	// Read header, currently only decoding BACKUP_AGENT_SNAPSHOT_FILE_VERSION
-	if (reader.consume<int32_t>() != BACKUP_AGENT_SNAPSHOT_FILE_VERSION)
+	int32_t file_version = reader.consume<int32_t>();
+	if (file_version == BACKUP_AGENT_SNAPSHOT_FILE_INDEX_VERSION) {
+		// Index blocks at the end of an indexed snapshot file contain no KV pairs
+		return results;
+	}
+	if (file_version != BACKUP_AGENT_SNAPSHOT_FILE_VERSION)
 		throw restore_unsupported_file_version();
 
 	// Read begin key, if this fails then block was invalid.
@@ -1256,6 +1331,9 @@ ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeRangeFileBlock(Reference<
 			    wait(EncryptedRangeFileWriter::decrypt(cx, encryptHeader, dataPayloadStart, dataLen, &results.arena()));
 			reader = StringRefReader(decryptedData, restore_corrupted_data());
 			wait(decodeKVPairs(&reader, &results, true, encryptMode, blockDomainId, tenantCache));
+		} else if (file_version == BACKUP_AGENT_SNAPSHOT_FILE_INDEX_VERSION) {
+			// Index blocks at the end of an indexed snapshot file contain no KV pairs
+			CODE_PROBE(true, "Restore decoded a snapshot file index block");
 		} else {
 			throw restore_unsupported_file_version();
 		}
@@ -1281,6 +1359,62 @@ ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeRangeFileBlock(Reference<
 	}
 }
 
+ACTOR Future<Optional<RangeFileIndex>> readRangeFileIndex(Reference<IAsyncFile> file, int64_t fileSize) {
+	state int footerSize = sizeof(int64_t) + sizeof(uint64_t);
+	if (fileSize < footerSize) {
+		return Optional<RangeFileIndex>();
+	}
+
+	// Read the footer and bail out if this is not an indexed file
+	state Standalone<StringRef> footer = makeString(footerSize);
+	int fLen = wait(uncancellable(holdWhile(footer, file->read(mutateString(footer), footerSize, fileSize - footerSize))));
+	if (fLen != footerSize)
+		throw restore_bad_read();
+	StringRefReader footerReader(footer, restore_corrupted_data());
+	state int64_t indexOffset = (int64_t)footerReader.consumeNetworkUInt64();
+	uint64_t magic = footerReader.consume<uint64_t>();
+	if (magic != BACKUP_RANGEFILE_INDEX_FOOTER_MAGIC || indexOffset <= 0 || indexOffset >= fileSize - footerSize) {
+		return Optional<RangeFileIndex>();
+	}
+
+	state int len = fileSize - footerSize - indexOffset;
+	state Standalone<StringRef> buf = makeString(len);
+	int rLen = wait(uncancellable(holdWhile(buf, file->read(mutateString(buf), len, indexOffset))));
+	if (rLen != len)
+		throw restore_bad_read();
+
+	// Treat an unparseable index as an absent one so callers fall back to scanning the data blocks
+	try {
+		RangeFileIndex index;
+		StringRefReader reader(buf, restore_corrupted_data());
+		while (!reader.eof()) {
+			if (reader.consume<int32_t>() != (int32_t)BACKUP_AGENT_SNAPSHOT_FILE_INDEX_VERSION)
+				throw restore_unsupported_file_version();
+			uint32_t count = reader.consumeNetworkUInt32();
+			while (count-- > 0) {
+				int64_t offset = (int64_t)reader.consumeNetworkUInt64();
+				uint32_t kLen = reader.consumeNetworkUInt32();
+				const uint8_t* k = reader.consume(kLen);
+				index.boundaries.emplace_back(offset, Key(KeyRef(k, kLen)));
+			}
+			// Skip padding to the next index block
+			while (!reader.eof() && *reader.rptr == 0xFF)
+				reader.consume(1);
+		}
+		// A valid index has at least the begin and end keys of the file
+		if (index.boundaries.size() < 2)
+			throw restore_corrupted_data();
+		return index;
+	} catch (Error& e) {
+		TraceEvent(SevWarnAlways, "FileRestoreUnparseableRangeFileIndex")
+		    .error(e)
+		    .detail("Filename", file->getFilename())
+		    .detail("IndexOffset", indexOffset)
+		    .detail("FileSize", fileSize);
+		return Optional<RangeFileIndex>();
+	}
+}
+
 // Very simple format compared to KeyRange files.
 // Header, [Key, Value]... Key len
 struct LogFileWriter {
@@ -1682,6 +1816,8 @@ struct BackupRangeTaskFunc : BackupTaskFuncBase {
 		static TaskParam<Key> beginKey() { return __FUNCTION__sr; }
 		static TaskParam<Key> endKey() { return __FUNCTION__sr; }
 		static TaskParam<bool> addBackupRangeTasks() { return __FUNCTION__sr; }
+		static TaskParam<bool> splitTailTasks() { return __FUNCTION__sr; }
+		static TaskParam<int64_t> splitTailTaskBytes() { return __FUNCTION__sr; }
 	} Params;
 
 	std::string toString(Reference<Task> task) const override {
@@ -1867,6 +2003,8 @@ struct BackupRangeTaskFunc : BackupTaskFuncBase {
 		state bool done = false;
 		state int64_t nrKeys = 0;
 		state Optional<bool> encryptionEnabled;
+		state double startTime = now();
+		state int64_t totalBytes = 0;
 
 		loop {
 			state RangeResultWithVersion values;
@@ -1907,8 +2045,24 @@ struct BackupRangeTaskFunc : BackupTaskFuncBase {
 					    .detail("EndKey", nextKey.printable())
 					    .detail("AddedFileToMap", usedFile);
 
+					totalBytes += outFile->size();
 					nrKeys = 0;
 					beginKey = nextKey;
+
+					// If this task has been writing long enough that it is likely a straggler holding
+					// up the snapshot, stop here and let _finish shed the unfinished tail as new tasks
+					// sized by the throughput observed so far, so idle task slots can share the work.
+					// Progress through beginKey is already durable.
+					double elapsed = now() - startTime;
+					if (!done && elapsed > CLIENT_KNOBS->BACKUP_RANGE_RESPLIT_SECONDS) {
+						CODE_PROBE(true, "Backup range task shedding its unfinished tail");
+						int64_t taskBytes =
+						    std::max<int64_t>(totalBytes * (CLIENT_KNOBS->BACKUP_RANGE_RESPLIT_SECONDS / elapsed),
+						                      CLIENT_KNOBS->BACKUP_RANGEFILE_BLOCK_SIZE);
+						Params.splitTailTasks().set(task, true);
+						Params.splitTailTaskBytes().set(task, taskBytes);
+						return Void();
+					}
 				}
 
 				if (done)
@@ -2024,6 +2178,63 @@ struct BackupRangeTaskFunc : BackupTaskFuncBase {
 		return Void();
 	}
 
+	// Shed the unfinished tail of a long-running range task as new tasks, each covering roughly
+	// taskBytes of data at storage byte boundaries, so the remainder is spread over idle task slots
+	// instead of finishing serially in this one.
+	ACTOR static Future<Void> splitTailRangeInternal(Reference<ReadYourWritesTransaction> tr,
+	                                                 Reference<TaskBucket> taskBucket,
+	                                                 Reference<FutureBucket> futureBucket,
+	                                                 Reference<Task> task,
+	                                                 Reference<TaskFuture> onDone) {
+		tr->setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+		tr->setOption(FDBTransactionOptions::LOCK_AWARE);
+		state Key beginKey = Params.beginKey().get(task);
+		state Key endKey = Params.endKey().get(task);
+		state int64_t taskBytes = Params.splitTailTaskBytes().get(task);
+
+		// Split point lookup is best effort; with no usable boundaries the whole tail becomes one task
+		state Standalone<VectorRef<KeyRef>> boundaries;
+		try {
+			Standalone<VectorRef<KeyRef>> b = wait(tr->getRangeSplitPoints(KeyRangeRef(beginKey, endKey), taskBytes));
+			boundaries = b;
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled)
+				throw;
+			boundaries = Standalone<VectorRef<KeyRef>>();
+		}
+
+		state std::vector<Future<Key>> addTaskVector;
+		state Key nextKey = beginKey;
+		for (int idx = 0; idx < boundaries.size(); ++idx) {
+			if (boundaries[idx] <= nextKey || boundaries[idx] >= endKey)
+				continue;
+			if ((int)addTaskVector.size() + 1 >= CLIENT_KNOBS->BACKUP_SHARD_TASK_LIMIT)
+				break;
+			addTaskVector.push_back(addTask(tr,
+			                                taskBucket,
+			                                task,
+			                                task->getPriority(),
+			                                nextKey,
+			                                Key(boundaries[idx]),
+			                                TaskCompletionKey::joinWith(onDone)));
+			TraceEvent("FileBackupRangeShedTail")
+			    .suppressFor(60)
+			    .detail("BackupUID", BackupConfig(task).getUid())
+			    .detail("BeginKey", Params.beginKey().get(task).printable())
+			    .detail("EndKey", Params.endKey().get(task).printable())
+			    .detail("SliceBeginKey", nextKey.printable())
+			    .detail("SliceEndKey", boundaries[idx].printable())
+			    .detail("TaskBytes", taskBytes);
+			nextKey = Key(boundaries[idx]);
+		}
+
+		addTaskVector.push_back(
+		    addTask(tr, taskBucket, task, task->getPriority(), nextKey, endKey, TaskCompletionKey::joinWith(onDone)));
+		wait(waitForAll(addTaskVector));
+
+		return Void();
+	}
+
 	ACTOR static Future<Void> _finish(Reference<ReadYourWritesTransaction> tr,
 	                                  Reference<TaskBucket> taskBucket,
 	                                  Reference<FutureBucket> futureBucket,
@@ -2031,6 +2242,8 @@ struct BackupRangeTaskFunc : BackupTaskFuncBase {
 		state Reference<TaskFuture> taskFuture = futureBucket->unpack(task->params[Task::reservedTaskParamKeyDone]);
 		if (Params.addBackupRangeTasks().get(task)) {
 			wait(startBackupRangeInternal(tr, taskBucket, futureBucket, task, taskFuture));
+		} else if (Params.splitTailTasks().getOrDefault(task, false)) {
+			wait(splitTailRangeInternal(tr, taskBucket, futureBucket, task, taskFuture));
 		} else {
 			wait(taskFuture->set(tr, taskBucket));
 		}
@@ -3735,6 +3948,11 @@ struct RestoreRangeTaskFunc : RestoreFileTaskFuncBase {
 			}
 			throw;
 		}
+		// Index blocks at the end of an indexed snapshot file decode to no KV pairs and restore nothing
+		if (blockData.empty()) {
+			CODE_PROBE(true, "Restore dispatched a snapshot file index block");
+			return Void();
+		}
 		state Optional<Reference<TenantEntryCache<Void>>> tenantCache;
 		state std::vector<Future<Void>> validTenantCheckFutures;
 		state Arena arena;
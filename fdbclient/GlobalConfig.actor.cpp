@@ -153,8 +153,12 @@ void GlobalConfig::erase(KeyRangeRef range) {
 	}
 }
 
-// Updates local copy of global configuration by reading the entire key-range
-// from storage (proxied through the GrvProxies).
+// Updates local copy of global configuration by reading the entire key-range.
+// This is the slow path, used only at initialization and when this process has
+// fallen behind the mutation history carried in ClientDBInfo (see updater()
+// below); ordinary configuration changes propagate as versioned deltas through
+// that history. The read is served from a cache on the GrvProxies rather than
+// from storage, so even a fleet-wide resync does not touch storage servers.
 ACTOR Future<Void> GlobalConfig::refresh(GlobalConfig* self, Version lastKnown) {
 	// TraceEvent trace(SevInfo, "GlobalConfigRefresh");
 	self->erase(KeyRangeRef(""_sr, "\xff"_sr));
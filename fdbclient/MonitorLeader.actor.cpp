@@ -496,6 +496,9 @@ std::string ClientLeaderRegInterface::getAddressString() const {
 
 // Nominee is the worker among all workers that are considered as leader by one coordinator
 // This function contacts a coordinator coord to ask who is its nominee.
+// Note that this is a long poll, not interval polling: the request carries the last known change id and
+// the coordinator holds the reply until its nominee differs, so a steady-state client generates no
+// traffic and leader changes are pushed as soon as the coordinator observes them.
 ACTOR Future<Void> monitorNominee(Key key,
                                   ClientLeaderRegInterface coord,
                                   AsyncTrigger* nomineeChange,
@@ -102,6 +102,31 @@ ThreadFuture<Optional<Value>> DLTransaction::get(const KeyRef& key, bool snapsho
 	});
 }
 
+ThreadFuture<RangeResult> DLTransaction::getBatch(const VectorRef<KeyRef>& keys, bool snapshot) {
+	if (!api->transactionGetBatch) {
+		return unsupported_operation();
+	}
+
+	std::vector<FdbCApi::FDBKey> ks;
+	ks.reserve(keys.size());
+	for (const auto& k : keys) {
+		ks.push_back(FdbCApi::FDBKey{ k.begin(), k.size() });
+	}
+
+	FdbCApi::FDBFuture* f = api->transactionGetBatch(tr, ks.data(), ks.size(), snapshot);
+
+	return toThreadFuture<RangeResult>(api, f, [](FdbCApi::FDBFuture* f, FdbCApi* api) {
+		const FdbCApi::FDBKeyValue* kvs;
+		int count;
+		FdbCApi::fdb_bool_t more;
+		FdbCApi::fdb_error_t error = api->futureGetKeyValueArray(f, &kvs, &count, &more);
+		ASSERT(!error);
+
+		// The memory for this is stored in the FDBFuture and is released when the future gets destroyed
+		return RangeResult(RangeResultRef(VectorRef<KeyValueRef>((KeyValueRef*)kvs, count), more), Arena());
+	});
+}
+
 ThreadFuture<Key> DLTransaction::getKey(const KeySelectorRef& key, bool snapshot) {
 	FdbCApi::FDBFuture* f =
 	    api->transactionGetKey(tr, key.getKey().begin(), key.getKey().size(), key.orEqual, key.offset, snapshot);
@@ -1139,6 +1164,11 @@ void DLApi::init() {
 	                   fdbCPath,
 	                   "fdb_transaction_get_tag_throttled_duration",
 	                   headerVersion >= ApiVersion::withGetTagThrottledDuration().version());
+	loadClientFunction(&api->transactionGetBatch,
+	                   lib,
+	                   fdbCPath,
+	                   "fdb_transaction_get_batch",
+	                   headerVersion >= ApiVersion::withGetBatch().version());
 	loadClientFunction(&api->transactionGetTotalCost,
 	                   lib,
 	                   fdbCPath,
@@ -1474,6 +1504,10 @@ ThreadFuture<Optional<Value>> MultiVersionTransaction::get(const KeyRef& key, bo
 	return executeOperation(&ITransaction::get, key, std::forward<bool>(snapshot));
 }
 
+ThreadFuture<RangeResult> MultiVersionTransaction::getBatch(const VectorRef<KeyRef>& keys, bool snapshot) {
+	return executeOperation(&ITransaction::getBatch, keys, std::forward<bool>(snapshot));
+}
+
 ThreadFuture<Key> MultiVersionTransaction::getKey(const KeySelectorRef& key, bool snapshot) {
 	return executeOperation(&ITransaction::getKey, key, std::forward<bool>(snapshot));
 }
@@ -3103,10 +3137,28 @@ void MultiVersionApi::setupNetwork() {
 			networkStartSetup = true;
 
 			if (externalClientDescriptions.empty() && localClientDisabled) {
-				TraceEvent(SevWarn, "CannotSetupNetwork")
-				    .detail("Reason", "Local client is disabled and no external clients configured");
+				// The local client was disabled (typically because multiple client threads were
+				// requested) without configuring an external client library. If this code is
+				// running out of a client shared library, use that library as the external
+				// client: the per-thread copy machinery below then gives every network thread its
+				// own image -- and with it its own network and transport globals -- without the
+				// caller locating or managing library copies itself.
+				std::string ownPath = platform::getImageInfo().fileName;
+				std::string ext = DYNAMIC_LIB_EXT;
+				if (ownPath.size() > ext.size() && ownPath.rfind(ext) == ownPath.size() - ext.size() &&
+				    fileExists(ownPath)) {
+					TraceEvent("UsingOwnClientLibraryAsExternalClient")
+					    .detail("LibraryPath", ownPath)
+					    .detail("ThreadCount", threadCount);
+					externalClientDescriptions.emplace(
+					    std::make_pair(basename(ownPath), ClientDesc(ownPath, true, false)));
+				} else {
+					TraceEvent(SevWarn, "CannotSetupNetwork")
+					    .detail("Reason", "Local client is disabled and no external clients configured")
+					    .detail("ImagePath", ownPath);
 
-				throw no_external_client_provided();
+					throw no_external_client_provided();
+				}
 			}
 
 			if (externalClientDescriptions.empty() && !disableBypass) {
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <deque>
 #include <iterator>
 #include <limits>
 #include <memory>
@@ -696,6 +697,19 @@ ACTOR Future<Void> databaseLogger(DatabaseContext* cx) {
 			    .detail("MedianBytesPerCommit", cx->bytesPerCommit.median())
 			    .detail("MaxBytesPerCommit", cx->bytesPerCommit.max())
 			    .detail("NumLocalityCacheEntries", cx->locationCache.size());
+
+			cx->queueModel.logMetrics(cx->dbId);
+
+			if (cx->specialKeySpace && !cx->specialKeySpace->getReadLatencyStats().empty()) {
+				TraceEvent sksEv("SpecialKeySpaceReadMetrics", cx->dbId);
+				sksEv.detail("Elapsed", (lastLogged == 0) ? 0 : now() - lastLogged).detail("Internal", cx->internal);
+				for (auto const& [module, stats] : cx->specialKeySpace->getReadLatencyStats()) {
+					std::string name = SpecialKeySpace::moduleToName(module);
+					sksEv.detail(name + "Count", stats.count)
+					    .detail(name + "MeanLatency", stats.totalLatency / stats.count)
+					    .detail(name + "MaxLatency", stats.maxLatency);
+				}
+			}
 		}
 
 		if (cx->usedAnyChangeFeeds && logTraces) {
@@ -1495,6 +1509,77 @@ ACTOR Future<UID> getClusterId(Database db) {
 	return db->clientInfo->get().clusterId;
 }
 
+// Warm-start persistence for the key location map (CLIENT_KNOBS->LOCATION_CACHE_PERSIST_FILE): a
+// snapshot of locationCache is written periodically so a freshly started client primes its cache
+// from disk instead of sending a GetKeyServerLocations storm to the proxies, which fleet-wide
+// deploys otherwise turn into a latency spike.  The file holds a protocol-versioned list of
+// (range, serverListValue...) entries; stale entries are corrected lazily by the normal
+// wrong_shard_server retry path, exactly as if a shard had moved while the client was running.
+static std::string locationCacheSnapshot(CoalescedKeyRangeMap<Reference<LocationInfo>>& locationCache) {
+	std::vector<std::pair<KeyRange, std::vector<Value>>> snapshot;
+	auto rs = locationCache.ranges();
+	for (auto r = rs.begin(); r != rs.end(); ++r) {
+		if (!r->value()) {
+			continue;
+		}
+		LocationInfo& loc = *r->value();
+		std::vector<Value> servers;
+		servers.reserve(loc.size());
+		for (int i = 0; i < loc.size(); i++) {
+			servers.push_back(serverListValue(loc.getInterface(i)));
+		}
+		snapshot.emplace_back(KeyRange(r->range()), std::move(servers));
+	}
+	BinaryWriter wr(IncludeVersion(currentProtocolVersion()));
+	wr << snapshot;
+	return wr.toValue().toString();
+}
+
+ACTOR Future<Void> persistLocationCache(DatabaseContext* cx) {
+	loop {
+		wait(delay(CLIENT_KNOBS->LOCATION_CACHE_PERSIST_INTERVAL, cx->taskID));
+		try {
+			atomicReplace(CLIENT_KNOBS->LOCATION_CACHE_PERSIST_FILE, locationCacheSnapshot(cx->locationCache), false);
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			TraceEvent(SevWarnAlways, "LocationCachePersistError")
+			    .error(e)
+			    .detail("File", CLIENT_KNOBS->LOCATION_CACHE_PERSIST_FILE);
+		}
+	}
+}
+
+void DatabaseContext::loadPersistedLocationCache() {
+	std::string const& path = CLIENT_KNOBS->LOCATION_CACHE_PERSIST_FILE;
+	if (!fileExists(path)) {
+		return;
+	}
+	try {
+		std::string bytes = readFileBytes(path, 128 << 20);
+		BinaryReader rd(StringRef(bytes), IncludeVersion());
+		std::vector<std::pair<KeyRange, std::vector<Value>>> snapshot;
+		rd >> snapshot;
+		int loadedRanges = 0;
+		for (auto& entry : snapshot) {
+			std::vector<StorageServerInterface> servers;
+			servers.reserve(entry.second.size());
+			for (auto& v : entry.second) {
+				servers.push_back(decodeServerListValue(v));
+			}
+			if (!servers.empty() && !entry.first.empty()) {
+				setCachedLocation(entry.first, servers);
+				++loadedRanges;
+			}
+		}
+		TraceEvent("LocationCacheLoaded").detail("File", path).detail("Ranges", loadedRanges);
+	} catch (Error& e) {
+		// A stale or corrupt snapshot (e.g. written by an incompatible version) is just a cold start
+		TraceEvent(SevWarn, "LocationCacheLoadError").error(e).detail("File", path);
+	}
+}
+
 DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnectionRecord>>> connectionRecord,
                                  Reference<AsyncVar<ClientDBInfo>> clientInfo,
                                  Reference<AsyncVar<Optional<ClientLeaderRegInterface>> const> coordinator,
@@ -1528,6 +1613,7 @@ DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnection
     transactionGetRangeStreamRequests("GetRangeStreamRequests", cc), transactionWatchRequests("WatchRequests", cc),
     transactionGetAddressesForKeyRequests("GetAddressesForKeyRequests", cc), transactionBytesRead("BytesRead", cc),
     transactionKeysRead("KeysRead", cc), transactionMetadataVersionReads("MetadataVersionReads", cc),
+    transactionReadCacheHits("ReadCacheHits", cc), transactionReadCacheMisses("ReadCacheMisses", cc),
     transactionCommittedMutations("CommittedMutations", cc),
     transactionCommittedMutationBytes("CommittedMutationBytes", cc), transactionSetMutations("SetMutations", cc),
     transactionClearMutations("ClearMutations", cc), transactionAtomicMutations("AtomicMutations", cc),
@@ -1806,6 +1892,11 @@ DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnection
 	}
 	throttleExpirer = recurring([this]() { expireThrottles(); }, CLIENT_KNOBS->TAG_THROTTLE_EXPIRATION_INTERVAL);
 
+	if (!CLIENT_KNOBS->LOCATION_CACHE_PERSIST_FILE.empty()) {
+		loadPersistedLocationCache();
+		locationCachePersister = persistLocationCache(this);
+	}
+
 	if (BUGGIFY) {
 		DatabaseContext::debugUseTags = true;
 	}
@@ -1830,6 +1921,7 @@ DatabaseContext::DatabaseContext(const Error& err)
     transactionGetRangeStreamRequests("GetRangeStreamRequests", cc), transactionWatchRequests("WatchRequests", cc),
     transactionGetAddressesForKeyRequests("GetAddressesForKeyRequests", cc), transactionBytesRead("BytesRead", cc),
     transactionKeysRead("KeysRead", cc), transactionMetadataVersionReads("MetadataVersionReads", cc),
+    transactionReadCacheHits("ReadCacheHits", cc), transactionReadCacheMisses("ReadCacheMisses", cc),
     transactionCommittedMutations("CommittedMutations", cc),
     transactionCommittedMutationBytes("CommittedMutationBytes", cc), transactionSetMutations("SetMutations", cc),
     transactionClearMutations("ClearMutations", cc), transactionAtomicMutations("AtomicMutations", cc),
@@ -2148,6 +2240,73 @@ void DatabaseContext::decreaseWatchCounter() {
 	ASSERT(outstandingWatches >= 0);
 }
 
+int64_t DatabaseContext::ReadCache::entryBytes(KeyRef key, Optional<Value> const& value) {
+	// The key is stored twice (map and LRU list), plus node overhead
+	return 2 * key.size() + value.expectedSize() + sizeof(Entry) + 2 * sizeof(Key) + 6 * sizeof(void*);
+}
+
+Optional<Optional<Value>> DatabaseContext::ReadCache::get(KeyRef key) {
+	auto it = entries.find(key);
+	if (it == entries.end()) {
+		return Optional<Optional<Value>>();
+	}
+	if (now() - it->second.readTime > CLIENT_KNOBS->READ_CACHE_STALENESS_BOUND) {
+		bytes -= entryBytes(it->first, it->second.value);
+		lru.erase(it->second.lruPos);
+		entries.erase(it);
+		return Optional<Optional<Value>>();
+	}
+	lru.splice(lru.begin(), lru, it->second.lruPos);
+	return it->second.value;
+}
+
+void DatabaseContext::ReadCache::insert(KeyRef key, Optional<Value> const& value, Version version) {
+	int64_t b = entryBytes(key, value);
+	if (b > CLIENT_KNOBS->READ_CACHE_MAX_BYTES) {
+		return;
+	}
+	invalidate(singleKeyRange(key));
+	lru.emplace_front(key);
+	entries.emplace(lru.front(), Entry{ value, version, now(), lru.begin() });
+	bytes += b;
+	while (bytes > CLIENT_KNOBS->READ_CACHE_MAX_BYTES) {
+		auto evict = entries.find(lru.back());
+		ASSERT(evict != entries.end());
+		bytes -= entryBytes(evict->first, evict->second.value);
+		entries.erase(evict);
+		lru.pop_back();
+	}
+}
+
+void DatabaseContext::ReadCache::invalidate(KeyRangeRef range) {
+	auto it = entries.lower_bound(range.begin);
+	while (it != entries.end() && it->first < range.end) {
+		bytes -= entryBytes(it->first, it->second.value);
+		lru.erase(it->second.lruPos);
+		it = entries.erase(it);
+	}
+}
+
+void DatabaseContext::addReadCacheRange(const KeyRangeRef& range) {
+	KeyRangeRef clamped = range & normalKeys;
+	if (clamped.empty()) {
+		return;
+	}
+	readCacheRanges.insert(clamped, true);
+	readCacheRangesPresent = true;
+}
+
+bool DatabaseContext::canServeFromReadCache(const KeyRef& key) {
+	return readCacheRangesPresent && CLIENT_KNOBS->READ_CACHE_MAX_BYTES > 0 && key < allKeys.end &&
+	       readCacheRanges.rangeContaining(key).value();
+}
+
+void DatabaseContext::invalidateReadCache(const KeyRangeRef& range) {
+	if (readCacheRangesPresent) {
+		readCache.invalidate(range);
+	}
+}
+
 Future<Void> DatabaseContext::onConnected() const {
 	return connected;
 }
@@ -2194,6 +2353,13 @@ ACTOR static Future<Void> switchConnectionRecordImpl(Reference<IClusterConnectio
 	}
 }
 
+Reference<BlobGranuleFileCache> DatabaseContext::getBlobGranuleFileCache() {
+	if (!blobGranuleFileCache.isValid() && CLIENT_KNOBS->BG_FILE_CACHE_MAX_BYTES > 0) {
+		blobGranuleFileCache = makeReference<BlobGranuleFileCache>(CLIENT_KNOBS->BG_FILE_CACHE_MAX_BYTES);
+	}
+	return blobGranuleFileCache;
+}
+
 Reference<IClusterConnectionRecord> DatabaseContext::getConnectionRecord() {
 	if (connectionRecord) {
 		return connectionRecord->get();
@@ -2734,6 +2900,12 @@ Reference<CommitProxyInfo> DatabaseContext::getCommitProxies(UseProvisionalProxi
 	return commitProxies;
 }
 
+// GRV proxies are deliberately treated as interchangeable: they are all recruited in the
+// primary region, so there is no same-region alternative for a remote-region client to
+// prefer and the WAN round trip is inherent to obtaining a causally consistent read
+// version. Clients that can tolerate bounded staleness should use the GRV cache
+// (use_grv_cache / grv_cache_max_staleness) to skip the round trip instead. Storage reads
+// are already locality-aware through loadBalanceDistance on the replica interfaces.
 Reference<GrvProxyInfo> DatabaseContext::getGrvProxies(UseProvisionalProxies useProvisionalProxies) {
 	updateProxies();
 	if (proxyProvisional && !useProvisionalProxies) {
@@ -4006,6 +4178,9 @@ ACTOR Future<Void> sameVersionDiffValue(Database cx, Reference<WatchParameters>
 	}
 }
 
+// Deduplicates watches within this client: all watches on the same (tenant, key) share the one
+// server-side registration tracked in the watchMap and are fanned out locally through the shared
+// watchPromise, with version bookkeeping below deciding when the registration must be recreated.
 Future<Void> getWatchFuture(Database cx, Reference<WatchParameters> parameters) {
 	Reference<WatchMetadata> metadata = cx->getWatchMetadata(parameters->tenant.tenantId, parameters->key);
 
@@ -4019,6 +4194,7 @@ Future<Void> getWatchFuture(Database cx, Reference<WatchParameters> parameters)
 	}
 	// case 2: val_1 == val_2 (received watch with same value as key already in the map so just update)
 	else if (metadata->parameters->value == parameters->value) {
+		CODE_PROBE(true, "Watch deduplicated against an identical in-flight watch");
 		if (parameters->version > metadata->parameters->version) {
 			metadata->parameters = parameters;
 		}
@@ -4159,6 +4335,52 @@ void setMatchIndex(GetKeyValuesFamilyRequest& req, int matchIndex) {
 	}
 }
 
+// Builds and issues the range read for one shard of getExactRange.  Speculative reads for shards
+// past the one currently being processed are issued with the limits remaining at issue time;
+// getExactRange trims any over-delivery when it stitches the replies together in shard order.
+template <class GetKeyValuesFamilyRequest, class GetKeyValuesFamilyReply>
+Future<GetKeyValuesFamilyReply> issueExactRangeRead(Reference<TransactionState> trState,
+                                                    KeyRangeLocationInfo const& location,
+                                                    Key const& mapper,
+                                                    GetRangeLimits limits,
+                                                    int matchIndex,
+                                                    Reverse reverse,
+                                                    UseTenant useTenant,
+                                                    SpanContext spanContext) {
+	GetKeyValuesFamilyRequest req;
+	req.mapper = mapper;
+	req.arena.dependsOn(mapper.arena());
+
+	req.tenantInfo = useTenant ? trState->getTenantInfo() : TenantInfo();
+	req.version = trState->readVersion();
+	req.begin = firstGreaterOrEqual(location.range.begin);
+	req.end = firstGreaterOrEqual(location.range.end);
+
+	setMatchIndex<GetKeyValuesFamilyRequest>(req, matchIndex);
+	req.spanContext = spanContext;
+	trState->cx->getLatestCommitVersions(location.locations, trState, req.ssLatestCommitVersions);
+
+	// keep shard's arena around in case of async tss comparison
+	req.arena.dependsOn(location.range.arena());
+
+	transformRangeLimits(limits, reverse, req);
+	ASSERT(req.limitBytes > 0 && req.limit != 0 && req.limit < 0 == reverse);
+
+	// FIXME: buggify byte limits on internal functions that use them, instead of globally
+	req.tags = trState->cx->sampleReadTags() ? trState->options.readTags : Optional<TagSet>();
+
+	req.options = trState->readOptions;
+
+	++trState->cx->transactionPhysicalReads;
+	return loadBalance(trState->cx.getPtr(),
+	                   location.locations,
+	                   getRangeRequestStream<GetKeyValuesFamilyRequest>(),
+	                   req,
+	                   TaskPriority::DefaultPromiseEndpoint,
+	                   AtMostOnce::False,
+	                   trState->cx->enableLocalityLoadBalance ? &trState->cx->queueModel : nullptr);
+}
+
 ACTOR template <class GetKeyValuesFamilyRequest, class GetKeyValuesFamilyReply, class RangeResultFamily>
 Future<RangeResultFamily> getExactRange(Reference<TransactionState> trState,
                                         KeyRange keys,
@@ -4181,68 +4403,39 @@ Future<RangeResultFamily> getExactRange(Reference<TransactionState> trState,
 		state std::vector<KeyRangeLocationInfo> locations =
 		    wait(getKeyRangeLocations(trState,
 		                              keys,
-		                              CLIENT_KNOBS->GET_RANGE_SHARD_LIMIT,
+		                              std::max(CLIENT_KNOBS->GET_RANGE_SHARD_LIMIT, CLIENT_KNOBS->GET_RANGE_FANOUT),
 		                              reverse,
 		                              getRangeRequestStream<GetKeyValuesFamilyRequest>(),
 		                              useTenant));
 		ASSERT(locations.size());
 		state int shard = 0;
+		// Bounded fan-out: keep up to GET_RANGE_FANOUT shard reads in flight and stitch the
+		// replies together in shard order.  inFlight.front() always belongs to locations[shard];
+		// reads for later shards are speculative and are cancelled (dropped) if an earlier reply
+		// satisfies the limits first.
+		state std::deque<Future<GetKeyValuesFamilyReply>> inFlight;
+		state int nextToIssue = 0;
 		loop {
-			const KeyRangeRef& range = locations[shard].range;
-
-			GetKeyValuesFamilyRequest req;
-			req.mapper = mapper;
-			req.arena.dependsOn(mapper.arena());
-
-			req.tenantInfo = useTenant ? trState->getTenantInfo() : TenantInfo();
-			req.version = trState->readVersion();
-			req.begin = firstGreaterOrEqual(range.begin);
-			req.end = firstGreaterOrEqual(range.end);
-
-			setMatchIndex<GetKeyValuesFamilyRequest>(req, matchIndex);
-			req.spanContext = span.context;
-			trState->cx->getLatestCommitVersions(locations[shard].locations, trState, req.ssLatestCommitVersions);
-
-			// keep shard's arena around in case of async tss comparison
-			req.arena.dependsOn(locations[shard].range.arena());
-
-			transformRangeLimits(limits, reverse, req);
-			ASSERT(req.limitBytes > 0 && req.limit != 0 && req.limit < 0 == reverse);
-
-			// FIXME: buggify byte limits on internal functions that use them, instead of globally
-			req.tags = trState->cx->sampleReadTags() ? trState->options.readTags : Optional<TagSet>();
-
-			req.options = trState->readOptions;
+			while ((int)inFlight.size() < std::max(1, CLIENT_KNOBS->GET_RANGE_FANOUT) &&
+			       nextToIssue < (int)locations.size()) {
+				inFlight.push_back(issueExactRangeRead<GetKeyValuesFamilyRequest, GetKeyValuesFamilyReply>(
+				    trState, locations[nextToIssue], mapper, limits, matchIndex, reverse, useTenant, span.context));
+				++nextToIssue;
+			}
 
 			try {
 				if (trState->readOptions.present() && trState->readOptions.get().debugID.present()) {
 					g_traceBatch.addEvent("TransactionDebug",
 					                      trState->readOptions.get().debugID.get().first(),
 					                      "NativeAPI.getExactRange.Before");
-					/*TraceEvent("TransactionDebugGetExactRangeInfo", trState->readOptions.debugID.get())
-					    .detail("ReqBeginKey", req.begin.getKey())
-					    .detail("ReqEndKey", req.end.getKey())
-					    .detail("ReqLimit", req.limit)
-					    .detail("ReqLimitBytes", req.limitBytes)
-					    .detail("ReqVersion", req.version)
-					    .detail("Reverse", reverse)
-					    .detail("Servers", locations[shard].second->description());*/
 				}
-				++trState->cx->transactionPhysicalReads;
 				state GetKeyValuesFamilyReply rep;
 				try {
 					choose {
 						when(wait(trState->cx->connectionFileChanged())) {
 							throw transaction_too_old();
 						}
-						when(GetKeyValuesFamilyReply _rep = wait(loadBalance(
-						         trState->cx.getPtr(),
-						         locations[shard].locations,
-						         getRangeRequestStream<GetKeyValuesFamilyRequest>(),
-						         req,
-						         TaskPriority::DefaultPromiseEndpoint,
-						         AtMostOnce::False,
-						         trState->cx->enableLocalityLoadBalance ? &trState->cx->queueModel : nullptr))) {
+						when(GetKeyValuesFamilyReply _rep = wait(inFlight.front())) {
 							rep = _rep;
 						}
 					}
@@ -4251,25 +4444,28 @@ Future<RangeResultFamily> getExactRange(Reference<TransactionState> trState,
 					++trState->cx->transactionPhysicalReadsCompleted;
 					throw;
 				}
+				inFlight.pop_front();
 				if (trState->readOptions.present() && trState->readOptions.get().debugID.present())
 					g_traceBatch.addEvent("TransactionDebug",
 					                      trState->readOptions.get().debugID.get().first(),
 					                      "NativeAPI.getExactRange.After");
-				output.arena().dependsOn(rep.arena);
-				output.append(output.arena(), rep.data.begin(), rep.data.size());
 
-				if (limits.hasRowLimit() && rep.data.size() > limits.rows) {
-					TraceEvent(SevError, "GetExactRangeTooManyRows")
-					    .detail("RowLimit", limits.rows)
-					    .detail("DeliveredRows", output.size());
-					ASSERT(false);
+				// A speculative read was issued with the limits remaining at issue time, which may
+				// exceed what we can still accept now that earlier shards have been processed, so
+				// apply the limits row by row
+				int accepted = 0;
+				while (accepted < rep.data.size() && !limits.isReached()) {
+					limits.decrement(rep.data[accepted]);
+					++accepted;
 				}
-				limits.decrement(rep.data);
+				output.arena().dependsOn(rep.arena);
+				output.append(output.arena(), rep.data.begin(), accepted);
 
 				if (limits.isReached()) {
 					output.more = true;
 					return output;
 				}
+				ASSERT(accepted == rep.data.size());
 
 				bool more = rep.more;
 				// If the reply says there is more but we know that we finished the shard, then fix rep.more
@@ -4297,6 +4493,12 @@ Future<RangeResultFamily> getExactRange(Reference<TransactionState> trState,
 					else
 						locations[shard].range =
 						    KeyRangeRef(keyAfter(output[output.size() - 1].key), locations[shard].range.end);
+					if (!locations[shard].range.empty()) {
+						// The continuation must be stitched in before any speculative reads already
+						// in flight for later shards
+						inFlight.push_front(issueExactRangeRead<GetKeyValuesFamilyRequest, GetKeyValuesFamilyReply>(
+						    trState, locations[shard], mapper, limits, matchIndex, reverse, useTenant, span.context));
+					}
 				}
 
 				if (!more || locations[shard].range.empty()) {
@@ -4313,6 +4515,7 @@ Future<RangeResultFamily> getExactRange(Reference<TransactionState> trState,
 						CODE_PROBE(true, "Multiple requests of key locations");
 
 						keys = KeyRangeRef(begin, end);
+						inFlight.clear();
 						break;
 					}
 
@@ -4339,6 +4542,7 @@ Future<RangeResultFamily> getExactRange(Reference<TransactionState> trState,
 					trState->cx->invalidateCache(
 					    useTenant ? trState->tenant().mapRef(&Tenant::prefix) : Optional<KeyRef>(), keys);
 
+					inFlight.clear();
 					wait(delay(CLIENT_KNOBS->WRONG_SHARD_SERVER_DELAY, trState->taskID));
 					break;
 				} else {
@@ -5256,8 +5460,9 @@ static KeyRange intersect(KeyRangeRef lhs, KeyRangeRef rhs) {
 	return KeyRange(KeyRangeRef(std::max(lhs.begin, rhs.begin), std::min(lhs.end, rhs.end)));
 }
 
-// Divides the requested key range into 1MB fragments, create range streams for each fragment, and merges the results so
-// the client get them in order
+// Divides the requested key range into fragments (up to RANGESTREAM_FRAGMENT_SIZE bytes each, scaled down under
+// consumer backpressure), create range streams for each fragment, and merges the results so the client get them in
+// order
 ACTOR Future<Void> getRangeStream(Reference<TransactionState> trState,
                                   PromiseStream<RangeResult> _results,
                                   KeySelector begin,
@@ -5302,7 +5507,10 @@ ACTOR Future<Void> getRangeStream(Reference<TransactionState> trState,
 		    trState, reverse ? e : b, &StorageServerInterface::getKeyValuesStream, reverse, UseTenant::True));
 		state KeyRange shardIntersection = intersect(locationInfo.range, KeyRangeRef(b, e));
 		state Standalone<VectorRef<KeyRef>> splitPoints =
-		    wait(getRangeSplitPoints(trState, shardIntersection, CLIENT_KNOBS->RANGESTREAM_FRAGMENT_SIZE));
+		    wait(getRangeSplitPoints(trState,
+		                             shardIntersection,
+		                             results.suggestedByteBudget(CLIENT_KNOBS->RANGESTREAM_FRAGMENT_SIZE_MIN,
+		                                                         CLIENT_KNOBS->RANGESTREAM_FRAGMENT_SIZE)));
 		state std::vector<KeyRange> toSend;
 		// state std::vector<Future<std::list<KeyRangeRef>::iterator>> outstandingRequests;
 
@@ -5438,7 +5646,14 @@ void Transaction::setVersion(Version v) {
 	trState->readVersionObtainedFromGrvProxy = false;
 }
 
-Future<Optional<Value>> Transaction::get(const Key& key, Snapshot snapshot) {
+// Reads a value and stamps the cross-transaction read cache with the result and the version it was read at
+ACTOR Future<Optional<Value>> getValueAndUpdateReadCache(Reference<TransactionState> trState, Key key) {
+	Optional<Value> value = wait(getValue(trState, key, UseTenant::True));
+	trState->cx->readCache.insert(key, value, trState->readVersion());
+	return value;
+}
+
+Future<Optional<Value>> Transaction::get(const Key& key, Snapshot snapshot, UseReadCache useReadCache) {
 	++trState->cx->transactionLogicalReads;
 	++trState->cx->transactionGetValueRequests;
 	// ASSERT (key < allKeys.end);
@@ -5448,6 +5663,21 @@ Future<Optional<Value>> Transaction::get(const Key& key, Snapshot snapshot) {
 		return Optional<Value>();
 	}
 
+	// Snapshot reads in a declared stale-tolerant range can be served from the cross-transaction read cache
+	// without a GRV or a storage request. Non-snapshot reads bypass the cache so they still register read
+	// conflict ranges against a real read version. The snapshot flag alone is not trustworthy here: RYW issues
+	// every read it manages as a snapshot read and adds conflict ranges itself, so it passes UseReadCache::False
+	// for reads the application asked to be serializable.
+	bool cacheable = snapshot && useReadCache && !trState->hasTenant() && trState->cx->canServeFromReadCache(key);
+	if (cacheable) {
+		Optional<Optional<Value>> cached = trState->cx->readCache.get(key);
+		if (cached.present()) {
+			++trState->cx->transactionReadCacheHits;
+			return cached.get();
+		}
+		++trState->cx->transactionReadCacheMisses;
+	}
+
 	auto ver = getReadVersion();
 
 	/*	if (!systemKeys.contains(key))
@@ -5495,6 +5725,9 @@ Future<Optional<Value>> Transaction::get(const Key& key, Snapshot snapshot) {
 		}
 	}
 
+	if (cacheable) {
+		return getValueAndUpdateReadCache(trState, key);
+	}
 	return getValue(trState, key, useTenant);
 }
 
@@ -5888,6 +6121,7 @@ void Transaction::set(const KeyRef& key, const ValueRef& value, AddConflictRange
 	auto v = ValueRef(req.arena, value);
 	t.mutations.emplace_back(req.arena, MutationRef::SetValue, r.begin, v);
 	trState->totalCost += getWriteOperationCost(key.expectedSize() + value.expectedSize());
+	trState->cx->invalidateReadCache(r);
 
 	if (addConflictRange) {
 		t.write_conflict_ranges.push_back(req.arena, r);
@@ -5918,6 +6152,7 @@ void Transaction::atomicOp(const KeyRef& key,
 
 	t.mutations.emplace_back(req.arena, operationType, r.begin, v);
 	trState->totalCost += getWriteOperationCost(key.expectedSize());
+	trState->cx->invalidateReadCache(r);
 
 	if (addConflictRange && operationType != MutationRef::SetVersionstampedKey)
 		t.write_conflict_ranges.push_back(req.arena, r);
@@ -5949,6 +6184,7 @@ void Transaction::clear(const KeyRangeRef& range, AddConflictRange addConflictRa
 		return;
 
 	t.mutations.emplace_back(req.arena, MutationRef::ClearRange, r.begin, r.end);
+	trState->cx->invalidateReadCache(r);
 	// NOTE: The throttling cost of each clear is assumed to be one page.
 	// This makes compuation fast, but can be inaccurate and may
 	// underestimate the cost of large clears.
@@ -5972,6 +6208,7 @@ void Transaction::clear(const KeyRef& key, AddConflictRange addConflictRange) {
 	data[key.size()] = 0;
 	t.mutations.emplace_back(
 	    req.arena, MutationRef::ClearRange, KeyRef(data, key.size()), KeyRef(data, key.size() + 1));
+	trState->cx->invalidateReadCache(KeyRangeRef(KeyRef(data, key.size()), KeyRef(data, key.size() + 1)));
 	if (addConflictRange)
 		t.write_conflict_ranges.emplace_back(req.arena, KeyRef(data, key.size()), KeyRef(data, key.size() + 1));
 }
@@ -6064,6 +6301,7 @@ void TransactionOptions::clear() {
 	expensiveClearCostEstimation = false;
 	useGrvCache = false;
 	skipGrvCache = false;
+	grvCacheMaxStaleness = 0.0;
 	rawAccess = false;
 	bypassStorageQuota = false;
 }
@@ -6260,6 +6498,15 @@ ACTOR static Future<Void> commitDummyTransaction(Reference<TransactionState> trS
 	}
 }
 
+// Determines whether a transaction with the given idempotency id committed within the given
+// version window by reading the idempotency keyspace. This read happens once per
+// commit_unknown_result retry, not per commit, and it cannot be short-circuited by an
+// approximate structure: answering "not committed" causes the transaction to be re-executed,
+// so a negative must be authoritative. A proxy-resident bloom filter over recent ids would
+// give authoritative negatives only while it provably covers the whole
+// [expiredVersion, now] window, and it is empty after every proxy generation change -- which
+// is exactly when unknown results cluster -- so the filter would have to be rebuilt by
+// scanning the same keyspace this read consults.
 ACTOR static Future<Optional<CommitResult>> determineCommitStatus(Reference<TransactionState> trState,
                                                                   Version minPossibleCommitVersion,
                                                                   Version maxPossibleCommitVersion,
@@ -7073,6 +7320,18 @@ void Transaction::setOption(FDBTransactionOptions::Option option, Optional<Strin
 		validateOptionValueNotPresent(value);
 		trState->options.skipGrvCache = true;
 		break;
+
+	case FDBTransactionOptions::GRV_CACHE_MAX_STALENESS:
+		validateOptionValuePresent(value);
+		if (apiVersionAtLeast(ApiVersion::withGrvCache().version()) && !trState->cx->sharedStatePtr) {
+			throw invalid_option();
+		}
+		if (trState->numErrors == 0) {
+			trState->options.grvCacheMaxStaleness =
+			    extractIntOption(value, 1, (int64_t)(CLIENT_KNOBS->GRV_CACHE_MAX_STALENESS_LIMIT * 1000)) / 1000.0;
+			trState->options.useGrvCache = true;
+		}
+		break;
 	case FDBTransactionOptions::READ_SYSTEM_KEYS:
 	case FDBTransactionOptions::ACCESS_SYSTEM_KEYS:
 	case FDBTransactionOptions::RAW_ACCESS:
@@ -7436,7 +7695,9 @@ Future<Version> TransactionState::getReadVersion(uint32_t flags) {
 		Version rv = cx->getCachedReadVersion();
 		double lastTime = cx->getLastGrvTime();
 		double requestTime = now();
-		if (requestTime - lastTime <= CLIENT_KNOBS->MAX_VERSION_CACHE_LAG && rv != Version(0)) {
+		double maxStaleness = options.grvCacheMaxStaleness > 0.0 ? options.grvCacheMaxStaleness
+		                                                         : CLIENT_KNOBS->MAX_VERSION_CACHE_LAG;
+		if (requestTime - lastTime <= maxStaleness && rv != Version(0)) {
 			ASSERT(!debug_checkVersionTime(rv, requestTime, "CheckStaleness"));
 			return rv;
 		} // else go through regular GRV path
@@ -9362,9 +9623,14 @@ void DatabaseContext::setSharedState(DatabaseSharedState* p) {
 }
 
 ACTOR Future<Void> storageFeedVersionUpdater(StorageServerInterface interf, ChangeFeedStorageData* self) {
+	// One consolidated empty version poll covers every quiet feed on this storage server. While the server
+	// stays idle (no stream reply advanced our version between polls), back the cadence off so tens of
+	// thousands of quiet feeds don't pin both sides at the fast poll rate; any stream-driven advance means
+	// mutations are flowing again and resets the cadence.
+	state double pollDelay = CLIENT_KNOBS->CHANGE_FEED_EMPTY_BATCH_TIME;
 	loop {
 		if (self->version.get() < self->desired.get()) {
-			wait(delay(CLIENT_KNOBS->CHANGE_FEED_EMPTY_BATCH_TIME) || self->version.whenAtLeast(self->desired.get()));
+			wait(delay(pollDelay) || self->version.whenAtLeast(self->desired.get()));
 			if (self->version.get() < self->desired.get()) {
 				try {
 					ChangeFeedVersionUpdateReply rep = wait(brokenPromiseToNever(
@@ -9372,14 +9638,17 @@ ACTOR Future<Void> storageFeedVersionUpdater(StorageServerInterface interf, Chan
 					if (rep.version > self->version.get()) {
 						self->version.set(rep.version);
 					}
+					pollDelay = std::min(2.0 * pollDelay, CLIENT_KNOBS->CHANGE_FEED_EMPTY_BATCH_MAX_TIME);
 				} catch (Error& e) {
 					if (e.code() != error_code_server_overloaded) {
 						throw;
 					}
-					if (FLOW_KNOBS->PREVENT_FAST_SPIN_DELAY > CLIENT_KNOBS->CHANGE_FEED_EMPTY_BATCH_TIME) {
-						wait(delay(FLOW_KNOBS->PREVENT_FAST_SPIN_DELAY - CLIENT_KNOBS->CHANGE_FEED_EMPTY_BATCH_TIME));
+					if (FLOW_KNOBS->PREVENT_FAST_SPIN_DELAY > pollDelay) {
+						wait(delay(FLOW_KNOBS->PREVENT_FAST_SPIN_DELAY - pollDelay));
 					}
 				}
+			} else {
+				pollDelay = CLIENT_KNOBS->CHANGE_FEED_EMPTY_BATCH_TIME;
 			}
 		} else {
 			wait(self->desired.whenAtLeast(self->version.get() + 1));
@@ -9998,6 +10267,7 @@ ACTOR Future<Void> mergeChangeFeedStreamInternal(Reference<ChangeFeedData> resul
 	}
 
 	state Version nextVersion;
+	state Standalone<VectorRef<MutationsAndVersionRef>> nextOut;
 	loop {
 		// bring all of the streams up to date to ensure we have the latest element from each stream in mutations
 		interfNum = 0;
@@ -10015,6 +10285,8 @@ ACTOR Future<Void> mergeChangeFeedStreamInternal(Reference<ChangeFeedData> resul
 		}
 
 		if (mutations.empty()) {
+			// a stream that ended was empty at the last flush check, so nothing can be left unflushed
+			ASSERT(nextOut.empty());
 			throw end_of_stream();
 		}
 
@@ -10024,7 +10296,6 @@ ACTOR Future<Void> mergeChangeFeedStreamInternal(Reference<ChangeFeedData> resul
 		wait(delay(0));
 
 		// pop first item off queue - this will be mutation with the lowest version
-		Standalone<VectorRef<MutationsAndVersionRef>> nextOut;
 		nextVersion = mutations.top().next.version;
 
 		streamsUsed.push_back(mutations.top());
@@ -10042,30 +10313,51 @@ ACTOR Future<Void> mergeChangeFeedStreamInternal(Reference<ChangeFeedData> resul
 			mutations.pop();
 		}
 
-		ASSERT(nextOut.size() == 1);
 		ASSERT(nextVersion >= *begin);
 
 		*begin = nextVersion + 1;
 
+		// empty versions are just a progress marker and are never sent to the client
+		if (nextOut.back().mutations.empty()) {
+			ASSERT(results->mutations.isEmpty());
+			nextOut.pop_back();
+		}
+
 		if (DEBUG_CF_CLIENT_TRACE) {
 			TraceEvent(SevDebug, "TraceChangeFeedClientMergeCursorSending", mergeCursorUID)
 			    .detail("Count", streamsUsed.size())
-			    .detail("Version", nextVersion);
+			    .detail("Version", nextVersion)
+			    .detail("BatchedVersions", nextOut.size());
+		}
+
+		// If every stream we just consumed from already has its next element buffered, keep merging into the
+		// current batch before sending, so the client receives fewer, smoother version-ordered batches rather
+		// than one send and consumer round trip per version. Flush once a consumed stream would block or the
+		// batch is large enough to be efficient.
+		bool flush = nextOut.expectedSize() >= CLIENT_KNOBS->CHANGE_FEED_STREAM_MIN_BYTES;
+		if (!flush) {
+			for (auto& stream : streamsUsed) {
+				if (stream.results.isEmpty()) {
+					flush = true;
+					break;
+				}
+			}
 		}
 
-		// send mutations at nextVersion to the client
-		if (nextOut.back().mutations.empty()) {
-			ASSERT(results->mutations.isEmpty());
-		} else {
-			ASSERT(nextOut.back().version > results->lastReturnedVersion.get());
+		if (flush) {
+			if (!nextOut.empty()) {
+				CODE_PROBE(nextOut.size() > 1, "Change feed merge cursor batched multiple versions");
+				ASSERT(nextOut.front().version > results->lastReturnedVersion.get());
 
-			results->mutations.send(nextOut);
-			wait(results->mutations.onEmpty());
-			wait(delay(0));
-		}
+				results->mutations.send(nextOut);
+				wait(results->mutations.onEmpty());
+				wait(delay(0));
+				nextOut = Standalone<VectorRef<MutationsAndVersionRef>>();
+			}
 
-		if (nextVersion > results->lastReturnedVersion.get()) {
-			results->lastReturnedVersion.set(nextVersion);
+			if (nextVersion > results->lastReturnedVersion.get()) {
+				results->lastReturnedVersion.set(nextVersion);
+			}
 		}
 	}
 }
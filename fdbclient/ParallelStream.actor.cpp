@@ -55,6 +55,21 @@ ACTOR static Future<Void> consume(FutureStream<ParallelStreamTest::TestValue> st
 	}
 }
 
+ACTOR static Future<Void> consumeSlowly(FutureStream<ParallelStreamTest::TestValue> stream, int expected) {
+	state int next = 0;
+	try {
+		loop {
+			ParallelStreamTest::TestValue value = waitNext(stream);
+			ASSERT(value.x == next++);
+			wait(delay(deterministicRandom()->random01() * 0.1));
+		}
+	} catch (Error& e) {
+		ASSERT(e.code() == error_code_end_of_stream);
+		ASSERT(next == expected);
+		return Void();
+	}
+}
+
 } // namespace ParallelStreamTest
 
 TEST_CASE("/fdbclient/ParallelStream") {
@@ -75,4 +90,26 @@ TEST_CASE("/fdbclient/ParallelStream") {
 	return Void();
 }
 
+// Exercises the backpressure-adaptive concurrency path: a consumer which drains much more slowly than the producers
+// fill should force the concurrency target down without losing ordering or results.
+TEST_CASE("/fdbclient/ParallelStream/SlowConsumer") {
+	state PromiseStream<ParallelStreamTest::TestValue> results;
+	state size_t bufferLimit = deterministicRandom()->randomInt(1, 21);
+	state size_t numProducers = deterministicRandom()->randomInt(1, 101);
+	state ParallelStream<ParallelStreamTest::TestValue> parallelStream(results, bufferLimit);
+	state Future<Void> consumer = ParallelStreamTest::consumeSlowly(results.getFuture(), numProducers);
+	state std::vector<Future<Void>> producers;
+	TraceEvent("StartingParallelStreamSlowConsumerTest")
+	    .detail("BufferLimit", bufferLimit)
+	    .detail("NumProducers", numProducers);
+	state int i = 0;
+	for (; i < numProducers; ++i) {
+		ParallelStream<ParallelStreamTest::TestValue>::Fragment* fragment = wait(parallelStream.createFragment());
+		producers.push_back(ParallelStreamTest::produce(fragment, ParallelStreamTest::TestValue(i)));
+	}
+	wait(parallelStream.finish());
+	wait(consumer);
+	return Void();
+}
+
 void forceLinkParallelStreamTests() {}
@@ -18,6 +18,7 @@
  * limitations under the License.
  */
 
+#include "fdbclient/ClientKnobs.h"
 #include "fdbclient/RYWIterator.h"
 #include "fdbclient/KeyRangeMap.h"
 #include "flow/UnitTest.h"
@@ -821,3 +822,63 @@ TEST_CASE("/fdbclient/WriteMap/random") {
 
 	return Void();
 }
+
+TEST_CASE("/fdbclient/WriteMap/flatten") {
+	Arena arena = Arena();
+	WriteMap writes = WriteMap(&arena);
+
+	std::map<KeyRef, ValueRef> expected;
+	for (int i = 0; i < CLIENT_KNOBS->WRITE_MAP_FLATTEN_THRESHOLD + 100; i++) {
+		KeyRef key = RandomTestImpl::getRandomKey(arena);
+		ValueRef value = RandomTestImpl::getRandomValue(arena);
+		writes.mutate(key, MutationRef::SetValue, value, true);
+		expected[key] = value;
+	}
+
+	WriteMap::iterator treeIt(&writes); // the first read after a mutation always walks the tree
+	ASSERT(!treeIt.usesFlatSnapshot());
+	WriteMap::iterator flatIt(&writes); // the second read flattens
+	ASSERT(flatIt.usesFlatSnapshot());
+
+	// Both iterators yield the same segments, and the operations match the writes
+	treeIt.skip(allKeys.begin);
+	flatIt.skip(allKeys.begin);
+	auto e = expected.begin();
+	while (flatIt.beginKey() < allKeys.end) {
+		ASSERT(treeIt.beginKey() == flatIt.beginKey());
+		ASSERT(treeIt.endKey() == flatIt.endKey());
+		ASSERT(treeIt.type() == flatIt.type());
+		if (flatIt.is_operation()) {
+			ASSERT(e != expected.end());
+			ASSERT(flatIt.beginKey() == e->first);
+			ASSERT(flatIt.op().top().value.get() == e->second);
+			++e;
+		}
+		++treeIt;
+		++flatIt;
+	}
+	ASSERT(e == expected.end());
+
+	// Random skips land on the same segment through both paths, and stepping back agrees too
+	for (int i = 0; i < 100; i++) {
+		KeyRef key = RandomTestImpl::getRandomKey(arena);
+		treeIt.skip(key);
+		flatIt.skip(key);
+		ASSERT(treeIt.beginKey() == flatIt.beginKey());
+		ASSERT(treeIt.endKey() == flatIt.endKey());
+		ASSERT(treeIt.type() == flatIt.type());
+		if (treeIt.beginKey() > allKeys.begin) {
+			--treeIt;
+			--flatIt;
+			ASSERT(treeIt.beginKey() == flatIt.beginKey());
+			ASSERT(treeIt.endKey() == flatIt.endKey());
+		}
+	}
+
+	// The next mutation invalidates the snapshot
+	writes.mutate(RandomTestImpl::getRandomKey(arena), MutationRef::SetValue, "x"_sr, true);
+	WriteMap::iterator afterIt(&writes);
+	ASSERT(!afterIt.usesFlatSnapshot());
+
+	return Void();
+}
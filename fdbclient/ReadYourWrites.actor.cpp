@@ -55,8 +55,12 @@ public:
 	}
 
 	struct GetValueReq {
-		explicit GetValueReq(Key key) : key(key) {}
+		GetValueReq(Key key, Snapshot snapshot) : key(key), snapshot(snapshot) {}
 		Key key;
+		// Whether the application asked for a snapshot read. The native read is always issued as a snapshot
+		// read regardless, with conflict ranges managed at this layer, so this is the flag that decides
+		// whether the cross-transaction read cache may serve the read.
+		Snapshot snapshot;
 		typedef Optional<Value> Result;
 	};
 
@@ -111,7 +115,20 @@ public:
 		} else if (it->is_empty_range()) {
 			return Optional<Value>();
 		} else {
-			Optional<Value> res = wait(ryw->tr.get(read.key, Snapshot::True));
+			// Snapshot point reads in a declared stale-tolerant range can be served from the cross-transaction
+			// read cache. Hits are returned without entering the RYW snapshot cache so that a later serializable
+			// read of the same key fetches at the real read version, which its conflict range is validated
+			// against. Serializable and dependent reads bypass the cache entirely (UseReadCache::False below).
+			if (read.snapshot && !dependent && !ryw->tr.trState->hasTenant() &&
+			    ryw->getDatabase()->canServeFromReadCache(read.key)) {
+				Optional<Optional<Value>> cached = ryw->getDatabase()->readCache.get(read.key);
+				if (cached.present()) {
+					++ryw->getDatabase()->transactionReadCacheHits;
+					return cached.get();
+				}
+			}
+			Optional<Value> res =
+			    wait(ryw->tr.get(read.key, Snapshot::True, UseReadCache(read.snapshot && !dependent)));
 			KeyRef k(ryw->arena, read.key);
 
 			if (res.present()) {
@@ -1184,7 +1201,7 @@ public:
 				it.skip(getValue.key);
 				// The result is not used in GetValueReq variation of addConflictRange. Let's just pass in a
 				// placeholder.
-				addConflictRange<true>(ryw, GetValueReq(getValue.key), it, Optional<Value>());
+				addConflictRange<true>(ryw, GetValueReq(getValue.key, Snapshot::False), it, Optional<Value>());
 			} else if (std::holds_alternative<GetRangeReqAndResultRef>(reqAndResult)) {
 				auto getRange = std::get<GetRangeReqAndResultRef>(reqAndResult);
 				// We only support forward scan for secondary getRange requests.
@@ -1297,7 +1314,7 @@ public:
 
 		if (!ryw->options.readYourWritesDisabled) {
 			ryw->watchMap[key].push_back(watch);
-			val = readWithConflictRange(ryw, GetValueReq(key), Snapshot::False);
+			val = readWithConflictRange(ryw, GetValueReq(key, Snapshot::False), Snapshot::False);
 		} else {
 			ryw->approximateSize += 2 * key.expectedSize() + 1;
 			val = ryw->tr.get(key);
@@ -1693,7 +1710,8 @@ Future<Optional<Value>> ReadYourWritesTransaction::get(const Key& key, Snapshot
 		return Optional<Value>();
 	}
 
-	Future<Optional<Value>> result = RYWImpl::readWithConflictRange(this, RYWImpl::GetValueReq(key), snapshot);
+	Future<Optional<Value>> result =
+	    RYWImpl::readWithConflictRange(this, RYWImpl::GetValueReq(key, snapshot), snapshot);
 	reading.add(success(result));
 	return result;
 }
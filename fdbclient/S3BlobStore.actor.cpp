@@ -90,6 +90,7 @@ S3BlobStoreEndpoint::BlobKnobs::BlobKnobs() {
 	delete_requests_per_second = CLIENT_KNOBS->BLOBSTORE_DELETE_REQUESTS_PER_SECOND;
 	multipart_max_part_size = CLIENT_KNOBS->BLOBSTORE_MULTIPART_MAX_PART_SIZE;
 	multipart_min_part_size = CLIENT_KNOBS->BLOBSTORE_MULTIPART_MIN_PART_SIZE;
+	multipart_part_target_seconds = CLIENT_KNOBS->BLOBSTORE_MULTIPART_PART_TARGET_SECONDS;
 	concurrent_uploads = CLIENT_KNOBS->BLOBSTORE_CONCURRENT_UPLOADS;
 	concurrent_lists = CLIENT_KNOBS->BLOBSTORE_CONCURRENT_LISTS;
 	concurrent_reads_per_file = CLIENT_KNOBS->BLOBSTORE_CONCURRENT_READS_PER_FILE;
@@ -129,6 +130,7 @@ bool S3BlobStoreEndpoint::BlobKnobs::set(StringRef name, int value) {
 	TRY_PARAM(concurrent_requests, cr);
 	TRY_PARAM(multipart_max_part_size, maxps);
 	TRY_PARAM(multipart_min_part_size, minps);
+	TRY_PARAM(multipart_part_target_seconds, mpts);
 	TRY_PARAM(concurrent_uploads, cu);
 	TRY_PARAM(concurrent_lists, cl);
 	TRY_PARAM(concurrent_reads_per_file, crpf);
@@ -168,6 +170,7 @@ std::string S3BlobStoreEndpoint::BlobKnobs::getURLParameters() const {
 	_CHECK_PARAM(concurrent_requests, cr);
 	_CHECK_PARAM(multipart_max_part_size, maxps);
 	_CHECK_PARAM(multipart_min_part_size, minps);
+	_CHECK_PARAM(multipart_part_target_seconds, mpts);
 	_CHECK_PARAM(concurrent_uploads, cu);
 	_CHECK_PARAM(concurrent_lists, cl);
 	_CHECK_PARAM(concurrent_reads_per_file, crpf);
@@ -479,6 +482,75 @@ Future<Void> S3BlobStoreEndpoint::deleteObject(std::string const& bucket, std::s
 	return deleteObject_impl(Reference<S3BlobStoreEndpoint>::addRef(this), bucket, object);
 }
 
+// Escape the characters which are special in XML element content, for object keys embedded in a bulk
+// delete request body.
+static std::string xmlEncodeKey(const std::string& key) {
+	std::string out;
+	out.reserve(key.size());
+	for (char c : key) {
+		if (c == '&')
+			out += "&amp;";
+		else if (c == '<')
+			out += "&lt;";
+		else if (c == '>')
+			out += "&gt;";
+		else
+			out += c;
+	}
+	return out;
+}
+
+ACTOR Future<Void> deleteObjects_impl(Reference<S3BlobStoreEndpoint> b,
+                                      std::string bucket,
+                                      std::vector<std::string> objects) {
+	state UnsentPacketQueue body; // NonCopyable state var so must be declared at top of actor
+	if (objects.empty())
+		return Void();
+	wait(b->requestRateDelete->getAllowance(objects.size()));
+
+	std::string manifest = "<Delete><Quiet>true</Quiet>";
+	for (auto& object : objects)
+		manifest += format("<Object><Key>%s</Key></Object>\n", xmlEncodeKey(object).c_str());
+	manifest += "</Delete>";
+
+	// The bulk delete API requires a Content-MD5 header over the request body.
+	MD5_CTX sum;
+	::MD5_Init(&sum);
+	::MD5_Update(&sum, manifest.data(), manifest.size());
+	std::string sumBytes;
+	sumBytes.resize(16);
+	::MD5_Final((unsigned char*)sumBytes.data(), &sum);
+	std::string contentMD5 = base64::encoder::from_string(sumBytes);
+	contentMD5.resize(contentMD5.size() - 1);
+
+	std::string resource = constructResourcePath(b, bucket, "");
+	resource += "?delete";
+	HTTP::Headers headers;
+	headers["Content-MD5"] = contentMD5;
+	PacketWriter pw(body.getWriteBuffer(manifest.size()), nullptr, Unversioned());
+	pw.serializeBytes(manifest);
+	Reference<HTTP::Response> r = wait(b->doRequest("POST", resource, headers, &body, manifest.size(), { 200 }));
+
+	// In quiet mode a 200 response body only lists keys whose deletion failed, so the presence of any
+	// Error element means part of the batch was not deleted.  Missing keys are reported as deleted, which
+	// matches the single object delete behavior above.
+	if (r->content.find("<Error>") != std::string::npos) {
+		TraceEvent(SevWarnAlways, "S3BlobStoreEndpointDeleteObjectsError")
+		    .suppressFor(60)
+		    .detail("Host", b->host)
+		    .detail("Bucket", bucket)
+		    .detail("NumObjects", objects.size())
+		    .detail("Response", r->content.substr(0, 1000));
+		throw http_request_failed();
+	}
+
+	return Void();
+}
+
+Future<Void> S3BlobStoreEndpoint::deleteObjects(std::string const& bucket, std::vector<std::string> const& objects) {
+	return deleteObjects_impl(Reference<S3BlobStoreEndpoint>::addRef(this), bucket, objects);
+}
+
 ACTOR Future<Void> deleteRecursively_impl(Reference<S3BlobStoreEndpoint> b,
                                           std::string bucket,
                                           std::string prefix,
@@ -512,7 +512,31 @@ const KeyRef JSONSchemas::statusSchema = R"statusSchema(
          "immediate_priority_transaction_start_seconds":0.0,
          "batch_priority_transaction_start_seconds":0.0,
          "transaction_start_seconds":0.0,
-         "commit_seconds":0.02
+         "commit_seconds":0.02,
+         "continuous":{
+            "window_seconds":0.0,
+            "transaction_start":{
+               "count":0,
+               "p50_seconds":0.0,
+               "p95_seconds":0.0,
+               "p99_seconds":0.0,
+               "max_seconds":0.0
+            },
+            "read":{
+               "count":0,
+               "p50_seconds":0.0,
+               "p95_seconds":0.0,
+               "p99_seconds":0.0,
+               "max_seconds":0.0
+            },
+            "commit":{
+               "count":0,
+               "p50_seconds":0.0,
+               "p95_seconds":0.0,
+               "p99_seconds":0.0,
+               "max_seconds":0.0
+            }
+         }
       },
       "clients":{
          "count":1,
@@ -73,12 +73,16 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( PEEK_TRACKER_EXPIRATION_TIME,                          600 ); if( randomize && BUGGIFY ) PEEK_TRACKER_EXPIRATION_TIME = 120; // Cannot be buggified lower without changing the following assert in LogSystemPeekCursor.actor.cpp: ASSERT_WE_THINK(e.code() == error_code_operation_obsolete || SERVER_KNOBS->PEEK_TRACKER_EXPIRATION_TIME < 10);
 	init( PEEK_USING_STREAMING,                                false ); if( randomize && isSimulated && BUGGIFY ) PEEK_USING_STREAMING = true;
 	init( PARALLEL_GET_MORE_REQUESTS,                             32 ); if( randomize && BUGGIFY ) PARALLEL_GET_MORE_REQUESTS = 2;
+	init( PARALLEL_PEEK_WINDOW_BYTES,                              0 ); if( randomize && BUGGIFY ) PARALLEL_PEEK_WINDOW_BYTES = 2e6;
+	init( PARALLEL_PEEK_MAX_REQUESTS,                            128 ); if( randomize && BUGGIFY ) PARALLEL_PEEK_MAX_REQUESTS = 4;
 	init( MULTI_CURSOR_PRE_FETCH_LIMIT,                           10 );
+	init( MERGED_PEEK_PARALLEL_PREFETCH,                        true ); if( randomize && BUGGIFY ) MERGED_PEEK_PARALLEL_PREFETCH = false;
 	init( MAX_QUEUE_COMMIT_BYTES,                               15e6 ); if( randomize && BUGGIFY ) MAX_QUEUE_COMMIT_BYTES = 5000;
 	init( DESIRED_OUTSTANDING_MESSAGES,                         5000 ); if( randomize && BUGGIFY ) DESIRED_OUTSTANDING_MESSAGES = deterministicRandom()->randomInt(0,100);
 	init( DESIRED_GET_MORE_DELAY,                              0.005 );
 	init( CONCURRENT_LOG_ROUTER_READS,                             5 ); if( randomize && BUGGIFY ) CONCURRENT_LOG_ROUTER_READS = 1;
 	init( LOG_ROUTER_PEEK_FROM_SATELLITES_PREFERRED,               1 ); if( randomize && BUGGIFY ) LOG_ROUTER_PEEK_FROM_SATELLITES_PREFERRED = 0;
+	init( LOG_ROUTER_POP_FROM_LOG_DELAY,                           0 ); if( randomize && BUGGIFY ) LOG_ROUTER_POP_FROM_LOG_DELAY = 0.05;
 	init( DISK_QUEUE_ADAPTER_MIN_SWITCH_TIME,                    1.0 );
 	init( DISK_QUEUE_ADAPTER_MAX_SWITCH_TIME,                    5.0 );
 	init( TLOG_SPILL_REFERENCE_MAX_PEEK_MEMORY_BYTES,            2e9 ); if ( randomize && BUGGIFY ) TLOG_SPILL_REFERENCE_MAX_PEEK_MEMORY_BYTES = 2e6;
@@ -117,6 +121,9 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( PEEK_BATCHING_EMPTY_MSG_INTERVAL,                    0.001 ); if ( randomize && BUGGIFY ) PEEK_BATCHING_EMPTY_MSG_INTERVAL = 0.01;
 	init( POP_FROM_LOG_DELAY,                                      1 ); if ( randomize && BUGGIFY ) POP_FROM_LOG_DELAY = 0;
 	init( TLOG_PULL_ASYNC_DATA_WARNING_TIMEOUT_SECS,             120 );
+	init( ENABLE_TLOG_PEEK_COMPRESSION,                        false ); if ( randomize && BUGGIFY ) ENABLE_TLOG_PEEK_COMPRESSION = true;
+	init( TLOG_PEEK_COMPRESSION_FILTER,                       "ZSTD" );
+	init( TLOG_PEEK_COMPRESSION_MIN_BYTES,                      4096 ); if ( randomize && BUGGIFY ) TLOG_PEEK_COMPRESSION_MIN_BYTES = deterministicRandom()->randomInt(0, 1000);
 
 	// disk snapshot max timeout, to be put in TLog, storage and coordinator nodes
 	init( MAX_FORKED_PROCESS_OUTPUT,                            1024 );
@@ -139,6 +146,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( DD_QUEUE_COUNTER_MAX_LOG,                              100 ); if( randomize && BUGGIFY ) DD_QUEUE_COUNTER_MAX_LOG = 1;
 	init( DD_QUEUE_COUNTER_SUMMARIZE,                           true );
 	init( RELOCATION_PARALLELISM_PER_SOURCE_SERVER,                2 ); if( randomize && BUGGIFY ) RELOCATION_PARALLELISM_PER_SOURCE_SERVER = 1;
+	init( RELOCATION_FETCH_BYTES_PER_SOURCE_SERVER,            500e6 ); if( randomize && BUGGIFY ) RELOCATION_FETCH_BYTES_PER_SOURCE_SERVER = deterministicRandom()->randomInt64( 1e5, 1e6 );
 	init( RELOCATION_PARALLELISM_PER_DEST_SERVER,                 10 ); if( randomize && BUGGIFY ) RELOCATION_PARALLELISM_PER_DEST_SERVER = 1; // Note: if this is smaller than FETCH_KEYS_PARALLELISM, this will artificially reduce performance. The current default of 10 is probably too high but is set conservatively for now.
 	init( DD_QUEUE_MAX_KEY_SERVERS,                              100 ); // Do not buggify
 	init( DD_REBALANCE_PARALLELISM,                               50 );
@@ -209,6 +217,10 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 		Shard with a read bandwidth smaller than this value will never be too busy to handle the reads.
 	*/
 	init( SHARD_MAX_BYTES_READ_PER_KSEC_JITTER,     0.1 );
+	init( DD_AUTO_STORAGE_CACHE,                  false ); if( randomize && BUGGIFY ) DD_AUTO_STORAGE_CACHE = true;
+	init( DD_AUTO_STORAGE_CACHE_PROMOTE_DELAY,    120.0 ); if( randomize && BUGGIFY ) DD_AUTO_STORAGE_CACHE_PROMOTE_DELAY = 5.0;
+	init( DD_AUTO_STORAGE_CACHE_DEMOTE_DELAY,     600.0 ); if( randomize && BUGGIFY ) DD_AUTO_STORAGE_CACHE_DEMOTE_DELAY = 30.0;
+	init( DD_AUTO_STORAGE_CACHE_BYTE_BUDGET,      250e6 );
 	bool buggifySmallBandwidthSplit = randomize && BUGGIFY;
 	init( SHARD_MAX_BYTES_PER_KSEC,                 1LL*1000000*1000 ); if( buggifySmallBandwidthSplit ) SHARD_MAX_BYTES_PER_KSEC = 10LL*1000*1000;
 	/* 1*1MB/sec * 1000sec/ksec
@@ -281,6 +293,8 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( MAX_TEAMS_PER_SERVER,           5*DESIRED_TEAMS_PER_SERVER );
 	init( DD_SHARD_SIZE_GRANULARITY,                         5000000 );
 	init( DD_SHARD_SIZE_GRANULARITY_SIM,                      500000 ); if( randomize && BUGGIFY ) DD_SHARD_SIZE_GRANULARITY_SIM = 0;
+	init( DD_TRACKER_ON_DEMAND_EVALUATORS,                      true ); if( randomize && BUGGIFY ) DD_TRACKER_ON_DEMAND_EVALUATORS = false;
+	init( DD_TRACKER_EVALUATOR_ACTIVATION_FACTOR,                1.2 ); if( randomize && BUGGIFY ) DD_TRACKER_EVALUATOR_ACTIVATION_FACTOR = 1.0 + deterministicRandom()->random01();
 	init( DD_MOVE_KEYS_PARALLELISM,                               15 ); if( randomize && BUGGIFY ) DD_MOVE_KEYS_PARALLELISM = 1;
 	init( DD_FETCH_SOURCE_PARALLELISM,                          1000 ); if( randomize && BUGGIFY ) DD_FETCH_SOURCE_PARALLELISM = 1;
 	init( DD_MERGE_LIMIT,                                       2000 ); if( randomize && BUGGIFY ) DD_MERGE_LIMIT = 2;
@@ -293,6 +307,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( REMOTE_KV_STORE,                                     false );
 	init( REBOOT_KV_STORE_DELAY,                                 0.1 );
 	init( REMOTE_KV_STORE_MAX_INIT_DURATION,                    10.0 );
+	init( REMOTE_KV_STORE_MUTATION_BATCH_BYTES,                65536 ); if( randomize && BUGGIFY ) REMOTE_KV_STORE_MUTATION_BATCH_BYTES = deterministicRandom()->coinflip() ? 0 : 100;
 	init( REBALANCE_MAX_RETRIES,                                 100 );
 	init( DD_OVERLAP_PENALTY,                                  10000 );
 	init( DD_EXCLUDE_MIN_REPLICAS,                                 1 );
@@ -316,6 +331,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( TENANT_CACHE_STORAGE_USAGE_TRACE_INTERVAL,             300 );
 	init( CP_FETCH_TENANTS_OVER_STORAGE_QUOTA_INTERVAL,            5 ); if( randomize && BUGGIFY ) CP_FETCH_TENANTS_OVER_STORAGE_QUOTA_INTERVAL = deterministicRandom()->randomInt(1, 10);
 	init( DD_BUILD_EXTRA_TEAMS_OVERRIDE,                          10 ); if( randomize && BUGGIFY ) DD_BUILD_EXTRA_TEAMS_OVERRIDE = 2;
+	init( DD_BUILD_TEAMS_BATCH_SIZE,                              64 ); if( randomize && BUGGIFY ) DD_BUILD_TEAMS_BATCH_SIZE = deterministicRandom()->randomInt(1, 4);
 
 	// TeamRemover
 	init( TR_FLAG_DISABLE_MACHINE_TEAM_REMOVER,                false ); if( randomize && BUGGIFY ) TR_FLAG_DISABLE_MACHINE_TEAM_REMOVER = deterministicRandom()->random01() < 0.1 ? true : false; // false by default. disable the consistency check when it's true
@@ -327,6 +343,9 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 
 	init( DD_REMOVE_STORE_ENGINE_DELAY,                         60.0 ); if( randomize && BUGGIFY ) DD_REMOVE_STORE_ENGINE_DELAY =  deterministicRandom()->random01() * 60.0;
 
+	// IKeyValueStore
+	init( KVSTORE_OP_TRACE_DIR,                                   "" );
+
 	// KeyValueStore SQLITE
 	init( CLEAR_BUFFER_SIZE,                                   20000 );
 	init( READ_VALUE_TIME_ESTIMATE,                           .00005 );
@@ -424,11 +443,14 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( ROCKSDB_READ_CHECKPOINT_TIMEOUT,                      60.0 ); if (isSimulated) ROCKSDB_READ_CHECKPOINT_TIMEOUT = 5 * 60;
 	init( ROCKSDB_CHECKPOINT_READ_AHEAD_SIZE,           2 << 20 ); // 2M
 	init( ROCKSDB_READ_QUEUE_WAIT,                               1.0 );
+	init( ROCKSDB_INLINE_BLOCK_CACHE_READS,                    false ); if( randomize && BUGGIFY ) ROCKSDB_INLINE_BLOCK_CACHE_READS = deterministicRandom()->coinflip();
+	init( ROCKSDB_MULTIGET_BATCH_SIZE,                            16 ); if( randomize && BUGGIFY ) ROCKSDB_MULTIGET_BATCH_SIZE = deterministicRandom()->randomInt(0, 64);
 	init( ROCKSDB_READ_QUEUE_HARD_MAX,                          1000 );
 	init( ROCKSDB_READ_QUEUE_SOFT_MAX,                           500 );
 	init( ROCKSDB_FETCH_QUEUE_HARD_MAX,                          100 );
 	init( ROCKSDB_FETCH_QUEUE_SOFT_MAX,                           50 );
 	init( ROCKSDB_HISTOGRAMS_SAMPLE_RATE,                      0.001 ); if( randomize && BUGGIFY ) ROCKSDB_HISTOGRAMS_SAMPLE_RATE = 0;
+	init( ROCKSDB_READ_RANGE_PARALLEL_SHARDS,                      4 ); if( randomize && BUGGIFY ) ROCKSDB_READ_RANGE_PARALLEL_SHARDS = deterministicRandom()->randomInt(1, 5);
 	init( ROCKSDB_READ_RANGE_ITERATOR_REFRESH_TIME,             30.0 ); if( randomize && BUGGIFY ) ROCKSDB_READ_RANGE_ITERATOR_REFRESH_TIME = 0.1;
 	init( ROCKSDB_READ_RANGE_REUSE_ITERATORS,                   true ); if( randomize && BUGGIFY ) ROCKSDB_READ_RANGE_REUSE_ITERATORS = deterministicRandom()->coinflip();
 	init( ROCKSDB_READ_RANGE_REUSE_BOUNDED_ITERATORS,          false ); if( randomize && BUGGIFY ) ROCKSDB_READ_RANGE_REUSE_BOUNDED_ITERATORS = deterministicRandom()->coinflip();
@@ -497,6 +519,10 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( START_TRANSACTION_BATCH_INTERVAL_MAX,                0.010 );
 	init( START_TRANSACTION_BATCH_INTERVAL_LATENCY_FRACTION,     0.5 );
 	init( START_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA,       0.1 );
+	init( GRV_LATENCY_TARGET_P99_DEFAULT,                        0.0 ); if( randomize && BUGGIFY ) GRV_LATENCY_TARGET_P99_DEFAULT = 0.05;
+	init( GRV_LATENCY_TARGET_P99_BATCH,                          0.0 ); if( randomize && BUGGIFY ) GRV_LATENCY_TARGET_P99_BATCH = 0.2;
+	init( GRV_LATENCY_TARGET_ADJUSTMENT_INTERVAL,                1.0 ); if( randomize && BUGGIFY ) GRV_LATENCY_TARGET_ADJUSTMENT_INTERVAL = 0.1;
+	init( GRV_LATENCY_TARGET_ADJUSTMENT_RATE,                   1.25 );
 	init( START_TRANSACTION_BATCH_QUEUE_CHECK_INTERVAL,        0.001 );
 	init( START_TRANSACTION_MAX_TRANSACTIONS_TO_START,        100000 );
 	init( START_TRANSACTION_MAX_REQUESTS_TO_START,             10000 );
@@ -526,6 +552,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( COMMIT_TRANSACTION_BATCH_BYTES_SCALE_POWER,             0.0 );
 
 	init( RESOLVER_COALESCE_TIME,                                1.0 );
+	init( RESOLVER_CONFLICT_SET_SHARDS,                            1 ); if( randomize && BUGGIFY ) RESOLVER_CONFLICT_SET_SHARDS = deterministicRandom()->randomInt(2, 9);
 	init( BUGGIFIED_ROW_LIMIT,                  APPLY_MUTATION_BYTES ); if( randomize && BUGGIFY ) BUGGIFIED_ROW_LIMIT = deterministicRandom()->randomInt(3, 30);
 	init( PROXY_SPIN_DELAY,                                     0.01 );
 	init( UPDATE_REMOTE_LOG_VERSION_INTERVAL,                    2.0 );
@@ -542,9 +569,11 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( MAX_COMPUTE_DURATION_LOG_CUTOFF,                       0.05 );
 	init( PROXY_COMPUTE_BUCKETS,                                20000 );
 	init( PROXY_COMPUTE_GROWTH_RATE,                             0.01 );
+	init( PROXY_PUSH_BUFFER_RESERVE_MAX_BYTES,                2 << 20 ); if( randomize && BUGGIFY ) PROXY_PUSH_BUFFER_RESERVE_MAX_BYTES = deterministicRandom()->randomInt(0, 4096);
 	init( TXN_STATE_SEND_AMOUNT,                                    4 );
 	init( REPORT_TRANSACTION_COST_ESTIMATION_DELAY,               0.1 );
 	init( PROXY_REJECT_BATCH_QUEUED_TOO_LONG,                    true );
+	init( PROXY_MAX_IN_FLIGHT_COMMIT_BATCHES,                     128 ); if( randomize && BUGGIFY ) PROXY_MAX_IN_FLIGHT_COMMIT_BATCHES = deterministicRandom()->randomInt(2, 10);
 
 	bool buggfyUseResolverPrivateMutations = randomize && BUGGIFY && !ENABLE_VERSION_VECTOR_TLOG_UNICAST;
 	init( PROXY_USE_RESOLVER_PRIVATE_MUTATIONS,                 false ); if( buggfyUseResolverPrivateMutations ) PROXY_USE_RESOLVER_PRIVATE_MUTATIONS = deterministicRandom()->coinflip();
@@ -569,6 +598,8 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( KEY_BYTES_PER_SAMPLE,                                  2e4 ); if( fastBalancing ) KEY_BYTES_PER_SAMPLE = 1e3;
 	init( MIN_BALANCE_TIME,                                      0.2 );
 	init( MIN_BALANCE_DIFFERENCE,                                1e6 ); if( fastBalancing ) MIN_BALANCE_DIFFERENCE = 1e4;
+	init( RESOLUTION_BALANCE_FRACTION,                           0.1 ); if( fastBalancing ) RESOLUTION_BALANCE_FRACTION = 0.0;
+	init( RESOLUTION_BALANCE_HYSTERESIS_POLLS,                     3 ); if( fastBalancing ) RESOLUTION_BALANCE_HYSTERESIS_POLLS = 1;
 	init( SECONDS_BEFORE_NO_FAILURE_DELAY,                  8 * 3600 );
 	init( MAX_TXS_SEND_MEMORY,                                   1e7 ); if( randomize && BUGGIFY ) MAX_TXS_SEND_MEMORY = 1e5;
 	init( MAX_RECOVERY_VERSIONS,           200 * VERSIONS_PER_SECOND );
@@ -590,6 +621,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( BACKUP_TIMEOUT,                                        0.4 );
 	init( BACKUP_NOOP_POP_DELAY,                                 5.0 );
 	init( BACKUP_FILE_BLOCK_BYTES,                       1024 * 1024 );
+	init( BACKUP_WORKER_COMPRESS_LOGS,                         false ); if( randomize && BUGGIFY ) BACKUP_WORKER_COMPRESS_LOGS = true;
 	init( BACKUP_LOCK_BYTES,                                     3e9 ); if(randomize && BUGGIFY) BACKUP_LOCK_BYTES = deterministicRandom()->randomInt(1024, 4096) * 256 * 1024;
 	init( BACKUP_UPLOAD_DELAY,                                  10.0 ); if(randomize && BUGGIFY) BACKUP_UPLOAD_DELAY = deterministicRandom()->random01() * 60;
 
@@ -614,6 +646,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( WAIT_FOR_ENCRYPT_KEY_PROXY_JOIN_DELAY,                 1.0 );
 	init( WORKER_FAILURE_TIME,                                   1.0 ); if( randomize && BUGGIFY ) WORKER_FAILURE_TIME = 10.0;
 	init( CHECK_OUTSTANDING_INTERVAL,                            0.5 ); if( randomize && BUGGIFY ) CHECK_OUTSTANDING_INTERVAL = 0.001;
+	init( CC_COORDINATOR_RESOLVE_CACHE_TTL,                     10.0 ); if( randomize && BUGGIFY ) CC_COORDINATOR_RESOLVE_CACHE_TTL = 0.0;
 	init( VERSION_LAG_METRIC_INTERVAL,                           0.5 ); if( randomize && BUGGIFY ) VERSION_LAG_METRIC_INTERVAL = 10.0;
 	init( MAX_VERSION_DIFFERENCE,           20 * VERSIONS_PER_SECOND );
 	init( INITIAL_UPDATE_CROSS_DC_INFO_DELAY,                    300 );
@@ -621,6 +654,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( FORCE_RECOVERY_CHECK_DELAY,                            5.0 );
 	init( RATEKEEPER_FAILURE_TIME,                               1.0 );
 	init( CONSISTENCYSCAN_FAILURE_TIME,                          1.0 );
+	init( CONSISTENCY_SCAN_CHECKSUM_ONLY,                       true ); if( randomize && BUGGIFY ) CONSISTENCY_SCAN_CHECKSUM_ONLY = false;
 	init( BLOB_MANAGER_FAILURE_TIME,                             1.0 );
 	init( BLOB_MIGRATOR_FAILURE_TIME,                            1.0 );
 	init( REPLACE_INTERFACE_DELAY,                              60.0 );
@@ -658,6 +692,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( POLICY_GENERATIONS,                                    100 ); if( randomize && BUGGIFY ) POLICY_GENERATIONS = 10;
 	init( DBINFO_SEND_AMOUNT,                                      5 );
 	init( DBINFO_BATCH_DELAY,                                    0.1 );
+	init( DBINFO_BATCH_NOTIFICATIONS,                           true ); if( randomize && BUGGIFY ) DBINFO_BATCH_NOTIFICATIONS = false;
 	init( SINGLETON_RECRUIT_BME_DELAY,                          10.0 );
 
 	//Move Keys
@@ -684,6 +719,8 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	//Ratekeeper
 	bool slowRatekeeper = randomize && BUGGIFY;
 	init( SMOOTHING_AMOUNT,                                      1.0 ); if( slowRatekeeper ) SMOOTHING_AMOUNT = 5.0;
+	init( RK_PREDICTION_HORIZON,                                10.0 ); if( randomize && BUGGIFY ) RK_PREDICTION_HORIZON = deterministicRandom()->random01() * 30.0;
+	init( RK_PREDICTION_MAX_RATE_RATIO,                          1.0 );
 	init( SLOW_SMOOTHING_AMOUNT,                                10.0 ); if( slowRatekeeper ) SLOW_SMOOTHING_AMOUNT = 50.0;
 	init( METRIC_UPDATE_RATE,                                     .1 ); if( slowRatekeeper ) METRIC_UPDATE_RATE = 0.5;
 	init( DETAILED_METRIC_UPDATE_RATE,                           5.0 );
@@ -774,6 +811,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( TAG_THROTTLE_EXPIRED_CLEANUP_INTERVAL,                30.0 ); if(randomize && BUGGIFY) TAG_THROTTLE_EXPIRED_CLEANUP_INTERVAL = 1.0;
 	init( AUTO_TAG_THROTTLING_ENABLED,                          true ); if(randomize && BUGGIFY) AUTO_TAG_THROTTLING_ENABLED = false;
 	init( SS_THROTTLE_TAGS_TRACKED,                                1 ); if(randomize && BUGGIFY) SS_THROTTLE_TAGS_TRACKED = deterministicRandom()->randomInt(1, 10);
+	init( SS_THROTTLE_TAG_SKETCH_SIZE,                            64 ); if(randomize && BUGGIFY) SS_THROTTLE_TAG_SKETCH_SIZE = deterministicRandom()->randomInt(1, 8);
 	init( GLOBAL_TAG_THROTTLING,                                true ); if(isSimulated) GLOBAL_TAG_THROTTLING = deterministicRandom()->coinflip();
 	init( ENFORCE_TAG_THROTTLING_ON_PROXIES,   GLOBAL_TAG_THROTTLING );
 	init( GLOBAL_TAG_THROTTLING_MIN_RATE,                        1.0 );
@@ -795,6 +833,8 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( SPLIT_JITTER_AMOUNT,                                  0.05 ); if( randomize && BUGGIFY ) SPLIT_JITTER_AMOUNT = 0.2;
 	init( IOPS_UNITS_PER_SAMPLE,                                10000 * 1000 / STORAGE_METRICS_AVERAGE_INTERVAL_PER_KSECONDS / 100 );
 	init( BYTES_WRITTEN_UNITS_PER_SAMPLE,                           SHARD_MIN_BYTES_PER_KSEC / STORAGE_METRICS_AVERAGE_INTERVAL_PER_KSECONDS / 25 );
+	init( BYTES_WRITTEN_SAMPLE_TARGET_ENTRIES,                 25000 ); if( randomize && BUGGIFY ) BYTES_WRITTEN_SAMPLE_TARGET_ENTRIES = deterministicRandom()->randomInt( 2, 100 );
+	init( TRANSIENT_SAMPLE_MAX_DENSITY_FACTOR,                  16.0 ); if( randomize && BUGGIFY ) TRANSIENT_SAMPLE_MAX_DENSITY_FACTOR = deterministicRandom()->random01() * 32;
 	init( BYTES_READ_UNITS_PER_SAMPLE,                          100000 ); // 100K bytes
 	init( OPS_READ_UNITES_PER_SAMPLE, 100 * STORAGE_METRICS_AVERAGE_INTERVAL ); // during a sampling interval, in average every 100 op being sampled once
 	init( READ_HOT_SUB_RANGE_CHUNK_SIZE,                        10000000); // 10MB
@@ -810,10 +850,27 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( BUGGIFY_LIMIT_BYTES,                                  1000 );
 	init( FETCH_USING_STREAMING,                               false ); if( randomize && isSimulated && BUGGIFY ) FETCH_USING_STREAMING = true; //Determines if fetch keys uses streaming reads
 	init( FETCH_USING_BLOB,                                    false );
+	init( FETCH_USING_CHECKPOINT,                              false ); // EXPERIMENTAL; Requires SHARD_ENCODE_LOCATION_METADATA and ssd-sharded-rocksdb
+	init( FETCH_USING_CHECKPOINT_MIN_BYTES,                    500e6 ); if( randomize && BUGGIFY ) FETCH_USING_CHECKPOINT_MIN_BYTES = 0;
 	init( FETCH_BLOCK_BYTES,                                     2e6 );
+	init( FETCH_KEYS_DURABLE_CHECKPOINT_BYTES,                 250e6 ); if( randomize && BUGGIFY ) FETCH_KEYS_DURABLE_CHECKPOINT_BYTES = deterministicRandom()->randomInt64( 1, 1e6 );
 	init( FETCH_KEYS_PARALLELISM_BYTES,                          4e6 ); if( randomize && BUGGIFY ) FETCH_KEYS_PARALLELISM_BYTES = 3e6;
 	init( FETCH_KEYS_PARALLELISM,                                  2 );
+	init( SS_PARALLEL_READ_RANGE_ENABLED,                      false ); if( randomize && BUGGIFY ) SS_PARALLEL_READ_RANGE_ENABLED = true;
+	init( SS_HOT_VALUE_CACHE_BYTES,                                0 ); if( randomize && BUGGIFY ) SS_HOT_VALUE_CACHE_BYTES = 100e3; // 0 disables the cache
+	init( SS_VERSION_TRIM_NODES_PER_YIELD,                       100 ); if( randomize && BUGGIFY ) SS_VERSION_TRIM_NODES_PER_YIELD = 5;
+	init( SS_BYTE_SAMPLE_SNAPSHOT_INTERVAL,                        0 ); if( randomize && BUGGIFY ) SS_BYTE_SAMPLE_SNAPSHOT_INTERVAL = 10.0; // seconds; 0 disables snapshotting
+	init( SS_BYTE_SAMPLE_SNAPSHOT_CHUNK_BYTES,                   1e6 ); if( randomize && BUGGIFY ) SS_BYTE_SAMPLE_SNAPSHOT_CHUNK_BYTES = 100;
+	init( SS_BYTE_SAMPLE_SNAPSHOT_MAX_VERSION_LAG,               5e9 ); if( randomize && BUGGIFY ) SS_BYTE_SAMPLE_SNAPSHOT_MAX_VERSION_LAG = 1e6;
+	init( SS_COALESCE_ATOMIC_OPS,                               true ); if( randomize && BUGGIFY ) SS_COALESCE_ATOMIC_OPS = false;
+	init( SS_ZERO_COPY_RANGE_REPLY,                             true ); if( randomize && BUGGIFY ) SS_ZERO_COPY_RANGE_REPLY = false;
+	init( SS_PARALLEL_READ_RANGE_MIN_BYTES,                      1e6 ); if( randomize && BUGGIFY ) SS_PARALLEL_READ_RANGE_MIN_BYTES = 100;
+	init( SS_PARALLEL_READ_RANGE_MAX_SUBRANGES,                    4 ); if( randomize && BUGGIFY ) SS_PARALLEL_READ_RANGE_MAX_SUBRANGES = deterministicRandom()->randomInt(2, 9);
 	init( FETCH_KEYS_PARALLELISM_CHANGE_FEED,                      6 );
+	init( FETCH_KEYS_PARALLEL_SOURCES,                             1 ); if( randomize && BUGGIFY ) FETCH_KEYS_PARALLEL_SOURCES = deterministicRandom()->randomInt(2, 5); // 1 fetches each shard as a single stream
+	init( FETCH_KEYS_PARALLEL_SUBRANGE_BYTES,                   10e6 ); if( randomize && BUGGIFY ) FETCH_KEYS_PARALLEL_SUBRANGE_BYTES = 1000;
+	init( FETCH_KEYS_PARALLEL_BUFFER_BYTES,                      4e6 ); if( randomize && BUGGIFY ) FETCH_KEYS_PARALLEL_BUFFER_BYTES = 10000;
+	init( FETCH_KEYS_PARALLEL_SUBRANGE_RETRIES,                    3 );
 	init( FETCH_KEYS_LOWER_PRIORITY,                               0 );
 	init( SERVE_FETCH_CHECKPOINT_PARALLELISM,                      4 );
 	init( SERVE_AUDIT_STORAGE_PARALLELISM,                         1 );
@@ -858,6 +915,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( QUICK_GET_KEY_VALUES_LIMIT,                           2000 );
 	init( QUICK_GET_KEY_VALUES_LIMIT_BYTES,                      1e7 );
 	init( STORAGE_FEED_QUERY_HARD_LIMIT,                      100000 );
+	init( STORAGE_FEED_DISK_READS_BYPASS_CACHE,                 true ); if ( randomize && BUGGIFY ) STORAGE_FEED_DISK_READS_BYPASS_CACHE = false;
 	// Read priority definitions in the form of a list of their relative concurrency share weights
 	init( STORAGESERVER_READ_PRIORITIES,           "120,10,20,40,60" );
 	// The total concurrency which will be shared by active priorities according to their relative weights
@@ -919,6 +977,15 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	// Status
 	init( STATUS_MIN_TIME_BETWEEN_REQUESTS,                      0.0 );
 	init( MAX_STATUS_REQUESTS_PER_SECOND,                      256.0 );
+	init( LATENCY_PROBE_INTERVAL,                                0.0 ); if( randomize && BUGGIFY ) LATENCY_PROBE_INTERVAL = 1.0; // A value of 0 disables the continuous latency probe
+	init( LATENCY_PROBE_WINDOW,                                300.0 );
+	// Workers refresh the metric trace events behind these sections every SYSTEM_MONITOR_INTERVAL (5s), so
+	// re-gathering them faster than that returns identical data; the TTLs default to just under that interval.
+	init( STATUS_WORKER_EVENTS_TTL,                              4.0 ); if( randomize && BUGGIFY ) STATUS_WORKER_EVENTS_TTL = deterministicRandom()->random01() * 10;
+	init( STATUS_STORAGE_METRICS_TTL,                            4.0 ); if( randomize && BUGGIFY ) STATUS_STORAGE_METRICS_TTL = deterministicRandom()->random01() * 10;
+	init( STATUS_LOG_METRICS_TTL,                                4.0 ); if( randomize && BUGGIFY ) STATUS_LOG_METRICS_TTL = deterministicRandom()->random01() * 10;
+	init( STATUS_PROXY_METRICS_TTL,                              4.0 ); if( randomize && BUGGIFY ) STATUS_PROXY_METRICS_TTL = deterministicRandom()->random01() * 10;
+	init( STATUS_SUMMARY_MAX_AGE,                               15.0 ); if( randomize && BUGGIFY ) STATUS_SUMMARY_MAX_AGE = deterministicRandom()->random01() * 60;
 	init( CONFIGURATION_ROWS_TO_FETCH,                         20000 );
 	init( DISABLE_DUPLICATE_LOG_WARNING,                       false );
 	init( HISTOGRAM_REPORT_INTERVAL,                           300.0 );
@@ -934,8 +1001,10 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( FASTRESTORE_NUM_LOADERS,                                 3 ); if( randomize && BUGGIFY ) { FASTRESTORE_NUM_LOADERS = deterministicRandom()->random01() * 10 + 1; }
 	init( FASTRESTORE_NUM_APPLIERS,                                3 ); if( randomize && BUGGIFY ) { FASTRESTORE_NUM_APPLIERS = deterministicRandom()->random01() * 10 + 1; }
 	init( FASTRESTORE_TXN_BATCH_MAX_BYTES,           1024.0 * 1024.0 ); if( randomize && BUGGIFY ) { FASTRESTORE_TXN_BATCH_MAX_BYTES = deterministicRandom()->random01() * 1024.0 * 1024.0 + 1.0; }
+	init( FASTRESTORE_APPLY_PIPELINES,                            64 ); if( randomize && BUGGIFY ) { FASTRESTORE_APPLY_PIPELINES = deterministicRandom()->random01() * 10 + 1; }
 	init( FASTRESTORE_VERSIONBATCH_MAX_BYTES, 10.0 * 1024.0 * 1024.0 ); if( randomize && BUGGIFY ) { FASTRESTORE_VERSIONBATCH_MAX_BYTES = deterministicRandom()->random01() < 0.2 ? 50 * 1024 : deterministicRandom()->random01() < 0.4 ? 100 * 1024 * 1024 : deterministicRandom()->random01() * 1000.0 * 1024.0 * 1024.0; } // too small value may increase chance of TooManyFile error
 	init( FASTRESTORE_VB_PARALLELISM,                              5 ); if( randomize && BUGGIFY ) { FASTRESTORE_VB_PARALLELISM = deterministicRandom()->random01() < 0.2 ? 2 : deterministicRandom()->random01() * 10 + 1; }
+	init( FASTRESTORE_VB_APPLY_BACKLOG,                            3 ); if( randomize && BUGGIFY ) { FASTRESTORE_VB_APPLY_BACKLOG = deterministicRandom()->random01() < 0.2 ? 0 : deterministicRandom()->random01() * 10 + 1; }
 	init( FASTRESTORE_VB_MONITOR_DELAY,                           30 ); if( randomize && BUGGIFY ) { FASTRESTORE_VB_MONITOR_DELAY = deterministicRandom()->random01() * 20 + 1; }
 	init( FASTRESTORE_VB_LAUNCH_DELAY,                           1.0 ); if( randomize && BUGGIFY ) { FASTRESTORE_VB_LAUNCH_DELAY = deterministicRandom()->random01() < 0.2 ? 0.1 : deterministicRandom()->random01() * 10.0 + 1; }
 	init( FASTRESTORE_ROLE_LOGGING_DELAY,                          5 ); if( randomize && BUGGIFY ) { FASTRESTORE_ROLE_LOGGING_DELAY = deterministicRandom()->random01() * 60 + 1; }
@@ -979,20 +1048,29 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( REDWOOD_DEFAULT_EXTENT_READ_SIZE,              1024 * 1024 );
 	init( REDWOOD_EXTENT_CONCURRENT_READS,                         4 );
 	init( REDWOOD_KVSTORE_RANGE_PREFETCH,                       true );
+	init( REDWOOD_RANGE_PREFETCH_WINDOW_BYTES,               2 << 20 ); if( randomize && BUGGIFY ) { REDWOOD_RANGE_PREFETCH_WINDOW_BYTES = deterministicRandom()->randomInt(4096, 100000); }
 	init( REDWOOD_PAGE_REBUILD_MAX_SLACK,                       0.33 );
 	init( REDWOOD_PAGE_REBUILD_SLACK_DISTRIBUTION,              0.50 );
 	init( REDWOOD_LAZY_CLEAR_BATCH_SIZE_PAGES,                    10 );
 	init( REDWOOD_LAZY_CLEAR_MIN_PAGES,                            0 );
 	init( REDWOOD_LAZY_CLEAR_MAX_PAGES,                          1e6 );
+	init( REDWOOD_LAZY_CLEAR_URGENT_QUEUE_PAGES,                 1e6 ); if( randomize && BUGGIFY ) { REDWOOD_LAZY_CLEAR_URGENT_QUEUE_PAGES = deterministicRandom()->randomInt(10, 1000); }
 	init( REDWOOD_REMAP_CLEANUP_WINDOW_BYTES, 4LL * 1024 * 1024 * 1024 );
 	init( REDWOOD_REMAP_CLEANUP_TOLERANCE_RATIO,                0.05 );
+	init( REDWOOD_REMAP_CLEANUP_URGENT_RATIO,                    2.0 );
+	init( REDWOOD_CLEANUP_IO_BACKOFF_PER_WAITER,               0.002 ); if( randomize && BUGGIFY ) { REDWOOD_CLEANUP_IO_BACKOFF_PER_WAITER = deterministicRandom()->random01() * 0.01; }
+	init( REDWOOD_CLEANUP_IO_MAX_BACKOFF,                        0.1 );
 	init( REDWOOD_PAGEFILE_GROWTH_SIZE_PAGES,                  20000 ); if( randomize && BUGGIFY ) { REDWOOD_PAGEFILE_GROWTH_SIZE_PAGES = deterministicRandom()->randomInt(200, 1000); }
 	init( REDWOOD_METRICS_INTERVAL,                              5.0 );
 	init( REDWOOD_HISTOGRAM_INTERVAL,                           30.0 );
 	init( REDWOOD_EVICT_UPDATED_PAGES,                          true ); if( randomize && BUGGIFY ) { REDWOOD_EVICT_UPDATED_PAGES = false; }
 	init( REDWOOD_DECODECACHE_REUSE_MIN_HEIGHT,                    2 ); if( randomize && BUGGIFY ) { REDWOOD_DECODECACHE_REUSE_MIN_HEIGHT = deterministicRandom()->randomInt(1, 7); }
 	init( REDWOOD_NODE_MAX_UNBALANCE,                              2 );
+	init( REDWOOD_REPLACED_LEAF_SKIP_READ,                      true ); if( randomize && BUGGIFY ) { REDWOOD_REPLACED_LEAF_SKIP_READ = false; }
+	init( REDWOOD_PAGE_CACHE_PROTECTED_FRACTION,                 0.8 ); if( randomize && BUGGIFY ) { REDWOOD_PAGE_CACHE_PROTECTED_FRACTION = deterministicRandom()->random01(); }
 	init( REDWOOD_IO_PRIORITIES,                       "32,32,32,32" );
+	init( REDWOOD_PAGE_ENCODE_THREADS,                             0 );
+	init( REDWOOD_COMMIT_PIPELINE_MAX_MUTATION_BYTES,       64 << 20 ); if( randomize && BUGGIFY ) { REDWOOD_COMMIT_PIPELINE_MAX_MUTATION_BYTES = deterministicRandom()->randomInt(4096, 1000000); }
 
 	// Server request latency measurement
 	init( LATENCY_SKETCH_ACCURACY,                              0.01 );
@@ -1036,6 +1114,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( BG_WRITE_MULTIPART,                                  false ); if (randomize && BUGGIFY) BG_WRITE_MULTIPART = true;
 	init( BG_ENABLE_DYNAMIC_WRITE_AMP,                          true ); if (randomize && BUGGIFY) BG_ENABLE_DYNAMIC_WRITE_AMP = false;
 	init( BG_DYNAMIC_WRITE_AMP_MIN_FACTOR,                       0.5 );
+	init( BG_ENABLE_EARLY_SPLIT_EVAL,                           true ); if (randomize && BUGGIFY) BG_ENABLE_EARLY_SPLIT_EVAL = false;
 	init( BG_DYNAMIC_WRITE_AMP_DECREASE_FACTOR,                  0.8 );
 
 	init( BG_ENABLE_MERGING,                                    true ); if (randomize && BUGGIFY) BG_ENABLE_MERGING = false;
@@ -1073,12 +1152,14 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( BLOB_FULL_RESTORE_MODE,                              false );
 	init( BLOB_MIGRATOR_CHECK_INTERVAL,     isSimulated ?  1.0 : 5.0 );
 	init( BLOB_MANIFEST_RW_ROWS,            isSimulated ?  10 : 1000 );
+	init( BLOB_MANIFEST_LOAD_PARALLELISM,      isSimulated ?  2 : 8 ); if( randomize && BUGGIFY ) BLOB_MANIFEST_LOAD_PARALLELISM = 1;
 	init( BLOB_RESTORE_MLOGS_URL, isSimulated ? "file://simfdb/backups/" : "" );
 	init( BLOB_MIGRATOR_ERROR_RETRIES,                            20 );
 	init( BLOB_RESTORE_MANIFEST_URL, isSimulated ? "file://simfdb/fdbblob/manifest" : "" );
 	init( BLOB_RESTORE_MANIFEST_FILE_MAX_SIZE, isSimulated ? 10000 : 10000000 );
 	init( BLOB_RESTORE_MANIFEST_RETENTION_MAX,                     10 );
 	init( BLOB_RESTORE_MLOGS_RETENTION_SECS,  isSimulated ?  120 : 3600 * 24 * 14 );
+	init( BLOB_RESTORE_SHARD_BYTES,          isSimulated ? 10000 : 250e6 );
 
 	init( BGCC_TIMEOUT,                   isSimulated ? 10.0 : 120.0 );
 	init( BGCC_MIN_INTERVAL,                isSimulated ? 1.0 : 10.0 );
@@ -106,7 +106,8 @@ std::unordered_map<std::string, KeyRange> SpecialKeySpace::managementApiCommandT
 
 std::unordered_map<std::string, KeyRange> SpecialKeySpace::actorLineageApiCommandToRange = {
 	{ "state", KeyRangeRef("state/"_sr, "state0"_sr).withPrefix(moduleToBoundary[MODULE::ACTORLINEAGE].begin) },
-	{ "time", KeyRangeRef("time/"_sr, "time0"_sr).withPrefix(moduleToBoundary[MODULE::ACTORLINEAGE].begin) }
+	{ "time", KeyRangeRef("time/"_sr, "time0"_sr).withPrefix(moduleToBoundary[MODULE::ACTORLINEAGE].begin) },
+	{ "folded", KeyRangeRef("folded/"_sr, "folded0"_sr).withPrefix(moduleToBoundary[MODULE::ACTORLINEAGE].begin) }
 };
 
 std::set<std::string> SpecialKeySpace::options = { "excluded/force",
@@ -292,6 +293,73 @@ void SpecialKeySpace::modulesBoundaryInit() {
 	}
 }
 
+const char* SpecialKeySpace::moduleToName(SpecialKeySpace::MODULE module) {
+	switch (module) {
+	case SpecialKeySpace::MODULE::ACTORLINEAGE:
+		return "ActorLineage";
+	case SpecialKeySpace::MODULE::ACTOR_PROFILER_CONF:
+		return "ActorProfilerConf";
+	case SpecialKeySpace::MODULE::CLUSTERFILEPATH:
+		return "ClusterFilePath";
+	case SpecialKeySpace::MODULE::CLUSTERID:
+		return "ClusterId";
+	case SpecialKeySpace::MODULE::CONFIGURATION:
+		return "Configuration";
+	case SpecialKeySpace::MODULE::CONNECTIONSTRING:
+		return "ConnectionString";
+	case SpecialKeySpace::MODULE::ERRORMSG:
+		return "ErrorMsg";
+	case SpecialKeySpace::MODULE::GLOBALCONFIG:
+		return "GlobalConfig";
+	case SpecialKeySpace::MODULE::MANAGEMENT:
+		return "Management";
+	case SpecialKeySpace::MODULE::METRICS:
+		return "Metrics";
+	case SpecialKeySpace::MODULE::TESTONLY:
+		return "TestOnly";
+	case SpecialKeySpace::MODULE::TRACING:
+		return "Tracing";
+	case SpecialKeySpace::MODULE::TRANSACTION:
+		return "Transaction";
+	case SpecialKeySpace::MODULE::STATUSJSON:
+		return "StatusJson";
+	case SpecialKeySpace::MODULE::WORKERINTERFACE:
+		return "WorkerInterface";
+	case SpecialKeySpace::MODULE::UNKNOWN:
+	default:
+		return "Unknown";
+	}
+}
+
+void SpecialKeySpace::recordModuleRead(SpecialKeySpace::MODULE module, double latency) {
+	auto& stats = readLatencyStats[module];
+	++stats.count;
+	stats.totalLatency += latency;
+	stats.maxLatency = std::max(stats.maxLatency, latency);
+}
+
+// Reads a single module sub-range and records the observed latency against the
+// module, so the periodic client trace can show which modules are slow to serve
+ACTOR Future<RangeResult> readRangeImplActor(SpecialKeySpace* sks,
+                                             ReadYourWritesTransaction* ryw,
+                                             SpecialKeyRangeReadImpl* impl,
+                                             KeyRangeRef kr,
+                                             GetRangeLimits limits,
+                                             KeyRangeMap<Optional<RangeResult>>* cache) {
+	state double startTime = now();
+	state RangeResult pairs;
+	if (impl->isAsync() && cache->rangeContaining(kr.begin).value().present()) {
+		const SpecialKeyRangeAsyncImpl* ptr = dynamic_cast<const SpecialKeyRangeAsyncImpl*>(impl);
+		RangeResult pairs_ = wait(ptr->getRange(ryw, kr, limits, cache));
+		pairs = pairs_;
+	} else {
+		RangeResult pairs_ = wait(impl->getRange(ryw, kr, limits));
+		pairs = pairs_;
+	}
+	sks->recordModuleRead(sks->getModules().rangeContaining(kr.begin)->value(), now() - startTime);
+	return pairs;
+}
+
 ACTOR Future<RangeResult> SpecialKeySpace::checkRYWValid(SpecialKeySpace* sks,
                                                          ReadYourWritesTransaction* ryw,
                                                          KeySelector begin,
@@ -379,6 +447,11 @@ ACTOR Future<RangeResult> SpecialKeySpace::getRangeAggregationActor(SpecialKeySp
 
 	// TODO : workaround to write this two together to make the code compact
 	// The issue here is boost::iterator_range<> doest not provide rbegin(), rend()
+	// Collect the sub-ranges in consumption order first; with
+	// SPECIAL_KEY_SPACE_PARALLEL_MODULE_READS they are then all issued up front
+	// so that independent modules are fetched concurrently, while results are
+	// still assembled (and limits applied) strictly in order.
+	state std::vector<std::pair<KeyRangeRef, SpecialKeyRangeReadImpl*>> subRanges;
 	iter = reverse ? ranges.end() : ranges.begin();
 	if (reverse) {
 		while (iter != ranges.begin()) {
@@ -388,18 +461,39 @@ ACTOR Future<RangeResult> SpecialKeySpace::getRangeAggregationActor(SpecialKeySp
 			KeyRangeRef kr = iter->range();
 			KeyRef keyStart = kr.contains(begin.getKey()) ? begin.getKey() : kr.begin;
 			KeyRef keyEnd = kr.contains(end.getKey()) ? end.getKey() : kr.end;
-			if (iter->value()->isAsync() && cache.rangeContaining(keyStart).value().present()) {
-				const SpecialKeyRangeAsyncImpl* ptr = dynamic_cast<const SpecialKeyRangeAsyncImpl*>(iter->value());
-				RangeResult pairs_ = wait(ptr->getRange(ryw, KeyRangeRef(keyStart, keyEnd), limits, &cache));
-				pairs = pairs_;
-			} else {
-				RangeResult pairs_ = wait(iter->value()->getRange(ryw, KeyRangeRef(keyStart, keyEnd), limits));
-				pairs = pairs_;
-			}
-			result.arena().dependsOn(pairs.arena());
-			// limits handler
+			subRanges.emplace_back(KeyRangeRef(keyStart, keyEnd), iter->value());
+		}
+	} else {
+		for (iter = ranges.begin(); iter != ranges.end(); ++iter) {
+			if (iter->value() == nullptr)
+				continue;
+			KeyRangeRef kr = iter->range();
+			KeyRef keyStart = kr.contains(begin.getKey()) ? begin.getKey() : kr.begin;
+			KeyRef keyEnd = kr.contains(end.getKey()) ? end.getKey() : kr.end;
+			subRanges.emplace_back(KeyRangeRef(keyStart, keyEnd), iter->value());
+		}
+	}
+	state std::vector<Future<RangeResult>> futures(subRanges.size());
+	if (CLIENT_KNOBS->SPECIAL_KEY_SPACE_PARALLEL_MODULE_READS) {
+		// Issuing every sub-range with the full remaining limits may over-fetch
+		// from modules the sequential pass would have skipped once the limit was
+		// reached; those futures are simply dropped when we return early below.
+		for (int i = 0; i < (int)subRanges.size(); ++i) {
+			futures[i] = readRangeImplActor(sks, ryw, subRanges[i].second, subRanges[i].first, limits, &cache);
+		}
+	}
+	state int r;
+	for (r = 0; r < (int)subRanges.size(); ++r) {
+		if (!futures[r].isValid()) {
+			futures[r] = readRangeImplActor(sks, ryw, subRanges[r].second, subRanges[r].first, limits, &cache);
+		}
+		RangeResult pairs_ = wait(futures[r]);
+		pairs = pairs_;
+		result.arena().dependsOn(pairs.arena());
+		// limits handler
+		if (reverse) {
 			for (int i = pairs.size() - 1; i >= 0; --i) {
-				ASSERT(iter->range().contains(pairs[i].key));
+				ASSERT(subRanges[r].second->getKeyRange().contains(pairs[i].key));
 				result.push_back(result.arena(), pairs[i]);
 				// Note : behavior here is even the last k-v pair makes total bytes larger than specified, it's still
 				// returned. In other words, the total size of the returned value (less the last entry) will be less
@@ -411,30 +505,10 @@ ACTOR Future<RangeResult> SpecialKeySpace::getRangeAggregationActor(SpecialKeySp
 					return result;
 				};
 			}
-		}
-	} else {
-		for (iter = ranges.begin(); iter != ranges.end(); ++iter) {
-			if (iter->value() == nullptr)
-				continue;
-			KeyRangeRef kr = iter->range();
-			KeyRef keyStart = kr.contains(begin.getKey()) ? begin.getKey() : kr.begin;
-			KeyRef keyEnd = kr.contains(end.getKey()) ? end.getKey() : kr.end;
-			if (iter->value()->isAsync() && cache.rangeContaining(keyStart).value().present()) {
-				const SpecialKeyRangeAsyncImpl* ptr = dynamic_cast<const SpecialKeyRangeAsyncImpl*>(iter->value());
-				RangeResult pairs_ = wait(ptr->getRange(ryw, KeyRangeRef(keyStart, keyEnd), limits, &cache));
-				pairs = pairs_;
-			} else {
-				RangeResult pairs_ = wait(iter->value()->getRange(ryw, KeyRangeRef(keyStart, keyEnd), limits));
-				pairs = pairs_;
-			}
-			result.arena().dependsOn(pairs.arena());
-			// limits handler
+		} else {
 			for (int i = 0; i < pairs.size(); ++i) {
-				ASSERT(iter->range().contains(pairs[i].key));
+				ASSERT(subRanges[r].second->getKeyRange().contains(pairs[i].key));
 				result.push_back(result.arena(), pairs[i]);
-				// Note : behavior here is even the last k-v pair makes total bytes larger than specified, it's still
-				// returned. In other words, the total size of the returned value (less the last entry) will be less
-				// than byteLimit
 				limits.decrement(pairs[i]);
 				if (limits.isReached()) {
 					result.more = true;
@@ -2263,6 +2337,13 @@ ACTOR static Future<RangeResult> actorLineageGetRangeActor(ReadYourWritesTransac
 			if (kr.begin != kr.end) {
 				parse(endValues.begin() + 1, endValues.end(), endRangeHost, timeEnd, waitStateEnd, seqEnd);
 			}
+		} else if (SpecialKeySpace::getActorLineageApiCommandRange("folded").contains(kr)) {
+			// For the range \xff\xff/actor_lineage/folded/ip:port. Time and wait-state
+			// bounds keep their defaults; folding aggregates the entire sample window.
+			parse(beginValues.begin() + 1, beginValues.end(), host);
+			if (kr.begin != kr.end) {
+				parse(endValues.begin() + 1, endValues.end(), endRangeHost);
+			}
 		} else {
 			ryw->setSpecialKeySpaceErrorMsg(
 			    ManagementAPIError::toJsonString(false, "read actor_lineage", "invalid index in actor_lineage"));
@@ -2300,6 +2381,52 @@ ACTOR static Future<RangeResult> actorLineageGetRangeActor(ReadYourWritesTransac
 	actorLineageRequest.timeEnd = timeEnd;
 	ActorLineageReply reply = wait(process.actorLineage.getReply(actorLineageRequest));
 
+	if (SpecialKeySpace::getActorLineageApiCommandRange("folded").contains(kr)) {
+		// Aggregate every sampled actor stack in the window into folded stack lines
+		// ("WaitState;actorA;actorB <count>"), the input format flame graph tools
+		// consume. Each sample's payload is a msgpack array with one map per actor;
+		// the StackLineageCollector contributes the stack under the "StackLineage" key.
+		std::map<std::string, int64_t> folded;
+		for (const auto& sample : reply.samples) {
+			for (const auto& [waitState, data] : sample.data) {
+				msgpack::object_handle oh = msgpack::unpack(data.data(), data.size());
+				msgpack::object deserialized = oh.get();
+				if (deserialized.type != msgpack::type::ARRAY) {
+					continue;
+				}
+				for (uint32_t i = 0; i < deserialized.via.array.size; ++i) {
+					const msgpack::object& actor = deserialized.via.array.ptr[i];
+					if (actor.type != msgpack::type::MAP) {
+						continue;
+					}
+					std::string stack = to_string(waitState);
+					for (uint32_t j = 0; j < actor.via.map.size; ++j) {
+						const msgpack::object_kv& kv = actor.via.map.ptr[j];
+						if (kv.key.type != msgpack::type::STR ||
+						    std::string_view(kv.key.via.str.ptr, kv.key.via.str.size) != "StackLineage" ||
+						    kv.val.type != msgpack::type::ARRAY) {
+							continue;
+						}
+						for (uint32_t k = 0; k < kv.val.via.array.size; ++k) {
+							const msgpack::object& frame = kv.val.via.array.ptr[k];
+							if (frame.type == msgpack::type::STR) {
+								stack += ';';
+								stack.append(frame.via.str.ptr, frame.via.str.size);
+							}
+						}
+					}
+					++folded[stack];
+				}
+			}
+		}
+		for (const auto& [stack, count] : folded) {
+			std::string key = SpecialKeySpace::getActorLineageApiCommandPrefix("folded").toString() + host.toString() +
+			                  "/" + stack;
+			result.push_back_deep(result.arena(), KeyValueRef(key, std::to_string(count)));
+		}
+		return result;
+	}
+
 	time_t dt = 0;
 	int seq = -1;
 	for (const auto& sample : reply.samples) {
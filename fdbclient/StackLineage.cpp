@@ -25,5 +25,8 @@ std::vector<StringRef> getActorStackTrace() {
 }
 
 namespace {
-// StackLineageCollector stackLineageCollector;
-}
+// Registers actor stacks with the sampling profiler so that each sample carries the
+// full actor lineage. Lineages are only tracked in ENABLE_SAMPLING builds; elsewhere
+// the collector contributes empty stacks at negligible cost.
+StackLineageCollector stackLineageCollector;
+} // namespace
@@ -166,24 +166,44 @@ class TaskBucketImpl {
 public:
 	ACTOR static Future<Optional<Key>> getTaskKey(Reference<ReadYourWritesTransaction> tr,
 	                                              Reference<TaskBucket> taskBucket,
-	                                              int priority = 0) {
-		Standalone<StringRef> uid = StringRef(deterministicRandom()->randomUniqueID().toString());
+	                                              int priority = 0,
+	                                              int shard = -1) {
+		state std::string uid = deterministicRandom()->randomUniqueID().toString();
 
 		// Get keyspace for the specified priority level
 		state Subspace space = taskBucket->getAvailableSpace(priority);
+
+		// If a shard was given, restrict the probe (and therefore the read conflict range it creates) to
+		// that slice of the task UID keyspace.  Task UIDs are uniformly distributed hex strings so slicing
+		// on the first two characters partitions the available tasks roughly evenly, without changing
+		// where tasks are stored.
+		state Key begin = space.key();
+		state Key end = space.pack(maxUIDKey);
+		if (shard >= 0) {
+			int shardCount = std::max(1, std::min(CLIENT_KNOBS->TASKBUCKET_SHARD_COUNT, 256));
+			if (shardCount > 1) {
+				int shardBegin = (shard % shardCount) * 256 / shardCount;
+				int shardEnd = (shard % shardCount + 1) * 256 / shardCount;
+				begin = space.pack(StringRef(format("%02x", shardBegin)));
+				if (shardEnd < 256)
+					end = space.pack(StringRef(format("%02x", shardEnd)));
+				// Move the random UID into the shard so the first probe stays within it
+				uid = format("%02x", deterministicRandom()->randomInt(shardBegin, shardEnd)) + uid.substr(2);
+			}
+		}
+
 		{
 			// Get a task key that is <= a random UID task key, if successful then return it
-			RangeResult value =
-			    wait(tr->getRange(KeyRangeRef(space.key(), space.pack(uid)), 1, Snapshot::True, Reverse::True));
+			RangeResult value = wait(
+			    tr->getRange(KeyRangeRef(begin, space.pack(StringRef(uid))), 1, Snapshot::True, Reverse::True));
 			if (!value.empty()) {
 				return Optional<Key>(value[0].key);
 			}
 		}
 
 		{
-			// Get a task key that is <= the maximum possible UID, if successful return it.
-			RangeResult value =
-			    wait(tr->getRange(KeyRangeRef(space.key(), space.pack(maxUIDKey)), 1, Snapshot::True, Reverse::True));
+			// Get a task key that is <= the maximum possible UID in the shard, if successful return it.
+			RangeResult value = wait(tr->getRange(KeyRangeRef(begin, end), 1, Snapshot::True, Reverse::True));
 			if (!value.empty()) {
 				return Optional<Key>(value[0].key);
 			}
@@ -208,28 +228,41 @@ public:
 
 		state std::vector<Future<Optional<Key>>> taskKeyFutures(CLIENT_KNOBS->TASKBUCKET_MAX_PRIORITY + 1);
 
-		// Start looking for a task at each priority, highest first
-		state int pri;
-		for (pri = CLIENT_KNOBS->TASKBUCKET_MAX_PRIORITY; pri >= 0; --pri)
-			taskKeyFutures[pri] = getTaskKey(tr, taskBucket, pri);
-
 		// Task key and subspace it is located in.
 		state Optional<Key> taskKey;
 		state Subspace availableSpace;
 
-		// In priority order from highest to lowest, wait for fetch to finish and if it found a task then cancel the
-		// rest.
-		for (pri = CLIENT_KNOBS->TASKBUCKET_MAX_PRIORITY; pri >= 0; --pri) {
-			// If we already have a task key then cancel this fetch
-			if (taskKey.present())
-				taskKeyFutures[pri].cancel();
-			else {
-				Optional<Key> key = wait(taskKeyFutures[pri]);
-				if (key.present()) {
-					taskKey = key;
-					availableSpace = taskBucket->getAvailableSpace(pri);
+		// Look for a task in this instance's home shard of the available keyspace first so that
+		// concurrent agents mostly acquire from disjoint slices, then steal from the other shards if
+		// the home shard has no tasks at any priority.
+		state int shard = CLIENT_KNOBS->TASKBUCKET_SHARD_COUNT > 1 ? taskBucket->homeShard : -1;
+		state int pri;
+		loop {
+			// Start looking for a task at each priority, highest first
+			for (pri = CLIENT_KNOBS->TASKBUCKET_MAX_PRIORITY; pri >= 0; --pri)
+				taskKeyFutures[pri] = getTaskKey(tr, taskBucket, pri, shard);
+
+			// In priority order from highest to lowest, wait for fetch to finish and if it found a task then cancel
+			// the rest.
+			for (pri = CLIENT_KNOBS->TASKBUCKET_MAX_PRIORITY; pri >= 0; --pri) {
+				// If we already have a task key then cancel this fetch
+				if (taskKey.present())
+					taskKeyFutures[pri].cancel();
+				else {
+					Optional<Key> key = wait(taskKeyFutures[pri]);
+					if (key.present()) {
+						taskKey = key;
+						availableSpace = taskBucket->getAvailableSpace(pri);
+					}
 				}
 			}
+
+			if (taskKey.present() || shard < 0)
+				break;
+
+			// The home shard is empty, scan the full available keyspace instead
+			CODE_PROBE(true, "TaskBucket home shard was empty, stealing tasks from other shards");
+			shard = -1;
 		}
 
 		// If we don't have a task key, requeue timed out tasks and try again by calling self.
@@ -880,7 +913,9 @@ TaskBucket::TaskBucket(const Subspace& subspace,
     dispatchSlotChecksComplete("DispatchSlotChecksComplete", cc), prefix(subspace), active(prefix.get("ac"_sr)),
     pauseKey(prefix.pack("pause"_sr)), available(prefix.get("av"_sr)), available_prioritized(prefix.get("avp"_sr)),
     timeouts(prefix.get("to"_sr)), timeout(CLIENT_KNOBS->TASKBUCKET_TIMEOUT_VERSIONS), system_access(sysAccess),
-    priority_batch(priorityBatch), lockAware(lockAware) {}
+    priority_batch(priorityBatch), lockAware(lockAware),
+    homeShard(deterministicRandom()->randomInt(0, std::max(1, std::min(CLIENT_KNOBS->TASKBUCKET_SHARD_COUNT, 256)))) {
+}
 
 TaskBucket::~TaskBucket() {}
 
@@ -433,6 +433,30 @@ ThreadFuture<Optional<Value>> ThreadSafeTransaction::get(const KeyRef& key, bool
 	});
 }
 
+ThreadFuture<RangeResult> ThreadSafeTransaction::getBatch(const VectorRef<KeyRef>& keys, bool snapshot) {
+	Standalone<VectorRef<KeyRef>> ks;
+	ks.append_deep(ks.arena(), keys.begin(), keys.size());
+
+	ISingleThreadTransaction* tr = this->tr;
+	return onMainThread([tr, ks, snapshot]() -> Future<RangeResult> {
+		tr->checkDeferredError();
+		std::vector<Future<Optional<Value>>> values;
+		values.reserve(ks.size());
+		for (const auto& k : ks) {
+			values.push_back(tr->get(k, Snapshot{ snapshot }));
+		}
+		return map(getAll(values), [ks](std::vector<Optional<Value>> const& vals) {
+			RangeResult result;
+			for (int i = 0; i < (int)vals.size(); i++) {
+				if (vals[i].present()) {
+					result.push_back_deep(result.arena(), KeyValueRef(ks[i], vals[i].get()));
+				}
+			}
+			return result;
+		});
+	});
+}
+
 ThreadFuture<Key> ThreadSafeTransaction::getKey(const KeySelectorRef& key, bool snapshot) {
 	KeySelector k = key;
 
@@ -18,6 +18,9 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
+#include "fdbclient/ClientKnobs.h"
 #include "fdbclient/WriteMap.h"
 
 void OperationStack::reset(RYWMutation initialEntry) {
@@ -79,13 +82,36 @@ WriteMap& WriteMap::operator=(WriteMap&& r) noexcept {
 	writeMapEmpty = r.writeMapEmpty;
 	writes = std::move(r.writes);
 	ver = r.ver;
+	flat = std::move(r.flat);
+	mutations = r.mutations;
+	readsSinceLastMutation = r.readsSinceLastMutation;
 	scratch_iterator = std::move(r.scratch_iterator);
 	arena = r.arena;
 	return *this;
 }
 
+void WriteMap::appendToFlat(Tree const& node, Version at, std::vector<PTreeT const*>& out) {
+	if (!node)
+		return;
+	appendToFlat(node->left(at), at, out);
+	out.push_back(node.getPtr());
+	appendToFlat(node->right(at), at, out);
+}
+
+Reference<WriteMap::FlatTree> WriteMap::flattenForRead() {
+	++readsSinceLastMutation;
+	if (flat)
+		return flat;
+	if (readsSinceLastMutation < 2 || mutations < CLIENT_KNOBS->WRITE_MAP_FLATTEN_THRESHOLD)
+		return Reference<FlatTree>();
+	flat = makeReference<FlatTree>();
+	appendToFlat(writes, ver, flat->entries);
+	return flat;
+}
+
 void WriteMap::mutate(KeyRef key, MutationRef::Type operation, ValueRef param, bool addConflict) {
 	writeMapEmpty = false;
+	noteMutation();
 	auto& it = scratch_iterator;
 	it.reset(writes, ver);
 	it.skip(key);
@@ -159,6 +185,7 @@ void WriteMap::mutate(KeyRef key, MutationRef::Type operation, ValueRef param, b
 
 void WriteMap::clear(KeyRangeRef keys, bool addConflict) {
 	writeMapEmpty = false;
+	noteMutation();
 	if (!addConflict) {
 		clearNoConflict(keys);
 		return;
@@ -203,6 +230,7 @@ void WriteMap::clear(KeyRangeRef keys, bool addConflict) {
 }
 
 void WriteMap::addUnmodifiedAndUnreadableRange(KeyRangeRef keys) {
+	noteMutation();
 	auto& it = scratch_iterator;
 	it.reset(writes, ver);
 	it.skip(keys.begin);
@@ -243,6 +271,7 @@ void WriteMap::addUnmodifiedAndUnreadableRange(KeyRangeRef keys) {
 
 void WriteMap::addConflictRange(KeyRangeRef keys) {
 	writeMapEmpty = false;
+	noteMutation();
 	auto& it = scratch_iterator;
 	it.reset(writes, ver);
 	it.skip(keys.begin);
@@ -312,6 +341,9 @@ WriteMap::iterator::SEGMENT_TYPE WriteMap::iterator::type() const {
 WriteMap::iterator& WriteMap::iterator::operator++() {
 	if (!offset && !equalsKeyAfter(entry().key, nextEntry().key)) {
 		offset = true;
+	} else if (flat) {
+		++idx;
+		offset = !entry().stack.size();
 	} else {
 		beginLen = endLen;
 		finger.resize(beginLen);
@@ -323,6 +355,9 @@ WriteMap::iterator& WriteMap::iterator::operator++() {
 WriteMap::iterator& WriteMap::iterator::operator--() {
 	if (offset && entry().stack.size()) {
 		offset = false;
+	} else if (flat) {
+		--idx;
+		offset = !entry().stack.size() || !equalsKeyAfter(entry().key, nextEntry().key);
 	} else {
 		endLen = beginLen;
 		finger.resize(endLen);
@@ -334,6 +369,20 @@ WriteMap::iterator& WriteMap::iterator::operator--() {
 
 void WriteMap::iterator::skip(
     KeyRef key) { // Changes *this to the segment containing key (so that beginKey()<=key && key < endKey())
+	if (flat) {
+		if (key == allKeys.end) {
+			idx = (int)flat->entries.size() - 2;
+		} else {
+			auto i = std::upper_bound(flat->entries.begin(),
+			                          flat->entries.end(),
+			                          key,
+			                          [](KeyRef const& k, PTreeT const* e) { return k < e->data.key; });
+			idx = int(i - flat->entries.begin()) - 1;
+		}
+		offset = !entry().stack.size() || (entry().key != key);
+		return;
+	}
+
 	finger.clear();
 
 	if (key == allKeys.end)
@@ -352,6 +401,8 @@ void WriteMap::iterator::reset(Tree const& tree, Version ver) {
 	this->finger.clear();
 	beginLen = endLen = 0;
 	offset = false;
+	flat.clear();
+	idx = 0;
 }
 
 RYWMutation WriteMap::coalesce(RYWMutation existingEntry, RYWMutation newEntry, Arena& arena) {
@@ -97,11 +97,11 @@ public:
 
 	ACTOR static Future<Void> write_impl(Reference<AsyncFileS3BlobStoreWrite> f, const uint8_t* data, int length) {
 		state Part* p = f->m_parts.back().getPtr();
-		// If this write will cause the part to cross the min part size boundary then write to the boundary and start a
-		// new part.
-		while (p->length + length >= f->m_bstore->knobs.multipart_min_part_size) {
+		// If this write will cause the part to cross the current part size boundary then write to the boundary and
+		// start a new part.
+		while (p->length + length >= f->m_partSize) {
 			// Finish off this part
-			int finishlen = f->m_bstore->knobs.multipart_min_part_size - p->length;
+			int finishlen = f->m_partSize - p->length;
 			p->write((const uint8_t*)data, finishlen);
 
 			// Adjust source buffer args
@@ -135,8 +135,10 @@ public:
 	ACTOR static Future<std::string> doPartUpload(AsyncFileS3BlobStoreWrite* f, Part* p) {
 		p->finalizeMD5();
 		std::string upload_id = wait(f->getUploadID());
+		state double startTime = now();
 		std::string etag = wait(f->m_bstore->uploadPart(
 		    f->m_bucket, f->m_object, upload_id, p->number, &p->content, p->length, p->md5string));
+		f->updatePartSize(p->length, now() - startTime);
 		return etag;
 	}
 
@@ -221,6 +223,22 @@ private:
 	std::vector<Reference<Part>> m_parts;
 	Promise<Void> m_error;
 	FlowLock m_concurrentUploads;
+	int m_partSize;
+	double m_uploadSpeed;
+
+	// Adapt the target part size to the observed per-connection upload throughput so that each part takes roughly
+	// multipart_part_target_seconds to send. Small parts spend most of their time on per-request overhead (auth,
+	// headers, window ramp-up); larger parts amortize it, up to multipart_max_part_size. Parts already in flight
+	// are unaffected, so a slowdown only shrinks parts that have not been started yet.
+	void updatePartSize(int64_t bytes, double duration) {
+		if (m_bstore->knobs.multipart_part_target_seconds <= 0 || duration <= 0)
+			return;
+		double speed = bytes / duration;
+		m_uploadSpeed = (m_uploadSpeed == 0) ? speed : (m_uploadSpeed + speed) / 2;
+		int64_t target = m_uploadSpeed * m_bstore->knobs.multipart_part_target_seconds;
+		m_partSize = std::max<int64_t>(m_bstore->knobs.multipart_min_part_size,
+		                               std::min<int64_t>(target, m_bstore->knobs.multipart_max_part_size));
+	}
 
 	// End the current part and start uploading it, but also wait for a part to finish if too many are in transit.
 	ACTOR static Future<Void> endCurrentPart(AsyncFileS3BlobStoreWrite* f, bool startNew = false) {
@@ -238,8 +256,7 @@ private:
 
 		// Make a new part to write to
 		if (startNew)
-			f->m_parts.push_back(
-			    Reference<Part>(new Part(f->m_parts.size() + 1, f->m_bstore->knobs.multipart_min_part_size)));
+			f->m_parts.push_back(Reference<Part>(new Part(f->m_parts.size() + 1, f->m_partSize)));
 
 		return Void();
 	}
@@ -253,10 +270,11 @@ private:
 public:
 	AsyncFileS3BlobStoreWrite(Reference<S3BlobStoreEndpoint> bstore, std::string bucket, std::string object)
 	  : m_bstore(bstore), m_bucket(bucket), m_object(object), m_cursor(0),
-	    m_concurrentUploads(bstore->knobs.concurrent_writes_per_file) {
+	    m_concurrentUploads(bstore->knobs.concurrent_writes_per_file),
+	    m_partSize(bstore->knobs.multipart_min_part_size), m_uploadSpeed(0) {
 
 		// Add first part
-		m_parts.push_back(makeReference<Part>(1, m_bstore->knobs.multipart_min_part_size));
+		m_parts.push_back(makeReference<Part>(1, m_partSize));
 	}
 };
 
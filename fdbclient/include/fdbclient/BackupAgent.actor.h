@@ -1008,6 +1008,17 @@ ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeRangeFileBlock(Reference<
                                                                       int len,
                                                                       Database cx);
 
+// Parsed form of the trailing key-range index of a snapshot range file.  boundaries[i] is the file
+// offset and begin key of data block i, and the final entry is the data end offset and the file's
+// end key.
+struct RangeFileIndex {
+	std::vector<std::pair<int64_t, Key>> boundaries;
+};
+
+// Read the trailing key-range index of a range file if present.  Returns an empty Optional for
+// files written without an index and for files whose index cannot be parsed.
+ACTOR Future<Optional<RangeFileIndex>> readRangeFileIndex(Reference<IAsyncFile> file, int64_t fileSize);
+
 Standalone<VectorRef<KeyValueRef>> decodeMutationLogFileBlock(const Standalone<StringRef>& buf);
 
 // Reads a mutation log block from file and parses into batch mutation blocks for further parsing.
@@ -65,6 +65,10 @@ static const uint32_t BACKUP_AGENT_MLOG_VERSION = 2001;
 
 // Mutation log version written by BackupWorker
 static const uint32_t PARTITIONED_MLOG_VERSION = 4110;
+// Partitioned mutation log block whose payload is zstd-compressed. Blocks are individually
+// versioned, so compressed and uncompressed blocks can coexist within one file; the block
+// header is [version:uint32_t][rawLen:uint32_t][compressedLen:uint32_t][compressed payload].
+static const uint32_t COMPRESSED_PARTITIONED_MLOG_VERSION = 4111;
 
 // Snapshot file version written by FileBackupAgent
 static const uint32_t BACKUP_AGENT_SNAPSHOT_FILE_VERSION = 1001;
@@ -72,6 +76,17 @@ static const uint32_t BACKUP_AGENT_SNAPSHOT_FILE_VERSION = 1001;
 // Encrypted Snapshot file version written by FileBackupAgent
 static const uint32_t BACKUP_AGENT_ENCRYPTED_SNAPSHOT_FILE_VERSION = 1002;
 
+// Index block version written at the end of snapshot files which include a trailing key-range index.
+// An index block is [version:int32_t][numEntries:uint32_t BE] followed by numEntries boundaries of
+// [offset:int64_t BE][keyLen:uint32_t BE][key], padded with 0xFF to the file's block size.  Boundary i
+// is the file offset and begin key of data block i, and the final boundary is the data end offset and
+// the file's end key.  The file ends with a footer of [index offset:int64_t BE] followed by
+// BACKUP_RANGEFILE_INDEX_FOOTER_MAGIC, so readers can find the index with a single ranged read.
+static const uint32_t BACKUP_AGENT_SNAPSHOT_FILE_INDEX_VERSION = 1003;
+
+// Magic value ending an indexed snapshot file, stored in little endian byte order
+static const uint64_t BACKUP_RANGEFILE_INDEX_FOOTER_MAGIC = 0x0FDB58A0C3D17291;
+
 struct LogFile {
 	Version beginVersion;
 	Version endVersion;
@@ -262,6 +277,7 @@ public:
 		std::string step;
 		int total;
 		int done;
+		double startTime{ 0 }; // Time the current step began, used to estimate time remaining
 		std::string toString() const;
 	};
 	// Delete backup files which do not contain any data at or after (more recent than) expireEndVersion.
@@ -102,6 +102,10 @@ public:
 	// Delete a file
 	virtual Future<Void> deleteFile(const std::string& fileName) = 0;
 
+	// Delete a batch of files.  The default implementation issues a deleteFile() per name, but backends
+	// with a bulk delete operation can override this to remove the batch with fewer requests.
+	virtual Future<Void> deleteFiles(const std::vector<std::string>& fileNames);
+
 	// Delete entire container.  During the process, if pNumDeleted is not null it will be
 	// updated with the count of deleted files so that progress can be seen.
 	Future<Void> deleteContainer(int* pNumDeleted) override = 0;
@@ -61,6 +61,8 @@ public:
 
 	Future<Void> deleteFile(const std::string& path) final;
 
+	Future<Void> deleteFiles(const std::vector<std::string>& paths) final;
+
 	Future<FilesAndSizesT> listFiles(const std::string& path, std::function<bool(std::string const&)> pathFilter) final;
 
 	Future<Void> create() final;
@@ -899,6 +899,12 @@ public:
 	                              BlobCipherEncryptHeader* header,
 	                              Arena&);
 	StringRef encrypt(const uint8_t*, const int, BlobCipherEncryptHeaderRef*, Arena&);
+	// Encrypts 'data' in place, avoiding the ciphertext buffer allocation and copy-back of the
+	// encrypt() variants. AES-256-CTR is a stream cipher, so the ciphertext occupies exactly the
+	// plaintext's bytes. Intended for hot paths (e.g. Redwood page commit) where many buffers are
+	// encrypted back-to-back.
+	void encryptInPlace(uint8_t* data, const int dataLen, BlobCipherEncryptHeaderRef* headerRef);
+	void encryptInPlace(uint8_t* data, const int dataLen, BlobCipherEncryptHeader* header);
 
 private:
 	void init();
@@ -944,6 +950,11 @@ public:
 	                  const int ciphertextLen,
 	                  const BlobCipherEncryptHeaderRef& headerRef,
 	                  Arena&);
+	// Decrypts 'data' in place; the counterpart of EncryptBlobCipherAes265Ctr::encryptInPlace().
+	// Authentication tokens (when enabled) are validated against the ciphertext before it is
+	// overwritten with the plaintext.
+	void decryptInPlace(uint8_t* data, const int dataLen, const BlobCipherEncryptHeaderRef& headerRef);
+	void decryptInPlace(uint8_t* data, const int dataLen, const BlobCipherEncryptHeader& header);
 
 private:
 	EVP_CIPHER_CTX* ctx;
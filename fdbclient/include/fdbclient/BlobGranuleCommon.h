@@ -30,7 +30,9 @@
 #include "flow/IRandom.h"
 #include "flow/serialize.h"
 
+#include <list>
 #include <sstream>
+#include <unordered_map>
 
 #define BG_ENCRYPT_COMPRESS_DEBUG false
 
@@ -377,6 +379,53 @@ struct BlobRestoreStatus {
 	}
 };
 
+// A bounded LRU cache of immutable granule file contents, keyed by file name plus read offset and length.
+// Granule files are never modified once written (a re-snapshot writes new files under new names), so entries
+// never need invalidation; files superseded by a re-snapshot simply age out of the LRU.
+class BlobGranuleFileCache : public ReferenceCounted<BlobGranuleFileCache> {
+public:
+	explicit BlobGranuleFileCache(int64_t maxBytes) : maxBytes(maxBytes) {}
+
+	Optional<Standalone<StringRef>> get(const std::string& key) {
+		auto it = entries.find(key);
+		if (it == entries.end()) {
+			++misses;
+			return Optional<Standalone<StringRef>>();
+		}
+		++hits;
+		lru.splice(lru.begin(), lru, it->second.second);
+		return it->second.first;
+	}
+
+	void insert(const std::string& key, const Standalone<StringRef>& data) {
+		if (data.size() > maxBytes || entries.count(key)) {
+			return;
+		}
+		while (currentBytes + data.size() > maxBytes) {
+			auto evict = entries.find(lru.back());
+			ASSERT(evict != entries.end());
+			currentBytes -= evict->second.first.size();
+			entries.erase(evict);
+			lru.pop_back();
+		}
+		lru.push_front(key);
+		entries[key] = { data, lru.begin() };
+		currentBytes += data.size();
+	}
+
+	int64_t getHits() const { return hits; }
+	int64_t getMisses() const { return misses; }
+	int64_t getCurrentBytes() const { return currentBytes; }
+
+private:
+	int64_t maxBytes;
+	int64_t currentBytes = 0;
+	int64_t hits = 0;
+	int64_t misses = 0;
+	std::list<std::string> lru; // most recently used at front
+	std::unordered_map<std::string, std::pair<Standalone<StringRef>, std::list<std::string>::iterator>> entries;
+};
+
 struct BlobRestoreArg {
 	constexpr static FileIdentifier file_identifier = 947689;
 	Optional<Version> version;
@@ -44,12 +44,14 @@ ACTOR Future<RangeResult> readBlobGranule(BlobGranuleChunkRef chunk,
                                           Version beginVersion,
                                           Version readVersion,
                                           Reference<BlobConnectionProvider> bstore,
-                                          Optional<BlobWorkerStats*> stats = Optional<BlobWorkerStats*>());
+                                          Optional<BlobWorkerStats*> stats = Optional<BlobWorkerStats*>(),
+                                          Reference<BlobGranuleFileCache> fileCache = Reference<BlobGranuleFileCache>());
 
 ACTOR Future<Void> readBlobGranules(BlobGranuleFileRequest request,
                                     BlobGranuleFileReply reply,
                                     Reference<BlobConnectionProvider> bstore,
-                                    PromiseStream<RangeResult> results);
+                                    PromiseStream<RangeResult> results,
+                                    Reference<BlobGranuleFileCache> fileCache = Reference<BlobGranuleFileCache>());
 
 bool isRangeFullyCovered(KeyRange range, Standalone<VectorRef<BlobGranuleChunkRef>> blobChunks);
 
@@ -28,5 +28,6 @@ FDB_DECLARE_BOOLEAN_PARAM(Reverse);
 FDB_DECLARE_BOOLEAN_PARAM(Snapshot);
 FDB_DECLARE_BOOLEAN_PARAM(IsInternal);
 FDB_DECLARE_BOOLEAN_PARAM(AddConflictRange);
+FDB_DECLARE_BOOLEAN_PARAM(UseReadCache);
 FDB_DECLARE_BOOLEAN_PARAM(UseMetrics);
 FDB_DECLARE_BOOLEAN_PARAM(IsSwitchable);
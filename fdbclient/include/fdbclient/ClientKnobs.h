@@ -74,6 +74,10 @@ public:
 	int64_t VALUE_SIZE_LIMIT;
 	int64_t SPLIT_KEY_SIZE_LIMIT;
 	int METADATA_VERSION_CACHE_SIZE;
+	double READ_CACHE_STALENESS_BOUND; // Seconds a cross-transaction read cache entry may be served before expiring
+	int64_t READ_CACHE_MAX_BYTES; // Budget for the cross-transaction read cache; LRU evicted beyond this
+	int WRITE_MAP_FLATTEN_THRESHOLD; // Mutating calls before reads flatten the write map into a sorted array
+	bool SPECIAL_KEY_SPACE_PARALLEL_MODULE_READS; // Fetch independent special-key-space module sub-ranges concurrently
 	int64_t CHANGE_FEED_LOCATION_LIMIT;
 	int64_t CHANGE_FEED_CACHE_SIZE;
 	double CHANGE_FEED_POP_TIMEOUT;
@@ -91,8 +95,11 @@ public:
 	int LOCATION_CACHE_EVICTION_SIZE_SIM;
 	double LOCATION_CACHE_ENDPOINT_FAILURE_GRACE_PERIOD;
 	double LOCATION_CACHE_FAILED_ENDPOINT_RETRY_INTERVAL;
+	std::string LOCATION_CACHE_PERSIST_FILE; // If nonempty, persist the location cache here and prime it at startup
+	double LOCATION_CACHE_PERSIST_INTERVAL;
 
 	int GET_RANGE_SHARD_LIMIT;
+	int GET_RANGE_FANOUT; // Maximum concurrent shard reads in getExactRange; 1 restores sequential shard walking
 	int WARM_RANGE_SHARD_LIMIT;
 	int STORAGE_METRICS_SHARD_LIMIT;
 	int SHARD_COUNT_LIMIT;
@@ -103,9 +110,14 @@ public:
 	double MID_SHARD_SIZE_MAX_STALENESS;
 	bool TAG_ENCODE_KEY_SERVERS;
 	int64_t RANGESTREAM_FRAGMENT_SIZE;
+	int64_t RANGESTREAM_FRAGMENT_SIZE_MIN; // Smallest per-fragment byte budget adaptive streaming will fall back to
 	int RANGESTREAM_BUFFERED_FRAGMENTS_LIMIT;
+	bool PARALLEL_STREAM_ADAPTIVE_CONCURRENCY; // Adjust in-flight fragments and byte budgets from consumer drain rate
+	double PARALLEL_STREAM_CONCURRENCY_ADJUST_INTERVAL;
 	bool QUARANTINE_TSS_ON_MISMATCH;
 	double CHANGE_FEED_EMPTY_BATCH_TIME;
+	double CHANGE_FEED_EMPTY_BATCH_MAX_TIME; // Cadence the consolidated per-storage-server empty version poll backs
+	                                         // off to while every feed on that server is idle
 
 	// KeyRangeMap
 	int KRM_GET_RANGE_LIMIT;
@@ -126,6 +138,8 @@ public:
 	int LOG_RANGE_BLOCK_SIZE;
 	int MUTATION_BLOCK_SIZE;
 	double MAX_VERSION_CACHE_LAG; // The upper bound in seconds for OK amount of staleness when using a cached RV
+	double GRV_CACHE_MAX_STALENESS_LIMIT; // The largest staleness bound in seconds a transaction may request with the
+	                                      // grv_cache_max_staleness option; must stay well inside the MVCC window
 	double MAX_PROXY_CONTACT_LAG; // The upper bound in seconds for how often we want a response from the GRV proxies
 	double DEBUG_USE_GRV_CACHE_CHANCE; // Debug setting to change the chance for a regular GRV request to use the cache
 	bool FORCE_GRV_CACHE_OFF; // Panic button to turn off cache. Holds priority over other options.
@@ -143,10 +157,15 @@ public:
 	int TASKBUCKET_CHECK_ACTIVE_AMOUNT;
 	int TASKBUCKET_TIMEOUT_VERSIONS;
 	int TASKBUCKET_MAX_TASK_KEYS;
+	int TASKBUCKET_SHARD_COUNT; // Number of slices of the available task keyspace that agents spread their
+	                            // task acquisitions across.  Read pattern only, does not affect the layout
+	                            // of tasks on disk.  Maximum 256.
 
 	// Backup
 	int BACKUP_LOCAL_FILE_WRITE_BLOCK;
 	int BACKUP_CONCURRENT_DELETES;
+	int BACKUP_DELETE_BATCH_SIZE; // Number of files per bulk delete request during expiration, capped at the blob
+	                              // store's bulk delete limit
 	int BACKUP_SIMULATED_LIMIT_BYTES;
 	int BACKUP_GET_RANGE_LIMIT_BYTES;
 	int BACKUP_LOCK_BYTES;
@@ -170,11 +189,16 @@ public:
 	int COPY_LOG_PREFETCH_BLOCKS;
 	int COPY_LOG_READ_AHEAD_BYTES;
 	double COPY_LOG_TASK_DURATION_NANOS;
+	int COPY_LOG_WRITE_PARALLELISM; // Maximum concurrent destination commits while copying a DR log range
 	int BACKUP_TASKS_PER_AGENT;
 	int BACKUP_POLL_PROGRESS_SECONDS;
 	int64_t VERSIONS_PER_SECOND; // Copy of SERVER_KNOBS, as we can't link with it
 	int SIM_BACKUP_TASKS_PER_AGENT;
 	int BACKUP_RANGEFILE_BLOCK_SIZE;
+	bool BACKUP_RANGEFILE_WRITE_INDEX; // write a trailing key-range index to snapshot files so readers can
+	                                   // find the blocks relevant to a key range without scanning the file
+	double BACKUP_RANGE_RESPLIT_SECONDS; // a range task writing longer than this sheds its unfinished tail as new
+	                                     // tasks sized by the throughput observed so far
 	int BACKUP_LOGFILE_BLOCK_SIZE;
 	int BACKUP_DISPATCH_ADDTASK_SIZE;
 	int RESTORE_DISPATCH_ADDTASK_SIZE;
@@ -229,6 +253,7 @@ public:
 	int BLOBSTORE_CONCURRENT_REQUESTS;
 	int BLOBSTORE_MULTIPART_MAX_PART_SIZE;
 	int BLOBSTORE_MULTIPART_MIN_PART_SIZE;
+	int BLOBSTORE_MULTIPART_PART_TARGET_SECONDS; // 0 disables adaptive part sizing
 	int BLOBSTORE_CONCURRENT_UPLOADS;
 	int BLOBSTORE_CONCURRENT_LISTS;
 	int BLOBSTORE_CONCURRENT_WRITES_PER_FILE;
@@ -276,6 +301,8 @@ public:
 
 	// Blob Granules
 	int BG_MAX_GRANULE_PARALLELISM;
+	int64_t BG_FILE_CACHE_MAX_BYTES; // Maximum bytes of immutable granule file contents cached per database. 0 disables
+	                                 // the client-side granule file cache.
 	int BG_TOO_MANY_GRANULES;
 	int64_t BLOB_METADATA_REFRESH_INTERVAL;
 
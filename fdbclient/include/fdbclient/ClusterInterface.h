@@ -246,9 +246,15 @@ struct StatusRequest {
 	constexpr static FileIdentifier file_identifier = 14419140;
 	ReplyPromise<struct StatusReply> reply;
 
+	// If set, the reply only carries the client section and the cluster health
+	// essentials, and the cluster controller may serve it from a recent cached
+	// full status instead of gathering a new one. Intended for health checks
+	// that poll much faster than full status generation can be afforded.
+	bool summaryOnly = false;
+
 	template <class Ar>
 	void serialize(Ar& ar) {
-		serializer(ar, reply);
+		serializer(ar, reply, summaryOnly);
 	}
 };
 
@@ -205,6 +205,14 @@ struct CommitID {
 	    conflictingKRIndices(conflictingKRIndices) {}
 };
 
+// Keys in tenant transactions carry the full tenant prefix on the wire even though
+// tenantInfo already identifies the tenant. Eliding the prefix (sending raw keys and
+// re-prepending the prefix proxy-side) would shave several bytes per key for short
+// multi-tenant keys, but it cannot be done locally in this struct: flatbuffers
+// serialization is context-free, so MutationRef and the conflict ranges would need a
+// tenant-aware encoding, and resolvers, TLogs and storage servers all key their data
+// structures by the prefixed key. Any such change needs a protocol feature flag and a
+// coordinated change across those components, not just this request type.
 struct CommitTransactionRequest : TimedRequest {
 	constexpr static FileIdentifier file_identifier = 93948;
 	enum { FLAG_IS_LOCK_AWARE = 0x1, FLAG_FIRST_IN_BATCH = 0x2, FLAG_BYPASS_STORAGE_QUOTA = 0x4 };
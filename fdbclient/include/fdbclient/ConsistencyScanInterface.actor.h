@@ -189,7 +189,11 @@ ACTOR Future<bool> checkDataConsistency(Database cx,
                                         int restart,
                                         int64_t maxRate,
                                         int64_t targetInterval,
-                                        KeyRef progressKey);
+                                        KeyRef progressKey,
+                                        // If present, only check the shards at these (sorted) indices into the
+                                        // shard list derived from keyLocations. Used by callers that schedule
+                                        // shards themselves, e.g. the per-team parallel consistency check.
+                                        Optional<std::vector<int>> shardIndices = Optional<std::vector<int>>());
 
 #include "flow/unactorcompiler.h"
 
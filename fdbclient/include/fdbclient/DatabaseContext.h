@@ -28,6 +28,7 @@
 #include "fdbclient/StorageServerInterface.h"
 #include "flow/IRandom.h"
 #include "flow/genericactors.actor.h"
+#include <list>
 #include <vector>
 #include <unordered_map>
 #pragma once
@@ -77,6 +78,8 @@ struct LocationInfo : MultiInterface<ReferencedInterface<StorageServerInterface>
 using CommitProxyInfo = ModelInterface<CommitProxyInterface>;
 using GrvProxyInfo = ModelInterface<GrvProxyInterface>;
 
+class BlobGranuleFileCache;
+
 class ClientTagThrottleData : NonCopyable {
 private:
 	double tpsRate;
@@ -267,6 +270,9 @@ public:
 	                        int limit,
 	                        Reverse reverse);
 	Reference<LocationInfo> setCachedLocation(const KeyRangeRef&, const std::vector<struct StorageServerInterface>&);
+	// Primes locationCache from the snapshot file named by LOCATION_CACHE_PERSIST_FILE, if any.
+	// Entries are trusted optimistically; stale ones are corrected by the wrong_shard_server path.
+	void loadPersistedLocationCache();
 	void invalidateCache(const Optional<KeyRef>& tenantPrefix, const KeyRef& key, Reverse isBackward = Reverse::False);
 	void invalidateCache(const Optional<KeyRef>& tenantPrefix, const KeyRangeRef& keys);
 
@@ -553,6 +559,8 @@ public:
 	Counter transactionBytesRead;
 	Counter transactionKeysRead;
 	Counter transactionMetadataVersionReads;
+	Counter transactionReadCacheHits;
+	Counter transactionReadCacheMisses;
 	Counter transactionCommittedMutations;
 	Counter transactionCommittedMutationBytes;
 	Counter transactionSetMutations;
@@ -629,9 +637,14 @@ public:
 	bool transactionTracingSample;
 	double verifyCausalReadsProp = 0.0;
 	bool blobGranuleNoMaterialize = false;
+	// Cache of immutable granule file contents, lazily created when BG_FILE_CACHE_MAX_BYTES > 0 and
+	// shared by all granule reads on this database
+	Reference<BlobGranuleFileCache> blobGranuleFileCache;
+	Reference<BlobGranuleFileCache> getBlobGranuleFileCache();
 
 	Future<Void> logger;
 	Future<Void> throttleExpirer;
+	Future<Void> locationCachePersister;
 
 	TaskPriority taskID;
 
@@ -654,6 +667,48 @@ public:
 	int mvCacheInsertLocation;
 	std::vector<std::pair<Version, Optional<Value>>> metadataVersionCache;
 
+	// Cross-transaction read cache
+	// An opt-in database-level point read cache for key ranges the application has declared immutable or
+	// stale-tolerant (reference data that is read by nearly every transaction but rarely changes). Unlike
+	// SnapshotCache, which only lives for one transaction, entries here are shared by all transactions on this
+	// DatabaseContext. Entries are stamped with the version and time at which they were read, served only to
+	// snapshot reads while younger than READ_CACHE_STALENESS_BOUND, and invalidated whenever this client writes
+	// into a cached range. Reads served from the cache do not add read conflict ranges and may be stale up to the
+	// staleness bound, which is exactly the contract the application opts into by declaring the range. Budgeted by
+	// READ_CACHE_MAX_BYTES and evicted in LRU order.
+	struct ReadCache {
+		struct Entry {
+			Optional<Value> value;
+			Version version;
+			double readTime;
+			std::list<Key>::iterator lruPos;
+		};
+		struct KeyCompare {
+			using is_transparent = void;
+			bool operator()(StringRef a, StringRef b) const { return a < b; }
+		};
+
+		// Ordered so that clear ranges can invalidate with a single range scan
+		std::map<Key, Entry, KeyCompare> entries;
+		std::list<Key> lru; // front is most recently used
+		int64_t bytes = 0;
+
+		static int64_t entryBytes(KeyRef key, Optional<Value> const& value);
+		// Returns the cached result for key if it is younger than the staleness bound; expired entries are evicted
+		Optional<Optional<Value>> get(KeyRef key);
+		void insert(KeyRef key, Optional<Value> const& value, Version version);
+		void invalidate(KeyRangeRef range);
+	};
+	KeyRangeMap<bool> readCacheRanges;
+	ReadCache readCache;
+	bool readCacheRangesPresent = false;
+
+	// Declares [range.begin, range.end) (clamped to normalKeys) immutable-or-stale-tolerant and eligible for the
+	// cross-transaction read cache.
+	void addReadCacheRange(const KeyRangeRef& range);
+	bool canServeFromReadCache(const KeyRef& key);
+	void invalidateReadCache(const KeyRangeRef& range);
+
 	HealthMetrics healthMetrics;
 	double healthMetricsLastUpdated;
 	double detailedHealthMetricsLastUpdated;
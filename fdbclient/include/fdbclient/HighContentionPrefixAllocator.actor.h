@@ -59,10 +59,18 @@ private:
 	Subspace counters;
 	Subspace recent;
 
+	// Multiplies the candidate window while allocations keep probing already-claimed
+	// prefixes, spreading concurrent allocations over more candidates. Halved again
+	// after each allocation that succeeds on its first probe.
+	// if thread safety is needed, updates to this should be locked
+	int64_t windowMultiplier = 1;
+	static constexpr int64_t maxWindowMultiplier = 16;
+
 	ACTOR template <class TransactionT>
 	Future<Standalone<StringRef>> allocate(HighContentionPrefixAllocator* self, Reference<TransactionT> tr) {
 		state int64_t start = 0;
 		state int64_t window = 0;
+		state bool probedClaimedPrefix = false;
 
 		loop {
 			state typename TransactionT::template FutureT<RangeResult> rangeFuture =
@@ -109,13 +117,16 @@ private:
 			}
 
 			loop {
-				state int64_t candidate = deterministicRandom()->randomInt(start, start + window);
+				// Under contention, pick candidates from a widened window so concurrent
+				// allocations are less likely to probe the same prefix
+				state int64_t candidate =
+				    deterministicRandom()->randomInt64(start, start + window * self->windowMultiplier);
 
 				// if thread safety is needed, this should be locked {
 				state typename TransactionT::template FutureT<RangeResult> latestCounterFuture =
 				    tr->getRange(self->counters.range(), 1, Snapshot::True, Reverse::True);
 				state typename TransactionT::template FutureT<Optional<Value>> candidateValueFuture =
-				    tr->get(self->recent.get(candidate).key());
+				    tr->get(self->recent.get(candidate).key(), Snapshot::True);
 				tr->setOption(FDBTransactionOptions::NEXT_WRITE_NO_WRITE_CONFLICT_RANGE);
 				tr->set(self->recent.get(candidate).key(), ValueRef());
 				// }
@@ -133,9 +144,20 @@ private:
 				}
 
 				if (!candidateValueFuture.get().present()) {
+					// The candidate was probed at snapshot isolation, so only the prefix
+					// actually claimed carries conflict ranges; probing a prefix that
+					// another transaction claims no longer aborts this transaction
+					tr->addReadConflictRange(singleKeyRange(self->recent.get(candidate).key()));
 					tr->addWriteConflictRange(singleKeyRange(self->recent.get(candidate).key()));
+					if (probedClaimedPrefix) {
+						self->windowMultiplier =
+						    std::min(self->windowMultiplier * 2, HighContentionPrefixAllocator::maxWindowMultiplier);
+					} else {
+						self->windowMultiplier = std::max<int64_t>(self->windowMultiplier / 2, 1);
+					}
 					return Tuple::makeTuple(candidate).pack();
 				}
+				probedClaimedPrefix = true;
 			}
 		}
 	}
@@ -43,6 +43,13 @@ public:
 
 	bool empty() const { return elements == 0; }
 
+	// Preallocate space in the current write segment. Growing a segment copies
+	// it within the arena, and the arena does not reclaim the old allocation
+	// until it dies, so callers that can estimate the final size of what they
+	// are about to build (e.g. from the previous status round) should reserve
+	// it up front to avoid inflating peak memory with growth copies.
+	void reserve(int bytesToReserve) { jsonText.back().reserve(arena, jsonText.back().size() + bytesToReserve); }
+
 	static JsonBuilderObject makeMessage(const char* name, const char* description);
 
 	static int coerceAsciiNumberToJSON(const char* s, int len, char* dst);
@@ -147,6 +147,7 @@ struct StorageMetrics;
 
 struct TransactionOptions {
 	double maxBackoff;
+	double grvCacheMaxStaleness; // 0 means use CLIENT_KNOBS->MAX_VERSION_CACHE_LAG
 	uint32_t getReadVersionFlags;
 	uint32_t sizeLimit;
 	int maxTransactionLoggingFieldLength;
@@ -357,7 +358,11 @@ public:
 	Future<Version> getRawReadVersion();
 	Optional<Version> getCachedReadVersion() const;
 
-	[[nodiscard]] Future<Optional<Value>> get(const Key& key, Snapshot = Snapshot::False);
+	// UseReadCache::False keeps even a snapshot read out of the cross-transaction read cache; RYW passes it for
+	// reads it issues as snapshot reads while managing conflict ranges itself
+	[[nodiscard]] Future<Optional<Value>> get(const Key& key,
+	                                          Snapshot = Snapshot::False,
+	                                          UseReadCache = UseReadCache::True);
 	[[nodiscard]] Future<Void> watch(Reference<Watch> watch);
 	[[nodiscard]] Future<Key> getKey(const KeySelector& key, Snapshot = Snapshot::False);
 	// Future< Optional<KeyValue> > get( const KeySelectorRef& key );
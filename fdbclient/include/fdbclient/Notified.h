@@ -37,9 +37,11 @@ struct Notified {
 	[[nodiscard]] Future<Void> whenAtLeast(const ValueType& limit) {
 		if (val >= limit)
 			return Void();
-		Promise<Void> p;
-		waiting.emplace(limit, p);
-		return p.getFuture();
+		// Waiters with the same threshold share one broadcast promise
+		auto& bucket = waiting[limit];
+		++bucket.count;
+		++totalWaiting;
+		return bucket.promise.getFuture();
 	}
 
 	[[nodiscard]] ValueType get() const { return val; }
@@ -61,10 +63,11 @@ struct Notified {
 			val = v;
 
 			std::vector<Promise<Void>> toSend;
-			while (waiting.size() && v >= waiting.top().first) {
-				Promise<Void> p = std::move(waiting.top().second);
-				waiting.pop();
-				toSend.push_back(p);
+			auto it = waiting.begin();
+			while (it != waiting.end() && v >= it->first) {
+				totalWaiting -= it->second.count;
+				toSend.push_back(std::move(it->second.promise));
+				it = waiting.erase(it);
 			}
 			for (auto& p : toSend) {
 				p.send(Void());
@@ -74,20 +77,27 @@ struct Notified {
 
 	void operator=(const ValueType& v) { set(v); }
 
-	Notified(Notified&& r) noexcept : waiting(std::move(r.waiting)), val(std::move(r.val)) {}
+	Notified(Notified&& r) noexcept
+	  : waiting(std::move(r.waiting)), totalWaiting(r.totalWaiting), val(std::move(r.val)) {}
 	void operator=(Notified&& r) noexcept {
 		waiting = std::move(r.waiting);
+		totalWaiting = r.totalWaiting;
 		val = std::move(r.val);
 	}
 
-	int numWaiting() { return waiting.size(); }
+	int numWaiting() { return totalWaiting; }
 
 private:
-	using Item = std::pair<ValueType, Promise<Void>>;
-	struct ItemCompare {
-		bool operator()(const Item& a, const Item& b) { return a.first > b.first; }
+	// Waiters are bucketed by threshold, in sorted order; all waiters with the same
+	// threshold share a single broadcast promise. Advancing to v therefore touches one
+	// bucket per distinct threshold <= v rather than one entry per waiter, keeping
+	// wake chains short when many requests wait on the same version.
+	struct WaiterBucket {
+		Promise<Void> promise;
+		int count = 0;
 	};
-	std::priority_queue<Item, std::vector<Item>, ItemCompare> waiting;
+	std::map<ValueType, WaiterBucket> waiting;
+	int totalWaiting = 0;
 	T val;
 };
 
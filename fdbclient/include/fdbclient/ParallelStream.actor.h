@@ -28,6 +28,7 @@
 #elif !defined(FDBCLIENT_PARALLEL_STREAM_ACTOR_H)
 #define FDBCLIENT_PARALLEL_STREAM_ACTOR_H
 
+#include "fdbclient/Knobs.h"
 #include "flow/genericactors.actor.h"
 #include "flow/actorcompiler.h" // must be last include
 
@@ -68,6 +69,35 @@ private:
 	size_t fragmentsProcessed{ 0 };
 	PromiseStream<T> results;
 	Future<Void> flusher;
+	size_t bufferLimit;
+
+	// Backpressure-adaptive concurrency. The flusher classifies each wait as either waiting for the consumer to
+	// drain the output stream or waiting for a producer to deliver data, and periodically adjusts the number of
+	// fragments allowed in flight: multiplicative decrease when the consumer is the bottleneck (so a slow consumer
+	// does not buffer an unbounded backlog of fragment data), additive increase when the producers are (so a fast
+	// consumer ramps back up to the full buffer limit).
+	AsyncVar<int64_t> activeFragments{ 0 };
+	double concurrencyTarget;
+	AsyncTrigger concurrencyChanged;
+	double consumerWaitTime = 0;
+	double producerWaitTime = 0;
+	double lastAdjustTime;
+
+	void adjustConcurrency() {
+		if (!CLIENT_KNOBS->PARALLEL_STREAM_ADAPTIVE_CONCURRENCY ||
+		    now() - lastAdjustTime < CLIENT_KNOBS->PARALLEL_STREAM_CONCURRENCY_ADJUST_INTERVAL) {
+			return;
+		}
+		if (consumerWaitTime > producerWaitTime) {
+			concurrencyTarget = std::max<double>(1, concurrencyTarget / 2);
+		} else {
+			concurrencyTarget = std::min<double>(std::max<size_t>(1, bufferLimit), concurrencyTarget + 1);
+		}
+		consumerWaitTime = 0;
+		producerWaitTime = 0;
+		lastAdjustTime = now();
+		concurrencyChanged.trigger();
+	}
 
 public:
 	// A background actor which take results from the oldest fragment and sends them to the main output stream
@@ -79,9 +109,14 @@ public:
 				state Reference<Fragment> fragment = waitNext(self->fragments.getFuture());
 				loop {
 					try {
+						state double waitStart = now();
 						wait(self->results.onEmpty());
+						self->consumerWaitTime += now() - waitStart;
+						waitStart = now();
 						T value = waitNext(fragment->stream.getFuture());
+						self->producerWaitTime += now() - waitStart;
 						self->results.send(value);
+						self->adjustConcurrency();
 						if (++messagesSinceYield == messagesBetweenYields) {
 							wait(yield());
 							messagesSinceYield = 0;
@@ -89,6 +124,7 @@ public:
 					} catch (Error& e) {
 						if (e.code() == error_code_end_of_stream) {
 							fragment.clear();
+							self->activeFragments.set(self->activeFragments.get() - 1);
 							break;
 						} else {
 							throw e;
@@ -105,21 +141,40 @@ public:
 		}
 	}
 
-	ParallelStream(PromiseStream<T> results, size_t bufferLimit) : results(results) {
+	ParallelStream(PromiseStream<T> results, size_t bufferLimit)
+	  : results(results), bufferLimit(bufferLimit), concurrencyTarget(std::max<size_t>(1, bufferLimit)),
+	    lastAdjustTime(now()) {
 		semaphore = makeReference<BoundedFlowLock>(1, bufferLimit);
 		flusher = flushToClient(this);
 	}
 
 	// Creates a fragment to get merged into the main output stream
 	ACTOR static Future<Fragment*> createFragmentImpl(ParallelStream<T>* self) {
+		if (CLIENT_KNOBS->PARALLEL_STREAM_ADAPTIVE_CONCURRENCY) {
+			while (self->activeFragments.get() >= (int64_t)self->concurrencyTarget) {
+				wait(self->activeFragments.onChange() || self->concurrencyChanged.onTrigger());
+			}
+		}
 		int64_t permitNumber = wait(self->semaphore->take());
 		auto fragment = makeReference<Fragment>(self->semaphore, permitNumber, FragmentConstructorTag());
+		self->activeFragments.set(self->activeFragments.get() + 1);
 		self->fragments.send(fragment);
 		return fragment.getPtr();
 	}
 
 	Future<Fragment*> createFragment() { return createFragmentImpl(this); }
 
+	// Returns a per-fragment byte budget in [minBudget, maxBudget], scaled down from maxBudget in proportion to how
+	// far backpressure has lowered the concurrency target, so that a consumer-limited stream both runs fewer
+	// fragments and buffers less data per fragment.
+	int64_t suggestedByteBudget(int64_t minBudget, int64_t maxBudget) const {
+		if (!CLIENT_KNOBS->PARALLEL_STREAM_ADAPTIVE_CONCURRENCY) {
+			return maxBudget;
+		}
+		int64_t budget = maxBudget * concurrencyTarget / std::max<size_t>(1, bufferLimit);
+		return std::clamp(budget, std::min(minBudget, maxBudget), maxBudget);
+	}
+
 	Future<Void> finish() {
 		fragments.sendError(end_of_stream());
 		return flusher;
@@ -143,7 +143,8 @@ public:
 		BlobKnobs();
 		int secure_connection, connect_tries, connect_timeout, max_connection_life, request_tries, request_timeout_min,
 		    requests_per_second, list_requests_per_second, write_requests_per_second, read_requests_per_second,
-		    delete_requests_per_second, multipart_max_part_size, multipart_min_part_size, concurrent_requests,
+		    delete_requests_per_second, multipart_max_part_size, multipart_min_part_size,
+		    multipart_part_target_seconds, concurrent_requests,
 		    concurrent_uploads, concurrent_lists, concurrent_reads_per_file, concurrent_writes_per_file,
 		    enable_read_cache, read_block_size, read_ahead_blocks, read_cache_blocks_per_file,
 		    max_send_bytes_per_second, max_recv_bytes_per_second, sdk_auth, global_connection_pool;
@@ -166,6 +167,9 @@ public:
 				"delete_requests_per_second (or drps)  Max number of delete requests to start per second.",
 				"multipart_max_part_size (or maxps)    Max part size for multipart uploads.",
 				"multipart_min_part_size (or minps)    Min part size for multipart uploads.",
+				"multipart_part_target_seconds (or mpts) Grow part sizes so each part takes roughly this long to "
+				"upload at the observed per-connection throughput, between the min and max part sizes. 0 disables "
+				"adaptive part sizing.",
 				"concurrent_requests (or cr)           Max number of total requests in progress at once, regardless of "
 				"operation-specific concurrency limits.",
 				"concurrent_uploads (or cu)            Max concurrent uploads (part or whole) that can be in progress "
@@ -385,6 +389,11 @@ public:
 	// Delete an object in a bucket
 	Future<Void> deleteObject(std::string const& bucket, std::string const& object);
 
+	// Delete a batch of objects in a bucket with a single bulk delete request.  The caller must keep the
+	// batch size within the blob store's limit (1000 objects for S3).  Throws if the store reports a
+	// failure for any key in the batch.
+	Future<Void> deleteObjects(std::string const& bucket, std::vector<std::string> const& objects);
+
 	// Delete all objects in a bucket under a prefix.  Note this is not atomic as blob store does not
 	// support this operation directly. This method is just a convenience method that lists and deletes
 	// all of the objects in the bucket under the given prefix.
@@ -75,12 +75,19 @@ public:
 	int LOG_SYSTEM_PUSHED_DATA_BLOCK_SIZE;
 	double PEEK_TRACKER_EXPIRATION_TIME;
 	int PARALLEL_GET_MORE_REQUESTS;
+	int64_t PARALLEL_PEEK_WINDOW_BYTES; // When > 0, a parallel peek cursor grows its pipeline beyond
+	                                    // PARALLEL_GET_MORE_REQUESTS until the outstanding bytes cover the link's
+	                                    // bandwidth-delay product, up to this many bytes
+	int PARALLEL_PEEK_MAX_REQUESTS; // Hard cap on outstanding requests when the byte window is enabled
 	int MULTI_CURSOR_PRE_FETCH_LIMIT;
+	bool MERGED_PEEK_PARALLEL_PREFETCH; // Fetch the non-best cursors of a merged peek in parallel with the best server
 	int64_t MAX_QUEUE_COMMIT_BYTES;
 	int DESIRED_OUTSTANDING_MESSAGES;
 	double DESIRED_GET_MORE_DELAY;
 	int CONCURRENT_LOG_ROUTER_READS;
 	int LOG_ROUTER_PEEK_FROM_SATELLITES_PREFERRED; // 0==peek from primary, non-zero==peek from satellites
+	double LOG_ROUTER_POP_FROM_LOG_DELAY; // How long popFromLog waits between pops of a log router, so that pop
+	                                      // versions arriving within the window collapse into one cross-DC request
 	double DISK_QUEUE_ADAPTER_MIN_SWITCH_TIME;
 	double DISK_QUEUE_ADAPTER_MAX_SWITCH_TIME;
 	int64_t TLOG_SPILL_REFERENCE_MAX_PEEK_MEMORY_BYTES;
@@ -112,6 +119,9 @@ public:
 	double PEEK_BATCHING_EMPTY_MSG_INTERVAL;
 	double POP_FROM_LOG_DELAY;
 	double TLOG_PULL_ASYNC_DATA_WARNING_TIMEOUT_SECS;
+	bool ENABLE_TLOG_PEEK_COMPRESSION; // Compress peek replies to log router tags (cross-DC pulls) before sending
+	std::string TLOG_PEEK_COMPRESSION_FILTER; // Filter name understood by CompressionUtils::fromFilterString
+	int TLOG_PEEK_COMPRESSION_MIN_BYTES; // Replies smaller than this are never compressed
 
 	// Data distribution queue
 	double HEALTH_POLL_TIME;
@@ -126,6 +136,10 @@ public:
 	bool DD_QUEUE_COUNTER_SUMMARIZE; // Enable summary of remaining servers when the number of servers with ongoing
 	                                 // relocations in the last minute exceeds DD_QUEUE_COUNTER_MAX_LOG
 	double RELOCATION_PARALLELISM_PER_SOURCE_SERVER;
+	int64_t RELOCATION_FETCH_BYTES_PER_SOURCE_SERVER; // Budget of estimated in-flight relocation bytes per source
+	                                                  // server. Rebalance-class moves wait for budget before fetching;
+	                                                  // team-health moves bypass the budget but still count toward it.
+	                                                  // <= 0 disables the budget.
 	double RELOCATION_PARALLELISM_PER_DEST_SERVER;
 	int DD_QUEUE_MAX_KEY_SERVERS;
 	int DD_REBALANCE_PARALLELISM;
@@ -188,6 +202,14 @@ public:
 	double SHARD_MAX_READ_DENSITY_RATIO;
 	int64_t SHARD_READ_HOT_BANDWIDTH_MIN_PER_KSECONDS;
 	double SHARD_MAX_BYTES_READ_PER_KSEC_JITTER;
+	bool DD_AUTO_STORAGE_CACHE; // Whether the read hot detector automatically populates and depopulates the storage
+	                            // cache role from sustained read-hot ranges
+	double DD_AUTO_STORAGE_CACHE_PROMOTE_DELAY; // How long a range must stay read hot before it is promoted into the
+	                                            // storage cache
+	double DD_AUTO_STORAGE_CACHE_DEMOTE_DELAY; // How long an auto-cached range must go without being reported read hot
+	                                           // before it is removed from the storage cache
+	int64_t DD_AUTO_STORAGE_CACHE_BYTE_BUDGET; // Max total storage bytes of ranges the read hot detector will keep in
+	                                           // the storage cache at once
 	double STORAGE_METRIC_TIMEOUT;
 	double METRIC_DELAY;
 	double ALL_DATA_REMOVED_DELAY;
@@ -222,6 +244,10 @@ public:
 	int MAX_TEAMS_PER_SERVER;
 	int64_t DD_SHARD_SIZE_GRANULARITY;
 	int64_t DD_SHARD_SIZE_GRANULARITY_SIM;
+	bool DD_TRACKER_ON_DEMAND_EVALUATORS; // Only keep split/merge evaluator actors running for shards near a threshold
+	double DD_TRACKER_EVALUATOR_ACTIVATION_FACTOR; // How close to a split or merge threshold a shard must be before its
+	                                               // evaluator is kept running; >= 1.0, larger values keep more
+	                                               // evaluators active
 	int DD_MOVE_KEYS_PARALLELISM;
 	int DD_FETCH_SOURCE_PARALLELISM;
 	int DD_MERGE_LIMIT;
@@ -276,6 +302,8 @@ public:
 	double DD_FAILURE_TIME;
 	double DD_ZERO_HEALTHY_TEAM_DELAY;
 	int DD_BUILD_EXTRA_TEAMS_OVERRIDE; // build extra teams to allow data movement to progress. must be larger than 0
+	int DD_BUILD_TEAMS_BATCH_SIZE; // max server teams built per run-loop iteration; the team builder yields between
+	                               // batches so a large build does not stall the data distributor
 
 	// Run storage enginee on a child process on the same machine with storage process
 	bool REMOTE_KV_STORE;
@@ -283,6 +311,9 @@ public:
 	double REBOOT_KV_STORE_DELAY;
 	// max waiting time for the remote kv store to initialize
 	double REMOTE_KV_STORE_MAX_INIT_DURATION;
+	// Buffer sets and clears to the remote kv store and ship them in one message per roughly this many bytes, rather
+	// than one message per mutation; 0 sends each mutation individually
+	int64_t REMOTE_KV_STORE_MUTATION_BATCH_BYTES;
 
 	// KeyValueStore SQLITE
 	int CLEAR_BUFFER_SIZE;
@@ -321,6 +352,10 @@ public:
 	int SPRING_CLEANING_MIN_VACUUM_PAGES;
 	int SPRING_CLEANING_MAX_VACUUM_PAGES;
 
+	// IKeyValueStore
+	std::string KVSTORE_OP_TRACE_DIR; // if set, storage stores record their operation stream (op, sizes, think time)
+	                                  // to this directory for replay with the kvstoretracereplay role
+
 	// KeyValueStoreMemory
 	int64_t REPLACE_CONTENTS_BYTES;
 
@@ -348,6 +383,13 @@ public:
 	double ROCKSDB_READ_CHECKPOINT_TIMEOUT;
 	int64_t ROCKSDB_CHECKPOINT_READ_AHEAD_SIZE;
 	double ROCKSDB_READ_QUEUE_WAIT;
+	// Attempt point reads inline on the network thread from the block cache only, falling back to
+	// the reader thread pool when the read would require disk IO. Saves two thread hops per
+	// cache-resident read.
+	bool ROCKSDB_INLINE_BLOCK_CACHE_READS;
+	// Maximum number of point reads batched into a single RocksDB MultiGet(). Values <= 1 disable
+	// batching and post one read action per key.
+	int ROCKSDB_MULTIGET_BATCH_SIZE;
 	int ROCKSDB_READ_QUEUE_SOFT_MAX;
 	int ROCKSDB_READ_QUEUE_HARD_MAX;
 	int ROCKSDB_FETCH_QUEUE_SOFT_MAX;
@@ -355,6 +397,9 @@ public:
 	// These histograms are in read and write path which can cause performance overhead.
 	// Set to 0 to disable histograms.
 	double ROCKSDB_HISTOGRAMS_SAMPLE_RATE;
+	// Maximum number of physical shards a multi-shard range read on ShardedRocksDB dispatches to
+	// the reader pool concurrently. 1 keeps the serial single-action path.
+	int ROCKSDB_READ_RANGE_PARALLEL_SHARDS;
 	double ROCKSDB_READ_RANGE_ITERATOR_REFRESH_TIME;
 	bool ROCKSDB_READ_RANGE_REUSE_ITERATORS;
 	bool ROCKSDB_READ_RANGE_REUSE_BOUNDED_ITERATORS;
@@ -408,6 +453,11 @@ public:
 	double START_TRANSACTION_BATCH_INTERVAL_MAX;
 	double START_TRANSACTION_BATCH_INTERVAL_LATENCY_FRACTION;
 	double START_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA;
+	double GRV_LATENCY_TARGET_P99_DEFAULT; // p99 GRV latency (seconds) the adaptive batching controller holds for
+	                                       // default priority; 0 keeps the latency-fraction heuristic
+	double GRV_LATENCY_TARGET_P99_BATCH; // same, for batch priority
+	double GRV_LATENCY_TARGET_ADJUSTMENT_INTERVAL;
+	double GRV_LATENCY_TARGET_ADJUSTMENT_RATE;
 	double START_TRANSACTION_BATCH_QUEUE_CHECK_INTERVAL;
 	double START_TRANSACTION_MAX_TRANSACTIONS_TO_START;
 	int START_TRANSACTION_MAX_REQUESTS_TO_START;
@@ -435,6 +485,8 @@ public:
 	double COMMIT_TRIGGER_DELAY;
 
 	double RESOLVER_COALESCE_TIME;
+	int RESOLVER_CONFLICT_SET_SHARDS; // Number of key-range partitions of the resolver's conflict set; 1 disables
+	                                  // sharding
 	int BUGGIFIED_ROW_LIMIT;
 	double PROXY_SPIN_DELAY;
 	double UPDATE_REMOTE_LOG_VERSION_INTERVAL;
@@ -449,9 +501,12 @@ public:
 	double MAX_COMPUTE_DURATION_LOG_CUTOFF;
 	int PROXY_COMPUTE_BUCKETS;
 	double PROXY_COMPUTE_GROWTH_RATE;
+	int PROXY_PUSH_BUFFER_RESERVE_MAX_BYTES; // Cap on the per-location buffer pre-sizing of LogPushData
+
 	int TXN_STATE_SEND_AMOUNT;
 	double REPORT_TRANSACTION_COST_ESTIMATION_DELAY;
 	bool PROXY_REJECT_BATCH_QUEUED_TOO_LONG;
+	int PROXY_MAX_IN_FLIGHT_COMMIT_BATCHES; // Maximum commit batches between pre-resolution and reply
 	bool PROXY_USE_RESOLVER_PRIVATE_MUTATIONS;
 	bool BURSTINESS_METRICS_ENABLED;
 	// Interval on which to emit burstiness metrics on the commit proxy (in
@@ -471,6 +526,8 @@ public:
 	double COMMIT_SLEEP_TIME;
 	double MIN_BALANCE_TIME;
 	int64_t MIN_BALANCE_DIFFERENCE;
+	double RESOLUTION_BALANCE_FRACTION; // Also require the difference to exceed this fraction of the mean load
+	int RESOLUTION_BALANCE_HYSTERESIS_POLLS; // Consecutive imbalanced polls required before moving a boundary
 	double SECONDS_BEFORE_NO_FAILURE_DELAY;
 	int64_t MAX_TXS_SEND_MEMORY;
 	int64_t MAX_RECOVERY_VERSIONS;
@@ -492,6 +549,7 @@ public:
 	double BACKUP_TIMEOUT; // master's reaction time for backup failure
 	double BACKUP_NOOP_POP_DELAY;
 	int BACKUP_FILE_BLOCK_BYTES;
+	bool BACKUP_WORKER_COMPRESS_LOGS; // write partitioned mutation log blocks zstd-compressed (when built with zstd)
 	int64_t BACKUP_LOCK_BYTES;
 	double BACKUP_UPLOAD_DELAY;
 
@@ -516,6 +574,7 @@ public:
 	double WAIT_FOR_ENCRYPT_KEY_PROXY_JOIN_DELAY;
 	double WORKER_FAILURE_TIME;
 	double CHECK_OUTSTANDING_INTERVAL;
+	double CC_COORDINATOR_RESOLVE_CACHE_TTL; // How long worker registration reuses resolved coordinator addresses
 	double INCOMPATIBLE_PEERS_LOGGING_INTERVAL;
 	double VERSION_LAG_METRIC_INTERVAL;
 	int64_t MAX_VERSION_DIFFERENCE;
@@ -526,6 +585,8 @@ public:
 	double FORCE_RECOVERY_CHECK_DELAY;
 	double RATEKEEPER_FAILURE_TIME;
 	double CONSISTENCYSCAN_FAILURE_TIME;
+	bool CONSISTENCY_SCAN_CHECKSUM_ONLY; // non-quiescent scans compare per-replica range digests and only ship full
+	                                     // key-value content when the digests disagree
 	double BLOB_MANAGER_FAILURE_TIME;
 	double BLOB_MIGRATOR_FAILURE_TIME;
 	double REPLACE_INTERFACE_DELAY;
@@ -580,6 +641,8 @@ public:
 	double RECRUITMENT_TIMEOUT;
 	int DBINFO_SEND_AMOUNT;
 	double DBINFO_BATCH_DELAY;
+	bool DBINFO_BATCH_NOTIFICATIONS; // Coalesce ServerDBInfo change notifications so a burst of updates wakes each
+	                                 // waiter at most once per run loop iteration
 	double SINGLETON_RECRUIT_BME_DELAY;
 
 	// Move Keys
@@ -606,6 +669,10 @@ public:
 
 	// Ratekeeper
 	double SMOOTHING_AMOUNT;
+	double RK_PREDICTION_HORIZON; // Seconds to project storage and tlog queue growth forward when deciding to begin
+	                              // limiting before a queue actually breaches its target; 0 disables prediction
+	double RK_PREDICTION_MAX_RATE_RATIO; // The predictive term alone throttles input at most down to the drain rate
+	                                     // (ratio 1.0); only a real queue breach drains the queue
 	double SLOW_SMOOTHING_AMOUNT;
 	double METRIC_UPDATE_RATE;
 	double DETAILED_METRIC_UPDATE_RATE;
@@ -660,6 +727,8 @@ public:
 	// Limit to the number of throttling tags each storage server
 	// will track and send to the ratekeeper
 	int64_t SS_THROTTLE_TAGS_TRACKED;
+	int SS_THROTTLE_TAG_SKETCH_SIZE; // Number of counters in the space-saving sketch used for read tag accounting;
+	                                 // bounds memory and per-request work regardless of distinct tag count
 	// Use global tag throttling strategy. i.e. throttle based on the cluster-wide
 	// throughput for tags and their associated quotas.
 	bool GLOBAL_TAG_THROTTLING;
@@ -742,6 +811,10 @@ public:
 	double SPLIT_JITTER_AMOUNT;
 	int64_t IOPS_UNITS_PER_SAMPLE;
 	int64_t BYTES_WRITTEN_UNITS_PER_SAMPLE;
+	int64_t BYTES_WRITTEN_SAMPLE_TARGET_ENTRIES; // target size of the write bandwidth sample; <= 0 keeps the fixed
+	                                             // sampling granularity
+	double TRANSIENT_SAMPLE_MAX_DENSITY_FACTOR; // how much finer than the default granularity an adaptive transient
+	                                            // sample is allowed to get while it is below its target size
 	int64_t BYTES_READ_UNITS_PER_SAMPLE;
 	int64_t OPS_READ_UNITES_PER_SAMPLE;
 	int64_t READ_HOT_SUB_RANGE_CHUNK_SIZE;
@@ -757,10 +830,30 @@ public:
 	int BUGGIFY_LIMIT_BYTES;
 	bool FETCH_USING_STREAMING;
 	bool FETCH_USING_BLOB;
+	bool FETCH_USING_CHECKPOINT; // Fetch shards by moving the source's column family SST files and ingesting them,
+	                             // instead of replaying the key-value stream through the commit path
+	int64_t FETCH_USING_CHECKPOINT_MIN_BYTES; // Minimum estimated shard size for which a checkpoint fetch is attempted
 	int FETCH_BLOCK_BYTES;
+	int64_t FETCH_KEYS_DURABLE_CHECKPOINT_BYTES; // Split long streaming fetches at this many fetched bytes so the
+	                                             // fetched prefix becomes durably available and a rebooted destination
+	                                             // resumes from there; <= 0 disables checkpointing
 	int FETCH_KEYS_PARALLELISM_BYTES;
+	bool SS_PARALLEL_READ_RANGE_ENABLED;
+	int64_t SS_HOT_VALUE_CACHE_BYTES;
+	int SS_VERSION_TRIM_NODES_PER_YIELD;
+	double SS_BYTE_SAMPLE_SNAPSHOT_INTERVAL;
+	int SS_BYTE_SAMPLE_SNAPSHOT_CHUNK_BYTES;
+	int64_t SS_BYTE_SAMPLE_SNAPSHOT_MAX_VERSION_LAG;
+	bool SS_COALESCE_ATOMIC_OPS;
+	bool SS_ZERO_COPY_RANGE_REPLY;
+	int64_t SS_PARALLEL_READ_RANGE_MIN_BYTES;
+	int SS_PARALLEL_READ_RANGE_MAX_SUBRANGES;
 	int FETCH_KEYS_PARALLELISM;
 	int FETCH_KEYS_PARALLELISM_CHANGE_FEED;
+	int FETCH_KEYS_PARALLEL_SOURCES;
+	int64_t FETCH_KEYS_PARALLEL_SUBRANGE_BYTES;
+	int64_t FETCH_KEYS_PARALLEL_BUFFER_BYTES;
+	int FETCH_KEYS_PARALLEL_SUBRANGE_RETRIES;
 	int FETCH_KEYS_LOWER_PRIORITY;
 	int SERVE_FETCH_CHECKPOINT_PARALLELISM;
 	int SERVE_AUDIT_STORAGE_PARALLELISM;
@@ -806,6 +899,8 @@ public:
 	int QUICK_GET_KEY_VALUES_LIMIT;
 	int QUICK_GET_KEY_VALUES_LIMIT_BYTES;
 	int STORAGE_FEED_QUERY_HARD_LIMIT;
+	bool STORAGE_FEED_DISK_READS_BYPASS_CACHE; // Read change feed data from disk without caching the results, so feed
+	                                           // streams don't evict real KV data from the storage engine's cache
 	std::string STORAGESERVER_READ_PRIORITIES;
 	int STORAGE_SERVER_READ_CONCURRENCY;
 	std::string STORAGESERVER_READTYPE_PRIORITY_MAP;
@@ -875,6 +970,13 @@ public:
 	// Status
 	double STATUS_MIN_TIME_BETWEEN_REQUESTS;
 	double MAX_STATUS_REQUESTS_PER_SECOND;
+	double LATENCY_PROBE_INTERVAL; // Seconds between continuous synthetic-client latency probes; 0 disables them
+	double LATENCY_PROBE_WINDOW; // Sliding window over which continuous probe DDSketches accumulate
+	double STATUS_WORKER_EVENTS_TTL; // How long cached worker metric/error events may be served in status
+	double STATUS_STORAGE_METRICS_TTL; // How long cached storage server metrics may be served in status
+	double STATUS_LOG_METRICS_TTL; // How long cached tlog metrics may be served in status
+	double STATUS_PROXY_METRICS_TTL; // How long cached commit/GRV proxy metrics may be served in status
+	double STATUS_SUMMARY_MAX_AGE; // Summary-only status requests may be served from a full status this old
 	int CONFIGURATION_ROWS_TO_FETCH;
 	bool DISABLE_DUPLICATE_LOG_WARNING;
 	double HISTOGRAM_REPORT_INTERVAL;
@@ -892,10 +994,15 @@ public:
 	int64_t FASTRESTORE_NUM_APPLIERS;
 	// FASTRESTORE_TXN_BATCH_MAX_BYTES is target txn size used by appliers to apply mutations
 	double FASTRESTORE_TXN_BATCH_MAX_BYTES;
+	// Number of concurrent transaction pipelines an applier uses to commit its disjoint sub-ranges
+	int FASTRESTORE_APPLY_PIPELINES;
 	// FASTRESTORE_VERSIONBATCH_MAX_BYTES is the maximum data size in each version batch
 	double FASTRESTORE_VERSIONBATCH_MAX_BYTES;
 	// FASTRESTORE_VB_PARALLELISM is the number of concurrently running version batches
 	int64_t FASTRESTORE_VB_PARALLELISM;
+	// FASTRESTORE_VB_APPLY_BACKLOG is how many loaded version batches may queue behind the serialized apply
+	// phase; it bounds the mutations appliers buffer while loaders parse ahead
+	int64_t FASTRESTORE_VB_APPLY_BACKLOG;
 	int64_t FASTRESTORE_VB_MONITOR_DELAY; // How quickly monitor finished version batch
 	double FASTRESTORE_VB_LAUNCH_DELAY;
 	int64_t FASTRESTORE_ROLE_LOGGING_DELAY;
@@ -941,6 +1048,8 @@ public:
 	int REDWOOD_DEFAULT_EXTENT_READ_SIZE; // Extent read size for Redwood files
 	int REDWOOD_EXTENT_CONCURRENT_READS; // Max number of simultaneous extent disk reads in progress.
 	bool REDWOOD_KVSTORE_RANGE_PREFETCH; // Whether to use range read prefetching
+	int REDWOOD_RANGE_PREFETCH_WINDOW_BYTES; // Maximum bytes of leaf readahead kept in flight ahead of a range
+	                                         // read's consumption point
 	double REDWOOD_PAGE_REBUILD_MAX_SLACK; // When rebuilding pages, max slack to allow in page before extending it
 	double REDWOOD_PAGE_REBUILD_SLACK_DISTRIBUTION; // When rebuilding pages, use this ratio of slack distribution
 	                                                // between the rightmost (new) page and the previous page. Defaults
@@ -955,18 +1064,35 @@ public:
 	                                  // queue is empty
 	int REDWOOD_LAZY_CLEAR_MAX_PAGES; // Maximum number of pages to free before ending a lazy clear cycle, unless the
 	                                  // queue is empty
+	int64_t REDWOOD_LAZY_CLEAR_URGENT_QUEUE_PAGES; // Lazy delete queue depth above which lazy clear no longer backs
+	                                               // off for foreground IO pressure
 	int64_t REDWOOD_REMAP_CLEANUP_WINDOW_BYTES; // Total size of remapped pages to keep before being removed by
 	                                            // remap cleanup
 	double REDWOOD_REMAP_CLEANUP_TOLERANCE_RATIO; // Maximum ratio of the remap cleanup window that remap cleanup is
 	                                              // allowed to be ahead or behind
+	double REDWOOD_REMAP_CLEANUP_URGENT_RATIO; // Multiple of the remap cleanup window beyond which remap cleanup no
+	                                           // longer backs off for foreground IO pressure
+	double REDWOOD_CLEANUP_IO_BACKOFF_PER_WAITER; // Seconds that background cleanup waits between batches per
+	                                              // operation waiting on the pager's IO lock; 0 disables pacing
+	double REDWOOD_CLEANUP_IO_MAX_BACKOFF; // Maximum seconds that background cleanup waits between batches
 	int REDWOOD_PAGEFILE_GROWTH_SIZE_PAGES; // Number of pages to grow page file by
 	double REDWOOD_METRICS_INTERVAL;
 	double REDWOOD_HISTOGRAM_INTERVAL;
 	bool REDWOOD_EVICT_UPDATED_PAGES; // Whether to prioritize eviction of updated pages from cache.
 	int REDWOOD_DECODECACHE_REUSE_MIN_HEIGHT; // Minimum height for which to keep and reuse page decode caches
 	int REDWOOD_NODE_MAX_UNBALANCE; // Maximum imbalance in a node before it should be rebuilt instead of updated
+	bool REDWOOD_REPLACED_LEAF_SKIP_READ; // Build replacement leaf pages directly from the mutation buffer, without
+	                                      // reading the old page, when a commit fully clears the leaf's key range
+	double REDWOOD_PAGE_CACHE_PROTECTED_FRACTION; // Maximum fraction of the page cache that entries hit more than
+	                                              // once (the protected segment) may occupy
 
 	std::string REDWOOD_IO_PRIORITIES;
+	int REDWOOD_PAGE_ENCODE_THREADS; // Number of threads for running page encryption during writes off the
+	                                 // network thread; 0 encrypts on the network thread
+	int64_t REDWOOD_COMMIT_PIPELINE_MAX_MUTATION_BYTES; // Maximum mutation bytes held by mutation buffers of commits
+	                                                    // still in flight before canCommit() blocks new commits
+
+
 
 	// Server request latency measurement
 	double LATENCY_SKETCH_ACCURACY;
@@ -1014,6 +1140,8 @@ public:
 	bool BG_WRITE_MULTIPART;
 	bool BG_ENABLE_DYNAMIC_WRITE_AMP;
 	double BG_DYNAMIC_WRITE_AMP_MIN_FACTOR;
+	bool BG_ENABLE_EARLY_SPLIT_EVAL; // Evaluate granule splits mid delta-cycle once the granule has outgrown the
+	                                 // split threshold, instead of waiting for the full delta budget
 	double BG_DYNAMIC_WRITE_AMP_DECREASE_FACTOR;
 
 	int BLOB_WORKER_INITIAL_SNAPSHOT_PARALLELISM;
@@ -1050,12 +1178,15 @@ public:
 	bool BLOB_FULL_RESTORE_MODE;
 	double BLOB_MIGRATOR_CHECK_INTERVAL;
 	int BLOB_MANIFEST_RW_ROWS;
+	int BLOB_MANIFEST_LOAD_PARALLELISM; // Concurrent manifest segment loads and granule lookups during restore
 	std::string BLOB_RESTORE_MLOGS_URL;
 	int BLOB_MIGRATOR_ERROR_RETRIES;
 	std::string BLOB_RESTORE_MANIFEST_URL;
 	int BLOB_RESTORE_MANIFEST_FILE_MAX_SIZE;
 	int BLOB_RESTORE_MANIFEST_RETENTION_MAX;
 	int BLOB_RESTORE_MLOGS_RETENTION_SECS;
+	int64_t BLOB_RESTORE_SHARD_BYTES; // Target size of the granule-aligned shards the initial restore assignment is
+	                                  // split into, so data distribution can copy them off the migrator in parallel
 
 	// Blob metadata
 	int64_t BLOB_METADATA_CACHE_TTL;
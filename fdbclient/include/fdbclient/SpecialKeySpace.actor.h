@@ -26,6 +26,8 @@
 #elif !defined(FDBCLIENT_SPECIALKEYSPACE_ACTOR_H)
 #define FDBCLIENT_SPECIALKEYSPACE_ACTOR_H
 
+#include <map>
+
 #include "flow/flow.h"
 #include "flow/Arena.h"
 #include "fdbclient/FDBTypes.h"
@@ -189,6 +191,14 @@ public:
 		READWRITE // The underlying special key range can be called with get, getRange, set, clear
 	};
 
+	// Cumulative client-observed read latency per module, used by the periodic
+	// client trace so management tooling can see which modules are slow to serve
+	struct ModuleReadLatencyStats {
+		int64_t count = 0;
+		double totalLatency = 0;
+		double maxLatency = 0;
+	};
+
 	SpecialKeySpace(KeyRef spaceStartKey = Key(), KeyRef spaceEndKey = normalKeys.end, bool testOnly = true);
 
 	Future<Optional<Value>> get(ReadYourWritesTransaction* ryw, const Key& key);
@@ -235,6 +245,12 @@ public:
 	static Key getManagementApiCommandOptionSpecialKey(const std::string& command, const std::string& option);
 	static const std::set<std::string>& getManagementApiOptionsSet() { return options; }
 	static const std::set<std::string>& getTracingOptions() { return tracingOptions; }
+	static const char* moduleToName(SpecialKeySpace::MODULE module);
+
+	void recordModuleRead(SpecialKeySpace::MODULE module, double latency);
+	const std::map<SpecialKeySpace::MODULE, ModuleReadLatencyStats>& getReadLatencyStats() const {
+		return readLatencyStats;
+	}
 
 private:
 	ACTOR static Future<Optional<Value>> getActor(SpecialKeySpace* sks, ReadYourWritesTransaction* ryw, KeyRef key);
@@ -259,6 +275,8 @@ private:
 	// key space range, (\xff\xff, \xff\xff\xff) in prod and (, \xff) in test
 	KeyRange range;
 
+	std::map<SpecialKeySpace::MODULE, ModuleReadLatencyStats> readLatencyStats;
+
 	static std::unordered_map<SpecialKeySpace::MODULE, KeyRange> moduleToBoundary;
 
 	// management command to its special keys' range
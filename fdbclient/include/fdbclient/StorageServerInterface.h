@@ -123,6 +123,7 @@ struct StorageServerInterface {
 	RequestStream<struct FetchCheckpointKeyValuesRequest> fetchCheckpointKeyValues;
 	RequestStream<struct UpdateCommitCostRequest> updateCommitCostRequest;
 	RequestStream<struct AuditStorageRequest> auditStorage;
+	RequestStream<struct GetRangeDigestRequest> getRangeDigest;
 
 private:
 	bool acceptingRequests;
@@ -198,6 +199,8 @@ public:
 				    RequestStream<struct UpdateCommitCostRequest>(getValue.getEndpoint().getAdjustedEndpoint(22));
 				auditStorage =
 				    RequestStream<struct AuditStorageRequest>(getValue.getEndpoint().getAdjustedEndpoint(23));
+				getRangeDigest =
+				    RequestStream<struct GetRangeDigestRequest>(getValue.getEndpoint().getAdjustedEndpoint(24));
 			}
 		} else {
 			ASSERT(Ar::isDeserializing);
@@ -250,6 +253,7 @@ public:
 		streams.push_back(fetchCheckpointKeyValues.getReceiver());
 		streams.push_back(updateCommitCostRequest.getReceiver());
 		streams.push_back(auditStorage.getReceiver());
+		streams.push_back(getRangeDigest.getReceiver());
 		FlowTransport::transport().addEndpoints(streams);
 	}
 };
@@ -426,6 +430,47 @@ struct GetKeyValuesRequest : TimedRequest {
 	}
 };
 
+// A digest of one page of a key range, used by the consistency scan to compare replicas without
+// shipping their full content off the storage servers. Replicas given the same range, version, and
+// limits scan the same data, so equal digests together with equal counts and end position mean
+// equal content; any difference is re-checked with a full read.
+struct GetRangeDigestReply {
+	constexpr static FileIdentifier file_identifier = 1783072;
+	Version version;
+	uint64_t digest;
+	int64_t keys;
+	int64_t bytes; // logical size of the keys and values covered by the digest
+	Key lastKey;
+	bool more;
+
+	GetRangeDigestReply() : version(invalidVersion), digest(0), keys(0), bytes(0), more(false) {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, version, digest, keys, bytes, lastKey, more);
+	}
+};
+
+struct GetRangeDigestRequest {
+	constexpr static FileIdentifier file_identifier = 1783073;
+	SpanContext spanContext;
+	KeyRange range;
+	Version version;
+	int limit, limitBytes;
+	Optional<ReadOptions> options;
+	ReplyPromise<GetRangeDigestReply> reply;
+	VersionVector ssLatestCommitVersions; // includes the latest commit versions, as known
+	                                      // to this client, of all storage replicas that
+	                                      // serve the given key range
+
+	GetRangeDigestRequest() : version(invalidVersion), limit(0), limitBytes(0) {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, spanContext, range, version, limit, limitBytes, options, reply, ssLatestCommitVersions);
+	}
+};
+
 struct GetMappedKeyValuesReply : public LoadBalancedReply {
 	constexpr static FileIdentifier file_identifier = 1783067;
 	Arena arena;
@@ -305,6 +305,11 @@ private:
 	bool system_access;
 	bool priority_batch;
 	bool lockAware;
+
+	// Shard of the available task keyspace that this instance probes first when acquiring a task.
+	// Assigned randomly per instance so that concurrent agents spread their task acquisitions, and
+	// the conflict ranges those create, across disjoint slices of the keyspace.
+	int homeShard;
 };
 
 class TaskFuture;
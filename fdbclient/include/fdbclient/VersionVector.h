@@ -505,8 +505,9 @@ struct dynamic_size_traits<VersionVector> : std::true_type {
 		size_t encodedSize;
 		if (vv.isEncodedSizeCached()) {
 			encodedSize = vv.getCachedEncodedSize();
-			// @todo remove this assert before doing performance tests
-			ASSERT(encodedSize == vv.getEncodedSize());
+			// Recomputing the encoded size doubles the cost of every serialization, so only
+			// validate the cache in simulation.
+			ASSERT_WE_THINK(encodedSize == vv.getEncodedSize());
 		} else {
 			encodedSize = vv.getEncodedSize();
 			const_cast<VersionVector&>(vv).setCachedEncodedSize(encodedSize);
@@ -532,8 +533,8 @@ struct dynamic_size_traits<VersionVector> : std::true_type {
 		// Serialize vv::maxVersion.
 		vv.serialize<Version>(out, (vv.getMaxVersion()));
 
-		// @todo remove this assert before doing performance tests
-		ASSERT(out - begin == vv.getEncodedSize());
+		// getEncodedSize() makes another full pass over the vector, so only check it in simulation.
+		ASSERT_WE_THINK(out - begin == vv.getEncodedSize());
 	}
 
 	template <class Context>
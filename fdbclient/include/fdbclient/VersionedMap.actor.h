@@ -32,7 +32,9 @@
 #include "flow/actorcompiler.h" // This must be the last #include.
 
 ACTOR template <class Tree>
-Future<Void> deferredCleanupActor(std::vector<Tree> toFree, TaskPriority taskID = TaskPriority::DefaultYield) {
+Future<Void> deferredCleanupActor(std::vector<Tree> toFree,
+                                  TaskPriority taskID = TaskPriority::DefaultYield,
+                                  int nodesPerYield = 100) {
 	state int freeCount = 0;
 	while (!toFree.empty()) {
 		Tree a = std::move(toFree.back());
@@ -43,7 +45,7 @@ Future<Void> deferredCleanupActor(std::vector<Tree> toFree, TaskPriority taskID
 				toFree.push_back(std::move(a->pointer[c]));
 		}
 
-		if (++freeCount % 100 == 0)
+		if (++freeCount % nodesPerYield == 0)
 			wait(yield(taskID));
 	}
 
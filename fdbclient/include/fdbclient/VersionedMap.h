@@ -42,8 +42,91 @@ namespace PTreeImpl {
 #pragma warning(disable : 4800)
 #endif
 
+// Slab pool for PTree nodes. Nodes are bump-allocated out of 4k slabs; freeing a node only decrements its slab's
+// live count, and a slab whose nodes have all died is recycled (or returned) whole. Compared to per-node
+// allocation this eliminates free-list traffic on the insert-heavy MVCC write path, and trimming old versions in
+// forgetVersionsBefore returns memory a slab at a time. Nodes never move, so node references remain stable for
+// the life of the node exactly as with FastAllocator. The pool is thread local because the client can run
+// VersionedMap-backed structures on more than one network thread.
 template <class T>
-struct PTree : public ReferenceCounted<PTree<T>>, FastAllocated<PTree<T>>, NonCopyable {
+class PTreeNodeSlab {
+	static constexpr int slabBytes = 4096;
+	struct Slab {
+		Slab* nextFree;
+		int live; // nodes allocated from this slab and not yet freed
+		int bump; // index of the next unallocated node
+	};
+	static constexpr int align(int s) {
+		return (s + int(alignof(std::max_align_t)) - 1) & ~(int(alignof(std::max_align_t)) - 1);
+	}
+	static constexpr int nodeBytes = align(sizeof(T));
+	static constexpr int headerBytes = align(sizeof(Slab));
+	static constexpr int nodesPerSlab = (slabBytes - headerBytes) / nodeBytes;
+	static_assert(nodesPerSlab > 0, "PTree node too large for a slab");
+
+	static inline thread_local Slab* current = nullptr;
+	static inline thread_local Slab* freeList = nullptr;
+	static inline thread_local int freeSlabCount = 0;
+	static constexpr int maxFreeSlabs = 64;
+
+public:
+	// Amortized per-node memory footprint, including slab header and fragmentation
+	static constexpr int nodeFootprint = slabBytes / nodesPerSlab;
+
+	static void* allocate() {
+		Slab* s = current;
+		if (s == nullptr || s->bump == nodesPerSlab) {
+			if (freeList != nullptr) {
+				s = freeList;
+				freeList = s->nextFree;
+				--freeSlabCount;
+			} else {
+				s = (Slab*)allocateFast4kAligned(slabBytes);
+			}
+			s->nextFree = nullptr;
+			s->live = 0;
+			s->bump = 0;
+			current = s;
+		}
+		void* p = (uint8_t*)s + headerBytes + s->bump * nodeBytes;
+		++s->bump;
+		++s->live;
+		return p;
+	}
+
+	static void release(void* ptr) {
+		Slab* s = (Slab*)(uintptr_t(ptr) & ~uintptr_t(slabBytes - 1));
+		if (--s->live == 0) {
+			if (s == current) {
+				// Everything allocated so far has died, so bump allocation can restart from the beginning
+				s->bump = 0;
+			} else if (freeSlabCount < maxFreeSlabs) {
+				s->nextFree = freeList;
+				freeList = s;
+				++freeSlabCount;
+			} else {
+				freeFast4kAligned(slabBytes, s);
+			}
+		}
+	}
+};
+
+// Drop-in replacement for FastAllocated<> backing object allocation with PTreeNodeSlab
+template <class Object>
+class PTreeSlabAllocated {
+public:
+	[[nodiscard]] static void* operator new(size_t s) {
+		ASSERT(s == sizeof(Object));
+		return PTreeNodeSlab<Object>::allocate();
+	}
+	static void operator delete(void* s) { PTreeNodeSlab<Object>::release(s); }
+	// Redefine placement new so you can still use it
+	static void* operator new(size_t, void* p) { return p; }
+	static void operator delete(void*, void*) {}
+};
+
+template <class T>
+struct PTree : public ReferenceCounted<PTree<T>>, PTreeSlabAllocated<PTree<T>>, NonCopyable {
 	uint32_t priority;
 	Reference<PTree> pointer[3];
 	Version lastUpdateVersion;
@@ -172,42 +255,93 @@ static Reference<PTree<T>> update(Reference<PTree<T>> const& node,
 	}
 }
 
+// Three-way comparison used on the search and insert paths, which can skip a key prefix the caller already knows
+// to be equal. Every key on a search path bounds the keys of the subtree below it, so once a prefix of the search
+// key has matched both a smaller and a larger ancestor, every key in the subtree between them shares that prefix
+// and comparisons can resume past it. The generic overload ignores the hint; string-keyed trees use the
+// prefix-skipping kernel from Arena.h.
 template <class T, class X>
-bool contains(const Reference<PTree<T>>& p, Version at, const X& x) {
+inline int compareWithSkipHint(const X& x, const T& data, int skipLen, int* matchedLen) {
+	*matchedLen = 0;
+	return ::compare(x, data);
+}
+
+template <class Value>
+inline int compareWithSkipHint(const StringRef& x, const MapPair<StringRef, Value>& data, int skipLen, int* matchedLen) {
+	return compareWithPrefixSkip(x, data.key, skipLen, matchedLen);
+}
+
+template <class Value>
+inline int compareWithSkipHint(const StringRef& x,
+                               const MapPair<Standalone<StringRef>, Value>& data,
+                               int skipLen,
+                               int* matchedLen) {
+	return compareWithPrefixSkip(x, data.key, skipLen, matchedLen);
+}
+
+template <class Key, class Value>
+inline int compareWithSkipHint(const MapPair<Key, Value>& x,
+                               const MapPair<Key, Value>& data,
+                               int skipLen,
+                               int* matchedLen) {
+	return compareWithSkipHint(x.key, data, skipLen, matchedLen);
+}
+
+template <class T, class X>
+bool contains(const Reference<PTree<T>>& p, Version at, const X& x, int ltMatched, int gtMatched) {
 	if (!p)
 		return false;
-	int cmp = compare(x, p->data);
+	int matched;
+	int cmp = compareWithSkipHint(x, p->data, std::min(ltMatched, gtMatched), &matched);
 	bool less = cmp < 0;
 	if (cmp == 0)
 		return true;
-	return contains(p->child(!less, at), at, x);
+	(less ? gtMatched : ltMatched) = matched;
+	return contains(p->child(!less, at), at, x, ltMatched, gtMatched);
 }
 
-// TODO: Remove the number of invocations of operator<, and replace with something closer to memcmp.
-// and same for upper_bound.
 template <class T, class X>
-void lower_bound(const Reference<PTree<T>>& p, Version at, const X& x, PTreeFinger<T>& f) {
+bool contains(const Reference<PTree<T>>& p, Version at, const X& x) {
+	return contains(p, at, x, 0, 0);
+}
+
+template <class T, class X>
+void lower_bound(const Reference<PTree<T>>& p, Version at, const X& x, PTreeFinger<T>& f, int ltMatched, int gtMatched) {
 	if (!p) {
 		f.trim_to_bound();
 		return;
 	}
-	int cmp = compare(x, p->data);
+	int matched;
+	int cmp = compareWithSkipHint(x, p->data, std::min(ltMatched, gtMatched), &matched);
 	bool less = cmp < 0;
 	f.push_for_bound(p.getPtr(), less);
 	if (cmp == 0)
 		return;
-	lower_bound(p->child(!less, at), at, x, f);
+	(less ? gtMatched : ltMatched) = matched;
+	lower_bound(p->child(!less, at), at, x, f, ltMatched, gtMatched);
 }
 
 template <class T, class X>
-void upper_bound(const Reference<PTree<T>>& p, Version at, const X& x, PTreeFinger<T>& f) {
+void lower_bound(const Reference<PTree<T>>& p, Version at, const X& x, PTreeFinger<T>& f) {
+	lower_bound(p, at, x, f, 0, 0);
+}
+
+template <class T, class X>
+void upper_bound(const Reference<PTree<T>>& p, Version at, const X& x, PTreeFinger<T>& f, int ltMatched, int gtMatched) {
 	if (!p) {
 		f.trim_to_bound();
 		return;
 	}
-	bool less = x < p->data;
+	int matched;
+	bool less = compareWithSkipHint(x, p->data, std::min(ltMatched, gtMatched), &matched) < 0;
 	f.push_for_bound(p.getPtr(), less);
-	upper_bound(p->child(!less, at), at, x, f);
+	(less ? gtMatched : ltMatched) = matched;
+	upper_bound(p->child(!less, at), at, x, f, ltMatched, gtMatched);
+}
+
+template <class T, class X>
+void upper_bound(const Reference<PTree<T>>& p, Version at, const X& x, PTreeFinger<T>& f) {
+	upper_bound(p, at, x, f, 0, 0);
 }
 
 template <class T, bool forward>
@@ -281,17 +415,19 @@ T get(PTreeFinger<T>& f) {
 
 // Modifies p to point to a PTree with x inserted
 template <class T>
-void insert(Reference<PTree<T>>& p, Version at, const T& x) {
+void insert(Reference<PTree<T>>& p, Version at, const T& x, int ltMatched, int gtMatched) {
 	if (!p) {
 		p = makeReference<PTree<T>>(x, at);
 	} else {
-		int c = ::compare(x, p->data);
+		int matched;
+		int c = compareWithSkipHint(x, p->data, std::min(ltMatched, gtMatched), &matched);
 		if (c == 0) {
 			p = makeReference<PTree<T>>(p->priority, x, p->left(at), p->right(at), at);
 		} else {
 			const bool direction = !(c < 0);
+			(direction ? ltMatched : gtMatched) = matched;
 			Reference<PTree<T>> child = p->child(direction, at);
-			insert(child, at, x);
+			insert(child, at, x, ltMatched, gtMatched);
 			p = update(p, direction, child, at);
 			if (p->child(direction, at)->priority > p->priority)
 				rotate(p, at, !direction);
@@ -299,6 +435,11 @@ void insert(Reference<PTree<T>>& p, Version at, const T& x) {
 	}
 }
 
+template <class T>
+void insert(Reference<PTree<T>>& p, Version at, const T& x) {
+	insert(p, at, x, 0, 0);
+}
+
 template <class T>
 Reference<PTree<T>> firstNode(const Reference<PTree<T>>& p, Version at) {
 	if (!p)
@@ -690,7 +831,7 @@ public:
 	}
 
 	// For each item in the versioned map, 4 PTree nodes are potentially allocated:
-	static const int overheadPerItem = nextFastAllocatedSize(sizeof(PTreeT)) * 4;
+	static const int overheadPerItem = PTreeImpl::PTreeNodeSlab<PTreeT>::nodeFootprint * 4;
 	struct iterator;
 
 	VersionedMap() : oldestVersion(0), latestVersion(0) { roots.emplace_back(0, Tree()); }
@@ -724,7 +865,9 @@ public:
 		oldestVersion = newOldestVersion;
 	}
 
-	Future<Void> forgetVersionsBeforeAsync(Version newOldestVersion, TaskPriority taskID = TaskPriority::DefaultYield) {
+	Future<Void> forgetVersionsBeforeAsync(Version newOldestVersion,
+	                                       TaskPriority taskID = TaskPriority::DefaultYield,
+	                                       int nodesPerYield = 100) {
 		ASSERT_LE(newOldestVersion, latestVersion);
 		auto r = upper_bound(roots.begin(), roots.end(), newOldestVersion, rootsComparator());
 		auto upper = r;
@@ -755,7 +898,7 @@ public:
 
 		roots.erase(roots.begin(), newBegin);
 		oldestVersion = newOldestVersion;
-		return deferredCleanupActor(toFree, taskID);
+		return deferredCleanupActor(toFree, taskID, nodesPerYield);
 	}
 
 public:
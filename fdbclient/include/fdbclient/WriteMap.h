@@ -136,6 +136,7 @@ public:
 
 	WriteMap(WriteMap&& r) noexcept
 	  : arena(r.arena), writeMapEmpty(r.writeMapEmpty), writes(std::move(r.writes)), ver(r.ver),
+	    flat(std::move(r.flat)), mutations(r.mutations), readsSinceLastMutation(r.readsSinceLastMutation),
 	    scratch_iterator(std::move(r.scratch_iterator)) {}
 
 	WriteMap& operator=(WriteMap&& r) noexcept;
@@ -149,13 +150,24 @@ public:
 
 	void addConflictRange(KeyRangeRef keys);
 
+	// A key-ordered array of the tree's nodes at a single version.  Built lazily for write-heavy
+	// transactions so that reads between mutations binary search contiguous memory instead of
+	// descending the tree; invalidated by the next mutation.  Iterators hold a reference so a
+	// snapshot stays usable after the map moves on.
+	struct FlatTree : public ReferenceCounted<FlatTree> {
+		std::vector<PTreeT const*> entries;
+	};
+
 	struct iterator {
 		// Iterates over three types of segments: unmodified ranges, cleared ranges, and modified keys.
 		// Modified keys may be dependent (need to be collapsed with a snapshot value) or independent (value is known
 		// regardless of the snapshot value) Every key will belong to exactly one segment.  The first segment begins at
 		// "" and the last segment ends at \xff\xff.
 
-		explicit iterator(WriteMap* map) : tree(map->writes), at(map->ver), offset(false) { ++map->ver; }
+		explicit iterator(WriteMap* map)
+		  : tree(map->writes), at(map->ver), offset(false), flat(map->flattenForRead()), idx(0) {
+			++map->ver;
+		}
 		// Creates an iterator which is conceptually before the beginning of map (you may essentially only call skip()
 		// or ++ on it) This iterator also represents a snapshot (will be unaffected by future writes)
 
@@ -184,16 +196,22 @@ public:
 		iterator& operator++();
 		iterator& operator--();
 		bool operator==(const iterator& r) const {
+			if (flat || r.flat)
+				return offset == r.offset && &entry() == &r.entry();
 			return offset == r.offset && beginLen == r.beginLen && finger[beginLen - 1] == r.finger[beginLen - 1];
 		}
 		void skip(KeyRef key);
 
+		bool usesFlatSnapshot() const { return flat.isValid(); }
+
 	private:
 		friend class WriteMap;
 		void reset(Tree const& tree, Version ver);
 
-		WriteMapEntry const& entry() const { return finger[beginLen - 1]->data; }
-		WriteMapEntry const& nextEntry() const { return finger[endLen - 1]->data; }
+		WriteMapEntry const& entry() const { return flat ? flat->entries[idx]->data : finger[beginLen - 1]->data; }
+		WriteMapEntry const& nextEntry() const {
+			return flat ? flat->entries[idx + 1]->data : finger[endLen - 1]->data;
+		}
 
 		bool keyAtBegin() { return !offset || !entry().stack.size(); }
 
@@ -202,6 +220,8 @@ public:
 		int beginLen, endLen;
 		PTreeFingerT finger;
 		bool offset; // false-> the operation stack at entry(); true-> the following cleared or unmodified range
+		Reference<FlatTree> flat; // if valid, entry() and movement use idx instead of the finger
+		int idx;
 	};
 
 	bool empty() const { return writeMapEmpty; }
@@ -219,10 +239,24 @@ private:
 	// incremented after reads, so that consecutive writes have the same version and those separated by
 	// reads have different versions.
 	Version ver;
+	Reference<FlatTree> flat; // the current flattened snapshot, or invalid if a mutation occurred since
+	int mutations = 0; // mutating calls over the map's lifetime, used as a cheap size proxy
+	int readsSinceLastMutation = 0;
 	iterator scratch_iterator; // Avoid unnecessary memory allocation in write operations
 
 	void dump();
 
+	// Called by every reading iterator; returns the flattened snapshot to use, building one for
+	// write-heavy maps on the second consecutive read since the last mutation (so alternating
+	// reads and writes never pay the O(n) rebuild), or an invalid reference to walk the tree.
+	Reference<FlatTree> flattenForRead();
+	static void appendToFlat(Tree const& node, Version at, std::vector<PTreeT const*>& out);
+	void noteMutation() {
+		flat.clear();
+		readsSinceLastMutation = 0;
+		++mutations;
+	}
+
 	// SOMEDAY: clearNoConflict replaces cleared sets with two map entries for everyone one item cleared
 	void clearNoConflict(KeyRangeRef keys);
 };
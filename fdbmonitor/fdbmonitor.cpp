@@ -66,6 +66,9 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
 #include <fcntl.h>
 
 #include <syslog.h>
@@ -441,6 +444,73 @@ uint64_t parseWithSuffix(const char* to_parse, const char* default_unit = nullpt
 	return ret;
 }
 
+/* Listening sockets held open by fdbmonitor across child process restarts (see the
+   held-listen-addresses option). Keyed by the configured "ip:port" string. Because the socket
+   never closes while the child is being replaced, the port stays bound and peers queue in the
+   listen backlog instead of seeing connection resets and backing off. */
+std::unordered_map<std::string, int> held_listen_sockets;
+
+/* Returns the held listening socket for the given "ip:port" address, creating it on first use.
+   Returns -1 if the address cannot be parsed or the socket cannot be bound. The socket is marked
+   close-on-exec in fdbmonitor; start_process() clears that flag in children that should inherit
+   it and tells them which fd to adopt via the FDB_HELD_LISTEN_FDS environment variable. */
+int get_held_listen_socket(const std::string& address) {
+	auto itr = held_listen_sockets.find(address);
+	if (itr != held_listen_sockets.end())
+		return itr->second;
+
+	size_t sep = address.rfind(':');
+	if (sep == std::string::npos) {
+		log_msg(SevError, "Held listen address '%s' is not of the form ip:port\n", address.c_str());
+		return -1;
+	}
+
+	std::string host = address.substr(0, sep);
+	int port = atoi(address.substr(sep + 1).c_str());
+	if (port <= 0 || port > 65535) {
+		log_msg(SevError, "Held listen address '%s' has an invalid port\n", address.c_str());
+		return -1;
+	}
+	if (host.size() >= 2 && host[0] == '[' && host[host.size() - 1] == ']')
+		host = host.substr(1, host.size() - 2);
+
+	struct sockaddr_storage sa;
+	memset(&sa, 0, sizeof(sa));
+	socklen_t salen;
+	struct sockaddr_in* sin = (struct sockaddr_in*)&sa;
+	struct sockaddr_in6* sin6 = (struct sockaddr_in6*)&sa;
+	if (inet_pton(AF_INET, host.c_str(), &sin->sin_addr) == 1) {
+		sin->sin_family = AF_INET;
+		sin->sin_port = htons(port);
+		salen = sizeof(*sin);
+	} else if (inet_pton(AF_INET6, host.c_str(), &sin6->sin6_addr) == 1) {
+		sin6->sin6_family = AF_INET6;
+		sin6->sin6_port = htons(port);
+		salen = sizeof(*sin6);
+	} else {
+		log_msg(SevError, "Unable to parse held listen address '%s'\n", address.c_str());
+		return -1;
+	}
+
+	int fd = socket(sa.ss_family, SOCK_STREAM, 0);
+	if (fd < 0) {
+		log_err("socket", errno, "Unable to create held listening socket for %s", address.c_str());
+		return -1;
+	}
+
+	int one = 1;
+	if (fcntl(fd, F_SETFD, FD_CLOEXEC) < 0 || setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) < 0 ||
+	    bind(fd, (struct sockaddr*)&sa, salen) < 0 || listen(fd, SOMAXCONN) < 0) {
+		log_err("bind", errno, "Unable to bind held listening socket for %s", address.c_str());
+		close(fd);
+		return -1;
+	}
+
+	log_msg(SevInfo, "Holding listening socket for %s (fd %d)\n", address.c_str(), fd);
+	held_listen_sockets[address] = fd;
+	return fd;
+}
+
 struct Command {
 private:
 	std::vector<std::string> commands;
@@ -461,6 +531,8 @@ public:
 	bool deconfigured;
 	bool kill_on_configuration_change;
 	uint64_t memory_rss;
+	// Held listening sockets the child should adopt, as (ip:port, fd) pairs
+	std::vector<std::pair<std::string, int>> held_listen_fds;
 
 	// one pair for each of stdout and stderr
 	int pipes[2][2];
@@ -597,6 +669,28 @@ public:
 
 		const char* id_s = ssection.c_str() + strlen(section.c_str()) + 1;
 
+		const char* hla =
+		    get_value_multi(ini, "held-listen-addresses", ssection.c_str(), section.c_str(), "general", nullptr);
+		if (hla) {
+			std::string addresses(hla);
+			std::size_t pos = 0;
+			while ((pos = addresses.find("$ID", pos)) != addresses.npos)
+				addresses.replace(pos, 3, id_s, strlen(id_s));
+
+			std::stringstream as(addresses);
+			std::string address;
+			while (std::getline(as, address, ',')) {
+				if (address.empty())
+					continue;
+				int fd = get_held_listen_socket(address);
+				if (fd < 0) {
+					log_msg(SevError, "Unable to hold listening socket for %s\n", ssection.c_str());
+					return;
+				}
+				held_listen_fds.emplace_back(address, fd);
+			}
+		}
+
 		for (auto i : keys) {
 			// For "memory" option, despite they are handled by fdbmonitor, we still pass it to fdbserver.
 			if (isParameterNameEqual(i.pItem, "command") || isParameterNameEqual(i.pItem, "restart-delay") ||
@@ -605,7 +699,8 @@ public:
 			    isParameterNameEqual(i.pItem, "restart-delay-reset-interval") ||
 			    isParameterNameEqual(i.pItem, "disable-lifecycle-logging") ||
 			    isParameterNameEqual(i.pItem, "delete-envvars") ||
-			    isParameterNameEqual(i.pItem, "kill-on-configuration-change")) {
+			    isParameterNameEqual(i.pItem, "kill-on-configuration-change") ||
+			    isParameterNameEqual(i.pItem, "held-listen-addresses")) {
 				continue;
 			}
 
@@ -654,6 +749,7 @@ public:
 	void update(const Command& other) {
 		quiet = other.quiet;
 		delete_envvars = other.delete_envvars;
+		held_listen_fds = other.held_listen_fds;
 		initial_restart_delay = other.initial_restart_delay;
 		max_restart_delay = other.max_restart_delay;
 		restart_backoff = other.restart_backoff;
@@ -779,6 +875,33 @@ void start_process(Command* cmd, ProcessID id, uid_t uid, gid_t gid, int delay,
 			} while (start <= vars.length());
 		}
 
+		if (!cmd->held_listen_fds.empty()) {
+			std::string held;
+			for (auto& entry : cmd->held_listen_fds) {
+				/* clear close-on-exec so this child inherits the held socket */
+				if (fcntl(entry.second, F_SETFD, 0) < 0) {
+					fprintf(stderr,
+					        "Unable to inherit held listening socket for %s (fcntl error %d: %s)\n",
+					        entry.first.c_str(),
+					        errno,
+					        strerror(errno));
+					exit(1);
+				}
+				if (!held.empty())
+					held += ",";
+				held += entry.first + "=" + std::to_string(entry.second);
+			}
+			fprintf(stdout, "Passing held listening sockets to child: '%s'\n", held.c_str());
+			fflush(stdout);
+			if (setenv("FDB_HELD_LISTEN_FDS", held.c_str(), 1)) {
+				fprintf(stderr,
+				        "Unable to set FDB_HELD_LISTEN_FDS environment variable (setenv error %d: %s)\n",
+				        errno,
+				        strerror(errno));
+				exit(1);
+			}
+		}
+
 #ifdef __linux__
 		signal(SIGCHLD, SIG_DFL);
 
@@ -1032,6 +1155,23 @@ void load_conf(const char* confpath, uid_t& uid, gid_t& gid, sigset_t* mask, fdb
 			}
 		}
 	}
+
+	/* Close held listening sockets that no configured command references anymore */
+	std::unordered_set<std::string> wanted_held_addresses;
+	for (auto& i : id_command) {
+		for (auto& entry : i.second->held_listen_fds) {
+			wanted_held_addresses.insert(entry.first);
+		}
+	}
+	for (auto itr = held_listen_sockets.begin(); itr != held_listen_sockets.end();) {
+		if (!wanted_held_addresses.count(itr->first)) {
+			log_msg(SevInfo, "Closing held listening socket for %s\n", itr->first.c_str());
+			close(itr->second);
+			itr = held_listen_sockets.erase(itr);
+		} else {
+			++itr;
+		}
+	}
 }
 
 /* cmd->pipes[pipe_idx] *must* be ready to read without blocking */
@@ -38,8 +38,11 @@ EvictablePage::~EvictablePage() {
 			pageCache->pages.pop_back();
 		}
 	} else {
-		// remove it from the LRU
-		pageCache->lruPages.erase(EvictablePageCache::List::s_iterator_to(*this));
+		// remove it from whichever LRU segment it is on
+		if (hot)
+			pageCache->protectedPages.erase(EvictablePageCache::List::s_iterator_to(*this));
+		else
+			pageCache->lruPages.erase(EvictablePageCache::List::s_iterator_to(*this));
 	}
 }
 
@@ -134,6 +137,38 @@ Future<Void> AsyncFileCached::read_write_impl(AsyncFileCached* self,
 	return waitForAll(actors);
 }
 
+void AsyncFileCached::maybeIssueReadAhead(int64_t offset, int length) {
+	if (FLOW_KNOBS->CACHE_READAHEAD_BYTES <= 0)
+		return;
+
+	if (offset == nextSequentialReadOffset)
+		++sequentialReads;
+	else
+		sequentialReads = 1;
+	nextSequentialReadOffset = offset + length;
+
+	if (sequentialReads < FLOW_KNOBS->CACHE_READAHEAD_MIN_SEQUENTIAL_READS)
+		return;
+
+	// Start at the first page entirely beyond this read (a partial page was just populated by it) and
+	// stop at the readahead horizon or the end of the file.  Pages already cached cost nothing to skip,
+	// so a steady sequential reader only ever starts reads for the pages newly inside its horizon.
+	int64_t pageOffset = nextSequentialReadOffset - (nextSequentialReadOffset % pageCache->pageSize);
+	if (nextSequentialReadOffset % pageCache->pageSize)
+		pageOffset += pageCache->pageSize;
+	int64_t horizon = std::min(nextSequentialReadOffset + FLOW_KNOBS->CACHE_READAHEAD_BYTES, this->length);
+
+	for (; pageOffset < horizon; pageOffset += pageCache->pageSize) {
+		if (pages.count(pageOffset))
+			continue;
+		AFCPage* page = new AFCPage(this, pageOffset);
+		pages[pageOffset] = page;
+		page->prefetch();
+		++countFileCacheReadAheadPages;
+		++countCacheReadAheadPages;
+	}
+}
+
 Future<Void> AsyncFileCached::readZeroCopy(void** data, int* length, int64_t offset) {
 	++countFileCacheReads;
 	++countCacheReads;
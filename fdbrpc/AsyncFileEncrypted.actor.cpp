@@ -58,6 +58,35 @@ public:
 		return Standalone<StringRef>(decrypted, arena);
 	}
 
+	// Move completed readahead decryptions into the block cache so 'pendingReads' stays small, and
+	// if the current read continues a sequential scan, start reading and decrypting the blocks
+	// beyond it ahead of the consumer.
+	static void issueReadAhead(Reference<AsyncFileEncrypted> self, uint32_t firstBlock, uint32_t lastBlock) {
+		for (auto it = self->pendingReads.begin(); it != self->pendingReads.end();) {
+			if (it->second.isReady()) {
+				if (!it->second.isError()) {
+					self->readBuffers.insert(it->first, it->second.get());
+				}
+				it = self->pendingReads.erase(it);
+			} else {
+				++it;
+			}
+		}
+		const bool sequential = firstBlock <= self->lastReadEndBlock + 1 && lastBlock >= self->lastReadEndBlock;
+		self->lastReadEndBlock = lastBlock;
+		if (!sequential) {
+			return;
+		}
+		for (uint32_t block = lastBlock + 1; block <= lastBlock + FLOW_KNOBS->ENCRYPTION_READAHEAD_BLOCKS; ++block) {
+			if (self->pendingReads.size() >= 2 * FLOW_KNOBS->ENCRYPTION_READAHEAD_BLOCKS) {
+				break;
+			}
+			if (!self->readBuffers.get(block).present() && !self->pendingReads.count(block)) {
+				self->pendingReads.emplace(block, readBlock(self.getPtr(), block));
+			}
+		}
+	}
+
 	ACTOR static Future<int> read(Reference<AsyncFileEncrypted> self, void* data, int length, int64_t offset) {
 		state const uint32_t firstBlock = offset / FLOW_KNOBS->ENCRYPTION_BLOCK_SIZE;
 		state const uint32_t lastBlock = (offset + length - 1) / FLOW_KNOBS->ENCRYPTION_BLOCK_SIZE;
@@ -65,6 +94,7 @@ public:
 		state unsigned char* output = reinterpret_cast<unsigned char*>(data);
 		state int bytesRead = 0;
 		ASSERT(self->mode == AsyncFileEncrypted::Mode::READ_ONLY);
+		issueReadAhead(self, firstBlock, lastBlock);
 		for (block = firstBlock; block <= lastBlock; ++block) {
 			state Standalone<StringRef> plaintext;
 
@@ -72,8 +102,20 @@ public:
 			if (cachedBlock.present()) {
 				plaintext = cachedBlock.get();
 			} else {
-				wait(store(plaintext, readBlock(self.getPtr(), block)));
+				// Wait on the in-flight read for this block if one exists (started by a concurrent
+				// read or by readahead), otherwise start one.
+				state Future<Standalone<StringRef>> blockRead;
+				auto pending = self->pendingReads.find(block);
+				if (pending != self->pendingReads.end()) {
+					CODE_PROBE(true, "AsyncFileEncrypted block read satisfied by readahead");
+					blockRead = pending->second;
+				} else {
+					blockRead = readBlock(self.getPtr(), block);
+				}
+				wait(store(plaintext, blockRead));
+				blockRead = Future<Standalone<StringRef>>();
 				self->readBuffers.insert(block, plaintext);
+				self->pendingReads.erase(block);
 			}
 			auto start = (block == firstBlock) ? plaintext.begin() + (offset % FLOW_KNOBS->ENCRYPTION_BLOCK_SIZE)
 			                                   : plaintext.begin();
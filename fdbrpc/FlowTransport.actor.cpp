@@ -504,6 +504,7 @@ static ReliablePacket* sendPacket(TransportData* self,
 
 ACTOR Future<Void> connectionMonitor(Reference<Peer> peer) {
 	state Endpoint remotePingEndpoint({ peer->destination }, Endpoint::wellKnownToken(WLTOKEN_PING_PACKET));
+	state double lastPingTime = 0;
 	loop {
 		if (!FlowTransport::isClient() && !peer->destination.isPublic() && peer->compatible) {
 			// Don't send ping messages to clients unless necessary. Instead monitor incoming client pings.
@@ -543,8 +544,22 @@ ACTOR Future<Void> connectionMonitor(Reference<Peer> peer) {
 			}
 		}
 
+		state int64_t bytesReceivedBeforeDelay = peer->bytesReceived;
 		wait(delayJittered(FLOW_KNOBS->CONNECTION_MONITOR_LOOP_TIME, TaskPriority::ReadSocket));
 
+		// On a connection that is actively receiving data the traffic itself demonstrates liveness,
+		// so the explicit ping is suppressed. Pings are still sent periodically on busy connections
+		// because peer->pingLatencies feeds degraded-peer detection, which needs a steady sample
+		// population; a stall in data traffic is caught by the bytesReceived check in the ping
+		// timeout handling below.
+		if (FLOW_KNOBS->CONNECTION_MONITOR_BUSY_PING_INTERVAL > 0 &&
+		    now() - lastPingTime < FLOW_KNOBS->CONNECTION_MONITOR_BUSY_PING_INTERVAL &&
+		    peer->bytesReceived > bytesReceivedBeforeDelay) {
+			CODE_PROBE(true, "Connection monitor ping suppressed by data traffic");
+			continue;
+		}
+		lastPingTime = now();
+
 		// TODO: Stop monitoring and close the connection with no onDisconnect requests outstanding
 		state PingRequest pingRequest;
 		FlowTransport::transport().sendUnreliable(SerializeSource<PingRequest>(pingRequest), remotePingEndpoint, true);
@@ -890,7 +905,7 @@ ACTOR Future<Void> connectionKeeper(Reference<Peer> self,
 Peer::Peer(TransportData* transport, NetworkAddress const& destination)
   : transport(transport), destination(destination), compatible(true), connected(false), outgoingConnectionIdle(true),
     lastConnectTime(0.0), reconnectionDelay(FLOW_KNOBS->INITIAL_RECONNECTION_TIME), peerReferences(-1),
-    bytesReceived(0), bytesSent(0), lastDataPacketSentTime(now()), outstandingReplies(0),
+    bytesReceived(0), bytesSent(0), lastDataPacketSentTime(now()), bytesPerPacket(0), outstandingReplies(0),
     pingLatencies(destination.isPublic() ? FLOW_KNOBS->PING_SKETCH_ACCURACY : 0.1), lastLoggedTime(0.0),
     lastLoggedBytesReceived(0), lastLoggedBytesSent(0), timeoutCount(0),
     protocolVersion(Reference<AsyncVar<Optional<ProtocolVersion>>>(new AsyncVar<Optional<ProtocolVersion>>())),
@@ -1790,7 +1805,11 @@ static ReliablePacket* sendPacket(TransportData* self,
 
 	bool firstUnsent = peer->unsent.empty();
 
-	PacketBuffer* pb = peer->unsent.getWriteBuffer();
+	// Pre-size the first buffer of a new chain from this peer's running packet size estimate.  The
+	// flatbuffer body of a message must be contiguous, so a peer whose messages outgrow the default
+	// buffer would otherwise abandon it mid-serialization and allocate again.  Estimates at or below
+	// the default size are clamped to it by PacketBuffer::create and cost nothing.
+	PacketBuffer* pb = peer->unsent.getWriteBuffer(size_t(peer->bytesPerPacket));
 	ReliablePacket* rp = reliable ? new ReliablePacket : 0;
 
 	int prevBytesWritten = pb->bytes_written;
@@ -1821,6 +1840,7 @@ static ReliablePacket* sendPacket(TransportData* self,
 	what.serializePacketWriter(wr);
 	pb = wr.finish();
 	len = wr.size() - packetInfoSize;
+	peer->bytesPerPacket = (7.0 * peer->bytesPerPacket + len) / 8.0;
 
 	if (checksumEnabled) {
 		// Find the correct place to start calculating checksum
@@ -24,6 +24,7 @@
 #include "libb64/encode.h"
 #include "flow/Knobs.h"
 #include <cctype>
+#include <memory>
 #include "flow/IConnection.h"
 
 #include "flow/actorcompiler.h" // has to be last include
@@ -115,19 +116,18 @@ PacketBuffer* writeRequestHeader(std::string const& verb,
 // Read at least 1 bytes from conn and up to maxlen in a single read, append read data into *buf
 // Returns the number of bytes read.
 ACTOR Future<int> read_into_string(Reference<IConnection> conn, std::string* buf, int maxlen) {
+	// Read into a scratch buffer and append only the bytes actually received. Resizing *buf for the
+	// maximum read would zero-initialize maxlen bytes (typically HTTP_READ_SIZE) per read, which costs
+	// far more than copying the bytes a read usually returns. new[] of uint8_t does not initialize.
+	state std::unique_ptr<uint8_t[]> scratch(new uint8_t[maxlen]);
 	loop {
-		// Read into buffer
-		int originalSize = buf->size();
-		// TODO:  resize is zero-initializing the space we're about to overwrite, so do something else, which probably
-		// means not using a string for this buffer
-		buf->resize(originalSize + maxlen);
-		uint8_t* wptr = (uint8_t*)buf->data() + originalSize;
-		int len = conn->read(wptr, wptr + maxlen);
-		buf->resize(originalSize + len);
+		int len = conn->read(scratch.get(), scratch.get() + maxlen);
 
 		// Make sure data was actually read, it's possible for there to be none.
-		if (len > 0)
+		if (len > 0) {
+			buf->append((const char*)scratch.get(), len);
 			return len;
+		}
 
 		// Wait for connection to have something to read
 		wait(conn->onReadable());
@@ -159,10 +159,28 @@ ACTOR Future<size_t> read_delimited_into_string(Reference<IConnection> conn,
 
 // Reads from conn (as needed) until there are at least len bytes starting at pos in buf
 ACTOR Future<Void> read_fixed_into_string(Reference<IConnection> conn, int len, std::string* buf, size_t pos) {
-	state int stop_size = pos + len;
-	while (buf->size() < stop_size)
-		wait(success(read_into_string(conn, buf, FLOW_KNOBS->HTTP_READ_SIZE)));
-	return Void();
+	state size_t stop_size = pos + len;
+	if (buf->size() >= stop_size)
+		return Void();
+
+	// The required size is known, so pay for sizing the buffer once and then read directly into place,
+	// rather than growing it read by read with an append (and a reallocation-and-copy) per packet. Reads
+	// are capped at stop_size so bytes belonging to whatever follows the fixed region stay on the socket.
+	state size_t filled = buf->size();
+	buf->resize(stop_size);
+	loop {
+		uint8_t* wptr = (uint8_t*)buf->data();
+		int n = conn->read(wptr + filled, wptr + stop_size);
+		filled += n;
+		if (filled == stop_size)
+			return Void();
+
+		if (n == 0) {
+			// Wait for connection to have something to read
+			wait(conn->onReadable());
+			wait(delay(0, TaskPriority::ReadSocket));
+		}
+	}
 }
 
 ACTOR Future<Void> read_http_response_headers(Reference<IConnection> conn,
@@ -41,6 +41,7 @@
 #include "fdbrpc/AsyncFileEncrypted.h"
 #include "fdbrpc/AsyncFileWinASIO.actor.h"
 #include "fdbrpc/AsyncFileKAIO.actor.h"
+#include "fdbrpc/AsyncFileIOUring.actor.h"
 #include "flow/AsioReactor.h"
 #include "flow/Platform.h"
 #include "fdbrpc/AsyncFileWriteChecker.h"
@@ -73,7 +74,12 @@ Future<Reference<class IAsyncFile>> Net2FileSystem::open(const std::string& file
 	// EIO.
 	if ((flags & IAsyncFile::OPEN_UNBUFFERED) && !(flags & IAsyncFile::OPEN_NO_AIO) &&
 	    !FLOW_KNOBS->DISABLE_POSIX_KERNEL_AIO)
-		f = AsyncFileKAIO::open(filename, flags, mode, nullptr);
+#ifdef HAS_LIBURING
+		if (FLOW_KNOBS->ENABLE_IO_URING)
+			f = AsyncFileIOUring::open(filename, flags, mode, nullptr);
+		else
+#endif
+			f = AsyncFileKAIO::open(filename, flags, mode, nullptr);
 	else
 #endif
 		f = Net2AsyncFile::open(
@@ -81,6 +87,10 @@ Future<Reference<class IAsyncFile>> Net2FileSystem::open(const std::string& file
 		    flags,
 		    mode,
 		    static_cast<boost::asio::io_service*>((void*)g_network->global(INetwork::enASIOService)));
+	// Wrap the raw backend first, so that instrumentation measures device latency rather than
+	// checksumming or chaos-injected delay.
+	if (FLOW_KNOBS->INSTRUMENT_ASYNC_FILE_IO)
+		f = map(f, [=](Reference<IAsyncFile> r) { return wrapInstrumentedFile(r); });
 	if (FLOW_KNOBS->PAGE_WRITE_CHECKSUM_HISTORY > 0)
 		f = map(f, [=](Reference<IAsyncFile> r) { return Reference<IAsyncFile>(new AsyncFileWriteChecker(r)); });
 	if (FLOW_KNOBS->ENABLE_CHAOS_FEATURES)
@@ -117,8 +127,16 @@ void Net2FileSystem::newFileSystem(double ioTimeout, const std::string& fileSyst
 Net2FileSystem::Net2FileSystem(double ioTimeout, const std::string& fileSystemPath) {
 	Net2AsyncFile::init();
 #ifdef __linux__
-	if (!FLOW_KNOBS->DISABLE_POSIX_KERNEL_AIO)
-		AsyncFileKAIO::init(Reference<IEventFD>(N2::ASIOReactor::getEventFD()), ioTimeout);
+	// Exactly one kernel AIO backend may be initialized: both deliver completions through the reactor's
+	// eventfd and install themselves as the run cycle function.
+	if (!FLOW_KNOBS->DISABLE_POSIX_KERNEL_AIO) {
+#ifdef HAS_LIBURING
+		if (FLOW_KNOBS->ENABLE_IO_URING)
+			AsyncFileIOUring::init(Reference<IEventFD>(N2::ASIOReactor::getEventFD()), ioTimeout);
+		else
+#endif
+			AsyncFileKAIO::init(Reference<IEventFD>(N2::ASIOReactor::getEventFD()), ioTimeout);
+	}
 
 	if (fileSystemPath.empty()) {
 		checkFileSystem = false;
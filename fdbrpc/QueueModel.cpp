@@ -29,8 +29,10 @@ void QueueModel::endRequest(uint64_t id, double latency, double penalty, double
 
 	if (clean) {
 		d.latency = latency;
+		d.smoothLatency.setTotal(latency);
 	} else {
 		d.latency = std::max(d.latency, latency);
+		d.smoothLatency.setTotal(std::max(d.smoothLatency.smoothTotal(), latency));
 	}
 
 	if (futureVersion) {
@@ -74,6 +76,37 @@ Optional<TSSEndpointData> QueueModel::getTssData(uint64_t id) {
 	return data[id].tssData;
 }
 
+void QueueModel::logMetrics(const UID& id) {
+	if (data.empty()) {
+		return;
+	}
+
+	double totalOutstanding = 0;
+	double maxLoad = 0;
+	uint64_t maxLoadEndpoint = 0;
+	int failedEndpoints = 0;
+	for (auto const& [token, d] : data) {
+		totalOutstanding += d.smoothOutstanding.smoothTotal();
+		if (now() < d.failedUntil) {
+			++failedEndpoints;
+		}
+		double load = d.loadEstimate();
+		if (load > maxLoad) {
+			maxLoad = load;
+			maxLoadEndpoint = token;
+		}
+	}
+
+	TraceEvent("QueueModelMetrics", id)
+	    .detail("Endpoints", data.size())
+	    .detail("FailedEndpoints", failedEndpoints)
+	    .detail("MeanOutstanding", totalOutstanding / data.size())
+	    .detail("MaxLoadEstimate", maxLoad)
+	    .detail("MaxLoadEndpoint", maxLoadEndpoint)
+	    .detail("SecondMultiplier", secondMultiplier)
+	    .detail("LaggingRequests", laggingRequestCount);
+}
+
 Optional<LoadBalancedReply> getLoadBalancedReply(const LoadBalancedReply* reply) {
 	return *reply;
 }
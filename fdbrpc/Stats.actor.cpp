@@ -36,18 +36,6 @@ Counter::Counter(std::string const& name, CounterCollection& collection)
 	collection.addCounter(this);
 }
 
-void Counter::operator+=(Value delta) {
-	if (!delta)
-		return; //< Otherwise last_event will be reset
-	interval_delta += delta;
-	auto t = now();
-	auto elapsed = t - last_event;
-	interval_sq_time += elapsed * elapsed;
-	last_event = t;
-
-	metric += delta;
-}
-
 double Counter::getRate() const {
 	double elapsed = now() - interval_start;
 	return elapsed > 0 ? interval_delta / elapsed : 0;
@@ -99,20 +87,29 @@ void CounterCollection::logToTraceEvent(TraceEvent& te) {
 			uint64_t val = c->getValue();
 			switch (c->model) {
 			case MetricsDataModel::OTLP: {
-				if (metrics->sumMap.find(c->id) != metrics->sumMap.end()) {
-					metrics->sumMap[c->id].points.emplace_back(static_cast<int64_t>(val));
+				// Pre-aggregate over the export interval: a cumulative sum only needs its latest value, so
+				// update the pending data point in place rather than appending one (with a fresh pair of
+				// address attributes) per logging interval; the emitter may run much less often than the
+				// logger.
+				auto itr = metrics->sumMap.find(c->id);
+				if (itr != metrics->sumMap.end() && !itr->second.points.empty()) {
+					OTEL::NumberDataPoint& p = itr->second.points.back();
+					p.val = static_cast<int64_t>(val);
+					p.recordTime = now();
 				} else {
-					metrics->sumMap[c->id] = OTEL::OTELSum(name + "." + c->getName(), val);
+					OTEL::OTELSum& sum = metrics->sumMap[c->id] = OTEL::OTELSum(name + "." + c->getName(), val);
+					sum.points.back().addAttribute("ip", ip_str);
+					sum.points.back().addAttribute("port", port_str);
+					sum.points.back().startTime = logTime;
 				}
-				metrics->sumMap[c->id].points.back().addAttribute("ip", ip_str);
-				metrics->sumMap[c->id].points.back().addAttribute("port", port_str);
-				metrics->sumMap[c->id].points.back().startTime = logTime;
+				break;
 			}
 			case MetricsDataModel::STATSD: {
 				std::vector<std::pair<std::string, std::string>> statsd_attributes{ { "ip", ip_str },
 					                                                                { "port", port_str } };
 				metrics->statsd_message.push_back(createStatsdMessage(
 				    c->getName(), StatsDMetric::COUNTER, std::to_string(val) /*, statsd_attributes*/));
+				break;
 			}
 			case MetricsDataModel::NONE:
 			default: {
@@ -261,26 +258,40 @@ void LatencySample::logSample() {
 		case MetricsDataModel::OTLP: {
 			// We only want to emit the entire DDSketch if the knob is set
 			if (FLOW_KNOBS->METRICS_EMIT_DDSKETCH) {
-				if (metrics->histMap.find(IMetric::id) != metrics->histMap.end()) {
-					metrics->histMap[IMetric::id].points.emplace_back(
-					    sketch.getErrorGuarantee(), sketch.getSamples(), sketch.min(), sketch.max(), sketch.getSum());
+				std::vector<uint32_t> samples = sketch.getSamples();
+				auto itr = metrics->histMap.find(IMetric::id);
+				if (itr != metrics->histMap.end() && !itr->second.points.empty() &&
+				    itr->second.points.back().buckets.size() == samples.size()) {
+					// Merge this interval's sketch into the pending data point instead of appending another
+					// multi-thousand bucket snapshot: the bucket boundaries are fixed by the error
+					// guarantee, so merging is an elementwise add plus folding min/max/sum.
+					OTEL::HistogramDataPoint& prev = itr->second.points.back();
+					for (size_t i = 0; i < samples.size(); i++) {
+						samples[i] += prev.buckets[i];
+					}
+					OTEL::HistogramDataPoint mergedPoint(sketch.getErrorGuarantee(),
+					                                     samples,
+					                                     std::min(prev.min, sketch.min()),
+					                                     std::max(prev.max, sketch.max()),
+					                                     prev.sum + sketch.getSum());
+					mergedPoint.attributes = std::move(prev.attributes);
+					mergedPoint.startTime = prev.startTime;
+					itr->second.points.pop_back();
+					itr->second.points.push_back(std::move(mergedPoint));
 				} else {
-					metrics->histMap[IMetric::id] = OTEL::OTELHistogram(name,
-					                                                    sketch.getErrorGuarantee(),
-					                                                    sketch.getSamples(),
-					                                                    sketch.min(),
-					                                                    sketch.max(),
-					                                                    sketch.getSum());
+					metrics->histMap[IMetric::id] = OTEL::OTELHistogram(
+					    name, sketch.getErrorGuarantee(), samples, sketch.min(), sketch.max(), sketch.getSum());
+					metrics->histMap[IMetric::id].points.back().addAttribute("ip", ip_str);
+					metrics->histMap[IMetric::id].points.back().addAttribute("port", port_str);
+					metrics->histMap[IMetric::id].points.back().startTime = sampleEmit;
 				}
-				metrics->histMap[IMetric::id].points.back().addAttribute("ip", ip_str);
-				metrics->histMap[IMetric::id].points.back().addAttribute("port", port_str);
-				metrics->histMap[IMetric::id].points.back().startTime = sampleEmit;
 			}
 			createOtelGauge(p50id, name + "p50", p50);
 			createOtelGauge(p90id, name + "p90", p90);
 			createOtelGauge(p95id, name + "p95", p95);
 			createOtelGauge(p99id, name + "p99", p99);
 			createOtelGauge(p999id, name + "p99_9", p99_9);
+			break;
 		}
 		case MetricsDataModel::STATSD: {
 			std::vector<std::pair<std::string, std::string>> statsd_attributes{ { "ip", ip_str },
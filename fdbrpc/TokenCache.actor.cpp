@@ -8,6 +8,7 @@
 #include "flow/ScopeExit.h"
 #include "flow/UnitTest.h"
 #include "flow/network.h"
+#include "flow/xxhash.h"
 
 #include <rapidjson/document.h>
 #include <rapidjson/writer.h>
@@ -19,6 +20,7 @@
 #include <fmt/format.h>
 #include <list>
 #include <deque>
+#include <vector>
 
 #include "flow/actorcompiler.h" // has to be last include
 
@@ -163,15 +165,35 @@ std::size_t hash_value(AuditEntry const& value) {
 struct TokenCacheImpl {
 	TokenCacheImpl();
 	LRUCache<StringRef, CacheEntry> cache;
+	// Direct-mapped front cache over the LRU, indexed by an XXH3 hash of the token bytes. A hit
+	// costs one fast hash, one load, and a token comparison, and doesn't touch the LRU list, so
+	// the per-request hot path for repeat tokens stays minimal. The LRU remains the source of
+	// truth; slots are republished from it whenever a token falls through.
+	struct FrontCacheSlot {
+		uint64_t tokenHash = 0;
+		StringRef token;
+		CacheEntry entry;
+	};
+	std::vector<FrontCacheSlot> frontCache;
 	boost::unordered_set<AuditEntry> usedTokens;
 	double lastResetTime;
 
 	bool validate(TenantId tenantId, StringRef token);
 	bool validateAndAdd(double currentTime, StringRef token, NetworkAddress const& peer);
 	void logTokenUsage(double currentTime, AuditEntry&& entry);
+
+	static unsigned frontCacheSize() {
+		// smallest power of two >= TOKEN_CACHE_SIZE, so slot selection is a mask
+		unsigned size = 1;
+		while (size < (unsigned)FLOW_KNOBS->TOKEN_CACHE_SIZE) {
+			size <<= 1;
+		}
+		return size;
+	}
 };
 
-TokenCacheImpl::TokenCacheImpl() : cache(FLOW_KNOBS->TOKEN_CACHE_SIZE), usedTokens(), lastResetTime(0) {}
+TokenCacheImpl::TokenCacheImpl()
+  : cache(FLOW_KNOBS->TOKEN_CACHE_SIZE), frontCache(frontCacheSize()), usedTokens(), lastResetTime(0) {}
 
 TokenCache::TokenCache() : impl(new TokenCacheImpl()) {}
 TokenCache::~TokenCache() {
@@ -272,20 +294,36 @@ bool TokenCacheImpl::validateAndAdd(double currentTime, StringRef token, Network
 
 bool TokenCacheImpl::validate(TenantId tenantId, StringRef token) {
 	NetworkAddress peer = FlowTransport::transport().currentDeliveryPeerAddress();
-	auto cachedEntry = cache.get(token);
 	double currentTime = g_network->timer();
 
-	if (!cachedEntry.present()) {
-		if (validateAndAdd(currentTime, token, peer)) {
-			cachedEntry = cache.get(token);
-		} else {
-			return false;
+	const uint64_t tokenHash = XXH3_64bits(token.begin(), token.size());
+	FrontCacheSlot& slot = frontCache[tokenHash & (frontCache.size() - 1)];
+	CacheEntry* entry;
+	if (slot.tokenHash == tokenHash && slot.token == token && currentTime <= slot.entry.expirationTime) {
+		CODE_PROBE(true, "Token validated via front cache");
+		entry = &slot.entry;
+	} else {
+		auto cachedEntry = cache.get(token);
+		if (!cachedEntry.present()) {
+			if (validateAndAdd(currentTime, token, peer)) {
+				cachedEntry = cache.get(token);
+			} else {
+				return false;
+			}
 		}
-	}
 
-	ASSERT(cachedEntry.present());
+		ASSERT(cachedEntry.present());
+		entry = cachedEntry.get();
 
-	auto& entry = cachedEntry.get();
+		if (currentTime <= entry->expirationTime) {
+			// Publish to the front cache so repeat validations of this token skip the LRU. The
+			// copied entry shares the LRU entry's arena; the token copy is made in that arena so
+			// the slot stays self-contained even after the LRU evicts the entry.
+			slot.tokenHash = tokenHash;
+			slot.entry = *entry;
+			slot.token = StringRef(slot.entry.arena, token);
+		}
+	}
 	if (entry->expirationTime < currentTime) {
 		CODE_PROBE(true, "Found expired token in cache");
 		TraceEvent(SevWarn, "InvalidToken"_audit).detail("From", peer).detail("Reason", "ExpiredInCache");
@@ -309,7 +347,7 @@ bool TokenCacheImpl::validate(TenantId tenantId, StringRef token) {
 	}
 	// audit logging
 	if (FLOW_KNOBS->AUDIT_LOGGING_ENABLED)
-		logTokenUsage(currentTime, AuditEntry(peer, tenantId, *cachedEntry.get()));
+		logTokenUsage(currentTime, AuditEntry(peer, tenantId, *entry));
 	return true;
 }
 
@@ -42,36 +42,42 @@ namespace bi = boost::intrusive;
 struct EvictablePage {
 	void* data;
 	int index;
+	bool hot; // under 2Q, true if this page is on the re-referenced (protected) list
+	bool prefetched; // true if this page was created by readahead and has not yet been read by anyone
 	class Reference<struct EvictablePageCache> pageCache;
 	bi::list_member_hook<> member_hook;
 
 	virtual bool evict() = 0; // true if page was evicted, false if it isn't immediately evictable (but will be evicted
 	                          // regardless if possible)
 
-	EvictablePage(Reference<EvictablePageCache> pageCache) : data(0), index(-1), pageCache(pageCache) {}
+	EvictablePage(Reference<EvictablePageCache> pageCache)
+	  : data(0), index(-1), hot(false), prefetched(false), pageCache(pageCache) {}
 	virtual ~EvictablePage();
 };
 
 struct EvictablePageCache : ReferenceCounted<EvictablePageCache> {
 	using List =
 	    bi::list<EvictablePage, bi::member_hook<EvictablePage, bi::list_member_hook<>, &EvictablePage::member_hook>>;
-	enum CacheEvictionType { RANDOM = 0, LRU = 1 };
+	enum CacheEvictionType { RANDOM = 0, LRU = 1, TWOQ = 2 };
 
 	static CacheEvictionType evictionPolicyStringToEnum(const std::string& policy) {
 		std::string cep = policy;
 		std::transform(cep.begin(), cep.end(), cep.begin(), ::tolower);
-		if (cep != "random" && cep != "lru")
+		if (cep != "random" && cep != "lru" && cep != "2q")
 			throw invalid_cache_eviction_policy();
 
 		if (cep == "random")
 			return RANDOM;
-		return LRU;
+		if (cep == "lru")
+			return LRU;
+		return TWOQ;
 	}
 
-	EvictablePageCache() : pageSize(0), maxPages(0), cacheEvictionType(RANDOM) {}
+	EvictablePageCache() : pageSize(0), maxPages(0), maxProtectedPages(0), cacheEvictionType(RANDOM) {}
 
 	explicit EvictablePageCache(int pageSize, int64_t maxSize)
 	  : pageSize(pageSize), maxPages(maxSize / pageSize),
+	    maxProtectedPages(int64_t((maxSize / pageSize) * FLOW_KNOBS->CACHE_PROTECTED_FRACTION)),
 	    cacheEvictionType(evictionPolicyStringToEnum(FLOW_KNOBS->CACHE_EVICTION_POLICY)) {
 		cacheEvictions.init("EvictablePageCache.CacheEvictions"_sr);
 	}
@@ -86,15 +92,44 @@ struct EvictablePageCache : ReferenceCounted<EvictablePageCache> {
 			page->index = pages.size();
 			pages.push_back(page);
 		} else {
+			// Under LRU this is the whole cache; under 2Q it is the probationary segment, which a page
+			// must be re-referenced from before it can displace anything in the protected segment.
 			lruPages.push_back(*page); // new page is considered the most recently used (placed at LRU tail)
 		}
 	}
 
 	void updateHit(EvictablePage* page) {
-		if (RANDOM != cacheEvictionType) {
+		if (RANDOM == cacheEvictionType)
+			return;
+		if (LRU == cacheEvictionType) {
 			// on a hit, update page's location in the LRU so that it's most recent (tail)
 			lruPages.erase(List::s_iterator_to(*page));
 			lruPages.push_back(*page);
+			return;
+		}
+		if (page->prefetched) {
+			// The first read of a readahead page is the access that created it, not a re-reference;
+			// counting it would let a single sequential pass promote its own readahead into the
+			// protected segment.
+			page->prefetched = false;
+			lruPages.erase(List::s_iterator_to(*page));
+			lruPages.push_back(*page);
+			return;
+		}
+		if (page->hot) {
+			protectedPages.erase(List::s_iterator_to(*page));
+			protectedPages.push_back(*page);
+		} else {
+			// Second access: promote out of the probationary segment
+			lruPages.erase(List::s_iterator_to(*page));
+			protectedPages.push_back(*page);
+			page->hot = true;
+			while (protectedPages.size() > (uint64_t)maxProtectedPages) {
+				EvictablePage& demoted = protectedPages.front();
+				protectedPages.pop_front();
+				demoted.hot = false;
+				lruPages.push_back(demoted);
+			}
 		}
 	}
 
@@ -111,15 +146,25 @@ struct EvictablePageCache : ReferenceCounted<EvictablePageCache> {
 				}
 			}
 		} else {
-			// For now, LRU is the only other CACHE_EVICTION option
-			if (lruPages.size() >= (uint64_t)maxPages) {
+			if (lruPages.size() + protectedPages.size() >= (uint64_t)maxPages) {
 				int i = 0;
-				// try the least recently used pages first (starting at head of the LRU list)
+				// try the least recently used pages first (starting at head of the LRU list); under 2Q this
+				// is the probationary segment, so one-shot scans are evicted before anything re-referenced
 				for (List::iterator it = lruPages.begin(); it != lruPages.end() && i < FLOW_KNOBS->MAX_EVICT_ATTEMPTS;
 				     ++it, ++i) { // If we don't manage to evict anything, just go ahead and exceed the cache limit
 					if (it->evict()) {
 						++cacheEvictions;
-						break;
+						return;
+					}
+				}
+				// Nothing probationary was evictable; fall back to the protected segment rather than
+				// exceeding the cache limit outright
+				for (List::iterator it = protectedPages.begin();
+				     it != protectedPages.end() && i < FLOW_KNOBS->MAX_EVICT_ATTEMPTS;
+				     ++it, ++i) {
+					if (it->evict()) {
+						++cacheEvictions;
+						return;
 					}
 				}
 			}
@@ -128,8 +173,10 @@ struct EvictablePageCache : ReferenceCounted<EvictablePageCache> {
 
 	std::vector<EvictablePage*> pages;
 	List lruPages;
+	List protectedPages; // used only under 2Q: pages referenced at least twice, never evicted before lruPages
 	int pageSize;
 	int64_t maxPages;
+	int64_t maxProtectedPages;
 	Int64MetricHandle cacheEvictions;
 	const CacheEvictionType cacheEvictionType;
 };
@@ -170,6 +217,7 @@ public:
 			ASSERT(length >= 0);
 		}
 		auto f = read_write_impl<false>(this, static_cast<uint8_t*>(data), length, offset);
+		maybeIssueReadAhead(offset, length);
 		if (f.isReady() && !f.isError())
 			return length;
 		++countFileCacheReadsBlocked;
@@ -272,6 +320,10 @@ private:
 	int64_t currentTruncateSize;
 	Reference<IRateControl> rateControl;
 
+	// Sequential access detection for readahead
+	int64_t nextSequentialReadOffset;
+	int sequentialReads;
+
 	// Map of pointers which hold page buffers for pages which have been overwritten
 	// but at the time of write there were still readZeroCopy holders.
 	std::unordered_map<void*, int> orphanedPages;
@@ -284,6 +336,7 @@ private:
 	Int64MetricHandle countFileCachePageReadsHit;
 	Int64MetricHandle countFileCachePageReadsMissed;
 	Int64MetricHandle countFileCachePageReadsMerged;
+	Int64MetricHandle countFileCacheReadAheadPages;
 	Int64MetricHandle countFileCacheReadBytes;
 
 	Int64MetricHandle countCacheFinds;
@@ -294,6 +347,7 @@ private:
 	Int64MetricHandle countCachePageReadsHit;
 	Int64MetricHandle countCachePageReadsMissed;
 	Int64MetricHandle countCachePageReadsMerged;
+	Int64MetricHandle countCacheReadAheadPages;
 	Int64MetricHandle countCacheReadBytes;
 
 	AsyncFileCached(Reference<IAsyncFile> uncached,
@@ -301,7 +355,8 @@ private:
 	                int64_t length,
 	                Reference<EvictablePageCache> pageCache)
 	  : filename(filename), uncached(uncached), length(length), prevLength(length), pageCache(pageCache),
-	    currentTruncate(Void()), currentTruncateSize(0), rateControl(nullptr) {
+	    currentTruncate(Void()), currentTruncateSize(0), rateControl(nullptr), nextSequentialReadOffset(-1),
+	    sequentialReads(0) {
 		if (!g_network->isSimulated()) {
 			countFileCacheWrites.init("AsyncFile.CountFileCacheWrites"_sr, filename);
 			countFileCacheReads.init("AsyncFile.CountFileCacheReads"_sr, filename);
@@ -310,6 +365,7 @@ private:
 			countFileCachePageReadsHit.init("AsyncFile.CountFileCachePageReadsHit"_sr, filename);
 			countFileCachePageReadsMissed.init("AsyncFile.CountFileCachePageReadsMissed"_sr, filename);
 			countFileCachePageReadsMerged.init("AsyncFile.CountFileCachePageReadsMerged"_sr, filename);
+			countFileCacheReadAheadPages.init("AsyncFile.CountFileCacheReadAheadPages"_sr, filename);
 			countFileCacheFinds.init("AsyncFile.CountFileCacheFinds"_sr, filename);
 			countFileCacheReadBytes.init("AsyncFile.CountFileCacheReadBytes"_sr, filename);
 
@@ -320,6 +376,7 @@ private:
 			countCachePageReadsHit.init("AsyncFile.CountCachePageReadsHit"_sr);
 			countCachePageReadsMissed.init("AsyncFile.CountCachePageReadsMissed"_sr);
 			countCachePageReadsMerged.init("AsyncFile.CountCachePageReadsMerged"_sr);
+			countCacheReadAheadPages.init("AsyncFile.CountCacheReadAheadPages"_sr);
 			countCacheFinds.init("AsyncFile.CountCacheFinds"_sr);
 			countCacheReadBytes.init("AsyncFile.CountCacheReadBytes"_sr);
 		}
@@ -367,6 +424,10 @@ private:
 	                                    int length,
 	                                    int64_t offset);
 
+	// Called with every read's offset and length; starts background reads of the pages following a
+	// detected sequential access pattern
+	void maybeIssueReadAhead(int64_t offset, int length);
+
 	void remove_page(AFCPage* page);
 };
 
@@ -485,6 +546,14 @@ struct AFCPage : public EvictablePage, public FastAllocated<AFCPage> {
 		return notReading;
 	}
 
+	// Start reading this page from disk because a sequential reader is expected to want it soon.  The
+	// prefetched flag keeps that reader's first access from counting as a re-reference under 2Q eviction.
+	void prefetch() {
+		ASSERT(!valid && notReading.isReady());
+		prefetched = true;
+		notReading = readThrough(this);
+	}
+
 	ACTOR static Future<Void> waitAndRead(AFCPage* self, void* data, int length, int offset) {
 		wait(self->notReading);
 		memcpy(data, static_cast<uint8_t const*>(self->data) + offset, length);
@@ -56,6 +56,12 @@ private:
 		Optional<Standalone<StringRef>> get(uint32_t block) const;
 	} readBuffers;
 
+	// Blocks currently being read and decrypted, keyed by block number. Used both to deduplicate
+	// concurrent reads of the same block and to hold readahead decryptions until a sequential
+	// reader consumes them (see ENCRYPTION_READAHEAD_BLOCKS).
+	std::unordered_map<uint32_t, Future<Standalone<StringRef>>> pendingReads;
+	uint32_t lastReadEndBlock{ 0 };
+
 	// Writing (append only):
 	std::unique_ptr<EncryptionStreamCipher> encryptor;
 	uint32_t currentBlock{ 0 };
@@ -0,0 +1,684 @@
+/*
+ * AsyncFileIOUring.actor.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#if defined(__linux__) && defined(HAS_LIBURING)
+
+// When actually compiled (NO_INTELLISENSE), include the generated version of this file.  In intellisense use the source
+// version.
+#if defined(NO_INTELLISENSE) && !defined(FLOW_ASYNCFILEIOURING_ACTOR_G_H)
+#define FLOW_ASYNCFILEIOURING_ACTOR_G_H
+#include "fdbrpc/AsyncFileIOUring.actor.g.h"
+#elif !defined(FLOW_ASYNCFILEIOURING_ACTOR_H)
+#define FLOW_ASYNCFILEIOURING_ACTOR_H
+
+#include "flow/IAsyncFile.h"
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/eventfd.h>
+#include <liburing.h>
+#include "fdbrpc/AsyncFileEIO.actor.h"
+#include "flow/Knobs.h"
+#include "fdbrpc/Stats.h"
+#include "flow/genericactors.actor.h"
+#include "flow/actorcompiler.h" // This must be the last #include.
+
+// An io_uring-backed unbuffered file.  Like AsyncFileKAIO, requests are queued until the end of the run loop
+// and submitted with a single syscall, but unlike KAIO the ring also executes fdatasync, so a sync does not
+// take a detour through the EIO thread pool.  Completions are delivered through the network loop's eventfd.
+class AsyncFileIOUring final : public IAsyncFile, public ReferenceCounted<AsyncFileIOUring> {
+public:
+	struct AsyncFileIOUringMetrics {
+		LatencySample readLatencySample = { "AsyncFileIOUringReadLatency",
+			                                UID(),
+			                                FLOW_KNOBS->IO_URING_LATENCY_LOGGING_INTERVAL,
+			                                FLOW_KNOBS->IO_URING_LATENCY_SKETCH_ACCURACY };
+		LatencySample writeLatencySample = { "AsyncFileIOUringWriteLatency",
+			                                 UID(),
+			                                 FLOW_KNOBS->IO_URING_LATENCY_LOGGING_INTERVAL,
+			                                 FLOW_KNOBS->IO_URING_LATENCY_SKETCH_ACCURACY };
+		LatencySample syncLatencySample = { "AsyncFileIOUringSyncLatency",
+			                                UID(),
+			                                FLOW_KNOBS->IO_URING_LATENCY_LOGGING_INTERVAL,
+			                                FLOW_KNOBS->IO_URING_LATENCY_SKETCH_ACCURACY };
+	};
+
+	static AsyncFileIOUringMetrics& getMetrics() {
+		static AsyncFileIOUringMetrics metrics;
+		return metrics;
+	}
+
+	static Future<Reference<IAsyncFile>> open(std::string filename, int flags, int mode, void* ignore) {
+		ASSERT(FLOW_KNOBS->ENABLE_IO_URING);
+		ASSERT(flags & OPEN_UNBUFFERED);
+
+		if (flags & OPEN_LOCK)
+			mode |= 02000; // Enable mandatory locking for this file if it is supported by the filesystem
+
+		std::string open_filename = filename;
+		if (flags & OPEN_ATOMIC_WRITE_AND_CREATE) {
+			ASSERT((flags & OPEN_CREATE) && (flags & OPEN_READWRITE) && !(flags & OPEN_EXCLUSIVE));
+			open_filename = filename + ".part";
+		}
+
+		int fd = ::open(open_filename.c_str(), openFlags(flags), mode);
+		if (fd < 0) {
+			Error e = errno == ENOENT ? file_not_found() : io_error();
+			TraceEvent ev("AsyncFileIOUringOpenFailed");
+			ev.error(e)
+			    .detail("Filename", filename)
+			    .detailf("Flags", "%x", flags)
+			    .detailf("OSFlags", "%x", openFlags(flags))
+			    .detailf("Mode", "0%o", mode)
+			    .GetLastError();
+			return e;
+		} else {
+			TraceEvent("AsyncFileIOUringOpen")
+			    .detail("Filename", filename)
+			    .detail("Flags", flags)
+			    .detail("Mode", mode)
+			    .detail("Fd", fd);
+		}
+
+		Reference<AsyncFileIOUring> r(new AsyncFileIOUring(fd, flags, filename));
+
+		if (flags & OPEN_LOCK) {
+			// Acquire a "write" lock for the entire file
+			flock lockDesc;
+			lockDesc.l_type = F_WRLCK;
+			lockDesc.l_whence = SEEK_SET;
+			lockDesc.l_start = 0;
+			lockDesc.l_len = 0;
+			lockDesc.l_pid = 0;
+			if (fcntl(fd, F_SETLK, &lockDesc) == -1) {
+				TraceEvent(SevWarn, "UnableToLockFile").detail("Filename", filename).GetLastError();
+				return lock_file_failure();
+			}
+		}
+
+		struct stat buf;
+		if (fstat(fd, &buf)) {
+			TraceEvent("AsyncFileIOUringFStatError").detail("Fd", fd).detail("Filename", filename).GetLastError();
+			return io_error();
+		}
+
+		r->lastFileSize = r->nextFileSize = buf.st_size;
+		return Reference<IAsyncFile>(std::move(r));
+	}
+
+	static void init(Reference<IEventFD> ev, double ioTimeout) {
+		ASSERT(FLOW_KNOBS->ENABLE_IO_URING);
+		if (!g_network->isSimulated()) {
+			ctx.countSubmit.init("AsyncFile.CountIOUringSubmit"_sr);
+			ctx.countCollect.init("AsyncFile.CountIOUringCollect"_sr);
+			ctx.countPreSubmitTruncate.init("AsyncFile.CountPreIOUringSubmitTruncate"_sr);
+			ctx.preSubmitTruncateBytes.init("AsyncFile.PreIOUringSubmitTruncateBytes"_sr);
+		}
+
+		// Newer kernels can skip the completion-side IPI (COOP_TASKRUN) and per-submission locking
+		// (SINGLE_ISSUER; safe because only the network thread ever submits).  queue_init rejects
+		// flags the running kernel does not recognize, so fall back to a bare ring in that case.
+		unsigned setupFlags = 0;
+#ifdef IORING_SETUP_COOP_TASKRUN
+		setupFlags |= IORING_SETUP_COOP_TASKRUN;
+#endif
+#ifdef IORING_SETUP_SINGLE_ISSUER
+		setupFlags |= IORING_SETUP_SINGLE_ISSUER;
+#endif
+		int rc = io_uring_queue_init(FLOW_KNOBS->MAX_OUTSTANDING, &ctx.ring, setupFlags);
+		if (rc < 0 && setupFlags) {
+			TraceEvent("IOUringSetupFlagsUnsupported").detail("Flags", setupFlags).detail("ReturnCode", rc);
+			rc = io_uring_queue_init(FLOW_KNOBS->MAX_OUTSTANDING, &ctx.ring, 0);
+		}
+		if (rc < 0) {
+			TraceEvent("IOUringSetupError").detail("ReturnCode", rc).GetLastError();
+			throw io_error();
+		}
+		// Completions wake the run loop through the same eventfd the reactor already polls
+		rc = io_uring_register_eventfd(&ctx.ring, ev->getFD());
+		if (rc < 0) {
+			TraceEvent("IOUringRegisterEventFDError").detail("ReturnCode", rc).GetLastError();
+			throw io_error();
+		}
+		if (FLOW_KNOBS->IO_URING_REGISTER_FILES) {
+			// Register a sparse file table up front so long-lived files (notably storage engine data
+			// files) can pin their fds into it and skip the per-submission fd lookup.  Sparse tables
+			// need kernel 5.19; older kernels just run with unregistered fds.
+			rc = io_uring_register_files_sparse(&ctx.ring, FLOW_KNOBS->IO_URING_MAX_REGISTERED_FILES);
+			if (rc < 0) {
+				TraceEvent(SevWarnAlways, "IOUringRegisterFilesUnsupported").detail("ReturnCode", rc);
+			} else {
+				ctx.fixedFilesSupported = true;
+				for (int i = FLOW_KNOBS->IO_URING_MAX_REGISTERED_FILES - 1; i >= 0; i--)
+					ctx.freeFixedFileSlots.push_back(i);
+			}
+		}
+		setTimeout(ioTimeout);
+		ctx.evfd = ev->getFD();
+		poll(ev);
+
+		g_network->setGlobal(INetwork::enRunCycleFunc, (flowGlobalType)&AsyncFileIOUring::launch);
+	}
+
+	static int get_eventfd() { return ctx.evfd; }
+	static void setTimeout(double ioTimeout) { ctx.setIOTimeout(ioTimeout); }
+
+	void addref() override { ReferenceCounted<AsyncFileIOUring>::addref(); }
+	void delref() override { ReferenceCounted<AsyncFileIOUring>::delref(); }
+
+	Future<int> read(void* data, int length, int64_t offset) override {
+		++countFileLogicalReads;
+		++countLogicalReads;
+
+		if (failed) {
+			return io_timeout();
+		}
+
+		IOBlock* io = new IOBlock(IOBlock::READ, fd);
+		io->buf = data;
+		io->nbytes = length;
+		io->offset = offset;
+
+		enqueue(io, this);
+		return io->result.getFuture();
+	}
+
+	Future<Void> write(void const* data, int length, int64_t offset) override {
+		++countFileLogicalWrites;
+		++countLogicalWrites;
+
+		if (failed) {
+			return io_timeout();
+		}
+
+		IOBlock* io = new IOBlock(IOBlock::WRITE, fd);
+		io->buf = (void*)data;
+		io->nbytes = length;
+		io->offset = offset;
+
+		nextFileSize = std::max(nextFileSize, offset + length);
+
+		enqueue(io, this);
+		return success(io->result.getFuture());
+	}
+
+#ifndef FALLOC_FL_ZERO_RANGE
+#define FALLOC_FL_ZERO_RANGE 0x10
+#endif
+	Future<Void> zeroRange(int64_t offset, int64_t length) override {
+		bool success = false;
+		if (ctx.fallocateZeroSupported) {
+			int rc = fallocate(fd, FALLOC_FL_ZERO_RANGE, offset, length);
+			if (rc == EOPNOTSUPP) {
+				ctx.fallocateZeroSupported = false;
+			}
+			if (rc == 0) {
+				success = true;
+			}
+		}
+		return success ? Void() : IAsyncFile::zeroRange(offset, length);
+	}
+
+	Future<Void> truncate(int64_t size) override {
+		++countFileLogicalWrites;
+		++countLogicalWrites;
+
+		if (failed) {
+			return io_timeout();
+		}
+
+		int result = -1;
+		bool completed = false;
+		double begin = timer_monotonic();
+
+		if (ctx.fallocateSupported && size >= lastFileSize) {
+			result = fallocate(fd, 0, 0, size);
+			if (result != 0) {
+				int fallocateErrCode = errno;
+				TraceEvent("AsyncFileIOUringAllocateError")
+				    .detail("Fd", fd)
+				    .detail("Filename", filename)
+				    .detail("Size", size)
+				    .GetLastError();
+				if (fallocateErrCode == EOPNOTSUPP) {
+					// Mark fallocate as unsupported. Try again with truncate.
+					ctx.fallocateSupported = false;
+				} else {
+					return io_error();
+				}
+			} else {
+				completed = true;
+			}
+		}
+		if (!completed)
+			result = ftruncate(fd, size);
+
+		double end = timer_monotonic();
+		if (nondeterministicRandom()->random01() < end - begin) {
+			TraceEvent("SlowIOUringTruncate")
+			    .detail("TruncateTime", end - begin)
+			    .detail("TruncateBytes", size - lastFileSize);
+		}
+
+		if (result != 0) {
+			TraceEvent("AsyncFileIOUringTruncateError").detail("Fd", fd).detail("Filename", filename).GetLastError();
+			return io_error();
+		}
+
+		lastFileSize = nextFileSize = size;
+
+		return Void();
+	}
+
+	// Unlike KAIO, the ring executes fdatasync itself: the sync is ordered through the same submission path
+	// as the writes it covers and completes without a thread pool hop.
+	Future<Void> sync() override {
+		++countFileLogicalWrites;
+		++countLogicalWrites;
+
+		if (failed) {
+			return io_timeout();
+		}
+
+		double start_time = timer();
+
+		IOBlock* io = new IOBlock(IOBlock::FSYNC, fd);
+		enqueue(io, this);
+
+		Future<Void> fsync = success(io->result.getFuture());
+		fsync = map(fsync, [=](Void r) {
+			getMetrics().syncLatencySample.addMeasurement(timer() - start_time);
+			return r;
+		});
+
+		if (flags & OPEN_ATOMIC_WRITE_AND_CREATE) {
+			flags &= ~OPEN_ATOMIC_WRITE_AND_CREATE;
+
+			return AsyncFileEIO::waitAndAtomicRename(fsync, filename + ".part", filename);
+		}
+
+		return fsync;
+	}
+
+	Future<int64_t> size() const override { return nextFileSize; }
+	int64_t debugFD() const override { return fd; }
+	std::string getFilename() const override { return filename; }
+	~AsyncFileIOUring() override {
+		if (fixedFileIndex >= 0) {
+			int unregFd = -1;
+			io_uring_register_files_update(&ctx.ring, fixedFileIndex, &unregFd, 1);
+			ctx.freeFixedFileSlots.push_back(fixedFileIndex);
+		}
+		close(fd);
+	}
+
+	static void launch() {
+		if (ctx.queue.size() && ctx.outstanding < FLOW_KNOBS->MAX_OUTSTANDING - FLOW_KNOBS->MIN_SUBMIT) {
+			double begin = timer_monotonic();
+			if (!ctx.outstanding)
+				ctx.ioStallBegin = begin;
+
+			int n = std::min<size_t>(FLOW_KNOBS->MAX_OUTSTANDING - ctx.outstanding, ctx.queue.size());
+
+			int64_t largestTruncate = 0;
+			int prepared = 0;
+			double start = timer();
+			for (int i = 0; i < n; i++) {
+				struct io_uring_sqe* sqe = io_uring_get_sqe(&ctx.ring);
+				if (sqe == nullptr)
+					break;
+
+				IOBlock* io = ctx.queue.top();
+				ctx.queue.pop();
+				io->startTime = start;
+				prepared++;
+
+				if (ctx.ioTimeout > 0) {
+					ctx.appendToRequestList(io);
+				}
+
+				if (io->owner->lastFileSize != io->owner->nextFileSize) {
+					++ctx.countPreSubmitTruncate;
+					int64_t truncateSize = io->owner->nextFileSize - io->owner->lastFileSize;
+					ASSERT(truncateSize > 0);
+					ctx.preSubmitTruncateBytes += truncateSize;
+					largestTruncate = std::max(largestTruncate, truncateSize);
+					io->owner->truncate(io->owner->nextFileSize);
+				}
+
+				switch (io->op) {
+				case IOBlock::READ:
+					io_uring_prep_read(sqe, io->fd, io->buf, io->nbytes, io->offset);
+					break;
+				case IOBlock::WRITE:
+					io_uring_prep_write(sqe, io->fd, io->buf, io->nbytes, io->offset);
+					break;
+				case IOBlock::FSYNC:
+					io_uring_prep_fsync(sqe, io->fd, IORING_FSYNC_DATASYNC);
+					break;
+				}
+				if (io->fixedFileIndex >= 0) {
+					// Same file, but addressed through the registered file table
+					sqe->fd = io->fixedFileIndex;
+					sqe->flags |= IOSQE_FIXED_FILE;
+				}
+				io_uring_sqe_set_data(sqe, io);
+			}
+
+			// Everything prepared above is staged in the submission ring, so a short return here only delays
+			// submission of the remainder until the next call; nothing needs to be requeued.
+			int submitted = 0;
+			while (submitted < prepared) {
+				int rc = io_uring_submit(&ctx.ring);
+				if (rc >= 0) {
+					submitted += rc;
+					if (rc == 0)
+						break;
+				} else if (rc != -EINTR && rc != -EAGAIN) {
+					TraceEvent("IOUringSubmitError").detail("ReturnCode", rc).GetLastError();
+					throw io_error();
+				}
+			}
+			ctx.outstanding += prepared;
+			++ctx.countSubmit;
+
+			double elapsed = timer_monotonic() - begin;
+			g_network->networkInfo.metrics.secSquaredSubmit += elapsed * elapsed / 2;
+
+			if (elapsed > FLOW_KNOBS->SLOW_LOOP_CUTOFF && nondeterministicRandom()->random01() < elapsed) {
+				TraceEvent("SlowIOUringLaunch")
+				    .detail("Elapsed", elapsed)
+				    .detail("Submitted", prepared)
+				    .detail("LargestTruncate", largestTruncate);
+			}
+		}
+	}
+
+	bool failed;
+
+private:
+	int fd, flags;
+	int fixedFileIndex; // Slot in the ring's registered file table, or -1 if not registered
+	int64_t lastFileSize, nextFileSize;
+	std::string filename;
+	Int64MetricHandle countFileLogicalWrites;
+	Int64MetricHandle countFileLogicalReads;
+
+	Int64MetricHandle countLogicalWrites;
+	Int64MetricHandle countLogicalReads;
+
+	struct IOBlock : FastAllocated<IOBlock> {
+		enum EOperation { READ, WRITE, FSYNC };
+
+		Promise<int> result;
+		Reference<AsyncFileIOUring> owner;
+		EOperation op;
+		int fd;
+		int fixedFileIndex;
+		void* buf;
+		int nbytes;
+		int64_t offset;
+		int64_t prio;
+		IOBlock* prev;
+		IOBlock* next;
+		double startTime;
+
+		struct indirect_order_by_priority {
+			bool operator()(IOBlock* a, IOBlock* b) { return a->prio < b->prio; }
+		};
+
+		IOBlock(EOperation op, int fd)
+		  : op(op), fd(fd), fixedFileIndex(-1), buf(nullptr), nbytes(0), offset(0), prio(0), prev(nullptr),
+		    next(nullptr), startTime(0) {}
+
+		TaskPriority getTask() const { return static_cast<TaskPriority>((prio >> 32) + 1); }
+
+		ACTOR static void deliver(Promise<int> result, bool failed, int r, TaskPriority task) {
+			wait(delay(0, task));
+			if (failed)
+				result.sendError(io_timeout());
+			else if (r < 0)
+				result.sendError(io_error());
+			else
+				result.send(r);
+		}
+
+		void setResult(int r) {
+			if (r < 0) {
+				struct stat fst;
+				fstat(fd, &fst);
+
+				errno = -r;
+				TraceEvent("AsyncFileIOUringIOError")
+				    .GetLastError()
+				    .detail("Fd", fd)
+				    .detail("Op", (int)op)
+				    .detail("Nbytes", nbytes)
+				    .detail("Offset", offset)
+				    .detail("Ptr", int64_t(buf))
+				    .detail("Size", fst.st_size)
+				    .detail("Filename", owner->filename);
+			}
+			deliver(result, owner->failed, r, getTask());
+			delete this;
+		}
+
+		void timeout(bool warnOnly) {
+			TraceEvent(SevWarnAlways, "AsyncFileIOUringTimeout")
+			    .detail("Fd", fd)
+			    .detail("Op", (int)op)
+			    .detail("Nbytes", nbytes)
+			    .detail("Offset", offset)
+			    .detail("Ptr", int64_t(buf))
+			    .detail("Filename", owner->filename);
+			g_network->setGlobal(INetwork::enASIOTimedOut, (flowGlobalType) true);
+
+			if (!warnOnly)
+				owner->failed = true;
+		}
+	};
+
+	struct Context {
+		struct io_uring ring;
+		int evfd;
+		int outstanding;
+		double ioStallBegin;
+		bool fallocateSupported;
+		bool fallocateZeroSupported;
+		bool fixedFilesSupported;
+		std::vector<int> freeFixedFileSlots;
+		std::priority_queue<IOBlock*, std::vector<IOBlock*>, IOBlock::indirect_order_by_priority> queue;
+		Int64MetricHandle countSubmit;
+		Int64MetricHandle countCollect;
+
+		double ioTimeout;
+		bool timeoutWarnOnly;
+		IOBlock* submittedRequestList;
+
+		Int64MetricHandle countPreSubmitTruncate;
+		Int64MetricHandle preSubmitTruncateBytes;
+
+		uint32_t opsIssued;
+		Context()
+		  : evfd(-1), outstanding(0), ioStallBegin(0), fallocateSupported(true), fallocateZeroSupported(true),
+		    fixedFilesSupported(false), submittedRequestList(nullptr), opsIssued(0) {
+			setIOTimeout(0);
+		}
+
+		void setIOTimeout(double timeout) {
+			ioTimeout = fabs(timeout);
+			timeoutWarnOnly = timeout < 0;
+		}
+
+		void appendToRequestList(IOBlock* io) {
+			ASSERT(!io->next && !io->prev);
+
+			if (submittedRequestList) {
+				io->prev = submittedRequestList->prev;
+				io->prev->next = io;
+
+				submittedRequestList->prev = io;
+				io->next = submittedRequestList;
+			} else {
+				submittedRequestList = io;
+				io->next = io->prev = io;
+			}
+		}
+
+		void removeFromRequestList(IOBlock* io) {
+			if (io->next == nullptr) {
+				ASSERT(io->prev == nullptr);
+				return;
+			}
+
+			ASSERT(io->prev != nullptr);
+
+			if (io == io->next) {
+				ASSERT(io == submittedRequestList && io == io->prev);
+				submittedRequestList = nullptr;
+			} else {
+				io->next->prev = io->prev;
+				io->prev->next = io->next;
+
+				if (submittedRequestList == io) {
+					submittedRequestList = io->next;
+				}
+			}
+
+			io->next = io->prev = nullptr;
+		}
+	};
+	static Context ctx;
+
+	explicit AsyncFileIOUring(int fd, int flags, std::string const& filename)
+	  : failed(false), fd(fd), flags(flags), fixedFileIndex(-1), filename(filename) {
+		ASSERT(FLOW_KNOBS->ENABLE_IO_URING);
+		if (!g_network->isSimulated()) {
+			countFileLogicalWrites.init("AsyncFile.CountFileLogicalWrites"_sr, filename);
+			countFileLogicalReads.init("AsyncFile.CountFileLogicalReads"_sr, filename);
+			countLogicalWrites.init("AsyncFile.CountLogicalWrites"_sr);
+			countLogicalReads.init("AsyncFile.CountLogicalReads"_sr);
+		}
+		registerFixedFile();
+	}
+
+	// Pin this fd into the ring's registered file table if a slot is free, so submissions against
+	// it can carry IOSQE_FIXED_FILE.  Failure just means ops on this file use the unregistered fd.
+	void registerFixedFile() {
+		if (!ctx.fixedFilesSupported || ctx.freeFixedFileSlots.empty())
+			return;
+		int slot = ctx.freeFixedFileSlots.back();
+		int rc = io_uring_register_files_update(&ctx.ring, slot, &fd, 1);
+		if (rc < 0) {
+			TraceEvent(SevWarn, "IOUringRegisterFileError").detail("ReturnCode", rc).detail("Filename", filename);
+			return;
+		}
+		ctx.freeFixedFileSlots.pop_back();
+		fixedFileIndex = slot;
+	}
+
+	void enqueue(IOBlock* io, AsyncFileIOUring* owner) {
+		if (io->op != IOBlock::FSYNC)
+			ASSERT(int64_t(io->buf) % 4096 == 0 && io->offset % 4096 == 0 && io->nbytes % 4096 == 0);
+
+		io->prio = (int64_t(g_network->getCurrentTask()) << 32) - (++ctx.opsIssued);
+		io->fixedFileIndex = owner->fixedFileIndex;
+		io->owner = Reference<AsyncFileIOUring>::addRef(owner);
+
+		ctx.queue.push(io);
+	}
+
+	static int openFlags(int flags) {
+		int oflags = O_DIRECT | O_CLOEXEC;
+		ASSERT(bool(flags & OPEN_READONLY) != bool(flags & OPEN_READWRITE)); // readonly xor readwrite
+		if (flags & OPEN_EXCLUSIVE)
+			oflags |= O_EXCL;
+		if (flags & OPEN_CREATE)
+			oflags |= O_CREAT;
+		if (flags & OPEN_READONLY)
+			oflags |= O_RDONLY;
+		if (flags & OPEN_READWRITE)
+			oflags |= O_RDWR;
+		if (flags & OPEN_ATOMIC_WRITE_AND_CREATE)
+			oflags |= O_TRUNC;
+		return oflags;
+	}
+
+	ACTOR static void poll(Reference<IEventFD> ev) {
+		loop {
+			wait(success(ev->read()));
+
+			wait(delay(0, TaskPriority::DiskIOComplete));
+
+			double currentTime = timer();
+			int n = 0;
+
+			struct io_uring_cqe* cqe;
+			while (io_uring_peek_cqe(&ctx.ring, &cqe) == 0) {
+				IOBlock* iob = static_cast<IOBlock*>(io_uring_cqe_get_data(cqe));
+				int result = cqe->res;
+				io_uring_cqe_seen(&ctx.ring, cqe);
+				++n;
+
+				if (ctx.ioTimeout > 0) {
+					ctx.removeFromRequestList(iob);
+				}
+
+				switch (iob->op) {
+				case IOBlock::READ:
+					getMetrics().readLatencySample.addMeasurement(currentTime - iob->startTime);
+					break;
+				case IOBlock::WRITE:
+					getMetrics().writeLatencySample.addMeasurement(currentTime - iob->startTime);
+					break;
+				default:
+					break;
+				}
+
+				iob->setResult(result);
+			}
+
+			++ctx.countCollect;
+			if (n) {
+				double t = timer_monotonic();
+				double elapsed = t - ctx.ioStallBegin;
+				ctx.ioStallBegin = t;
+				g_network->networkInfo.metrics.secSquaredDiskStall += elapsed * elapsed / 2;
+			}
+
+			ctx.outstanding -= n;
+
+			if (ctx.ioTimeout > 0) {
+				while (ctx.submittedRequestList && currentTime - ctx.submittedRequestList->startTime > ctx.ioTimeout) {
+					ctx.submittedRequestList->timeout(ctx.timeoutWarnOnly);
+					ctx.removeFromRequestList(ctx.submittedRequestList);
+				}
+			}
+		}
+	}
+};
+
+AsyncFileIOUring::Context AsyncFileIOUring::ctx;
+
+#include "flow/unactorcompiler.h"
+#endif
+#endif
@@ -28,6 +28,10 @@
 #include <algorithm>
 #include <cmath>
 
+// A reservoir sample of fixed size: above sampleSize the estimate degrades as tails are
+// increasingly likely to be evicted.  New latency instrumentation should use DDSketch
+// (fdbrpc/DDSketch.h), which is the basis of LatencySample and gives relative-error quantiles
+// (including p99.9) at small fixed memory, and whose sketches are mergeable across processes.
 template <class T>
 class ContinuousSample {
 public:
@@ -162,6 +162,7 @@ struct Peer : public ReferenceCounted<Peer> {
 	int64_t bytesReceived;
 	int64_t bytesSent;
 	double lastDataPacketSentTime;
+	double bytesPerPacket; // running (exponentially smoothed) estimate of serialized packet size to this peer
 	int outstandingReplies;
 	DDSketch<double> pingLatencies;
 	double lastLoggedTime;
@@ -477,6 +477,11 @@ Future<REPLY_TYPE(Request)> loadBalance(
 		double bestTime = 1e9; // The latency to the server with the least outstanding requests.
 		double nextTime = 1e9;
 		int badServers = 0;
+		// Healthy alternatives eligible for power of two choices, with their load
+		// estimates and latencies recorded at scan time.
+		std::vector<int> candidates;
+		std::vector<double> candidateMetric;
+		std::vector<double> candidateTime;
 
 		for (int i = 0; i < alternatives->size(); i++) {
 			// countBest(): the number of alternatives in the same locality (i.e., DC by default) as alternatives[0].
@@ -499,8 +504,12 @@ Future<REPLY_TYPE(Request)> loadBalance(
 			if (!IFailureMonitor::failureMonitor().getState(thisStream->getEndpoint()).failed) {
 				auto const& qd = model->getMeasurement(thisStream->getEndpoint().token.first());
 				if (now() > qd.failedUntil) {
-					double thisMetric = qd.smoothOutstanding.smoothTotal();
+					double thisMetric = FLOW_KNOBS->LOAD_BALANCE_P2C_SELECTION ? qd.loadEstimate()
+					                                                           : qd.smoothOutstanding.smoothTotal();
 					double thisTime = qd.latency;
+					candidates.push_back(i);
+					candidateMetric.push_back(thisMetric);
+					candidateTime.push_back(thisTime);
 					if (FLOW_KNOBS->LOAD_BALANCE_PENALTY_IS_BAD && qd.penalty > 1.001) {
 						// When a server wants to penalize itself (the default
 						// penalty value is 1.0), consider this server as bad.
@@ -538,7 +547,9 @@ Future<REPLY_TYPE(Request)> loadBalance(
 				if (!IFailureMonitor::failureMonitor().getState(thisStream->getEndpoint()).failed) {
 					auto const& qd = model->getMeasurement(thisStream->getEndpoint().token.first());
 					if (now() > qd.failedUntil) {
-						double thisMetric = qd.smoothOutstanding.smoothTotal();
+						double thisMetric = FLOW_KNOBS->LOAD_BALANCE_P2C_SELECTION
+						                        ? qd.loadEstimate()
+						                        : qd.smoothOutstanding.smoothTotal();
 						double thisTime = qd.latency;
 
 						if (thisMetric < nextMetric) {
@@ -551,6 +562,26 @@ Future<REPLY_TYPE(Request)> loadBalance(
 			}
 		}
 
+		if (FLOW_KNOBS->LOAD_BALANCE_P2C_SELECTION && candidates.size() >= 2) {
+			// Power of two choices: rather than deterministically routing to the
+			// replica that currently looks least loaded (which lets a fleet of
+			// clients herd onto the same replica between latency samples), pick
+			// two healthy replicas at random and send to the less loaded of the
+			// pair. The other one becomes the backup request target.
+			int c1 = deterministicRandom()->randomInt(0, (int)candidates.size());
+			int c2 = deterministicRandom()->randomInt(0, (int)candidates.size() - 1);
+			if (c2 >= c1)
+				c2++;
+			if (candidateMetric[c2] < candidateMetric[c1])
+				std::swap(c1, c2);
+			bestAlt = candidates[c1];
+			bestMetric = candidateMetric[c1];
+			bestTime = candidateTime[c1];
+			nextAlt = candidates[c2];
+			nextMetric = candidateMetric[c2];
+			nextTime = candidateTime[c2];
+		}
+
 		if (nextTime < 1e9) {
 			// Decide when to send the request to the second best choice.
 			if (bestTime > FLOW_KNOBS->INSTANT_SECOND_REQUEST_MULTIPLIER *
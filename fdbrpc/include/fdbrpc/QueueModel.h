@@ -50,6 +50,12 @@ struct QueueData {
 	// The last client perceived latency to this storage server.
 	double latency;
 
+	// An exponentially weighted moving average of the client perceived latency
+	// to this storage server. Unlike `latency`, which holds only the most
+	// recent sample, this survives a single fast (or slow) outlier and is
+	// therefore what replica selection ranks on.
+	Smoother smoothLatency;
+
 	// Represents the "cost" of each storage request. By default, the penalty is
 	// 1 indicating that each outstanding request corresponds 1 outstanding
 	// request. However, storage server can also increase the penalty if it
@@ -74,9 +80,17 @@ struct QueueData {
 	// a bit of a hack to store this here, but it's the only centralized place for per-endpoint tracking
 	Optional<TSSEndpointData> tssData;
 
+	// The load this client would add to the storage server by sending it one
+	// more request: the smoothed latency scaled up by the smoothed number of
+	// requests already waiting on it.
+	double loadEstimate() const { return smoothLatency.smoothTotal() * (1.0 + smoothOutstanding.smoothTotal()); }
+
 	QueueData()
-	  : smoothOutstanding(FLOW_KNOBS->QUEUE_MODEL_SMOOTHING_AMOUNT), latency(0.001), penalty(1.0), failedUntil(0),
-	    futureVersionBackoff(FLOW_KNOBS->FUTURE_VERSION_INITIAL_BACKOFF), increaseBackoffTime(0) {}
+	  : smoothOutstanding(FLOW_KNOBS->QUEUE_MODEL_SMOOTHING_AMOUNT), latency(0.001),
+	    smoothLatency(FLOW_KNOBS->QUEUE_MODEL_SMOOTHING_AMOUNT), penalty(1.0), failedUntil(0),
+	    futureVersionBackoff(FLOW_KNOBS->FUTURE_VERSION_INITIAL_BACKOFF), increaseBackoffTime(0) {
+		smoothLatency.reset(0.001);
+	}
 };
 
 typedef double TimeEstimate;
@@ -118,6 +132,11 @@ public:
 	// Retrieves the data for this endpoint's pair TSS endpoint, if present
 	Optional<TSSEndpointData> getTssData(uint64_t endpointId);
 
+	// Emits a trace event summarizing the model, for debugging load balancing
+	// decisions. One event per tracked endpoint would be too noisy for large
+	// clusters, so this logs aggregates plus the most loaded endpoint.
+	void logMetrics(const UID& id);
+
 	QueueModel() : secondMultiplier(1.0), secondBudget(0), laggingRequestCount(0) {
 		laggingRequests = actorCollection(addActor.getFuture(), &laggingRequestCount);
 		tssComparisons = actorCollection(addTSSActor.getFuture(), &laggingTSSCompareCount);
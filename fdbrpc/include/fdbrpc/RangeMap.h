@@ -318,9 +318,20 @@ void RangeMap<Key, Val, Range, Metric, MetricFunc>::insert(const Range& keys, co
 
 	auto begin = map.lower_bound(keys.begin);
 
-	map.erase(begin, end);
-	pair_type beginPair(keys.begin, value);
-	map.insert(beginPair, true, mf(beginPair));
+	if (begin != map.end() && begin->key == keys.begin) {
+		// The begin boundary already exists, so reuse its owned key instead of making a fresh
+		// copy of keys.begin. For Standalone keys this is a refcount bump rather than an
+		// allocation; re-inserting at an existing boundary is the common case for the metadata
+		// maps the proxies update on every shard change.
+		pair_type beginPair(begin->key, value);
+		Metric m = mf(beginPair);
+		map.erase(begin, end);
+		map.insert(std::move(beginPair), true, m);
+	} else {
+		map.erase(begin, end);
+		pair_type beginPair(keys.begin, value);
+		map.insert(beginPair, true, mf(beginPair));
+	}
 }
 
 #endif
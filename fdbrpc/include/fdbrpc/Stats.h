@@ -116,7 +116,19 @@ public:
 
 	Counter(std::string const& name, CounterCollection& collection);
 
-	void operator+=(Value delta);
+	// Inline because this runs on hot paths (e.g. per commit and per read on the proxies); rate and
+	// roughness state is a few local updates here and is only aggregated when the stats are traced
+	void operator+=(Value delta) {
+		if (!delta)
+			return; //< Otherwise last_event will be reset
+		interval_delta += delta;
+		auto t = now();
+		auto elapsed = t - last_event;
+		interval_sq_time += elapsed * elapsed;
+		last_event = t;
+
+		metric += delta;
+	}
 	void operator++() { *this += 1; }
 	void clear();
 	void resetInterval() override;
@@ -974,6 +974,16 @@ private:
 
 #define g_sim2 ((Sim2&)(*g_simulator))
 
+// The entire simulated cluster runs on the one thread that owns this object, and that is a load-bearing
+// property rather than an implementation shortcut. Determinism requires that every source of
+// nondeterminism is consumed in a reproducible order: there is a single deterministicRandom() stream
+// shared by all simulated processes, a single virtual clock, and a single task queue whose FIFO
+// tie-breaking defines the order of same-time events. Flow itself assumes one thread per network
+// (Arenas, reference counts and actor state are not synchronized), and simulated processes share one
+// address space, so "machines with no pending cross-machine events" still share the random stream and
+// allocator and cannot be stepped concurrently without changing the event order a seed produces.
+// Scaling simulation throughput is therefore done across seeds (one single-threaded simulator per
+// process), not within a seed.
 class Sim2 final : public ISimulator, public INetworkConnections {
 public:
 	// Implement INetwork interface
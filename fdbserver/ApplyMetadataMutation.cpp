@@ -198,6 +198,37 @@ private:
 		}
 	}
 
+	// Per-batch server tag caches. DD-driven shard churn delivers keyServers/ and serverKeys/ sets in large
+	// bursts, and each one previously re-read the full server tag list (or the owning server's tag) from the
+	// txnStateStore. The caches are dropped whenever a mutation in the same batch writes into serverTagKeys, so
+	// later mutations in the batch observe the update.
+	Optional<RangeResult> allServerTagsCache;
+	std::unordered_map<UID, Tag> serverTagCache;
+
+	const RangeResult& getAllServerTags() {
+		if (!allServerTagsCache.present()) {
+			// txnStateStore is always an in-memory KVS, and must always be recovered before
+			// applyMetadataMutations is called, so a wait here should never be needed.
+			allServerTagsCache = txnStateStore->readRange(serverTagKeys).get();
+		}
+		return allServerTagsCache.get();
+	}
+
+	Tag getServerTag(UID id) {
+		auto it = serverTagCache.find(id);
+		if (it == serverTagCache.end()) {
+			it = serverTagCache
+			         .emplace(id, decodeServerTagValue(txnStateStore->readValue(serverTagKeyFor(id)).get().get()))
+			         .first;
+		}
+		return it->second;
+	}
+
+	void invalidateServerTagCaches() {
+		allServerTagsCache.reset();
+		serverTagCache.clear();
+	}
+
 	void checkSetKeyServersPrefix(MutationRef m) {
 		if (!m.param1.startsWith(keyServersPrefix)) {
 			return;
@@ -217,10 +248,7 @@ private:
 		KeyRef end = keyInfo->rangeContaining(k).end();
 		KeyRangeRef insertRange(k, end);
 		std::vector<UID> src, dest;
-		// txnStateStore is always an in-memory KVS, and must always be recovered before
-		// applyMetadataMutations is called, so a wait here should never be needed.
-		Future<RangeResult> fResult = txnStateStore->readRange(serverTagKeys);
-		decodeKeyServersValue(fResult.get(), m.param2, src, dest);
+		decodeKeyServersValue(getAllServerTags(), m.param2, src, dest);
 
 		ASSERT(storageCache);
 		ServerCacheInfo info;
@@ -255,8 +283,7 @@ private:
 		}
 
 		if (toCommit) {
-			Tag tag = decodeServerTagValue(
-			    txnStateStore->readValue(serverTagKeyFor(serverKeysDecodeServer(m.param1))).get().get());
+			Tag tag = getServerTag(serverKeysDecodeServer(m.param1));
 			MutationRef privatized = m;
 			privatized.param1 = m.param1.withPrefix(systemKeys.begin, arena);
 			TraceEvent(SevDebug, "SendingPrivateMutation", dbgid)
@@ -278,6 +305,7 @@ private:
 
 		UID id = decodeServerTagKey(m.param1);
 		Tag tag = decodeServerTagValue(m.param2);
+		invalidateServerTagCaches();
 
 		if (toCommit) {
 			MutationRef privatized = m;
@@ -833,6 +861,7 @@ private:
 		if (!serverTagKeys.intersects(range)) {
 			return;
 		}
+		invalidateServerTagCaches();
 		// Storage server removal always happens in a separate version from any prior writes (or any subsequent
 		// reuse of the tag) so we can safely destroy the tag here without any concern about intra-batch
 		// ordering
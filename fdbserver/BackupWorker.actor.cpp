@@ -33,6 +33,7 @@
 #include "fdbserver/ServerDBInfo.h"
 #include "fdbserver/WaitFailure.h"
 #include "fdbserver/WorkerInterface.actor.h"
+#include "flow/CompressionUtils.h"
 #include "flow/Error.h"
 
 #include "flow/IRandom.h"
@@ -663,6 +664,81 @@ ACTOR Future<Void> saveProgress(BackupData* self, Version backupVersion) {
 	}
 }
 
+// Size of the on-disk header of a compressed mutation log block:
+// [version:uint32_t][rawLen:uint32_t][compressedLen:uint32_t]
+static constexpr int COMPRESSED_MLOG_BLOCK_HEADER_BYTES = 3 * sizeof(uint32_t);
+
+// Whether new mutation log blocks should be written compressed
+static bool shouldCompressLogBlocks() {
+	return SERVER_KNOBS->BACKUP_WORKER_COMPRESS_LOGS &&
+	       CompressionUtils::supportedFilters.count(CompressionFilter::ZSTD) > 0;
+}
+
+// Compress and append one buffered mutation log block. Every block except the last of a file
+// still occupies exactly blockSize bytes on disk (0xFF padded), so file offsets remain
+// block-aligned and restore assets address compressed files exactly as uncompressed ones. A
+// block that does not shrink under compression is written in the legacy uncompressed layout;
+// decoders dispatch on the per-block version.
+ACTOR Future<Void> flushLogBlock(Reference<IBackupFile> logFile,
+                                 std::shared_ptr<std::string> blockBuf,
+                                 int blockSize,
+                                 bool finalBlock) {
+	if (blockBuf->empty()) {
+		return Void();
+	}
+
+	// Take the payload before any wait so records appended concurrently go into the next block
+	state std::string payload;
+	payload.swap(*blockBuf);
+
+	state Arena arena;
+	StringRef raw(reinterpret_cast<const uint8_t*>(payload.data()), payload.size());
+	StringRef compressed = CompressionUtils::compress(CompressionFilter::ZSTD, raw, arena);
+
+	BinaryWriter wr(Unversioned());
+	if (compressed.size() + COMPRESSED_MLOG_BLOCK_HEADER_BYTES < raw.size() + sizeof(uint32_t)) {
+		wr << COMPRESSED_PARTITIONED_MLOG_VERSION << (uint32_t)raw.size() << (uint32_t)compressed.size();
+		wr.serializeBytes(compressed);
+	} else {
+		CODE_PROBE(true, "Incompressible mutation log block written uncompressed");
+		wr << PARTITIONED_MLOG_VERSION;
+		wr.serializeBytes(raw);
+	}
+	state Standalone<StringRef> block = wr.toValue();
+	ASSERT_WE_THINK(block.size() <= blockSize);
+	wait(logFile->append(block.begin(), block.size()));
+
+	if (!finalBlock) {
+		const int bytesLeft = blockSize - block.size();
+		if (bytesLeft > 0) {
+			state Value paddingFFs = fileBackup::makePadding(bytesLeft);
+			wait(logFile->append(paddingFFs.begin(), bytesLeft));
+		}
+	}
+	return Void();
+}
+
+// Buffered variant of addMutation() used when BACKUP_WORKER_COMPRESS_LOGS is on: records
+// accumulate in blockBuf and whole blocks are compressed and appended by flushLogBlock().
+ACTOR Future<Void> addMutation(Reference<IBackupFile> logFile,
+                               VersionedMessage message,
+                               StringRef mutation,
+                               std::shared_ptr<std::string> blockBuf,
+                               int blockSize) {
+	BinaryWriter wr(Unversioned());
+	wr << bigEndian64(message.version.version) << bigEndian32(message.version.sub) << bigEndian32(mutation.size());
+	state Standalone<StringRef> header = wr.toValue();
+
+	// Start a new block if this record would overflow the current one
+	if (!blockBuf->empty() &&
+	    (int64_t)blockBuf->size() + header.size() + mutation.size() > blockSize - COMPRESSED_MLOG_BLOCK_HEADER_BYTES) {
+		wait(flushLogBlock(logFile, blockBuf, blockSize, false));
+	}
+	blockBuf->append(reinterpret_cast<const char*>(header.begin()), header.size());
+	blockBuf->append(reinterpret_cast<const char*>(mutation.begin()), mutation.size());
+	return Void();
+}
+
 // Write a mutation to a log file. Note the mutation can be different from
 // message.message for clear mutations.
 ACTOR Future<Void> addMutation(Reference<IBackupFile> logFile,
@@ -739,6 +815,8 @@ ACTOR Future<Void> saveMutationsToFile(BackupData* self,
 	state KeyRangeMap<std::set<int>> keyRangeMap; // range to index in logFileFutures, logFiles, & blockEnds
 	state std::vector<Standalone<StringRef>> mutations;
 	state std::unordered_map<BlobCipherDetails, Reference<BlobCipherKey>> cipherKeys;
+	state bool compressLogs = shouldCompressLogBlocks();
+	state std::vector<std::shared_ptr<std::string>> blockBufs;
 	state int idx;
 
 	// Make sure all backups are ready, otherwise mutations will be lost.
@@ -798,6 +876,11 @@ ACTOR Future<Void> saveMutationsToFile(BackupData* self,
 	}
 
 	blockEnds = std::vector<int64_t>(logFiles.size(), 0);
+	if (compressLogs) {
+		for (int i = 0; i < logFiles.size(); i++) {
+			blockBufs.push_back(std::make_shared<std::string>());
+		}
+	}
 	for (idx = 0; idx < numMsg; idx++) {
 		auto& message = self->messages[idx];
 		MutationRef m;
@@ -813,7 +896,9 @@ ACTOR Future<Void> saveMutationsToFile(BackupData* self,
 			for (int index : keyRangeMap[m.param1]) {
 				if (message.getVersion() >= beginVersions[index]) {
 					adds.push_back(
-					    addMutation(logFiles[index], message, message.message, &blockEnds[index], blockSize));
+					    compressLogs
+					        ? addMutation(logFiles[index], message, message.message, blockBufs[index], blockSize)
+					        : addMutation(logFiles[index], message, message.message, &blockEnds[index], blockSize));
 				}
 			}
 		} else {
@@ -831,7 +916,9 @@ ACTOR Future<Void> saveMutationsToFile(BackupData* self,
 				for (int index : range.value()) {
 					if (message.getVersion() >= beginVersions[index]) {
 						adds.push_back(
-						    addMutation(logFiles[index], message, mutations.back(), &blockEnds[index], blockSize));
+						    compressLogs
+						        ? addMutation(logFiles[index], message, mutations.back(), blockBufs[index], blockSize)
+						        : addMutation(logFiles[index], message, mutations.back(), &blockEnds[index], blockSize));
 					}
 				}
 			}
@@ -840,6 +927,15 @@ ACTOR Future<Void> saveMutationsToFile(BackupData* self,
 		mutations.clear();
 	}
 
+	if (compressLogs) {
+		// Flush the partial final block of each file, unpadded
+		std::vector<Future<Void>> flushes;
+		for (int i = 0; i < logFiles.size(); i++) {
+			flushes.push_back(flushLogBlock(logFiles[i], blockBufs[i], blockSize, true));
+		}
+		wait(waitForAll(flushes));
+	}
+
 	std::vector<Future<Void>> finished;
 	std::transform(logFiles.begin(), logFiles.end(), std::back_inserter(finished), [](const Reference<IBackupFile>& f) {
 		return f->finish();
@@ -19,6 +19,7 @@
  */
 
 #include <algorithm>
+#include <list>
 #include <string>
 #include <vector>
 
@@ -505,23 +506,36 @@ public:
 					}
 				}
 
-				// check each granule range
-				state int i = 0;
-				for (i = 0; i < blobRanges.size() - 1; i++) {
+				// Check each granule range.  Lookups are issued in parallel batches on the same
+				// transaction; a failure of any lookup restarts the listing through tr.onError below.
+				state std::vector<KeyRange> granuleRanges;
+				for (int i = 0; i < blobRanges.size() - 1; i++) {
 					Key startKey = blobRanges[i].removePrefix(blobGranuleMappingKeys.begin);
 					Key endKey = blobRanges[i + 1].removePrefix(blobGranuleMappingKeys.begin);
-					state KeyRange granuleRange = KeyRangeRef(startKey, endKey);
-					try {
-						Standalone<BlobGranuleRestoreVersion> granule = wait(getGranule(&tr, granuleRange));
-						results.push_back_deep(results.arena(), granule);
-					} catch (Error& e) {
-						if (e.code() == error_code_restore_missing_data) {
-							dprint("missing data for key range {} \n", granuleRange.toString());
-							TraceEvent("BlobRestoreMissingData").detail("KeyRange", granuleRange.toString());
-						} else {
-							TraceEvent("BlobManifestError").error(e).detail("KeyRange", granuleRange.toString());
+					granuleRanges.push_back(KeyRangeRef(startKey, endKey));
+				}
+				state int i = 0;
+				while (i < (int)granuleRanges.size()) {
+					state int batchStart = i;
+					state int batchEnd =
+					    std::min<int>(i + SERVER_KNOBS->BLOB_MANIFEST_LOAD_PARALLELISM, granuleRanges.size());
+					state std::vector<Future<Standalone<BlobGranuleRestoreVersion>>> batch;
+					for (int j = i; j < batchEnd; j++) {
+						batch.push_back(getGranule(&tr, granuleRanges[j]));
+					}
+					for (; i < batchEnd; i++) {
+						try {
+							Standalone<BlobGranuleRestoreVersion> granule = wait(batch[i - batchStart]);
+							results.push_back_deep(results.arena(), granule);
+						} catch (Error& e) {
+							if (e.code() == error_code_restore_missing_data) {
+								dprint("missing data for key range {} \n", granuleRanges[i].toString());
+								TraceEvent("BlobRestoreMissingData").detail("KeyRange", granuleRanges[i].toString());
+							} else {
+								TraceEvent("BlobManifestError").error(e).detail("KeyRange", granuleRanges[i].toString());
+							}
+							throw;
 						}
-						throw;
 					}
 				}
 				return results;
@@ -558,12 +572,22 @@ private:
 		state BlobManifest manifest = BlobManifest::latest(files);
 		state Standalone<BlobManifestTailer> tailer = wait(loadTailer(self, container, manifest.tailer()));
 
-		// Load segments
+		// Load segments.  Segments hold disjoint rows so they can be fetched, parsed and written
+		// concurrently; the tailer validation below is the merge point for the row and byte totals.
 		state int64_t totalRows = 0;
 		state int64_t totalBytes = 0;
 		state std::vector<BlobManifestFile>::iterator iter;
+		state std::list<Future<Void>> loads;
 		for (iter = manifest.segmentsBegin(); iter != manifest.segmentsEnd(); ++iter) {
-			wait(loadSegment(self, container, *iter, &totalRows, &totalBytes));
+			loads.push_back(loadSegment(self, container, *iter, &totalRows, &totalBytes));
+			while ((int)loads.size() >= SERVER_KNOBS->BLOB_MANIFEST_LOAD_PARALLELISM) {
+				wait(loads.front());
+				loads.pop_front();
+			}
+		}
+		while (!loads.empty()) {
+			wait(loads.front());
+			loads.pop_front();
 		}
 
 		// Validate tailer
@@ -674,45 +698,41 @@ private:
 	}
 
 	// Find the newest granule for a key range. The newest granule has the max version and relevant files
+	// Note that several of these may run concurrently on the caller's transaction, so on error the
+	// caller, which owns the transaction, performs the retry.
 	ACTOR static Future<Standalone<BlobGranuleRestoreVersion>> getGranule(Transaction* tr, KeyRangeRef range) {
 		state Standalone<BlobGranuleRestoreVersion> granuleVersion;
 		state KeyRange historyKeyRange = blobGranuleHistoryKeyRangeFor(range);
-		loop {
-			try {
-				// reverse lookup so that the first row is the newest version
-				state RangeResult results = wait(
-				    tr->getRange(historyKeyRange, GetRangeLimits::BYTE_LIMIT_UNLIMITED, Snapshot::True, Reverse::True));
-				for (KeyValueRef row : results) {
-					state KeyRange keyRange;
-					state Version version;
-					std::tie(keyRange, version) = decodeBlobGranuleHistoryKey(row.key);
-					Standalone<BlobGranuleHistoryValue> historyValue = decodeBlobGranuleHistoryValue(row.value);
-					state UID granuleID = historyValue.granuleID;
-
-					std::vector<GranuleFileVersion> files = wait(listGranuleFiles(tr, granuleID));
-
-					granuleVersion.keyRange = KeyRangeRef(granuleVersion.arena(), keyRange);
-					granuleVersion.granuleID = granuleID;
-					if (files.empty()) {
-						dprint("Granule {} doesn't have files for version {}\n", granuleID.toString(), version);
-						granuleVersion.version = version;
-						granuleVersion.sizeInBytes = 1;
-					} else {
-						granuleVersion.version = files.back().version;
-						granuleVersion.sizeInBytes = granuleSizeInBytes(files);
-					}
-					dprint("Granule {}: \n", granuleVersion.granuleID.toString());
-					dprint("  {} {} {}\n", keyRange.toString(), granuleVersion.version, granuleVersion.sizeInBytes);
-					for (auto& file : files) {
-						dprint("  File {}: {} bytes\n", file.filename, file.sizeInBytes);
-					}
-					return granuleVersion;
-				}
-				throw restore_missing_data();
-			} catch (Error& e) {
-				wait(tr->onError(e));
+		// reverse lookup so that the first row is the newest version
+		state RangeResult results =
+		    wait(tr->getRange(historyKeyRange, GetRangeLimits::BYTE_LIMIT_UNLIMITED, Snapshot::True, Reverse::True));
+		for (KeyValueRef row : results) {
+			state KeyRange keyRange;
+			state Version version;
+			std::tie(keyRange, version) = decodeBlobGranuleHistoryKey(row.key);
+			Standalone<BlobGranuleHistoryValue> historyValue = decodeBlobGranuleHistoryValue(row.value);
+			state UID granuleID = historyValue.granuleID;
+
+			std::vector<GranuleFileVersion> files = wait(listGranuleFiles(tr, granuleID));
+
+			granuleVersion.keyRange = KeyRangeRef(granuleVersion.arena(), keyRange);
+			granuleVersion.granuleID = granuleID;
+			if (files.empty()) {
+				dprint("Granule {} doesn't have files for version {}\n", granuleID.toString(), version);
+				granuleVersion.version = version;
+				granuleVersion.sizeInBytes = 1;
+			} else {
+				granuleVersion.version = files.back().version;
+				granuleVersion.sizeInBytes = granuleSizeInBytes(files);
+			}
+			dprint("Granule {}: \n", granuleVersion.granuleID.toString());
+			dprint("  {} {} {}\n", keyRange.toString(), granuleVersion.version, granuleVersion.sizeInBytes);
+			for (auto& file : files) {
+				dprint("  File {}: {} bytes\n", file.filename, file.sizeInBytes);
 			}
+			return granuleVersion;
 		}
+		throw restore_missing_data();
 	}
 
 	// Return sum of last snapshot file size and delta files afterwards
@@ -151,24 +151,65 @@ private:
 		}
 	}
 
-	// Assign given key range to specified storage server.
+	// Granule-aligned split points for the initial restore assignment, coalescing adjacent granules up to
+	// BLOB_RESTORE_SHARD_BYTES per shard
+	static std::vector<Key> granuleAlignedBoundaries(Reference<BlobMigrator> self, KeyRangeRef keys) {
+		std::vector<Key> boundaries;
+		boundaries.push_back(keys.begin);
+		int64_t shardBytes = 0;
+		for (auto& granule : self->blobGranules_) {
+			if (!keys.contains(granule.keyRange.begin)) {
+				continue;
+			}
+			shardBytes += granule.sizeInBytes;
+			if (shardBytes >= SERVER_KNOBS->BLOB_RESTORE_SHARD_BYTES && granule.keyRange.end < keys.end) {
+				boundaries.push_back(granule.keyRange.end);
+				shardBytes = 0;
+			}
+		}
+		boundaries.push_back(keys.end);
+		return boundaries;
+	}
+
+	// Assign given key range to specified storage server. The assignment is written with granule-aligned
+	// shard boundaries so that DataDistributor starts the copy with many shards it can move to different
+	// teams in parallel, instead of one giant shard it first has to discover and split.
 	ACTOR static Future<Void> assignKeysToServer(Reference<BlobMigrator> self, KeyRangeRef keys, UID serverUID) {
-		state Transaction tr(self->db_);
-		loop {
-			tr.setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
-			tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
-			tr.setOption(FDBTransactionOptions::LOCK_AWARE);
-			try {
-				state Value value = keyServersValue(std::vector<UID>({ serverUID }), std::vector<UID>(), UID(), UID());
-				wait(krmSetRangeCoalescing(&tr, keyServersPrefix, keys, allKeys, value));
-				wait(krmSetRangeCoalescing(&tr, serverKeysPrefixFor(serverUID), keys, allKeys, serverKeysTrue));
-				wait(tr.commit());
-				dprint("Assign {} to server {}\n", normalKeys.toString(), serverUID.toString());
-				return Void();
-			} catch (Error& e) {
-				wait(tr.onError(e));
+		state Value value = keyServersValue(std::vector<UID>({ serverUID }), std::vector<UID>(), UID(), UID());
+		state std::vector<Key> boundaries = granuleAlignedBoundaries(self, keys);
+		state int begin = 0;
+		// Write the boundaries in batches so a restore with many granules stays under the transaction size limit
+		while (begin < (int)boundaries.size() - 1) {
+			state int end = std::min<int>(begin + 100, boundaries.size() - 1);
+			state Transaction tr(self->db_);
+			loop {
+				tr.setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
+				tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+				tr.setOption(FDBTransactionOptions::LOCK_AWARE);
+				try {
+					state int i;
+					for (i = begin; i < end; i++) {
+						wait(krmSetRange(&tr, keyServersPrefix, KeyRangeRef(boundaries[i], boundaries[i + 1]), value));
+					}
+					if (end == (int)boundaries.size() - 1) {
+						wait(krmSetRangeCoalescing(&tr, serverKeysPrefixFor(serverUID), keys, allKeys, serverKeysTrue));
+					}
+					wait(tr.commit());
+					break;
+				} catch (Error& e) {
+					wait(tr.onError(e));
+				}
 			}
+			begin = end;
 		}
+		dprint("Assign {} to server {} in {} shards\n",
+		       normalKeys.toString(),
+		       serverUID.toString(),
+		       boundaries.size() - 1);
+		TraceEvent("BlobMigratorAssignKeys", self->interf_.id())
+		    .detail("Keys", keys)
+		    .detail("Shards", boundaries.size() - 1);
+		return Void();
 	}
 
 	// Unassign given key range from its current storage servers
@@ -853,11 +853,6 @@ ACTOR Future<BlobFileIndex> writeDeltaFile(Reference<BlobWorkerData> bwData,
                                            Optional<std::pair<KeyRange, UID>> oldGranuleComplete,
                                            Future<Void> startDeltaFileWrite,
                                            int64_t deltaFileBudget) {
-	wait(startDeltaFileWrite);
-	state FlowLock::Releaser holdingLock(*bwData->deltaWritesBudget, deltaFileBudget);
-
-	wait(delay(0, TaskPriority::BlobWorkerUpdateStorage));
-
 	state std::string fileName = randomBGFilename(bwData->id, granuleID, currentDeltaVersion, ".delta");
 
 	state Optional<BlobGranuleCipherKeysCtx> cipherKeysCtx;
@@ -865,11 +860,18 @@ ACTOR Future<BlobFileIndex> writeDeltaFile(Reference<BlobWorkerData> bwData,
 	state Arena arena;
 
 	if (bwData->encryptMode.isEncryptionEnabled()) {
+		// Look up cipher keys before taking the write budget so the key provider round trip overlaps with the
+		// serialization and upload of earlier delta files instead of extending this file's budgeted critical section
 		BlobGranuleCipherKeysCtx ciphKeysCtx = wait(getLatestGranuleCipherKeys(bwData, keyRange, &arena));
 		cipherKeysCtx = std::move(ciphKeysCtx);
 		cipherKeysMeta = BlobGranuleCipherKeysCtx::toCipherKeysMeta(cipherKeysCtx.get());
 	}
 
+	wait(startDeltaFileWrite);
+	state FlowLock::Releaser holdingLock(*bwData->deltaWritesBudget, deltaFileBudget);
+
+	wait(delay(0, TaskPriority::BlobWorkerUpdateStorage));
+
 	state Optional<CompressionFilter> compressFilter = getBlobFileCompressFilter();
 	ASSERT(!bwData->encryptMode.isEncryptionEnabled() || cipherKeysCtx.present());
 	state Value serialized = serializeChunkedDeltaFile(StringRef(fileName),
@@ -3000,9 +3002,25 @@ ACTOR Future<Void> blobGranuleUpdateFiles(Reference<BlobWorkerData> bwData,
 			// making a bunch of extra delta files at some point, even if we don't consider it for a split
 			// yet
 
+			// If the granule has already outgrown the manager's split threshold based on the worker's own
+			// statistics (last snapshot size plus accumulated delta file bytes), evaluate the split now
+			// instead of waiting for the full delta budget, so a hot granule splits once and early at good
+			// boundaries instead of overshooting and splitting repeatedly. The 4/3 factor matches the split
+			// threshold in splitRange. Require some minimum delta accumulation so that a granule the manager
+			// already declined to split doesn't re-evaluate on every delta file.
+			bool earlySplitEval = false;
+			if (SERVER_KNOBS->BG_ENABLE_EARLY_SPLIT_EVAL && snapshotEligible && !metadata->files.snapshotFiles.empty() &&
+			    metadata->pendingDeltaVersion >= startState.changeFeedStartVersion &&
+			    metadata->bytesInNewDeltaFiles >= writeAmpTarget.getBytesBeforeCompact() / 4) {
+				int64_t estimatedGranuleSize =
+				    metadata->files.snapshotFiles.back().length + metadata->bytesInNewDeltaFiles;
+				earlySplitEval = estimatedGranuleSize > SERVER_KNOBS->BG_SNAPSHOT_FILE_TARGET_BYTES * 4 / 3;
+				CODE_PROBE(earlySplitEval, "Granule evaluating split early after outgrowing split threshold");
+			}
+
 			// If we have enough delta files, try to re-snapshot
 			// FIXME: have max file count in addition to bytes count
-			if (snapshotEligible && (metadata->doEarlyReSnapshot() ||
+			if (snapshotEligible && (metadata->doEarlyReSnapshot() || earlySplitEval ||
 			                         metadata->bytesInNewDeltaFiles >= writeAmpTarget.getBytesBeforeCompact())) {
 				if (BW_DEBUG && !inFlightFiles.empty()) {
 					fmt::print("Granule [{0} - {1}) ready to re-snapshot at {2} after {3} > {4} bytes, "
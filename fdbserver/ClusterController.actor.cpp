@@ -283,6 +283,11 @@ ACTOR Future<Void> clusterOpenDatabase(ClusterControllerData::DBInfo* db, OpenDa
 void checkOutstandingRecruitmentRequests(ClusterControllerData* self) {
 	for (int i = 0; i < self->outstandingRecruitmentRequests.size(); i++) {
 		Reference<RecruitWorkersInfo> info = self->outstandingRecruitmentRequests[i];
+		if (info->lastEvalGeneration == self->recruitmentInputsGeneration) {
+			// No fitness inputs have changed since this request last failed, so recruitment would fail identically
+			continue;
+		}
+		info->lastEvalGeneration = self->recruitmentInputsGeneration;
 		try {
 			info->rep = self->findWorkersForConfiguration(info->req);
 			if (info->dbgId.present()) {
@@ -305,6 +310,10 @@ void checkOutstandingRecruitmentRequests(ClusterControllerData* self) {
 void checkOutstandingRemoteRecruitmentRequests(ClusterControllerData* self) {
 	for (int i = 0; i < self->outstandingRemoteRecruitmentRequests.size(); i++) {
 		Reference<RecruitRemoteWorkersInfo> info = self->outstandingRemoteRecruitmentRequests[i];
+		if (info->lastEvalGeneration == self->recruitmentInputsGeneration) {
+			continue;
+		}
+		info->lastEvalGeneration = self->recruitmentInputsGeneration;
 		try {
 			info->rep = self->findRemoteWorkersForConfiguration(info->req);
 			if (info->dbgId.present()) {
@@ -722,7 +731,11 @@ ACTOR Future<Void> doCheckOutstandingRemoteRequests(ClusterControllerData* self)
 	return Void();
 }
 
-void checkOutstandingRequests(ClusterControllerData* self) {
+void checkOutstandingRequests(ClusterControllerData* self, bool fitnessInputsChanged = true) {
+	if (fitnessInputsChanged) {
+		++self->recruitmentInputsGeneration;
+	}
+
 	if (self->outstandingRemoteRequestChecker.isReady()) {
 		self->outstandingRemoteRequestChecker = doCheckOutstandingRemoteRequests(self);
 	}
@@ -795,6 +808,8 @@ ACTOR Future<Void> workerAvailabilityWatch(WorkerInterface worker,
 				cluster->removedDBInfoEndpoints.insert(worker.updateServerDBInfo.getEndpoint());
 				cluster->id_worker.erase(worker.locality.processId());
 				cluster->updateWorkerList.set(worker.locality.processId(), Optional<ProcessData>());
+				// The worker set shrank, so outstanding recruitment requests must be re-evaluated when next checked
+				++cluster->recruitmentInputsGeneration;
 				return Void();
 			}
 		}
@@ -1046,11 +1061,27 @@ void haltRegisteringOrCurrentSingleton(ClusterControllerData* self,
 	}
 }
 
+// Resolves the connection string's coordinator hostnames, caching the result briefly so that a worker
+// registration storm (e.g. a whole-cluster restart) resolves once per interval instead of once per request
+ACTOR Future<std::vector<NetworkAddress>> resolveCoordinatorsForRegistration(ClusterControllerData* self,
+                                                                             ClusterConnectionString cs) {
+	state std::string key = cs.toString();
+	if (self->cachedCoordinatorAddressesTime >= 0 && key == self->cachedCoordinatorAddressesKey &&
+	    now() - self->cachedCoordinatorAddressesTime < SERVER_KNOBS->CC_COORDINATOR_RESOLVE_CACHE_TTL) {
+		return self->cachedCoordinatorAddresses;
+	}
+	std::vector<NetworkAddress> addresses = wait(cs.tryResolveHostnames());
+	self->cachedCoordinatorAddressesKey = key;
+	self->cachedCoordinatorAddresses = addresses;
+	self->cachedCoordinatorAddressesTime = now();
+	return addresses;
+}
+
 ACTOR Future<Void> registerWorker(RegisterWorkerRequest req,
                                   ClusterControllerData* self,
                                   ClusterConnectionString cs,
                                   ConfigBroadcaster* configBroadcaster) {
-	std::vector<NetworkAddress> coordinatorAddresses = wait(cs.tryResolveHostnames());
+	std::vector<NetworkAddress> coordinatorAddresses = wait(resolveCoordinatorsForRegistration(self, cs));
 
 	const WorkerInterface& w = req.wi;
 	if (req.clusterId.present() && self->clusterId->get().present() && req.clusterId != self->clusterId->get() &&
@@ -1172,6 +1203,13 @@ ACTOR Future<Void> registerWorker(RegisterWorkerRequest req,
 		self->updateDBInfo.trigger();
 		checkOutstandingRequests(self);
 	} else if (info->second.details.interf.id() != w.id() || req.generation >= info->second.gen) {
+		// Workers re-register periodically with unchanged state; only a change to fitness-relevant inputs
+		// requires outstanding recruitment requests to be re-evaluated
+		bool fitnessInputsChanged = info->second.details.interf.id() != w.id() ||
+		                            info->second.details.processClass.classType() != newProcessClass.classType() ||
+		                            info->second.priorityInfo != newPriorityInfo ||
+		                            info->second.details.degraded != req.degraded ||
+		                            info->second.details.recoveredDiskFiles != req.recoveredDiskFiles;
 		if (!info->second.reply.isSet()) {
 			info->second.reply.send(Never());
 		}
@@ -1204,7 +1242,7 @@ ACTOR Future<Void> registerWorker(RegisterWorkerRequest req,
 			                                                    info->second.watcher,
 			                                                    isCoordinator));
 		}
-		checkOutstandingRequests(self);
+		checkOutstandingRequests(self, fitnessInputsChanged);
 	} else {
 		CODE_PROBE(true, "Received an old worker registration request.", probe::decoration::rare);
 	}
@@ -1343,11 +1381,29 @@ ACTOR Future<Void> statusServer(FutureStream<StatusRequest> requests,
 	// Place to accumulate a batch of requests to respond to
 	state std::vector<StatusRequest> requests_batch;
 
+	// Per-subsystem sections reused across requests, refreshed on their own TTLs
+	state StatusSectionCache sectionCache;
+
+	// Most recent successful full status, used to serve summary-only requests
+	// without gathering a new one. The summary extraction parses the full
+	// status json, so it is computed lazily and at most once per full status.
+	state Optional<StatusReply> lastFullReply;
+	state Optional<StatusReply> lastSummaryReply;
+	state double lastFullReplyTime = 0;
+
 	loop {
 		try {
 			// Wait til first request is ready
 			StatusRequest req = waitNext(requests);
 			++self->statusRequests;
+			if (req.summaryOnly && lastFullReply.present() &&
+			    now() - lastFullReplyTime < SERVER_KNOBS->STATUS_SUMMARY_MAX_AGE) {
+				if (!lastSummaryReply.present()) {
+					lastSummaryReply = statusSummaryReply(lastFullReply.get());
+				}
+				req.reply.send(lastSummaryReply.get());
+				continue;
+			}
 			requests_batch.push_back(req);
 
 			// Earliest time at which we may begin a new request
@@ -1363,7 +1419,13 @@ ACTOR Future<Void> statusServer(FutureStream<StatusRequest> requests,
 			// requests per second
 			while (requests.isReady()) {
 				auto req = requests.pop();
-				if (SERVER_KNOBS->STATUS_MIN_TIME_BETWEEN_REQUESTS > 0.0 &&
+				if (req.summaryOnly && lastFullReply.present() &&
+				    now() - lastFullReplyTime < SERVER_KNOBS->STATUS_SUMMARY_MAX_AGE) {
+					if (!lastSummaryReply.present()) {
+						lastSummaryReply = statusSummaryReply(lastFullReply.get());
+					}
+					req.reply.send(lastSummaryReply.get());
+				} else if (SERVER_KNOBS->STATUS_MIN_TIME_BETWEEN_REQUESTS > 0.0 &&
 				    requests_batch.size() + 1 >
 				        SERVER_KNOBS->STATUS_MIN_TIME_BETWEEN_REQUESTS * SERVER_KNOBS->MAX_STATUS_REQUESTS_PER_SECOND) {
 					TraceEvent(SevWarnAlways, "TooManyStatusRequests")
@@ -1406,7 +1468,8 @@ ACTOR Future<Void> statusServer(FutureStream<StatusRequest> requests,
 			                                                                  self->datacenterVersionDifference,
 			                                                                  configBroadcaster,
 			                                                                  self->db.metaclusterRegistration,
-			                                                                  self->db.metaclusterMetrics)));
+			                                                                  self->db.metaclusterMetrics,
+			                                                                  &sectionCache)));
 
 			if (result.isError() && result.getError().code() == error_code_actor_cancelled)
 				throw result.getError();
@@ -1415,11 +1478,23 @@ ACTOR Future<Void> statusServer(FutureStream<StatusRequest> requests,
 			// requests
 			last_request_time = now();
 
+			if (!result.isError()) {
+				lastFullReply = result.get();
+				lastSummaryReply = Optional<StatusReply>();
+				lastFullReplyTime = now();
+			}
+
 			while (!requests_batch.empty()) {
-				if (result.isError())
+				if (result.isError()) {
 					requests_batch.back().reply.sendError(result.getError());
-				else
+				} else if (requests_batch.back().summaryOnly) {
+					if (!lastSummaryReply.present()) {
+						lastSummaryReply = statusSummaryReply(result.get());
+					}
+					requests_batch.back().reply.send(lastSummaryReply.get());
+				} else {
 					requests_batch.back().reply.send(result.get());
+				}
 				requests_batch.pop_back();
 				wait(yield());
 			}
@@ -2709,6 +2784,9 @@ ACTOR Future<Void> workerHealthMonitor(ClusterControllerData* self) {
 				wait(lowPriorityDelay(SERVER_KNOBS->CC_WORKER_HEALTH_CHECKING_INTERVAL));
 			}
 
+			ClusterControllerData::DegradationInfo prevDegradationInfo = self->degradationInfo;
+			std::unordered_set<NetworkAddress> prevExcludedDegradedServers = self->excludedDegradedServers;
+
 			self->degradationInfo = self->getDegradationInfo();
 
 			// Compare `self->degradationInfo` with `self->excludedDegradedServers` and remove those that have
@@ -2776,6 +2854,16 @@ ACTOR Future<Void> workerHealthMonitor(ClusterControllerData* self) {
 				}
 			}
 
+			// Degradation state is a recruitment fitness input (via isExcludedDegradedServer()), so a
+			// recruitment that failed while servers were excluded must be re-evaluated once they recover;
+			// unchanged worker re-registrations no longer trigger that re-evaluation on their own.
+			if (self->excludedDegradedServers != prevExcludedDegradedServers ||
+			    self->degradationInfo.degradedServers != prevDegradationInfo.degradedServers ||
+			    self->degradationInfo.disconnectedServers != prevDegradationInfo.disconnectedServers ||
+			    self->degradationInfo.degradedSatellite != prevDegradationInfo.degradedSatellite) {
+				checkOutstandingRequests(self);
+			}
+
 			wait(delay(SERVER_KNOBS->CC_WORKER_HEALTH_CHECKING_INTERVAL));
 		} catch (Error& e) {
 			TraceEvent(SevWarnAlways, "ClusterControllerHealthMonitorError").error(e);
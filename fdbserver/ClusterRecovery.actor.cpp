@@ -18,6 +18,8 @@
  * limitations under the License.
  */
 
+#include <deque>
+
 #include "fdbclient/FDBTypes.h"
 #include "fdbclient/Metacluster.h"
 #include "fdbrpc/sim_validation.h"
@@ -1070,6 +1072,7 @@ ACTOR Future<Void> updateLocalityForDcId(Optional<Key> dcId,
 ACTOR Future<Void> readTransactionSystemState(Reference<ClusterRecoveryData> self,
                                               Reference<ILogSystem> oldLogSystem,
                                               Version txsPoppedVersion) {
+	state double startTime = now();
 	state Reference<AsyncVar<PeekTxsInfo>> myLocality = Reference<AsyncVar<PeekTxsInfo>>(
 	    new AsyncVar<PeekTxsInfo>(PeekTxsInfo(tagLocalityInvalid, tagLocalityInvalid, invalidVersion)));
 	state Future<Void> localityUpdater =
@@ -1239,7 +1242,7 @@ ACTOR Future<Void> readTransactionSystemState(Reference<ClusterRecoveryData> sel
 	                             // make KeyValueStoreMemory guarantee immediate reads, we should be able to get rid of
 	                             // the discardCommit() below and not need a writable log adapter
 
-	TraceEvent("RTSSComplete", self->dbgid).log();
+	TraceEvent("RTSSComplete", self->dbgid).detail("Duration", now() - startTime);
 
 	return Void();
 }
@@ -1247,13 +1250,14 @@ ACTOR Future<Void> readTransactionSystemState(Reference<ClusterRecoveryData> sel
 ACTOR Future<Void> sendInitialCommitToResolvers(Reference<ClusterRecoveryData> self) {
 	state KeyRange txnKeys = allKeys;
 	state Sequence txnSequence = 0;
+	state double startTime = now();
 	ASSERT(self->recoveryTransactionVersion);
 
 	state RangeResult data =
 	    self->txnStateStore
 	        ->readRange(txnKeys, BUGGIFY ? 3 : SERVER_KNOBS->DESIRED_TOTAL_BYTES, SERVER_KNOBS->DESIRED_TOTAL_BYTES)
 	        .get();
-	state std::vector<Future<Void>> txnReplies;
+	state std::deque<std::pair<Future<Void>, int64_t>> txnReplies;
 	state int64_t dataOutstanding = 0;
 
 	state std::vector<Endpoint> endpoints;
@@ -1281,25 +1285,32 @@ ACTOR Future<Void> sendInitialCommitToResolvers(Reference<ClusterRecoveryData> s
 		req.sequence = txnSequence;
 		req.last = !nextData.size();
 		req.broadcastInfo = endpoints;
-		txnReplies.push_back(broadcastTxnRequest(req, SERVER_KNOBS->TXN_STATE_SEND_AMOUNT, false));
-		dataOutstanding += SERVER_KNOBS->TXN_STATE_SEND_AMOUNT * data.arena().getSize();
+		int64_t reqBytes = SERVER_KNOBS->TXN_STATE_SEND_AMOUNT * data.arena().getSize();
+		txnReplies.emplace_back(broadcastTxnRequest(req, SERVER_KNOBS->TXN_STATE_SEND_AMOUNT, false), reqBytes);
+		dataOutstanding += reqBytes;
 		data = nextData;
 		txnSequence++;
 
-		if (dataOutstanding > SERVER_KNOBS->MAX_TXS_SEND_MEMORY) {
-			wait(waitForAll(txnReplies));
-			txnReplies = std::vector<Future<Void>>();
-			dataOutstanding = 0;
+		// Bound the outstanding data by retiring only the oldest broadcasts, so later chunks keep streaming
+		// to the proxies and resolvers instead of stalling behind a full drain of every in-flight reply
+		while (dataOutstanding > SERVER_KNOBS->MAX_TXS_SEND_MEMORY) {
+			wait(txnReplies.front().first);
+			dataOutstanding -= txnReplies.front().second;
+			txnReplies.pop_front();
 		}
 
 		wait(yield());
 	}
-	wait(waitForAll(txnReplies));
+	while (!txnReplies.empty()) {
+		wait(txnReplies.front().first);
+		txnReplies.pop_front();
+	}
 	TraceEvent("RecoveryInternal", self->dbgid)
 	    .detail("StatusCode", RecoveryStatus::recovery_transaction)
 	    .detail("Status", RecoveryStatus::names[RecoveryStatus::recovery_transaction])
 	    .detail("RecoveryTxnVersion", self->recoveryTransactionVersion)
 	    .detail("LastEpochEnd", self->lastEpochEnd)
+	    .detail("Duration", now() - startTime)
 	    .detail("Step", "SentTxnStateStoreToCommitProxies");
 
 	std::vector<Future<ResolveTransactionBatchReply>> replies;
@@ -1318,6 +1329,7 @@ ACTOR Future<Void> sendInitialCommitToResolvers(Reference<ClusterRecoveryData> s
 	    .detail("Status", RecoveryStatus::names[RecoveryStatus::recovery_transaction])
 	    .detail("RecoveryTxnVersion", self->recoveryTransactionVersion)
 	    .detail("LastEpochEnd", self->lastEpochEnd)
+	    .detail("Duration", now() - startTime)
 	    .detail("Step", "InitializedAllResolvers");
 	return Void();
 }
@@ -698,35 +698,88 @@ private:
 	void evaluateBatchSize();
 };
 
+// Memoizes the shard and storage cache ranges most recently resolved from the commit
+// data's range maps. Consecutive mutations in a batch frequently target the same shard,
+// so reusing the previous resolution skips most of the per-mutation range map
+// traversals during tag assignment. The memo points into keyInfo and cacheInfo, so
+// callers must reset() it after any wait, since commits from other batches can mutate
+// the maps across waits.
+struct ShardRouteMemo {
+	KeyRangeRef shardRange;
+	ServerCacheInfo* shardInfo = nullptr;
+	KeyRangeRef cacheRange;
+	bool cacheValid = false;
+	bool cacheTagged = false;
+
+	void reset() {
+		shardInfo = nullptr;
+		cacheValid = false;
+	}
+
+	// Returns the tags for the shard containing key, resolving and memoizing the range
+	// map lookup on a miss. shardRange and shardInfo describe this shard on return.
+	const std::vector<Tag>& tagsForKey(ProxyCommitData* commitData, StringRef key) {
+		if (shardInfo == nullptr || !shardRange.contains(key)) {
+			auto r = commitData->keyInfo.rangeContaining(key);
+			r.value().populateTags();
+			shardRange = r.range();
+			shardInfo = &r.value();
+		}
+		return shardInfo->tags;
+	}
+
+	// Returns the info for the single shard containing range, or nullptr if range spans
+	// a shard boundary
+	ServerCacheInfo* singleShard(ProxyCommitData* commitData, KeyRangeRef range) {
+		if (shardInfo == nullptr || !shardRange.contains(range.begin)) {
+			auto r = commitData->keyInfo.rangeContaining(range.begin);
+			if (range.end > r.range().end) {
+				return nullptr;
+			}
+			r.value().populateTags();
+			shardRange = r.range();
+			shardInfo = &r.value();
+		} else if (range.end > shardRange.end) {
+			return nullptr;
+		}
+		return shardInfo;
+	}
+
+	bool needsCacheTag(ProxyCommitData* commitData, StringRef key) {
+		if (!cacheValid || !cacheRange.contains(key)) {
+			auto r = commitData->cacheInfo.rangeContaining(key);
+			cacheRange = r.range();
+			cacheTagged = r.value();
+			cacheValid = true;
+		}
+		return cacheTagged;
+	}
+};
+
 std::set<Tag> CommitBatchContext::getWrittenTagsPreResolution() {
 	std::set<Tag> transactionTags;
 	std::vector<Tag> cacheVector = { cacheTag };
+	ShardRouteMemo routeMemo;
 	for (int transactionNum = 0; transactionNum < trs.size(); transactionNum++) {
 		int mutationNum = 0;
 		VectorRef<MutationRef>* pMutations = &trs[transactionNum].transaction.mutations;
 		for (; mutationNum < pMutations->size(); mutationNum++) {
 			auto& m = (*pMutations)[mutationNum];
 			if (isSingleKeyMutation((MutationRef::Type)m.type)) {
-				auto& tags = pProxyCommitData->tagsForKey(m.param1);
+				auto& tags = routeMemo.tagsForKey(pProxyCommitData, m.param1);
 				transactionTags.insert(tags.begin(), tags.end());
-				if (pProxyCommitData->cacheInfo[m.param1]) {
+				if (routeMemo.needsCacheTag(pProxyCommitData, m.param1)) {
 					transactionTags.insert(cacheTag);
 				}
 			} else if (m.type == MutationRef::ClearRange) {
 				KeyRangeRef clearRange(KeyRangeRef(m.param1, m.param2));
-				auto ranges = pProxyCommitData->keyInfo.intersectingRanges(clearRange);
-				auto firstRange = ranges.begin();
-				++firstRange;
-				if (firstRange == ranges.end()) {
-					std::set<Tag> filteredTags;
-					ranges.begin().value().populateTags();
-					filteredTags.insert(ranges.begin().value().tags.begin(), ranges.begin().value().tags.end());
-					transactionTags.insert(ranges.begin().value().tags.begin(), ranges.begin().value().tags.end());
+				ServerCacheInfo* clearShard = routeMemo.singleShard(pProxyCommitData, clearRange);
+				if (clearShard != nullptr) {
+					transactionTags.insert(clearShard->tags.begin(), clearShard->tags.end());
 				} else {
-					std::set<Tag> allSources;
+					auto ranges = pProxyCommitData->keyInfo.intersectingRanges(clearRange);
 					for (auto r : ranges) {
 						r.value().populateTags();
-						allSources.insert(r.value().tags.begin(), r.value().tags.end());
 						transactionTags.insert(r.value().tags.begin(), r.value().tags.end());
 					}
 				}
@@ -748,7 +801,10 @@ CommitBatchContext::CommitBatchContext(ProxyCommitData* const pProxyCommitData_,
   : pProxyCommitData(pProxyCommitData_), trs(std::move(*const_cast<std::vector<CommitTransactionRequest>*>(trs_))),
     currentBatchMemBytesCount(currentBatchMemBytesCount), startTime(g_network->now()),
     localBatchNumber(++pProxyCommitData->localCommitBatchesStarted),
-    toCommit(pProxyCommitData->logSystem, pProxyCommitData->localTLogCount), span("MP:commitBatch"_loc),
+    toCommit(pProxyCommitData->logSystem,
+             pProxyCommitData->localTLogCount,
+             std::min(pProxyCommitData->pushedMessageBytesHint, SERVER_KNOBS->PROXY_PUSH_BUFFER_RESERVE_MAX_BYTES)),
+    span("MP:commitBatch"_loc),
     committed(trs.size()) {
 
 	evaluateBatchSize();
@@ -1861,6 +1917,8 @@ void pushToBackupMutations(CommitBatchContext* self,
 ACTOR Future<Void> assignMutationsToStorageServers(CommitBatchContext* self) {
 	state ProxyCommitData* const pProxyCommitData = self->pProxyCommitData;
 	state std::vector<CommitTransactionRequest>& trs = self->trs;
+	state ShardRouteMemo routeMemo;
+	state Future<WriteMutationRefVar> writeFuture;
 
 	for (; self->transactionNum < trs.size(); self->transactionNum++) {
 		if (!(self->committed[self->transactionNum] == ConflictBatch::TransactionCommitted &&
@@ -1893,6 +1951,7 @@ ACTOR Future<Void> assignMutationsToStorageServers(CommitBatchContext* self) {
 				if (g_network->check_yield(TaskPriority::ProxyCommitYield1)) {
 					self->computeDuration += g_network->timer() - self->computeStart;
 					wait(delay(0, TaskPriority::ProxyCommitYield1));
+					routeMemo.reset();
 					self->computeStart = g_network->timer();
 				}
 			}
@@ -1909,7 +1968,7 @@ ACTOR Future<Void> assignMutationsToStorageServers(CommitBatchContext* self) {
 			// Determine the set of tags (responsible storage servers) for the mutation, splitting it
 			// if necessary.  Serialize (splits of) the mutation into the message buffer and add the tags.
 			if (isSingleKeyMutation((MutationRef::Type)m.type)) {
-				auto& tags = pProxyCommitData->tagsForKey(m.param1);
+				auto& tags = routeMemo.tagsForKey(pProxyCommitData, m.param1);
 
 				// sample single key mutation based on cost
 				// the expectation of sampling is every COMMIT_SAMPLE_COST sample once
@@ -1921,7 +1980,7 @@ ACTOR Future<Void> assignMutationsToStorageServers(CommitBatchContext* self) {
 					double prob = mul * cost / totalCosts;
 
 					if (deterministicRandom()->random01() < prob) {
-						const auto& storageServers = pProxyCommitData->keyInfo[m.param1].src_info;
+						const auto& storageServers = routeMemo.shardInfo->src_info;
 						for (const auto& ssInfo : storageServers) {
 							auto id = ssInfo->interf.id();
 							// scale cost
@@ -1933,7 +1992,7 @@ ACTOR Future<Void> assignMutationsToStorageServers(CommitBatchContext* self) {
 				}
 
 				if (pProxyCommitData->singleKeyMutationEvent->enabled) {
-					KeyRangeRef shard = pProxyCommitData->keyInfo.rangeContaining(m.param1).range();
+					KeyRangeRef shard = routeMemo.shardRange;
 					pProxyCommitData->singleKeyMutationEvent->tag1 = (int64_t)tags[0].id;
 					pProxyCommitData->singleKeyMutationEvent->tag2 = (int64_t)tags[1].id;
 					pProxyCommitData->singleKeyMutationEvent->tag3 = (int64_t)tags[2].id;
@@ -1944,32 +2003,34 @@ ACTOR Future<Void> assignMutationsToStorageServers(CommitBatchContext* self) {
 
 				DEBUG_MUTATION("ProxyCommit", self->commitVersion, m, pProxyCommitData->dbgid).detail("To", tags);
 				self->toCommit.addTags(tags);
-				if (pProxyCommitData->cacheInfo[m.param1]) {
+				if (routeMemo.needsCacheTag(pProxyCommitData, m.param1)) {
 					self->toCommit.addTag(cacheTag);
 				}
 				if (encryptedMutation.present()) {
 					ASSERT(encryptedMutation.get().isEncrypted());
 				}
-				WriteMutationRefVar var = wait(writeMutation(self, encryptDomain, &m, &encryptedMutation, &arena));
+				writeFuture = writeMutation(self, encryptDomain, &m, &encryptedMutation, &arena);
+				if (!writeFuture.isReady()) {
+					// The memo can't survive an actual wait
+					routeMemo.reset();
+				}
+				WriteMutationRefVar var = wait(writeFuture);
 				// FIXME: Remove assert once ClearRange RAW_ACCESS usecase handling is done
 				ASSERT(std::holds_alternative<MutationRef>(var));
 				writtenMutation = std::get<MutationRef>(var);
 			} else if (m.type == MutationRef::ClearRange) {
 				KeyRangeRef clearRange(KeyRangeRef(m.param1, m.param2));
-				auto ranges = pProxyCommitData->keyInfo.intersectingRanges(clearRange);
-				auto firstRange = ranges.begin();
-				++firstRange;
-				if (firstRange == ranges.end()) {
+				ServerCacheInfo* clearShard = routeMemo.singleShard(pProxyCommitData, clearRange);
+				if (clearShard != nullptr) {
 					// Fast path
 					DEBUG_MUTATION("ProxyCommit", self->commitVersion, m, pProxyCommitData->dbgid)
-					    .detail("To", ranges.begin().value().tags);
-					ranges.begin().value().populateTags();
-					self->toCommit.addTags(ranges.begin().value().tags);
+					    .detail("To", clearShard->tags);
+					self->toCommit.addTags(clearShard->tags);
 
 					// check whether clear is sampled
 					if (checkSample && !trCost->get().clearIdxCosts.empty() &&
 					    trCost->get().clearIdxCosts[0].first == mutationNum) {
-						for (const auto& ssInfo : ranges.begin().value().src_info) {
+						for (const auto& ssInfo : clearShard->src_info) {
 							auto id = ssInfo->interf.id();
 							pProxyCommitData->updateSSTagCost(
 							    id, trs[self->transactionNum].tagSet.get(), m, trCost->get().clearIdxCosts[0].second);
@@ -1978,6 +2039,7 @@ ACTOR Future<Void> assignMutationsToStorageServers(CommitBatchContext* self) {
 					}
 				} else {
 					CODE_PROBE(true, "A clear range extends past a shard boundary");
+					auto ranges = pProxyCommitData->keyInfo.intersectingRanges(clearRange);
 					std::set<Tag> allSources;
 					for (auto r : ranges) {
 						r.value().populateTags();
@@ -2006,7 +2068,12 @@ ACTOR Future<Void> assignMutationsToStorageServers(CommitBatchContext* self) {
 				if (pProxyCommitData->needsCacheTag(clearRange)) {
 					self->toCommit.addTag(cacheTag);
 				}
-				WriteMutationRefVar var = wait(writeMutation(self, encryptDomain, &m, &encryptedMutation, &arena));
+				writeFuture = writeMutation(self, encryptDomain, &m, &encryptedMutation, &arena);
+				if (!writeFuture.isReady()) {
+					// The memo can't survive an actual wait
+					routeMemo.reset();
+				}
+				WriteMutationRefVar var = wait(writeFuture);
 				// FIXME: Remove assert once ClearRange RAW_ACCESS usecase handling is done
 				ASSERT(std::holds_alternative<MutationRef>(var));
 				writtenMutation = std::get<MutationRef>(var);
@@ -2246,6 +2313,11 @@ ACTOR Future<Void> postResolution(CommitBatchContext* self) {
 	float ratio = self->toCommit.getEmptyMessageRatio();
 	pProxyCommitData->stats.commitBatchingEmptyMessageRatio.addMeasurement(ratio);
 
+	// Track a decaying high-water mark of per-location message bytes so that the next
+	// batch's LogPushData buffers can be sized to avoid reallocation copies.
+	pProxyCommitData->pushedMessageBytesHint =
+	    std::max(self->toCommit.getMaxMessageBytes(), pProxyCommitData->pushedMessageBytesHint * 7 / 8);
+
 	if (!self->forceRecovery) {
 		ASSERT(pProxyCommitData->latestLocalCommitBatchLogging.get() == self->localBatchNumber - 1);
 		pProxyCommitData->latestLocalCommitBatchLogging.set(self->localBatchNumber);
@@ -2521,6 +2593,12 @@ ACTOR Future<Void> commitBatch(ProxyCommitData* self,
 	state CommitBatch::CommitBatchContext context(self, trs, currentBatchMemBytesCount);
 	getCurrentLineage()->modify(&TransactionLineage::operation) = TransactionLineage::Operation::Commit;
 
+	// Bound the depth of the commit pipeline. The slot must be requested here, before the first wait, because
+	// FlowLock grants permits in request order and the stage sequencing below deadlocks if a later batch could
+	// hold the last permit while an earlier one is still waiting for its slot.
+	wait(self->commitBatchInFlightLock.take(TaskPriority::ProxyCommit));
+	state FlowLock::Releaser inFlightSlot(self->commitBatchInFlightLock);
+
 	// Active load balancing runs at a very high priority (to obtain accurate estimate of memory used by commit batches)
 	// so we need to downgrade here
 	wait(delay(0, TaskPriority::ProxyCommit));
@@ -2640,35 +2718,13 @@ ACTOR static Future<Void> tenantIdServer(CommitProxyInterface proxy,
 	}
 }
 
-ACTOR static Future<Void> doKeyServerLocationRequest(GetKeyServerLocationsRequest req, ProxyCommitData* commitData) {
-	// We can't respond to these requests until we have valid txnStateStore
-	getCurrentLineage()->modify(&TransactionLineage::operation) = TransactionLineage::Operation::GetKeyServersLocations;
-	getCurrentLineage()->modify(&TransactionLineage::txID) = req.spanContext.traceID;
-
-	wait(commitData->validState.getFuture());
-
-	state Version minVersion =
-	    req.minTenantVersion == latestVersion ? commitData->stats.lastCommitVersionAssigned + 1 : req.minTenantVersion;
-
-	wait(delay(0, TaskPriority::DefaultEndpoint));
-
-	bool validTenant = wait(checkTenant(commitData, req.tenant.tenantId, minVersion, "GetKeyServerLocation"));
-
-	if (!validTenant) {
-		++commitData->stats.keyServerLocationOut;
-		req.reply.sendError(tenant_not_found());
-		return Void();
-	}
-
+// Builds the location reply for req from the current keyInfo map. Callers must not wait
+// between checking commitData->validState and calling this, since commits may mutate
+// keyInfo across waits.
+static void buildKeyServerLocationReply(GetKeyServerLocationsRequest& req,
+                                        ProxyCommitData* commitData,
+                                        GetKeyServerLocationsReply& rep) {
 	std::unordered_set<UID> tssMappingsIncluded;
-	GetKeyServerLocationsReply rep;
-
-	if (req.tenant.hasTenant()) {
-		req.begin = req.begin.withPrefix(req.tenant.prefix.get(), req.arena);
-		if (req.end.present()) {
-			req.end = req.end.get().withPrefix(req.tenant.prefix.get(), req.arena);
-		}
-	}
 
 	if (!req.end.present()) {
 		auto r = req.reverse ? commitData->keyInfo.rangeContainingKeyBefore(req.begin)
@@ -2713,11 +2769,84 @@ ACTOR static Future<Void> doKeyServerLocationRequest(GetKeyServerLocationsReques
 		}
 	}
 	addTagMapping(rep, commitData);
+}
+
+ACTOR static Future<Void> doKeyServerLocationRequest(GetKeyServerLocationsRequest req, ProxyCommitData* commitData) {
+	// We can't respond to these requests until we have valid txnStateStore
+	getCurrentLineage()->modify(&TransactionLineage::operation) = TransactionLineage::Operation::GetKeyServersLocations;
+	getCurrentLineage()->modify(&TransactionLineage::txID) = req.spanContext.traceID;
+
+	wait(commitData->validState.getFuture());
+
+	state Version minVersion =
+	    req.minTenantVersion == latestVersion ? commitData->stats.lastCommitVersionAssigned + 1 : req.minTenantVersion;
+
+	wait(delay(0, TaskPriority::DefaultEndpoint));
+
+	bool validTenant = wait(checkTenant(commitData, req.tenant.tenantId, minVersion, "GetKeyServerLocation"));
+
+	if (!validTenant) {
+		++commitData->stats.keyServerLocationOut;
+		req.reply.sendError(tenant_not_found());
+		return Void();
+	}
+
+	GetKeyServerLocationsReply rep;
+
+	if (req.tenant.hasTenant()) {
+		req.begin = req.begin.withPrefix(req.tenant.prefix.get(), req.arena);
+		if (req.end.present()) {
+			req.end = req.end.get().withPrefix(req.tenant.prefix.get(), req.arena);
+		}
+	}
+
+	buildKeyServerLocationReply(req, commitData, rep);
 	req.reply.send(rep);
 	++commitData->stats.keyServerLocationOut;
 	return Void();
 }
 
+// Drains all tenantless location requests queued by readRequestServer in one actor, so
+// location request storms are answered in batches at default priority instead of
+// spawning one actor per request alongside commit processing. Point lookups repeated
+// within a batch are answered from a shared reply cache; the cache is only valid until
+// the next yield, since commits may mutate keyInfo whenever this actor waits.
+ACTOR static Future<Void> doKeyServerLocationRequestBatch(ProxyCommitData* commitData) {
+	getCurrentLineage()->modify(&TransactionLineage::operation) = TransactionLineage::Operation::GetKeyServersLocations;
+
+	// We can't respond to these requests until we have valid txnStateStore
+	wait(commitData->validState.getFuture());
+	wait(delay(0, TaskPriority::DefaultEndpoint));
+
+	state std::map<std::pair<bool, Key>, GetKeyServerLocationsReply> pointReplyCache;
+	while (!commitData->pendingKeyServerLocationRequests.empty()) {
+		GetKeyServerLocationsRequest req = commitData->pendingKeyServerLocationRequests.front();
+		commitData->pendingKeyServerLocationRequests.pop_front();
+		ASSERT(!req.tenant.hasTenant());
+
+		if (!req.end.present()) {
+			auto cached = pointReplyCache.try_emplace(std::make_pair(req.reverse, Key(req.begin)));
+			if (cached.second) {
+				buildKeyServerLocationReply(req, commitData, cached.first->second);
+			} else {
+				CODE_PROBE(true, "Key server location request answered from batch reply cache");
+			}
+			req.reply.send(cached.first->second);
+		} else {
+			GetKeyServerLocationsReply rep;
+			buildKeyServerLocationReply(req, commitData, rep);
+			req.reply.send(rep);
+		}
+		++commitData->stats.keyServerLocationOut;
+
+		if (check_yield(TaskPriority::DefaultEndpoint)) {
+			pointReplyCache.clear();
+			wait(yield(TaskPriority::DefaultEndpoint));
+		}
+	}
+	return Void();
+}
+
 ACTOR static Future<Void> readRequestServer(CommitProxyInterface proxy,
                                             PromiseStream<Future<Void>> addActor,
                                             ProxyCommitData* commitData) {
@@ -2730,9 +2859,16 @@ ACTOR static Future<Void> readRequestServer(CommitProxyInterface proxy,
 			++commitData->stats.keyServerLocationErrors;
 			req.reply.sendError(commit_proxy_memory_limit_exceeded());
 			TraceEvent(SevWarnAlways, "ProxyLocationRequestThresholdExceeded").suppressFor(60);
-		} else {
+		} else if (req.tenant.hasTenant()) {
+			// Tenant requests may need to wait for tenant metadata, so they keep their own actor
 			++commitData->stats.keyServerLocationIn;
 			addActor.send(doKeyServerLocationRequest(req, commitData));
+		} else {
+			++commitData->stats.keyServerLocationIn;
+			commitData->pendingKeyServerLocationRequests.push_back(req);
+			if (commitData->pendingKeyServerLocationRequests.size() == 1) {
+				addActor.send(doKeyServerLocationRequestBatch(commitData));
+			}
 		}
 	}
 }
@@ -353,6 +353,34 @@ ACTOR Future<int64_t> getDatabaseSize(Database cx) {
 // Checks that the data in each shard is the same on each storage server that it resides on.  Also performs some
 // sanity checks on the sizes of shards and storage servers. Returns false if there is a failure
 // TODO: Future optimization: Use streaming reads
+// Persists the key up to which the current round of the consistency scan has verified data, so
+// that a restarted scan can resume where it left off. A no-op when no ConsistencyScanInfo exists,
+// as is the case when the shared scan logic runs inside the ConsistencyCheck workload.
+ACTOR Future<Void> persistConsistencyScanProgress(Database cx, Key progressKey) {
+	state Reference<ReadYourWritesTransaction> csInfoTr = makeReference<ReadYourWritesTransaction>(cx);
+	loop {
+		try {
+			csInfoTr->reset();
+			csInfoTr->setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
+
+			state Optional<Value> val = wait(ConsistencyScanInfo::getInfo(csInfoTr));
+			wait(csInfoTr->commit());
+			if (val.present()) {
+				ConsistencyScanInfo consistencyScanInfo =
+				    ObjectReader::fromStringRef<ConsistencyScanInfo>(val.get(), IncludeVersion());
+				consistencyScanInfo.progress_key = progressKey;
+				csInfoTr->reset();
+				csInfoTr->setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
+				wait(ConsistencyScanInfo::setInfo(csInfoTr, consistencyScanInfo));
+				wait(csInfoTr->commit());
+			}
+			return Void();
+		} catch (Error& e) {
+			wait(csInfoTr->onError(e));
+		}
+	}
+}
+
 ACTOR Future<bool> checkDataConsistency(Database cx,
                                         VectorRef<KeyValueRef> keyLocations,
                                         DatabaseConfiguration configuration,
@@ -372,7 +400,8 @@ ACTOR Future<bool> checkDataConsistency(Database cx,
                                         int restart,
                                         int64_t maxRate,
                                         int64_t targetInterval,
-                                        KeyRef progressKey) {
+                                        KeyRef progressKey,
+                                        Optional<std::vector<int>> shardIndices) {
 	// Stores the total number of bytes on each storage server
 	// In a distributed test, this will be an estimated size
 	state std::map<UID, int64_t> storageServerSizes;
@@ -429,6 +458,12 @@ ACTOR Future<bool> checkDataConsistency(Database cx,
 	for (; i < ranges.size(); i++) {
 		state int shard = shardOrder[i];
 
+		// When a caller schedules shards itself (e.g. the per-team parallel check), only check its subset
+		if (shardIndices.present() &&
+		    !std::binary_search(shardIndices.get().begin(), shardIndices.get().end(), shard)) {
+			continue;
+		}
+
 		state KeyRangeRef range = ranges[shard];
 		state std::vector<UID> sourceStorageServers;
 		state std::vector<UID> destStorageServers;
@@ -535,6 +570,12 @@ ACTOR Future<bool> checkDataConsistency(Database cx,
 			state KeySelector begin = firstGreaterOrEqual(range.begin);
 			state Transaction onErrorTr(cx); // This transaction exists only to access onError and its backoff behavior
 
+			// In checksum-only mode, pages whose digests agree on every replica are never shipped to
+			// the scanner. Quiescent checks need the full content to validate byte sample estimates,
+			// so they always read in full.
+			state bool digestScan = SERVER_KNOBS->CONSISTENCY_SCAN_CHECKSUM_ONLY && !performQuiescentChecks;
+			state bool fullReadPage = false;
+
 			// Read a limited number of entries at a time, repeating until all keys in the shard have been read
 			loop {
 				try {
@@ -551,6 +592,104 @@ ACTOR Future<bool> checkDataConsistency(Database cx,
 					req.version = version;
 					req.tags = TagSet();
 
+					if (digestScan && !fullReadPage) {
+						state GetRangeDigestRequest digestReq;
+						Key digestBegin = begin.isFirstGreaterOrEqual() ? Key(begin.getKey()) : keyAfter(begin.getKey());
+						digestReq.range = KeyRangeRef(digestBegin, range.end);
+						digestReq.version = version;
+						digestReq.limit = req.limit;
+						digestReq.limitBytes = req.limitBytes;
+
+						state std::vector<Future<ErrorOr<GetRangeDigestReply>>> digestFutures;
+						state int d = 0;
+						for (d = 0; d < storageServerInterfaces.size(); d++) {
+							resetReply(digestReq);
+							if (SERVER_KNOBS->ENABLE_VERSION_VECTOR) {
+								cx->getLatestCommitVersion(
+								    storageServerInterfaces[d], digestReq.version, digestReq.ssLatestCommitVersions);
+							}
+							digestFutures.push_back(
+							    storageServerInterfaces[d].getRangeDigest.getReplyUnlessFailedFor(digestReq, 2, 0));
+						}
+
+						wait(waitForAll(digestFutures));
+
+						state int firstValidDigest = -1;
+						state bool digestsUsable = true;
+						totalReadAmount = 0;
+						for (d = 0; d < digestFutures.size(); d++) {
+							ErrorOr<GetRangeDigestReply> digestResult = digestFutures[d].get();
+							if (!digestResult.present()) {
+								// An unavailable replica needs the detailed error handling of the full read path
+								digestsUsable = false;
+							} else if (firstValidDigest == -1) {
+								firstValidDigest = d;
+								totalReadAmount += digestResult.get().bytes;
+							} else {
+								GetRangeDigestReply current = digestResult.get();
+								GetRangeDigestReply reference = digestFutures[firstValidDigest].get().get();
+								totalReadAmount += current.bytes;
+								if (current.digest != reference.digest || current.keys != reference.keys ||
+								    current.bytes != reference.bytes || current.lastKey != reference.lastKey ||
+								    current.more != reference.more) {
+									TraceEvent("ConsistencyCheck_DigestMismatch")
+									    .detail(format("StorageServer%d", d).c_str(), storageServers[d].toString())
+									    .detail(format("StorageServer%d", firstValidDigest).c_str(),
+									            storageServers[firstValidDigest].toString())
+									    .detail("ShardBegin", digestReq.range.begin)
+									    .detail("ShardEnd", digestReq.range.end)
+									    .detail("VersionNumber", digestReq.version);
+									digestsUsable = false;
+								}
+							}
+						}
+
+						if (!digestsUsable || firstValidDigest < 0) {
+							// Re-read this page in full: a digest mismatch needs the actual content to report
+							// what differs, and it is the full read that decides whether this is a failure
+							CODE_PROBE(firstValidDigest >= 0,
+							           "Consistency scan digest mismatch, falling back to full read");
+							fullReadPage = true;
+							continue;
+						}
+
+						CODE_PROBE(true, "Consistency scan page verified by digests only");
+						state GetRangeDigestReply agreed = digestFutures[firstValidDigest].get().get();
+
+						// Pace the scan by the bytes each replica read to compute its digest, even though
+						// almost none of them were shipped to us
+						if (rateLimitForThisRound > 0) {
+							wait(rateLimiter->getAllowance(totalReadAmount));
+							// Set ratelimit to max allowed if current round has been going on for a while
+							if (now() - rateLimiterStartTime > 1.1 * targetInterval &&
+							    rateLimitForThisRound != maxRate) {
+								rateLimitForThisRound = maxRate;
+								rateLimiter = Reference<IRateControl>(new SpeedLimit(rateLimitForThisRound, 1));
+								rateLimiterStartTime = now();
+								TraceEvent(SevInfo, "ConsistencyCheck_RateLimitSetMaxForThisRound")
+								    .detail("RateLimit", rateLimitForThisRound);
+							}
+						}
+						bytesReadInRange += totalReadAmount;
+						bytesReadInthisRound += totalReadAmount;
+
+						if (agreed.keys > 0) {
+							progressKey = agreed.lastKey;
+							wait(persistConsistencyScanProgress(cx, progressKey));
+						}
+
+						// Advance to the next page
+						if (agreed.more) {
+							ASSERT(agreed.keys > 0);
+							begin = firstGreaterOrEqual(keyAfter(agreed.lastKey));
+							ASSERT(begin.getKey() != allKeys.end);
+							lastStartSampleKey = lastSampleKey;
+							continue;
+						} else {
+							break;
+						}
+					}
+
 					// Try getting the entries in the specified range
 					state std::vector<Future<ErrorOr<GetKeyValuesReply>>> keyValueFutures;
 					state int j = 0;
@@ -750,31 +889,8 @@ ACTOR Future<bool> checkDataConsistency(Database cx,
 
 						// Persist the last key of the range we just verified as the progressKey
 						if (data.size()) {
-							state Reference<ReadYourWritesTransaction> csInfoTr =
-							    makeReference<ReadYourWritesTransaction>(cx);
 							progressKey = data[data.size() - 1].key;
-							loop {
-								try {
-									csInfoTr->reset();
-									csInfoTr->setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
-
-									state Optional<Value> val = wait(ConsistencyScanInfo::getInfo(csInfoTr));
-									wait(csInfoTr->commit());
-									if (val.present()) {
-										ConsistencyScanInfo consistencyScanInfo =
-										    ObjectReader::fromStringRef<ConsistencyScanInfo>(val.get(),
-										                                                     IncludeVersion());
-										consistencyScanInfo.progress_key = progressKey;
-										csInfoTr->reset();
-										csInfoTr->setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
-										wait(ConsistencyScanInfo::setInfo(csInfoTr, consistencyScanInfo));
-										wait(csInfoTr->commit());
-									}
-									break;
-								} catch (Error& e) {
-									wait(csInfoTr->onError(e));
-								}
-							}
+							wait(persistConsistencyScanProgress(cx, progressKey));
 						}
 
 						// Calculate the size of the shard, the variance of the shard size estimate, and the correct
@@ -847,6 +963,7 @@ ACTOR Future<bool> checkDataConsistency(Database cx,
 						begin = firstGreaterThan(result[result.size() - 1].key);
 						ASSERT(begin.getKey() != allKeys.end);
 						lastStartSampleKey = lastSampleKey;
+						fullReadPage = false;
 					} else
 						break;
 				} catch (Error& e) {
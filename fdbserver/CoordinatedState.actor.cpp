@@ -18,6 +18,8 @@
  * limitations under the License.
  */
 
+#include <map>
+
 #include "fdbclient/ClusterConnectionMemoryRecord.h"
 #include "fdbserver/ConfigBroadcaster.h"
 #include "fdbserver/CoordinatedState.h"
@@ -69,6 +71,15 @@ ACTOR Future<GenerationRegReadReply> nonemptyToNever(Future<GenerationRegReadRep
 	return r;
 }
 
+// The most recently observed generation for each cluster key in this process, used to seed the speculative
+// combined read+prepare round below. This is only a performance hint: correctness of a speculative
+// generation is established from the quorum's replies, so a stale (or, in simulation, cross-process) entry
+// just costs the usual second round trip.
+static std::map<Key, uint64_t>& generationHints() {
+	static std::map<Key, uint64_t> hints;
+	return hints;
+}
+
 struct CoordinatedStateImpl {
 	ServerCoordinators coordinators;
 	int stage;
@@ -92,27 +103,50 @@ struct CoordinatedStateImpl {
 	ACTOR static Future<Value> read(CoordinatedStateImpl* self) {
 		ASSERT(self->stage == 0);
 
+		// The first round is normally only a discovery read (gen 0) and a second round establishes our
+		// read generation. If this process has seen a generation for this cluster key before, guess the
+		// next one and send the first round as a combined read+prepare: when a majority confirms the
+		// guessed generation dominates everything they had seen, the second round trip is skipped.
+		// Otherwise this degenerates to the original discovery round and we proceed as before.
+		state UniqueGeneration specGen;
 		{
-			self->stage = 1;
-			GenerationRegReadReply rep = wait(self->replicatedRead(
-			    self, GenerationRegReadRequest(self->coordinators.clusterKey, UniqueGeneration())));
+			auto hint = generationHints().find(self->coordinators.clusterKey);
+			if (hint != generationHints().end()) {
+				specGen = UniqueGeneration(hint->second + 1, deterministicRandom()->randomUniqueID());
+			}
+		}
+
+		state int specConfirmed = 0;
+		self->stage = 1;
+		state GenerationRegReadReply rep = wait(self->replicatedRead(
+		    self, GenerationRegReadRequest(self->coordinators.clusterKey, specGen), &specConfirmed));
+
+		int majority = self->coordinators.stateServers.size() / 2 + 1;
+		if (specGen.generation > 0 && specConfirmed >= majority && rep.gen < specGen && rep.rgen == specGen) {
+			// A majority promised our speculative generation and had seen nothing higher, which is exactly
+			// what the second round would have established
+			CODE_PROBE(true, "Speculative coordinated state prepare succeeded");
+			self->gen = specGen;
+			self->conflictGen = std::max(self->conflictGen, std::max(rep.gen.generation, rep.rgen.generation));
+		} else {
+			CODE_PROBE(specGen.generation > 0, "Speculative coordinated state prepare failed");
 			self->conflictGen = std::max(self->conflictGen, std::max(rep.gen.generation, rep.rgen.generation)) + 1;
 			self->gen = UniqueGeneration(self->conflictGen, deterministicRandom()->randomUniqueID());
-		}
 
-		{
 			self->stage = 2;
-			GenerationRegReadReply rep =
-			    wait(self->replicatedRead(self, GenerationRegReadRequest(self->coordinators.clusterKey, self->gen)));
+			GenerationRegReadReply rep2 = wait(self->replicatedRead(
+			    self, GenerationRegReadRequest(self->coordinators.clusterKey, self->gen), nullptr));
+			rep = rep2;
 			self->stage = 3;
 			self->conflictGen = std::max(self->conflictGen, std::max(rep.gen.generation, rep.rgen.generation));
-			if (self->isDoomed(rep))
-				self->doomed = true;
-			self->initial = rep.gen.generation == 0;
-
-			self->stage = 4;
-			return rep.value.present() ? rep.value.get() : Value();
 		}
+		if (self->isDoomed(rep))
+			self->doomed = true;
+		self->initial = rep.gen.generation == 0;
+		generationHints()[self->coordinators.clusterKey] = self->gen.generation;
+
+		self->stage = 4;
+		return rep.value.present() ? rep.value.get() : Value();
 	}
 	ACTOR static Future<Void> onConflict(CoordinatedStateImpl* self) {
 		ASSERT(self->stage == 4);
@@ -121,7 +155,7 @@ struct CoordinatedStateImpl {
 		loop {
 			wait(delay(SERVER_KNOBS->COORDINATED_STATE_ONCONFLICT_POLL_INTERVAL));
 			GenerationRegReadReply rep = wait(self->replicatedRead(
-			    self, GenerationRegReadRequest(self->coordinators.clusterKey, UniqueGeneration())));
+			    self, GenerationRegReadRequest(self->coordinators.clusterKey, UniqueGeneration()), nullptr));
 			if (self->stage > 4)
 				break;
 			self->conflictGen = std::max(self->conflictGen, std::max(rep.gen.generation, rep.rgen.generation));
@@ -150,12 +184,18 @@ struct CoordinatedStateImpl {
 			return Void();
 		else {
 			self->conflictGen = std::max(self->conflictGen, wgen.generation);
+			// Remember the winning generation so the next attempt's speculative prepare aims above it
+			auto& hint = generationHints()[self->coordinators.clusterKey];
+			hint = std::max(hint, wgen.generation);
 			throw coordinated_state_conflict();
 		}
 	}
 
+	// If specConfirmed is non-null, it is set to the number of ready replies that promised req.gen as
+	// their highest read generation without having seen a write at or above it
 	ACTOR static Future<GenerationRegReadReply> replicatedRead(CoordinatedStateImpl* self,
-	                                                           GenerationRegReadRequest req) {
+	                                                           GenerationRegReadRequest req,
+	                                                           int* specConfirmed) {
 		state std::vector<GenerationRegInterface>& replicas = self->coordinators.stateServers;
 		state std::vector<Future<GenerationRegReadReply>> rep_empty_reply;
 		state std::vector<Future<GenerationRegReadReply>> rep_reply;
@@ -172,6 +212,21 @@ struct CoordinatedStateImpl {
 		           (replicas.size() + 1) / 2); // enough empty to ensure we cannot achieve a majority non-empty
 		wait(quorum(rep_reply, replicas.size() / 2 + 1) || majorityEmpty);
 
+		if (specConfirmed != nullptr) {
+			*specConfirmed = 0;
+			for (int i = 0; i < rep_reply.size(); i++) {
+				Optional<GenerationRegReadReply> r;
+				if (rep_reply[i].isReady() && !rep_reply[i].isError()) {
+					r = rep_reply[i].get();
+				} else if (rep_empty_reply[i].isReady() && !rep_empty_reply[i].isError()) {
+					r = rep_empty_reply[i].get();
+				}
+				if (r.present() && r.get().rgen == req.gen && r.get().gen < req.gen) {
+					++*specConfirmed;
+				}
+			}
+		}
+
 		if (majorityEmpty.isReady()) {
 			int best = -1;
 			for (int i = 0; i < rep_empty_reply.size(); i++)
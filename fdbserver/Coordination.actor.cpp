@@ -215,6 +215,10 @@ TEST_CASE("/fdbserver/Coordination/localGenerationReg/simple") {
 	return Void();
 }
 
+// Holds a client's open database request until the cached ClientDBInfo differs from the id the client
+// already knows, so connected clients are notified of leader and proxy changes by push rather than by
+// polling. The CLIENT_REGISTER_INTERVAL breakout only bounds how long a disappeared client can occupy a
+// slot in clientStatusInfoMap.
 ACTOR Future<Void> openDatabase(ClientData* db,
                                 int* clientCount,
                                 Reference<AsyncVar<bool>> hasConnectedClients,
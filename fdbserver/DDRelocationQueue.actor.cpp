@@ -649,6 +649,41 @@ struct DDQueue : public IDDRelocationQueue {
 	std::map<UID, Busyness> busymap; // UID is serverID
 	std::map<UID, Busyness> destBusymap; // UID is serverID
 
+	// Estimated bytes of shard data each source server is currently streaming out for in-flight
+	// relocations. Busyness limits moves by count; this limits them by volume, so several large
+	// rebalance moves cannot pile their fetch load onto one already-hot source server.
+	std::map<UID, int64_t> srcFetchBytesInFlight;
+	AsyncTrigger srcFetchBytesReleased;
+
+	void chargeSrcFetchBytes(std::vector<UID> const& servers, int64_t bytes) {
+		for (const UID& id : servers) {
+			srcFetchBytesInFlight[id] += bytes;
+		}
+	}
+	void releaseSrcFetchBytes(std::vector<UID> const& servers, int64_t bytes) {
+		for (const UID& id : servers) {
+			auto it = srcFetchBytesInFlight.find(id);
+			ASSERT(it != srcFetchBytesInFlight.end() && it->second >= bytes);
+			it->second -= bytes;
+			if (it->second == 0) {
+				srcFetchBytesInFlight.erase(it);
+			}
+		}
+		srcFetchBytesReleased.trigger();
+	}
+	// True if every source server can absorb another `bytes` of fetch load. A server with no
+	// in-flight relocation bytes always has budget, so shards larger than the budget still move.
+	bool srcHasFetchBudget(std::vector<UID> const& servers, int64_t bytes) const {
+		for (const UID& id : servers) {
+			auto it = srcFetchBytesInFlight.find(id);
+			if (it != srcFetchBytesInFlight.end() && it->second > 0 &&
+			    it->second + bytes > SERVER_KNOBS->RELOCATION_FETCH_BYTES_PER_SOURCE_SERVER) {
+				return false;
+			}
+		}
+		return true;
+	}
+
 	KeyRangeMap<RelocateData> queueMap;
 	std::set<RelocateData, std::greater<RelocateData>> fetchingSourcesQueue;
 	std::set<RelocateData, std::greater<RelocateData>> fetchKeysComplete;
@@ -1429,6 +1464,7 @@ ACTOR Future<Void> dataDistributionRelocator(DDQueue* self,
 	state WantTrueBest wantTrueBest(isValleyFillerPriority(rd.priority));
 	state uint64_t debugID = deterministicRandom()->randomUInt64();
 	state bool enableShardMove = SERVER_KNOBS->SHARD_ENCODE_LOCATION_METADATA && SERVER_KNOBS->ENABLE_DD_PHYSICAL_SHARD;
+	state int64_t srcFetchBytesCharged = 0;
 
 	try {
 		if (now() - self->lastInterval < 1.0) {
@@ -1481,6 +1517,21 @@ ACTOR Future<Void> dataDistributionRelocator(DDQueue* self,
 		state std::unordered_set<uint64_t> excludedDstPhysicalShards;
 
 		ASSERT(rd.src.size());
+
+		// Source-aware admission: now that the shard's size is known, wait until every source
+		// server has fetch-bandwidth budget before moving data. Only rebalance-class moves wait;
+		// team-health moves (and splits) proceed immediately but still consume budget, which
+		// pushes background rebalancing away from sources that are busy with urgent moves.
+		if (SERVER_KNOBS->RELOCATION_FETCH_BYTES_PER_SOURCE_SERVER > 0) {
+			if (rd.priority < SERVER_KNOBS->PRIORITY_TEAM_UNHEALTHY) {
+				while (!self->srcHasFetchBudget(rd.src, metrics.bytes)) {
+					CODE_PROBE(true, "Relocation waits for source fetch-bandwidth budget");
+					wait(self->srcFetchBytesReleased.onTrigger());
+				}
+			}
+			self->chargeSrcFetchBytes(rd.src, metrics.bytes);
+			srcFetchBytesCharged = metrics.bytes;
+		}
 		loop {
 			destOverloadedCount = 0;
 			stuckCount = 0;
@@ -2014,6 +2065,10 @@ ACTOR Future<Void> dataDistributionRelocator(DDQueue* self,
 						dataTransferComplete.send(rd);
 					}
 
+					if (srcFetchBytesCharged > 0) {
+						self->releaseSrcFetchBytes(rd.src, srcFetchBytesCharged);
+						srcFetchBytesCharged = 0;
+					}
 					self->bytesWritten += metrics.bytes;
 					self->shardsAffectedByTeamFailure->finishMove(rd.keys);
 					relocationComplete.send(rd);
@@ -2052,6 +2107,10 @@ ACTOR Future<Void> dataDistributionRelocator(DDQueue* self,
 		}
 	} catch (Error& e) {
 		state Error err = e;
+		if (srcFetchBytesCharged > 0) {
+			self->releaseSrcFetchBytes(rd.src, srcFetchBytesCharged);
+			srcFetchBytesCharged = 0;
+		}
 		TraceEvent(relocateShardInterval.end(), distributorId)
 		    .errorUnsuppressed(err)
 		    .detail("Duration", now() - startTime);
@@ -19,6 +19,7 @@
  */
 
 #include "fdbclient/FDBTypes.h"
+#include "fdbclient/ManagementAPI.actor.h"
 #include "fdbclient/StorageServerInterface.h"
 #include "fdbrpc/FailureMonitor.h"
 #include "fdbclient/SystemData.h"
@@ -165,6 +166,10 @@ void restartShardTrackers(DataDistributionTracker* self,
                           Optional<ShardMetrics> startingMetrics = Optional<ShardMetrics>(),
                           bool whenDDInit = false);
 
+// Restarts the shard's split/merge evaluator if its current metrics put it close enough
+// to a split or merge threshold to need one. No-op if the evaluator is already running.
+void activateShardEvaluator(DataDistributionTracker* self, KeyRangeRef keys);
+
 // Gets the permitted size and IO bounds for a shard. A shard that starts at allKeys.begin
 //  (i.e. '') will have a permitted size of 0, since the database can contain no data.
 ShardSizeBounds getShardSizeBounds(KeyRangeRef shard, int64_t maxShardSize) {
@@ -208,6 +213,26 @@ int64_t getMaxShardSize(double dbSizeEstimate) {
 	                (int64_t)SERVER_KNOBS->MAX_SHARD_BYTES);
 }
 
+// With on-demand evaluators, quiet shards that sit comfortably between the merge and
+// split thresholds do not keep a shardTracker actor running. This decides whether a
+// shard is close enough to a threshold to need one. The activation factor widens the
+// band so that evaluators restart before a threshold is actually crossed; it is
+// deliberately broader than the conditions shardEvaluator acts on, so retiring an
+// evaluator can never skip a split or merge.
+bool shardNeedsEvaluator(DataDistributionTracker* self, KeyRangeRef keys, ShardMetrics const& shardMetrics) {
+	if (!SERVER_KNOBS->DD_TRACKER_ON_DEMAND_EVALUATORS)
+		return true;
+	if (!self->maxShardSize->get().present())
+		return true;
+
+	ShardSizeBounds bounds = getShardSizeBounds(keys, self->maxShardSize->get().get());
+	StorageMetrics const& stats = shardMetrics.metrics;
+	double factor = SERVER_KNOBS->DD_TRACKER_EVALUATOR_ACTIVATION_FACTOR;
+
+	return stats.bytes * factor >= bounds.max.bytes || stats.bytes <= bounds.min.bytes * factor ||
+	       stats.bytesWrittenPerKSecond * factor >= SERVER_KNOBS->SHARD_MAX_BYTES_PER_KSEC;
+}
+
 // Returns the shard size bounds as well as whether `keys` a read hot shard.
 std::pair<ShardSizeBounds, bool> calculateShardSizeBounds(
     const KeyRange& keys,
@@ -352,6 +377,7 @@ ACTOR Future<Void> trackShardMetrics(DataDistributionTracker::SafeAccessor self,
 					}
 
 					shardMetrics->set(ShardMetrics(metrics.first.get(), lastLowBandwidthStartTime, shardCount));
+					activateShardEvaluator(self(), keys);
 					break;
 				} else {
 					shardCount = metrics.second;
@@ -359,6 +385,7 @@ ACTOR Future<Void> trackShardMetrics(DataDistributionTracker::SafeAccessor self,
 						auto newShardMetrics = shardMetrics->get().get();
 						newShardMetrics.shardCount = shardCount;
 						shardMetrics->set(newShardMetrics);
+						activateShardEvaluator(self(), keys);
 					}
 				}
 			}
@@ -373,19 +400,155 @@ ACTOR Future<Void> trackShardMetrics(DataDistributionTracker::SafeAccessor self,
 	}
 }
 
+// A range the read hot detector has promoted into the storage cache, or is considering promoting
+struct AutoCachedRangeInfo {
+	double firstHot; // when this range was first reported read hot
+	double lastHot; // the most recent time this range was reported read hot
+	int64_t bytes; // estimated storage bytes, counted against DD_AUTO_STORAGE_CACHE_BYTE_BUDGET once cached
+};
+
+// Promotes ranges that have stayed read hot for DD_AUTO_STORAGE_CACHE_PROMOTE_DELAY into the storage cache,
+// within the DD_AUTO_STORAGE_CACHE_BYTE_BUDGET. Promotion is skipped while the cluster has no storage cache
+// servers registered, since there would be nothing to serve the cached ranges.
+ACTOR Future<Void> updateAutoCachedRanges(DataDistributionTracker* self,
+                                          Standalone<VectorRef<ReadHotRangeWithMetrics>> readHotRanges,
+                                          std::map<KeyRange, AutoCachedRangeInfo, KeyRangeRef::ArbitraryOrder>* candidates,
+                                          std::map<KeyRange, AutoCachedRangeInfo, KeyRangeRef::ArbitraryOrder>* cachedRanges,
+                                          int64_t* cachedBytes) {
+	state std::vector<std::pair<KeyRange, int64_t>> toPromote;
+	double t = now();
+	for (const auto& r : readHotRanges) {
+		KeyRange range(r.keys);
+		bool alreadyCached = false;
+		for (auto& cached : *cachedRanges) {
+			if (cached.first.intersects(range)) {
+				cached.second.lastHot = t;
+				alreadyCached = true;
+			}
+		}
+		if (alreadyCached) {
+			continue;
+		}
+		// The hot subrange boundaries jitter between samples, so match candidates by intersection and keep
+		// the boundaries from the first report rather than requiring an exact repeat.
+		auto candidate = candidates->end();
+		for (auto it = candidates->begin(); it != candidates->end(); ++it) {
+			if (it->first.intersects(range)) {
+				candidate = it;
+				break;
+			}
+		}
+		if (candidate == candidates->end()) {
+			candidate = candidates->emplace(range, AutoCachedRangeInfo{ t, t, r.bytes }).first;
+		} else {
+			candidate->second.lastHot = t;
+			candidate->second.bytes = r.bytes;
+		}
+		if (t - candidate->second.firstHot >= SERVER_KNOBS->DD_AUTO_STORAGE_CACHE_PROMOTE_DELAY &&
+		    *cachedBytes + candidate->second.bytes <= SERVER_KNOBS->DD_AUTO_STORAGE_CACHE_BYTE_BUDGET) {
+			toPromote.emplace_back(candidate->first, candidate->second.bytes);
+		}
+	}
+	// Forget candidates that cooled off before qualifying
+	for (auto it = candidates->begin(); it != candidates->end();) {
+		if (t - it->second.lastHot > SERVER_KNOBS->DD_AUTO_STORAGE_CACHE_DEMOTE_DELAY) {
+			it = candidates->erase(it);
+		} else {
+			++it;
+		}
+	}
+	if (toPromote.empty()) {
+		return Void();
+	}
+
+	state Transaction tr(self->db->context());
+	loop {
+		try {
+			tr.setOption(FDBTransactionOptions::READ_SYSTEM_KEYS);
+			RangeResult cacheServers = wait(tr.getRange(storageCacheServerKeys, 1));
+			if (cacheServers.empty()) {
+				return Void();
+			}
+			break;
+		} catch (Error& e) {
+			wait(tr.onError(e));
+		}
+	}
+
+	state int i;
+	for (i = 0; i < (int)toPromote.size(); i++) {
+		if (*cachedBytes + toPromote[i].second > SERVER_KNOBS->DD_AUTO_STORAGE_CACHE_BYTE_BUDGET) {
+			continue;
+		}
+		wait(ManagementAPI::addCachedRange(self->db->context().getReference(), toPromote[i].first));
+		*cachedBytes += toPromote[i].second;
+		cachedRanges->emplace(toPromote[i].first, AutoCachedRangeInfo{ now(), now(), toPromote[i].second });
+		candidates->erase(toPromote[i].first);
+		CODE_PROBE(true, "DD promoted a sustained read-hot range into the storage cache");
+		TraceEvent("DDAutoCachedRangeAdded", self->distributorId)
+		    .detail("Begin", toPromote[i].first.begin)
+		    .detail("End", toPromote[i].first.end)
+		    .detail("Bytes", toPromote[i].second)
+		    .detail("TotalCachedBytes", *cachedBytes);
+	}
+	return Void();
+}
+
+// Removes auto-cached ranges from the storage cache once they have not been reported read hot for
+// DD_AUTO_STORAGE_CACHE_DEMOTE_DELAY.
+ACTOR Future<Void> demoteAutoCachedRanges(DataDistributionTracker* self,
+                                          std::map<KeyRange, AutoCachedRangeInfo, KeyRangeRef::ArbitraryOrder>* cachedRanges,
+                                          int64_t* cachedBytes) {
+	state std::vector<KeyRange> toRemove;
+	for (const auto& cached : *cachedRanges) {
+		if (now() - cached.second.lastHot > SERVER_KNOBS->DD_AUTO_STORAGE_CACHE_DEMOTE_DELAY) {
+			toRemove.push_back(cached.first);
+		}
+	}
+	state int i;
+	for (i = 0; i < (int)toRemove.size(); i++) {
+		wait(ManagementAPI::removeCachedRange(self->db->context().getReference(), toRemove[i]));
+		auto it = cachedRanges->find(toRemove[i]);
+		*cachedBytes -= it->second.bytes;
+		cachedRanges->erase(it);
+		CODE_PROBE(true, "DD removed a cooled range from the storage cache");
+		TraceEvent("DDAutoCachedRangeRemoved", self->distributorId)
+		    .detail("Begin", toRemove[i].begin)
+		    .detail("End", toRemove[i].end)
+		    .detail("TotalCachedBytes", *cachedBytes);
+	}
+	return Void();
+}
+
 ACTOR Future<Void> readHotDetector(DataDistributionTracker* self) {
+	state std::map<KeyRange, AutoCachedRangeInfo, KeyRangeRef::ArbitraryOrder> cacheCandidates;
+	state std::map<KeyRange, AutoCachedRangeInfo, KeyRangeRef::ArbitraryOrder> cachedRanges;
+	state int64_t cachedBytes = 0;
 	try {
 		loop {
-			state KeyRange keys = waitNext(self->readHotShard.getFuture());
-			Standalone<VectorRef<ReadHotRangeWithMetrics>> readHotRanges = wait(self->db->getReadHotRanges(keys));
-
-			for (const auto& keyRange : readHotRanges) {
-				TraceEvent("ReadHotRangeLog")
-				    .detail("ReadDensity", keyRange.density)
-				    .detail("ReadBandwidth", keyRange.readBandwidthSec)
-				    .detail("ReadDensityThreshold", SERVER_KNOBS->SHARD_MAX_READ_DENSITY_RATIO)
-				    .detail("KeyRangeBegin", keyRange.keys.begin)
-				    .detail("KeyRangeEnd", keyRange.keys.end);
+			choose {
+				when(state KeyRange keys = waitNext(self->readHotShard.getFuture())) {
+					state Standalone<VectorRef<ReadHotRangeWithMetrics>> readHotRanges =
+					    wait(self->db->getReadHotRanges(keys));
+
+					for (const auto& keyRange : readHotRanges) {
+						TraceEvent("ReadHotRangeLog")
+						    .detail("ReadDensity", keyRange.density)
+						    .detail("ReadBandwidth", keyRange.readBandwidthSec)
+						    .detail("ReadDensityThreshold", SERVER_KNOBS->SHARD_MAX_READ_DENSITY_RATIO)
+						    .detail("KeyRangeBegin", keyRange.keys.begin)
+						    .detail("KeyRangeEnd", keyRange.keys.end);
+					}
+
+					if (SERVER_KNOBS->DD_AUTO_STORAGE_CACHE && !self->db->isMocked()) {
+						wait(updateAutoCachedRanges(
+						    self, readHotRanges, &cacheCandidates, &cachedRanges, &cachedBytes));
+					}
+				}
+				when(wait(cachedRanges.empty() ? Never()
+				                               : delay(SERVER_KNOBS->DD_AUTO_STORAGE_CACHE_DEMOTE_DELAY / 4.0))) {
+					wait(demoteAutoCachedRanges(self, &cachedRanges, &cachedBytes));
+				}
 			}
 		}
 	} catch (Error& e) {
@@ -1224,6 +1387,16 @@ ACTOR Future<Void> shardTracker(DataDistributionTracker::SafeAccessor self,
 			// We could have a lot of actors being released from the previous wait at the same time. Immediately
 			// calling delay(0) mitigates the resulting SlowTask
 			wait(delay(0, TaskPriority::DataDistribution));
+
+			// A quiet shard well clear of both the split and merge thresholds does not need to keep an
+			// evaluator running. trackShardMetrics restarts one when the shard's own metrics approach a
+			// threshold, and reactivateShardEvaluators() covers changes to the max shard size. The merge
+			// coalesce delay survives retirement because HasBeenTrueFor is reconstructed from
+			// lastLowBandwidthStartTime.
+			if (shardSize->get().present() && !shardNeedsEvaluator(self(), keys, shardSize->get().get())) {
+				CODE_PROBE(true, "Shard evaluator retired for a quiet shard");
+				return Void();
+			}
 		}
 	} catch (Error& e) {
 		if (e.code() != error_code_actor_cancelled && e.code() != error_code_dd_tracker_cancelled) {
@@ -1233,6 +1406,53 @@ ACTOR Future<Void> shardTracker(DataDistributionTracker::SafeAccessor self,
 	}
 }
 
+void activateShardEvaluator(DataDistributionTracker* self, KeyRangeRef keys) {
+	if (!SERVER_KNOBS->DD_TRACKER_ON_DEMAND_EVALUATORS)
+		return;
+
+	auto shard = self->shards->rangeContaining(keys.begin);
+	if (shard->range() != keys) {
+		// The shard boundaries changed; new trackers have taken over this range.
+		return;
+	}
+
+	ShardTrackedData& data = shard->value();
+	if (data.trackShard.isValid() && !data.trackShard.isReady()) {
+		// The evaluator is still running.
+		return;
+	}
+
+	if (!data.stats->get().present() || !shardNeedsEvaluator(self, keys, data.stats->get().get()))
+		return;
+
+	CODE_PROBE(true, "Restarted a retired shard evaluator");
+	data.trackShard = shardTracker(DataDistributionTracker::SafeAccessor(self), KeyRange(keys), data.stats);
+}
+
+// Retired evaluators are normally restarted by trackShardMetrics when a shard's own
+// metrics change, but a change to the max shard size moves the thresholds themselves.
+// Sweep the shard map and restart evaluators for any shards the new bounds put back
+// inside the activation band.
+ACTOR Future<Void> reactivateShardEvaluators(DataDistributionTracker* self) {
+	loop {
+		wait(yieldedFuture(self->maxShardSize->onChange()));
+		if (!SERVER_KNOBS->DD_TRACKER_ON_DEMAND_EVALUATORS || !self->maxShardSize->get().present())
+			continue;
+
+		state Key begin = allKeys.begin;
+		state int sinceYield = 0;
+		while (begin < allKeys.end) {
+			auto shard = self->shards->rangeContaining(begin);
+			activateShardEvaluator(self, shard->range());
+			begin = Key(shard->range().end);
+			if (++sinceYield >= 1000) {
+				sinceYield = 0;
+				wait(yield(TaskPriority::DataDistributionLow));
+			}
+		}
+	}
+}
+
 void restartShardTrackers(DataDistributionTracker* self,
                           KeyRangeRef keys,
                           Optional<ShardMetrics> startingMetrics,
@@ -1492,6 +1712,7 @@ ACTOR Future<Void> dataDistributionTracker(Reference<InitialDataDistribution> in
 	                                   ddTenantCache);
 	state Future<Void> loggingTrigger = Void();
 	state Future<Void> readHotDetect = readHotDetector(&self);
+	state Future<Void> evaluatorReactivator = reactivateShardEvaluators(&self);
 	state Reference<EventCacheHolder> ddTrackerStatsEventHolder = makeReference<EventCacheHolder>("DDTrackerStats");
 	try {
 		wait(trackInitialShards(&self, initData));
@@ -587,8 +587,25 @@ public:
 
 				// addTeamsBestOf() will not add more teams than needed.
 				// If the team number is more than the desired, the extra teams are added in the code path when
-				// a team is added as an initial team
-				int addedTeams = self->addTeamsBestOf(teamsToBuild, desiredTeams, maxTeams);
+				// a team is added as an initial team.
+				// The build is sliced into batches with a yield between them so that a large build (e.g. after
+				// a fleet-wide roll on a big cluster) does not stall the distributor's run loop; each batch
+				// re-reads the collection state, so servers added or removed while we were yielded are picked
+				// up by the next batch.
+				state int addedTeams = 0;
+				state int teamsRemaining = teamsToBuild;
+				loop {
+					int batch = std::min(teamsRemaining, SERVER_KNOBS->DD_BUILD_TEAMS_BATCH_SIZE);
+					// May add more than requested to satisfy per-server team minimums
+					int added = self->addTeamsBestOf(batch, desiredTeams, maxTeams);
+					addedTeams += added;
+					teamsRemaining = std::max(0, teamsRemaining - std::max(added, 1));
+					// Stop once the request is satisfied or no further valid team can be built
+					if (teamsRemaining == 0 || added < batch) {
+						break;
+					}
+					wait(yield(TaskPriority::DataDistributionLaunch));
+				}
 
 				if (addedTeams <= 0 && self->teams.size() == 0) {
 					TraceEvent(SevWarn, "NoTeamAfterBuildTeam", self->distributorId)
@@ -4151,10 +4168,13 @@ int DDTeamCollection::addBestMachineTeams(int machineTeamsToBuild) {
 	// Step 1: Create machineLocalityMap which will be used in building machine team
 	rebuildMachineLocalityMap();
 
-	// Add a team in each iteration
-	while (addedMachineTeams < machineTeamsToBuild || notEnoughMachineTeamsForAMachine()) {
-		// Step 2: Get least used machines from which we choose machines as a machine team
-		std::vector<Reference<TCMachineInfo>> leastUsedMachines; // A less used machine has less number of teams
+	// Step 2: Get least used machines from which we choose machines as a machine team.
+	// A less used machine has less number of teams. The set is computed once and then maintained
+	// incrementally: adding a team only changes the team count of the machines placed into it, so a
+	// global rescan is needed only once every machine at the current minimum count has been used up.
+	std::vector<Reference<TCMachineInfo>> leastUsedMachines;
+	auto rescanLeastUsedMachines = [&]() {
+		leastUsedMachines.clear();
 		int minTeamCount = std::numeric_limits<int>::max();
 		for (auto& machine : machine_info) {
 			// Skip invalid machine whose representative server is not in server_info
@@ -4181,6 +4201,16 @@ int DDTeamCollection::addBestMachineTeams(int machineTeamsToBuild) {
 				leastUsedMachines.push_back(machine.second);
 			}
 		}
+	};
+	rescanLeastUsedMachines();
+
+	// Add a team in each iteration
+	while (addedMachineTeams < machineTeamsToBuild || notEnoughMachineTeamsForAMachine()) {
+		if (leastUsedMachines.empty()) {
+			// Every machine at the previous minimum team count has been placed into a new team;
+			// recompute the minimum over all machines.
+			rescanLeastUsedMachines();
+		}
 
 		std::vector<UID*> team;
 		std::vector<LocalityEntry> forcedAttributes;
@@ -4270,6 +4300,16 @@ int DDTeamCollection::addBestMachineTeams(int machineTeamsToBuild) {
 
 			addMachineTeam(machines);
 			addedMachineTeams++;
+
+			// The machines in the new team now have one more team than the rest of the minimum-count
+			// set, so drop them from the least used candidates rather than rescanning every machine.
+			leastUsedMachines.erase(std::remove_if(leastUsedMachines.begin(),
+			                                       leastUsedMachines.end(),
+			                                       [&machines](Reference<TCMachineInfo> const& m) {
+				                                       return std::find(machines.begin(), machines.end(), m) !=
+				                                              machines.end();
+			                                       }),
+			                        leastUsedMachines.end());
 		} else {
 			// When too many teams exist in simulation, traceAllInfo will buffer too many trace logs before
 			// trace has a chance to flush its buffer, which causes assertion failure.
@@ -4286,37 +4326,6 @@ int DDTeamCollection::addBestMachineTeams(int machineTeamsToBuild) {
 	return addedMachineTeams;
 }
 
-Reference<TCServerInfo> DDTeamCollection::findOneLeastUsedServer() const {
-	std::vector<Reference<TCServerInfo>> leastUsedServers;
-	int minTeams = std::numeric_limits<int>::max();
-	for (auto& [serverID, server] : server_info) {
-		// Only pick healthy server, which is not failed or excluded.
-		if (server_status.get(serverID).isUnhealthy())
-			continue;
-		if (!isValidLocality(configuration.storagePolicy, server->getLastKnownInterface().locality))
-			continue;
-
-		int numTeams = server->getTeams().size();
-		if (numTeams < minTeams) {
-			minTeams = numTeams;
-			leastUsedServers.clear();
-		}
-		if (minTeams == numTeams) {
-			leastUsedServers.push_back(server);
-		}
-	}
-
-	if (leastUsedServers.empty()) {
-		// If we cannot find a healthy server with valid locality
-		TraceEvent("NoHealthyAndValidLocalityServers")
-		    .detail("Servers", server_info.size())
-		    .detail("UnhealthyServers", unhealthyServers);
-		return Reference<TCServerInfo>();
-	} else {
-		return deterministicRandom()->randomChoice(leastUsedServers);
-	}
-}
-
 Reference<TCMachineTeamInfo> DDTeamCollection::findOneRandomMachineTeam(TCServerInfo const& chosenServer) const {
 	if (!chosenServer.machine->machineTeams.empty()) {
 		std::vector<Reference<TCMachineTeamInfo>> healthyMachineTeamsForChosenServer;
@@ -4602,6 +4611,32 @@ int DDTeamCollection::addTeamsBestOf(int teamsToBuild, int desiredTeams, int max
 		}
 	}
 
+	// The least used servers are computed once and then maintained incrementally: adding a team
+	// only changes the team count of its members, so a global rescan is needed only once every
+	// server at the current minimum count has been used up.
+	std::vector<Reference<TCServerInfo>> leastUsedServers;
+	auto rescanLeastUsedServers = [&]() {
+		leastUsedServers.clear();
+		int minTeams = std::numeric_limits<int>::max();
+		for (auto& [serverID, server] : server_info) {
+			// Only pick healthy server, which is not failed or excluded.
+			if (server_status.get(serverID).isUnhealthy())
+				continue;
+			if (!isValidLocality(configuration.storagePolicy, server->getLastKnownInterface().locality))
+				continue;
+
+			int numTeams = server->getTeams().size();
+			if (numTeams < minTeams) {
+				minTeams = numTeams;
+				leastUsedServers.clear();
+			}
+			if (minTeams == numTeams) {
+				leastUsedServers.push_back(server);
+			}
+		}
+	};
+	rescanLeastUsedServers();
+
 	while (addedTeams < teamsToBuild || notEnoughTeamsForAServer()) {
 		std::vector<UID> bestServerTeam;
 		int bestScore = std::numeric_limits<int>::max();
@@ -4609,12 +4644,21 @@ int DDTeamCollection::addTeamsBestOf(int teamsToBuild, int desiredTeams, int max
 		bool earlyQuitBuild = false;
 		for (int i = 0; i < maxAttempts && i < 100; ++i) {
 			// Step 1: Choose 1 least used server and then choose 1 least used machine team from the server
-			Reference<TCServerInfo> chosenServer = findOneLeastUsedServer();
-			if (!chosenServer.isValid()) {
+			if (leastUsedServers.empty()) {
+				// Every server at the previous minimum team count has been placed into a new team;
+				// recompute the minimum over all servers.
+				rescanLeastUsedServers();
+			}
+			if (leastUsedServers.empty()) {
+				// If we cannot find a healthy server with valid locality
+				TraceEvent("NoHealthyAndValidLocalityServers")
+				    .detail("Servers", server_info.size())
+				    .detail("UnhealthyServers", unhealthyServers);
 				TraceEvent(SevWarn, "NoValidServer").detail("Primary", primary);
 				earlyQuitBuild = true;
 				break;
 			}
+			Reference<TCServerInfo> chosenServer = deterministicRandom()->randomChoice(leastUsedServers);
 			// Note: To avoid creating correlation of picked machine teams, we simply choose a random machine team
 			// instead of choosing the least used machine team.
 			// The correlation happens, for example, when we add two new machines, we may always choose the machine
@@ -4692,6 +4736,17 @@ int DDTeamCollection::addTeamsBestOf(int teamsToBuild, int desiredTeams, int max
 		// Step 4: Add the server team
 		addTeam(bestServerTeam.begin(), bestServerTeam.end(), IsInitialTeam::False);
 		addedTeams++;
+
+		// The members of the new team now have one more team than the rest of the minimum-count
+		// set, so drop them from the least used candidates rather than rescanning every server.
+		leastUsedServers.erase(std::remove_if(leastUsedServers.begin(),
+		                                      leastUsedServers.end(),
+		                                      [&bestServerTeam](Reference<TCServerInfo> const& server) {
+			                                      return std::find(bestServerTeam.begin(),
+			                                                       bestServerTeam.end(),
+			                                                       server->getId()) != bestServerTeam.end();
+		                                      }),
+		                        leastUsedServers.end());
 	}
 
 	healthyMachineTeamCount = getHealthyMachineTeamCount();
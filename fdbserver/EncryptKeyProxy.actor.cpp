@@ -202,6 +202,13 @@ public:
 	PromiseStream<Future<Void>> addActor;
 	Future<Void> encryptionKeyRefresher;
 	Future<Void> blobMetadataRefresher;
+	Future<Void> latestCipherKeyFetcher;
+
+	// Domain ids whose latest CipherKey is missing from the cache and needs a KMS lookup. Concurrent
+	// cache misses for the same domain share one entry (and hence one KMS exchange); the promise is
+	// fulfilled once the fetch attempt completes and the cache is updated.
+	std::unordered_map<EncryptCipherDomainId, Promise<Void>> pendingDomainIdFetches;
+	AsyncTrigger domainIdFetchSignal;
 
 	EncryptBaseDomainIdCache baseCipherDomainIdCache;
 	EncryptBaseCipherDomainIdKeyIdCache baseCipherDomainIdKeyIdCache;
@@ -215,6 +222,7 @@ public:
 	Counter baseCipherKeyIdCacheHits;
 	Counter baseCipherDomainIdCacheMisses;
 	Counter baseCipherDomainIdCacheHits;
+	Counter baseCipherDomainIdFetchesCoalesced;
 	Counter baseCipherKeysRefreshed;
 	Counter numResponseWithErrors;
 	Counter numEncryptionKeyRefreshErrors;
@@ -233,6 +241,7 @@ public:
 	    baseCipherKeyIdCacheHits("EKPCipherIdCacheHits", ekpCacheMetrics),
 	    baseCipherDomainIdCacheMisses("EKPCipherDomainIdCacheMisses", ekpCacheMetrics),
 	    baseCipherDomainIdCacheHits("EKPCipherDomainIdCacheHits", ekpCacheMetrics),
+	    baseCipherDomainIdFetchesCoalesced("EKPCipherDomainIdFetchesCoalesced", ekpCacheMetrics),
 	    baseCipherKeysRefreshed("EKPCipherKeysRefreshed", ekpCacheMetrics),
 	    numResponseWithErrors("EKPNumResponseWithErrors", ekpCacheMetrics),
 	    numEncryptionKeyRefreshErrors("EKPNumEncryptionKeyRefreshErrors", ekpCacheMetrics),
@@ -460,6 +469,62 @@ ACTOR Future<Void> getCipherKeysByBaseCipherKeyIds(Reference<EncryptKeyProxyData
 	return Void();
 }
 
+// Drains 'pendingDomainIdFetches' with one KMS exchange per burst. Domain ids queued while an exchange
+// is in flight accumulate and are fetched together on the next iteration, so N concurrent cache misses
+// (e.g. every storage server of a freshly recovered cluster asking for the same domains) cost one KMS
+// round trip rather than N.
+ACTOR Future<Void> fetchLatestCipherKeysCore(Reference<EncryptKeyProxyData> ekpProxyData,
+                                             KmsConnectorInterface kmsConnectorInf) {
+	loop {
+		while (ekpProxyData->pendingDomainIdFetches.empty()) {
+			wait(ekpProxyData->domainIdFetchSignal.onTrigger());
+		}
+
+		state std::unordered_map<EncryptCipherDomainId, Promise<Void>> fetches;
+		std::swap(fetches, ekpProxyData->pendingDomainIdFetches);
+
+		state KmsConnLookupEKsByDomainIdsReq req;
+		req.debugId = deterministicRandom()->randomUniqueID();
+		for (const auto& fetch : fetches) {
+			req.encryptDomainIds.emplace_back(fetch.first);
+		}
+
+		try {
+			state double startTime = now();
+			std::function<Future<KmsConnLookupEKsByDomainIdsRep>()> repF = [&]() {
+				return kmsConnectorInf.ekLookupByDomainIds.getReply(req);
+			};
+			std::function<void()> retryTrace = [&]() {
+				for (const auto& item : req.encryptDomainIds) {
+					TraceEvent(SevDebug, "FetchLatestCipherKeysRetry").suppressFor(30).detail("DomainId", item);
+				}
+			};
+			KmsConnLookupEKsByDomainIdsRep rep =
+			    wait(kmsReqWithExponentialBackoff(repF, retryTrace, "FetchLatestCipherKeys"_sr));
+			ekpProxyData->kmsLookupByDomainIdsReqLatency.addMeasurement(now() - startTime);
+
+			for (const auto& item : rep.cipherKeyDetails) {
+				CipherKeyValidityTS validityTS = getCipherKeyValidityTS(item.refreshAfterSec, item.expireAfterSec);
+				ekpProxyData->insertIntoBaseDomainIdCache(
+				    item.encryptDomainId, item.encryptKeyId, item.encryptKey, validityTS.refreshAtTS, validityTS.expAtTS);
+			}
+
+			for (auto& fetch : fetches) {
+				fetch.second.send(Void());
+			}
+		} catch (Error& e) {
+			if (!canReplyWith(e)) {
+				// Includes actor_cancelled; destroying 'fetches' breaks the waiters' promises
+				throw;
+			}
+			TraceEvent("FetchLatestCipherKeys", ekpProxyData->myId).detail("ErrorCode", e.code());
+			for (auto& fetch : fetches) {
+				fetch.second.sendError(e);
+			}
+		}
+	}
+}
+
 ACTOR Future<Void> getLatestCipherKeys(Reference<EncryptKeyProxyData> ekpProxyData,
                                        KmsConnectorInterface kmsConnectorInf,
                                        EKPGetLatestBaseCipherKeysRequest req) {
@@ -525,55 +590,43 @@ ACTOR Future<Void> getLatestCipherKeys(Reference<EncryptKeyProxyData> ekpProxyDa
 
 	if (!lookupCipherDomainIds.empty()) {
 		try {
-			KmsConnLookupEKsByDomainIdsReq keysByDomainIdReq;
+			// Queue the missing domains for the shared fetcher and wait for it to update the cache. Misses
+			// already queued by a concurrent request piggyback on the in-flight KMS exchange.
+			state std::vector<Future<Void>> fetchFutures;
 			for (const auto domainId : lookupCipherDomainIds) {
-				keysByDomainIdReq.encryptDomainIds.emplace_back(domainId);
+				auto [itr, inserted] = ekpProxyData->pendingDomainIdFetches.try_emplace(domainId);
+				if (!inserted) {
+					++ekpProxyData->baseCipherDomainIdFetchesCoalesced;
+				}
+				fetchFutures.push_back(itr->second.getFuture());
 			}
-			keysByDomainIdReq.debugId = latestKeysReq.debugId;
+			ekpProxyData->domainIdFetchSignal.trigger();
+			wait(waitForAll(fetchFutures));
 
-			state double startTime = now();
-			std::function<Future<KmsConnLookupEKsByDomainIdsRep>()> keysByDomainIdRepF = [&]() {
-				return kmsConnectorInf.ekLookupByDomainIds.getReply(keysByDomainIdReq);
-			};
-			std::function<void()> retryTrace = [&]() {
-				for (const auto& item : keysByDomainIdReq.encryptDomainIds) {
-					TraceEvent(SevDebug, "GetLatestCipherKeysRetry").suppressFor(30).detail("DomainId", item);
+			// Pick the fetched CipherKeys out of the refreshed cache; as before, domains the KMS did not
+			// return are omitted from the reply
+			for (const auto domainId : lookupCipherDomainIds) {
+				const auto itr = ekpProxyData->baseCipherDomainIdCache.find(domainId);
+				if (itr == ekpProxyData->baseCipherDomainIdCache.end() || !itr->second.isValid()) {
+					TraceEvent(SevInfo, "GetLatestCipherKeysDomainIdNotFound", ekpProxyData->myId)
+					    .detail("DomainId", domainId);
+					continue;
 				}
-			};
-			KmsConnLookupEKsByDomainIdsRep keysByDomainIdRep =
-			    wait(kmsReqWithExponentialBackoff(keysByDomainIdRepF, retryTrace, "GetLatestCipherKeys"_sr));
-			ekpProxyData->kmsLookupByDomainIdsReqLatency.addMeasurement(now() - startTime);
-
-			for (auto& item : keysByDomainIdRep.cipherKeyDetails) {
-				CipherKeyValidityTS validityTS = getCipherKeyValidityTS(item.refreshAfterSec, item.expireAfterSec);
 
-				latestCipherReply.baseCipherDetails.emplace_back(item.encryptDomainId,
-				                                                 item.encryptKeyId,
-				                                                 item.encryptKey,
+				latestCipherReply.baseCipherDetails.emplace_back(domainId,
+				                                                 itr->second.baseCipherId,
+				                                                 itr->second.baseCipherKey,
 				                                                 arena,
-				                                                 validityTS.refreshAtTS,
-				                                                 validityTS.expAtTS);
-
-				// Record the fetched cipher details to the local cache for the future references
-				const auto itr = lookupCipherDomainIds.find(item.encryptDomainId);
-				if (itr == lookupCipherDomainIds.end()) {
-					TraceEvent(SevError, "GetLatestCipherKeysDomainIdNotFound", ekpProxyData->myId)
-					    .detail("DomainId", item.encryptDomainId);
-					throw encrypt_keys_fetch_failed();
-				}
-				ekpProxyData->insertIntoBaseDomainIdCache(item.encryptDomainId,
-				                                          item.encryptKeyId,
-				                                          item.encryptKey,
-				                                          validityTS.refreshAtTS,
-				                                          validityTS.expAtTS);
+				                                                 itr->second.refreshAt,
+				                                                 itr->second.expireAt);
 
 				if (dbgTrace.present()) {
 					// {encryptDomainId, baseCipherId} forms a unique tuple across encryption domains
 					dbgTrace.get().detail(getEncryptDbgTraceKeyWithTS(ENCRYPT_DBG_TRACE_INSERT_PREFIX,
-					                                                  item.encryptDomainId,
-					                                                  item.encryptKeyId,
-					                                                  validityTS.refreshAtTS,
-					                                                  validityTS.expAtTS),
+					                                                  domainId,
+					                                                  itr->second.baseCipherId,
+					                                                  itr->second.refreshAt,
+					                                                  itr->second.expireAt),
 					                      "");
 				}
 			}
@@ -891,6 +944,15 @@ ACTOR Future<Void> encryptKeyProxyServer(EncryptKeyProxyInterface ekpInterface,
 
 	activateKmsConnector(self, kmsConnectorInf);
 
+	// Warm the cache before the first client exchange: every encryption participant needs the
+	// default/system domain CipherKeys immediately on startup, so queue them for the fetcher up front
+	// rather than having the first wave of requests each pay a KMS round trip.
+	for (const EncryptCipherDomainId domainId : ENCRYPT_CIPHER_DETAULT_DOMAINS) {
+		self->pendingDomainIdFetches.try_emplace(domainId);
+	}
+	self->latestCipherKeyFetcher = fetchLatestCipherKeysCore(self, kmsConnectorInf);
+	self->domainIdFetchSignal.trigger();
+
 	// Register a recurring task to refresh the cached Encryption keys and blob metadata.
 	// Approach avoids external RPCs due to EncryptionKey refreshes for the inline write encryption codepath such as:
 	// CPs, Redwood Storage Server node flush etc. The process doing the encryption refresh the cached cipher keys based
@@ -69,6 +69,13 @@ struct GrvProxyStats {
 	LatencySample grvLatencySample; // GRV latency metric sample of default priority
 	LatencySample grvBatchLatencySample; // GRV latency metric sample of batched priority
 
+	// Adaptive GRV batching: per-priority latencies observed since the last controller adjustment, and the
+	// batch windows the controller is currently holding (see grvBatchWindowController)
+	DDSketch<double> recentDefaultGrvLatency;
+	DDSketch<double> recentBatchGrvLatency;
+	double defaultGrvBatchWindow;
+	double batchGrvBatchWindow;
+
 	Future<Void> logger;
 
 	int recentRequests;
@@ -133,7 +140,11 @@ struct GrvProxyStats {
 	                          id,
 	                          SERVER_KNOBS->LATENCY_METRICS_LOGGING_INTERVAL,
 	                          SERVER_KNOBS->LATENCY_SKETCH_ACCURACY),
-	    recentRequests(0), lastBucketBegin(now()),
+	    recentDefaultGrvLatency(SERVER_KNOBS->LATENCY_SKETCH_ACCURACY),
+	    recentBatchGrvLatency(SERVER_KNOBS->LATENCY_SKETCH_ACCURACY),
+	    defaultGrvBatchWindow(SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MIN),
+	    batchGrvBatchWindow(SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MIN), recentRequests(0),
+	    lastBucketBegin(now()),
 	    bucketInterval(FLOW_KNOBS->BASIC_LOAD_BALANCE_UPDATE_RATE / FLOW_KNOBS->BASIC_LOAD_BALANCE_BUCKETS),
 	    grvConfirmEpochLiveDist(
 	        Histogram::getHistogram("GrvProxy"_sr, "GrvConfirmEpochLive"_sr, Histogram::Unit::milliseconds)),
@@ -155,6 +166,8 @@ struct GrvProxyStats {
 		specialCounter(cc, "PercentageOfBatchGRVQueueProcessed", [this]() {
 			return int64_t(100 * this->percentageOfBatchGRVQueueProcessed);
 		});
+		specialCounter(cc, "DefaultGRVBatchWindowUs", [this]() { return int64_t(this->defaultGrvBatchWindow * 1e6); });
+		specialCounter(cc, "BatchGRVBatchWindowUs", [this]() { return int64_t(this->batchGrvBatchWindow * 1e6); });
 
 		logger = cc.traceCounters("GrvProxyMetrics", id, SERVER_KNOBS->WORKER_LOGGING_INTERVAL, "GrvProxyMetrics");
 		for (int i = 0; i < FLOW_KNOBS->BASIC_LOAD_BALANCE_BUCKETS; i++) {
@@ -476,6 +489,7 @@ ACTOR Future<Void> queueGetReadVersionRequests(Reference<AsyncVar<ServerDBInfo>
                                                PromiseStream<Void> GRVTimer,
                                                double* lastGRVTime,
                                                double* GRVBatchTime,
+                                               double* batchGRVBatchTime,
                                                FutureStream<double> normalGRVLatency,
                                                GrvProxyStats* stats,
                                                GrvTransactionRateInfo* batchRateInfo,
@@ -530,8 +544,10 @@ ACTOR Future<Void> queueGetReadVersionRequests(Reference<AsyncVar<ServerDBInfo>
 					                      "GrvProxyServer.queueTransactionStartRequests.Before");
 
 				if (systemQueue->empty() && defaultQueue->empty() && batchQueue->empty()) {
+					double window =
+					    req.priority >= TransactionPriority::DEFAULT ? *GRVBatchTime : *batchGRVBatchTime;
 					forwardPromise(GRVTimer,
-					               delayJittered(std::max(0.0, *GRVBatchTime - (now() - *lastGRVTime)),
+					               delayJittered(std::max(0.0, window - (now() - *lastGRVTime)),
 					                             TaskPriority::ProxyGRVTimer));
 				}
 
@@ -573,12 +589,55 @@ ACTOR Future<Void> queueGetReadVersionRequests(Reference<AsyncVar<ServerDBInfo>
 		}
 		// dynamic batching monitors reply latencies
 		when(double reply_latency = waitNext(normalGRVLatency)) {
-			double target_latency = reply_latency * SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_LATENCY_FRACTION;
-			*GRVBatchTime = std::max(
-			    SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MIN,
-			    std::min(SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MAX,
-			             target_latency * SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA +
-			                 *GRVBatchTime * (1 - SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA)));
+			if (SERVER_KNOBS->GRV_LATENCY_TARGET_P99_DEFAULT <= 0) {
+				double target_latency =
+				    reply_latency * SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_LATENCY_FRACTION;
+				*GRVBatchTime = std::max(
+				    SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MIN,
+				    std::min(SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MAX,
+				             target_latency * SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA +
+				                 *GRVBatchTime * (1 - SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA)));
+			}
+			if (SERVER_KNOBS->GRV_LATENCY_TARGET_P99_BATCH <= 0) {
+				*batchGRVBatchTime = *GRVBatchTime;
+			}
+		}
+	}
+}
+
+// One adjustment step of the latency-target controller: shrink the batch window when the observed p99 is
+// over the target, grow it while there is comfortable headroom, and collapse it when the priority class went
+// idle so the first requests after a lull are not held for a window tuned to old load.
+static double retuneGrvBatchWindow(DDSketch<double>& recentLatency, double target, double window) {
+	if (recentLatency.getPopulationSize() == 0) {
+		window = SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MIN;
+	} else {
+		double p99 = recentLatency.percentile(0.99);
+		if (p99 > target) {
+			window /= SERVER_KNOBS->GRV_LATENCY_TARGET_ADJUSTMENT_RATE;
+		} else if (p99 < 0.8 * target) {
+			window *= SERVER_KNOBS->GRV_LATENCY_TARGET_ADJUSTMENT_RATE;
+		}
+		recentLatency.clear();
+	}
+	return std::max(SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MIN,
+	                std::min(SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MAX, window));
+}
+
+// Periodically retunes the per-priority GRV batch windows to hold the configured p99 latency targets,
+// expanding batches under load (fewer version requests per started transaction) and collapsing them when a
+// class is idle or over its target. A class whose target knob is zero stays on the latency-fraction
+// heuristic in queueGetReadVersionRequests.
+ACTOR Future<Void> grvBatchWindowController(GrvProxyStats* stats, double* GRVBatchTime, double* batchGRVBatchTime) {
+	loop {
+		wait(delay(SERVER_KNOBS->GRV_LATENCY_TARGET_ADJUSTMENT_INTERVAL, TaskPriority::ProxyGRVTimer));
+		if (SERVER_KNOBS->GRV_LATENCY_TARGET_P99_DEFAULT > 0) {
+			*GRVBatchTime = retuneGrvBatchWindow(
+			    stats->recentDefaultGrvLatency, SERVER_KNOBS->GRV_LATENCY_TARGET_P99_DEFAULT, *GRVBatchTime);
+		}
+		if (SERVER_KNOBS->GRV_LATENCY_TARGET_P99_BATCH > 0) {
+			*batchGRVBatchTime = retuneGrvBatchWindow(
+			    stats->recentBatchGrvLatency, SERVER_KNOBS->GRV_LATENCY_TARGET_P99_BATCH, *batchGRVBatchTime);
 		}
 	}
 }
@@ -703,14 +762,25 @@ ACTOR Future<Void> sendGrvReplies(Future<GetReadVersionReply> replyFuture,
 	Version replyVersion = reply.version;
 
 	double end = g_network->timer();
+	// Clients that saw the same version vector last ask for deltas from the same reference
+	// version, and ssVersionVectorCache does not change within this reply loop, so computing
+	// the delta once per distinct reference version instead of once per request keeps large
+	// GRV batches from rescanning the version vector for every reply.
+	std::unordered_map<Version, VersionVector> cachedDeltas;
 	for (GetReadVersionRequest const& request : requests) {
 		double duration = end - request.requestTime() - request.proxyTagThrottledDuration;
 		if (request.priority == TransactionPriority::BATCH) {
 			stats->grvBatchLatencySample.addMeasurement(duration);
+			if (SERVER_KNOBS->GRV_LATENCY_TARGET_P99_BATCH > 0) {
+				stats->recentBatchGrvLatency.addSample(duration);
+			}
 		}
 
 		if (request.priority == TransactionPriority::DEFAULT) {
 			stats->grvLatencySample.addMeasurement(duration);
+			if (SERVER_KNOBS->GRV_LATENCY_TARGET_P99_DEFAULT > 0) {
+				stats->recentDefaultGrvLatency.addSample(duration);
+			}
 		}
 
 		if (request.priority >= TransactionPriority::DEFAULT) {
@@ -726,7 +796,13 @@ ACTOR Future<Void> sendGrvReplies(Future<GetReadVersionReply> replyFuture,
 		reply.midShardSize = midShardSize;
 		reply.tagThrottleInfo.clear();
 		if (SERVER_KNOBS->ENABLE_VERSION_VECTOR) {
-			grvProxyData->ssVersionVectorCache.getDelta(request.maxVersion, reply.ssVersionVectorDelta);
+			auto cached = cachedDeltas.find(request.maxVersion);
+			if (cached == cachedDeltas.end()) {
+				grvProxyData->ssVersionVectorCache.getDelta(request.maxVersion, reply.ssVersionVectorDelta);
+				cachedDeltas[request.maxVersion] = reply.ssVersionVectorDelta;
+			} else {
+				reply.ssVersionVectorDelta = cached->second;
+			}
 			grvProxyData->versionVectorSizeOnGRVReply.addMeasurement(reply.ssVersionVectorDelta.size());
 		}
 		reply.proxyId = grvProxyData->dbgid;
@@ -830,6 +906,7 @@ ACTOR static Future<Void> transactionStarter(GrvProxyInterface proxy,
 	state double lastGRVTime = 0;
 	state PromiseStream<Void> GRVTimer;
 	state double GRVBatchTime = SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MIN;
+	state double batchGRVBatchTime = SERVER_KNOBS->START_TRANSACTION_BATCH_INTERVAL_MIN;
 
 	state int64_t transactionCount = 0;
 	state int64_t batchTransactionCount = 0;
@@ -870,11 +947,15 @@ ACTOR static Future<Void> transactionStarter(GrvProxyInterface proxy,
 	                                          GRVTimer,
 	                                          &lastGRVTime,
 	                                          &GRVBatchTime,
+	                                          &batchGRVBatchTime,
 	                                          normalGRVLatency.getFuture(),
 	                                          &grvProxyData->stats,
 	                                          &batchRateInfo,
 	                                          &transactionTagCounter,
 	                                          &grvProxyData->tagThrottler));
+	if (SERVER_KNOBS->GRV_LATENCY_TARGET_P99_DEFAULT > 0 || SERVER_KNOBS->GRV_LATENCY_TARGET_P99_BATCH > 0) {
+		addActor.send(grvBatchWindowController(&grvProxyData->stats, &GRVBatchTime, &batchGRVBatchTime));
+	}
 
 	while (std::find(db->get().client.grvProxies.begin(), db->get().client.grvProxies.end(), proxy) ==
 	       db->get().client.grvProxies.end()) {
@@ -903,6 +984,8 @@ ACTOR static Future<Void> transactionStarter(GrvProxyInterface proxy,
 
 		grvProxyData->stats.transactionLimit = normalRateInfo.getLimit();
 		grvProxyData->stats.batchTransactionLimit = batchRateInfo.getLimit();
+		grvProxyData->stats.defaultGrvBatchWindow = GRVBatchTime;
+		grvProxyData->stats.batchGrvBatchWindow = batchGRVBatchTime;
 
 		int transactionsStarted[2] = { 0, 0 };
 		int systemTransactionsStarted[2] = { 0, 0 };
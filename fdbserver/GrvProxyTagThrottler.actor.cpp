@@ -26,10 +26,11 @@
 
 uint64_t GrvProxyTagThrottler::DelayedRequest::lastSequenceNumber = 0;
 
-void GrvProxyTagThrottler::DelayedRequest::updateProxyTagThrottledDuration(LatencyBandsMap& latencyBandsMap) {
+void GrvProxyTagThrottler::DelayedRequest::updateProxyTagThrottledDuration(LatencyBandsMap& latencyBandsMap,
+                                                                           LatencyBandsMap::Handle& bandsHandle) {
 	req.proxyTagThrottledDuration = now() - startTime;
 	auto const& [tag, count] = *req.tags.begin();
-	latencyBandsMap.addMeasurement(tag, req.proxyTagThrottledDuration, count);
+	latencyBandsMap.addMeasurement(tag, bandsHandle, req.proxyTagThrottledDuration, count);
 }
 
 bool GrvProxyTagThrottler::DelayedRequest::isMaxThrottled(double maxThrottleDuration) const {
@@ -52,7 +53,7 @@ void GrvProxyTagThrottler::TagQueue::rejectRequests(LatencyBandsMap& latencyBand
 	CODE_PROBE(true, "GrvProxyTagThrottler rejecting requests");
 	while (!requests.empty()) {
 		auto& delayedReq = requests.front();
-		delayedReq.updateProxyTagThrottledDuration(latencyBandsMap);
+		delayedReq.updateProxyTagThrottledDuration(latencyBandsMap, bandsHandle);
 		delayedReq.req.reply.sendError(proxy_tag_throttled());
 		requests.pop_front();
 	}
@@ -124,12 +125,10 @@ void GrvProxyTagThrottler::releaseTransactions(double elapsed,
 	struct TagQueueHandle {
 		// Store pointers here to avoid frequent std::unordered_map lookups
 		TagQueue* queue;
-		// Cannot be stored directly because we need to
-		uint32_t* numReleased;
 		// Sequence number of the first queued request
 		int64_t nextSeqNo;
 		bool operator>(TagQueueHandle const& rhs) const { return nextSeqNo > rhs.nextSeqNo; }
-		explicit TagQueueHandle(TagQueue& queue, uint32_t& numReleased) : queue(&queue), numReleased(&numReleased) {
+		explicit TagQueueHandle(TagQueue& queue) : queue(&queue) {
 			ASSERT(!this->queue->requests.empty());
 			nextSeqNo = this->queue->requests.front().sequenceNumber;
 		}
@@ -139,26 +138,15 @@ void GrvProxyTagThrottler::releaseTransactions(double elapsed,
 	// next request to process in each queue
 	std::priority_queue<TagQueueHandle, std::vector<TagQueueHandle>, std::greater<TagQueueHandle>> pqOfQueues;
 
-	// Track transactions released for each tag
-	std::vector<std::pair<TransactionTag, uint32_t>> transactionsReleased;
-	transactionsReleased.reserve(queues.size());
-	auto const transactionsReleasedInitialCapacity = transactionsReleased.capacity();
-
 	for (auto& [tag, queue] : queues) {
+		// Per-tag release counts are accumulated directly in each queue, so no
+		// per-tag lookups are needed when releasing or ending the window
+		queue.releasedInWindow = 0;
 		if (queue.rateInfo.present()) {
 			queue.rateInfo.get().startReleaseWindow();
 		}
 		if (!queue.requests.empty()) {
-			// First place the count in the transactionsReleased object,
-			// then pass a reference to the count to the TagQueueHandle object
-			// emplaced into pqOfQueues.
-			//
-			// Because we've reserved enough space in transactionsReleased
-			// to avoid resizing, this reference should remain valid.
-			// This allows each TagQueueHandle to update its number of
-			// numReleased counter without incurring the cost of a std::unordered_map lookup.
-			auto& [_, count] = transactionsReleased.emplace_back(tag, 0);
-			pqOfQueues.emplace(queue, count);
+			pqOfQueues.emplace(queue);
 		}
 	}
 
@@ -174,7 +162,7 @@ void GrvProxyTagThrottler::releaseTransactions(double elapsed,
 			auto count = delayedReq.req.tags.begin()->second;
 			ASSERT_EQ(tagQueueHandle.nextSeqNo, delayedReq.sequenceNumber);
 			if (tagQueueHandle.queue->rateInfo.present() &&
-			    !tagQueueHandle.queue->rateInfo.get().canStart(*(tagQueueHandle.numReleased), count)) {
+			    !tagQueueHandle.queue->rateInfo.get().canStart(tagQueueHandle.queue->releasedInWindow, count)) {
 				// Cannot release any more transaction from this tag (don't push the tag queue handle back into
 				// pqOfQueues)
 				CODE_PROBE(true, "GrvProxyTagThrottler throttling transaction");
@@ -187,8 +175,8 @@ void GrvProxyTagThrottler::releaseTransactions(double elapsed,
 			} else {
 				if (tagQueueHandle.nextSeqNo < nextQueueSeqNo) {
 					// Releasing transaction
-					*(tagQueueHandle.numReleased) += count;
-					delayedReq.updateProxyTagThrottledDuration(latencyBandsMap);
+					tagQueueHandle.queue->releasedInWindow += count;
+					delayedReq.updateProxyTagThrottledDuration(latencyBandsMap, tagQueueHandle.queue->bandsHandle);
 					if (delayedReq.req.priority == TransactionPriority::BATCH) {
 						outBatchPriority.push_back(delayedReq.req);
 					} else if (delayedReq.req.priority == TransactionPriority::DEFAULT) {
@@ -211,18 +199,9 @@ void GrvProxyTagThrottler::releaseTransactions(double elapsed,
 	}
 
 	// End release windows for all tag queues
-	{
-		TransactionTagMap<uint32_t> transactionsReleasedMap;
-		for (const auto& [tag, count] : transactionsReleased) {
-			transactionsReleasedMap[tag] = count;
-		}
-		for (auto& [tag, queue] : queues) {
-			queue.endReleaseWindow(transactionsReleasedMap[tag], elapsed);
-		}
+	for (auto& [tag, queue] : queues) {
+		queue.endReleaseWindow(queue.releasedInWindow, elapsed);
 	}
-	// If the capacity is increased, that means the vector has been illegally resized, potentially
-	// corrupting memory
-	ASSERT_EQ(transactionsReleased.capacity(), transactionsReleasedInitialCapacity);
 }
 
 void GrvProxyTagThrottler::addLatencyBandThreshold(double value) {
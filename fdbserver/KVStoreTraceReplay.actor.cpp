@@ -0,0 +1,269 @@
+/*
+ * KVStoreTraceReplay.actor.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "fdbrpc/DDSketch.h"
+#include "fdbserver/IKeyValueStore.h"
+#include "flow/Platform.h"
+#include "flow/actorcompiler.h" // This must be the last #include.
+
+// Records the operation stream a storage server issues to its IKeyValueStore so it can
+// later be replayed against any engine with the kvstoretracereplay server role. Only
+// operation types, key/value sizes and inter-operation think time are recorded, never
+// key or value contents, so traces from production are safe to move around.
+//
+// One text line per operation:
+//   get <keySize> 0 <think>
+//   getrange <beginKeySize> <rowLimit> <think>
+//   set <keySize> <valueSize> <think>
+//   clear <beginKeySize> <endKeySize> <think>
+//   commit 0 0 <think>
+// where <think> is the time in seconds since the previous recorded operation.
+struct KeyValueStoreTraceRecorder final : IKeyValueStore {
+	IKeyValueStore* store;
+	FILE* out;
+	double lastOpTime;
+
+	KeyValueStoreTraceRecorder(IKeyValueStore* store, std::string const& traceFile)
+	  : store(store), out(fopen(traceFile.c_str(), "w")), lastOpTime(now()) {
+		if (out == nullptr) {
+			TraceEvent(SevWarnAlways, "KVStoreTraceRecorderOpenFailed").detail("File", traceFile);
+		}
+	}
+
+	void record(const char* op, int a, int b) {
+		if (out == nullptr) {
+			return;
+		}
+		double t = now();
+		fprintf(out, "%s %d %d %.6f\n", op, a, b, t - lastOpTime);
+		lastOpTime = t;
+	}
+
+	Future<Void> getError() const override { return store->getError(); }
+	Future<Void> onClosed() const override { return store->onClosed(); }
+	void dispose() override {
+		if (out) {
+			fclose(out);
+		}
+		store->dispose();
+		delete this;
+	}
+	void close() override {
+		if (out) {
+			fclose(out);
+		}
+		store->close();
+		delete this;
+	}
+
+	KeyValueStoreType getType() const override { return store->getType(); }
+	StorageBytes getStorageBytes() const override { return store->getStorageBytes(); }
+	Future<EncryptionAtRestMode> encryptionMode() override { return store->encryptionMode(); }
+	Future<Void> init() override { return store->init(); }
+
+	void set(KeyValueRef keyValue, const Arena* arena = nullptr) override {
+		record("set", keyValue.key.size(), keyValue.value.size());
+		store->set(keyValue, arena);
+	}
+	void clear(KeyRangeRef range,
+	           const StorageServerMetrics* storageMetrics = nullptr,
+	           const Arena* arena = nullptr) override {
+		record("clear", range.begin.size(), range.end.size());
+		store->clear(range, storageMetrics, arena);
+	}
+	Future<Void> commit(bool sequential = false) override {
+		record("commit", 0, 0);
+		if (out) {
+			fflush(out);
+		}
+		return store->commit(sequential);
+	}
+
+	Future<Optional<Value>> readValue(KeyRef key, Optional<ReadOptions> options) override {
+		record("get", key.size(), 0);
+		return store->readValue(key, options);
+	}
+	Future<Optional<Value>> readValuePrefix(KeyRef key, int maxLength, Optional<ReadOptions> options) override {
+		record("get", key.size(), 0);
+		return store->readValuePrefix(key, maxLength, options);
+	}
+	Future<RangeResult> readRange(KeyRangeRef keys,
+	                              int rowLimit,
+	                              int byteLimit,
+	                              Optional<ReadOptions> options) override {
+		record("getrange", keys.begin.size(), rowLimit);
+		return store->readRange(keys, rowLimit, byteLimit, options);
+	}
+};
+
+IKeyValueStore* keyValueStoreTraceRecorder(IKeyValueStore* store, std::string const& traceFile) {
+	return new KeyValueStoreTraceRecorder(store, traceFile);
+}
+
+namespace {
+
+struct OpStats {
+	DDSketch<double> latency;
+	int64_t count = 0;
+
+	void add(double seconds) {
+		latency.addSample(seconds);
+		++count;
+	}
+
+	void report(const char* op) {
+		if (count == 0) {
+			return;
+		}
+		printf("%-9s %10" PRId64 "  mean %9.1fus  p50 %9.1fus  p95 %9.1fus  p99 %9.1fus  max %9.1fus\n",
+		       op,
+		       count,
+		       latency.mean() * 1e6,
+		       latency.percentile(0.5) * 1e6,
+		       latency.percentile(0.95) * 1e6,
+		       latency.percentile(0.99) * 1e6,
+		       latency.max() * 1e6);
+	}
+};
+
+// Keys are synthesized from a bounded universe so that replayed reads hit data written
+// earlier in the replay with realistic probability. Key contents do not round-trip
+// through the trace format, only sizes do.
+Key makeReplayKey(int size, Arena& arena) {
+	std::string k = format("%08x", deterministicRandom()->randomInt(0, 1 << 20));
+	if ((int)k.size() > size && size > 0) {
+		k.resize(size);
+	} else {
+		k.resize(std::max(size, 1), 'x');
+	}
+	return StringRef(arena, k);
+}
+
+} // namespace
+
+// Replays a trace recorded by KeyValueStoreTraceRecorder against a freshly created
+// store of the given type in dataFolder, and prints per-operation latency histograms.
+ACTOR Future<Void> KVStoreTraceReplay(std::string traceFile, std::string storeTypeStr, std::string dataFolder) {
+	if (!fileExists(traceFile)) {
+		throw file_not_found();
+	}
+	state KeyValueStoreType storeType = KeyValueStoreType::fromString(storeTypeStr);
+
+	std::string extension;
+	if (storeType == KeyValueStoreType::SSD_BTREE_V1) {
+		extension = ".fdb";
+	} else if (storeType == KeyValueStoreType::SSD_BTREE_V2) {
+		extension = ".sqlite";
+	} else if (storeType == KeyValueStoreType::SSD_REDWOOD_V1) {
+		extension = ".redwood-v1";
+	} else if (storeType == KeyValueStoreType::SSD_ROCKSDB_V1) {
+		extension = ".rocksdb";
+	} else if (storeType == KeyValueStoreType::SSD_SHARDED_ROCKSDB) {
+		extension = ".shardedrocksdb";
+	} else {
+		extension = "-";
+	}
+	state std::string storeFile = joinPath(dataFolder.empty() ? "." : dataFolder, "storage-replay" + extension);
+	state IKeyValueStore* store = openKVStore(storeType, storeFile, deterministicRandom()->randomUniqueID(), 1 << 30);
+	wait(store->init());
+
+	state FILE* in = fopen(traceFile.c_str(), "r");
+	if (in == nullptr) {
+		throw file_not_found();
+	}
+
+	state OpStats getStats;
+	state OpStats getRangeStats;
+	state OpStats setStats;
+	state OpStats clearStats;
+	state OpStats commitStats;
+	state int64_t ops = 0;
+	state std::string op;
+	state int a;
+	state int b;
+	state double think;
+	state double start;
+
+	loop {
+		{
+			char opBuf[16];
+			double thinkIn;
+			if (fscanf(in, "%15s %d %d %lf", opBuf, &a, &b, &thinkIn) != 4) {
+				break;
+			}
+			op = opBuf;
+			think = thinkIn;
+		}
+		if (think > 0) {
+			wait(delay(think));
+		}
+		state Arena arena;
+		start = timer_monotonic();
+		if (op == "get") {
+			wait(success(store->readValue(makeReplayKey(a, arena))));
+			getStats.add(timer_monotonic() - start);
+		} else if (op == "getrange") {
+			Key begin = makeReplayKey(a, arena);
+			wait(success(store->readRange(KeyRangeRef(begin, allKeys.end), b <= 0 ? 1000 : b)));
+			getRangeStats.add(timer_monotonic() - start);
+		} else if (op == "set") {
+			Key key = makeReplayKey(a, arena);
+			StringRef value = makeString(std::max(b, 0), arena);
+			deterministicRandom()->randomBytes(mutateString(value), value.size());
+			store->set(KeyValueRef(key, value));
+			setStats.add(timer_monotonic() - start);
+		} else if (op == "clear") {
+			Key begin = makeReplayKey(a, arena);
+			store->clear(singleKeyRange(begin, arena));
+			clearStats.add(timer_monotonic() - start);
+		} else if (op == "commit") {
+			wait(store->commit());
+			commitStats.add(timer_monotonic() - start);
+		} else {
+			fprintf(stderr, "Unknown trace op: %s\n", op.c_str());
+			fclose(in);
+			throw io_error();
+		}
+		++ops;
+	}
+	fclose(in);
+
+	// Make trailing sets and clears durable so engines are compared on equal terms.
+	start = timer_monotonic();
+	wait(store->commit());
+	commitStats.add(timer_monotonic() - start);
+
+	printf("Replayed %" PRId64 " operations from %s against %s\n", ops, traceFile.c_str(), storeTypeStr.c_str());
+	getStats.report("get");
+	getRangeStats.report("getrange");
+	setStats.report("set");
+	clearStats.report("clear");
+	commitStats.report("commit");
+
+	Future<Void> closed = store->onClosed();
+	store->dispose();
+	wait(closed);
+	return Void();
+}
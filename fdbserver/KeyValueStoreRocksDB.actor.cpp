@@ -429,13 +429,16 @@ struct Counters {
 	Counter convertedDeleteKeyReqs;
 	Counter convertedDeleteRangeReqs;
 	Counter rocksdbReadRangeQueries;
+	Counter inlineReadHits;
+	Counter inlineReadMisses;
 
 	Counters()
 	  : cc("RocksDBThrottle"), immediateThrottle("ImmediateThrottle", cc), failedToAcquire("FailedToAcquire", cc),
 	    deleteKeyReqs("DeleteKeyRequests", cc), deleteRangeReqs("DeleteRangeRequests", cc),
 	    convertedDeleteKeyReqs("ConvertedDeleteKeyRequests", cc),
 	    convertedDeleteRangeReqs("ConvertedDeleteRangeRequests", cc),
-	    rocksdbReadRangeQueries("RocksdbReadRangeQueries", cc) {}
+	    rocksdbReadRangeQueries("RocksdbReadRangeQueries", cc), inlineReadHits("InlineReadHits", cc),
+	    inlineReadMisses("InlineReadMisses", cc) {}
 };
 
 struct ReadIterator {
@@ -1567,6 +1570,110 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 			sharedState->readLatency[threadIndex]->addMeasurement(endTime - readBeginTime);
 		}
 
+		// A batch of point reads issued to RocksDB as a single MultiGet(). Each read completes
+		// through its own promise, so callers are unaware of the batching.
+		struct ReadValuesAction : TypedAction<Reader, ReadValuesAction> {
+			struct Entry {
+				Key key;
+				Optional<UID> debugID;
+				ThreadReturnPromise<Optional<Value>> result;
+				Entry(Key key, Optional<UID> debugID) : key(key), debugID(debugID) {}
+			};
+			std::vector<std::unique_ptr<Entry>> entries;
+			double startTime;
+			bool getHistograms;
+			ReadValuesAction()
+			  : startTime(timer_monotonic()),
+			    getHistograms(deterministicRandom()->random01() < SERVER_KNOBS->ROCKSDB_HISTOGRAMS_SAMPLE_RATE) {}
+			double getTimeEstimate() const override { return SERVER_KNOBS->READ_VALUE_TIME_ESTIMATE; }
+		};
+
+		void action(ReadValuesAction& a) {
+			ASSERT(!a.entries.empty());
+			if (doPerfContextMetrics) {
+				perfContextMetrics->reset();
+			}
+			const double readBeginTime = timer_monotonic();
+			sharedState->readQueueLatency[threadIndex]->addMeasurement(readBeginTime - a.startTime);
+			if (a.getHistograms) {
+				metricPromiseStream->send(
+				    std::make_pair(ROCKSDB_READVALUE_QUEUEWAIT_HISTOGRAM.toString(), readBeginTime - a.startTime));
+			}
+			if (SERVER_KNOBS->ROCKSDB_SET_READ_TIMEOUT && readBeginTime - a.startTime > readValueTimeout) {
+				TraceEvent(SevWarn, "KVSTimeout", id)
+				    .detail("Error", "Read value request timedout")
+				    .detail("Method", "ReadValuesAction")
+				    .detail("TimeoutValue", readValueTimeout);
+				for (auto& entry : a.entries) {
+					entry->result.sendError(transaction_too_old());
+				}
+				return;
+			}
+
+			Optional<TraceBatch> traceBatch;
+			for (auto& entry : a.entries) {
+				if (entry->debugID.present()) {
+					if (!traceBatch.present()) {
+						traceBatch = { TraceBatch{} };
+					}
+					traceBatch.get().addEvent("GetValueDebug", entry->debugID.get().first(), "Reader.Before");
+				}
+			}
+
+			auto& options = sharedState->getReadOptions();
+			if (SERVER_KNOBS->ROCKSDB_SET_READ_TIMEOUT) {
+				uint64_t deadlineMircos =
+				    db->GetEnv()->NowMicros() + (readValueTimeout - (readBeginTime - a.startTime)) * 1000000;
+				std::chrono::seconds deadlineSeconds(deadlineMircos / 1000000);
+				options.deadline = std::chrono::duration_cast<std::chrono::microseconds>(deadlineSeconds);
+			}
+
+			std::vector<rocksdb::Slice> keys;
+			keys.reserve(a.entries.size());
+			for (const auto& entry : a.entries) {
+				keys.push_back(toSlice(entry->key));
+			}
+			std::vector<rocksdb::PinnableSlice> values(a.entries.size());
+			std::vector<rocksdb::Status> statuses(a.entries.size());
+			double dbGetBeginTime = a.getHistograms ? timer_monotonic() : 0;
+			db->MultiGet(options, cf, a.entries.size(), keys.data(), values.data(), statuses.data());
+			if (a.getHistograms) {
+				metricPromiseStream->send(
+				    std::make_pair(ROCKSDB_READVALUE_GET_HISTOGRAM.toString(), timer_monotonic() - dbGetBeginTime));
+			}
+
+			for (int i = 0; i < (int)a.entries.size(); ++i) {
+				auto& entry = a.entries[i];
+				const auto& s = statuses[i];
+				if (entry->debugID.present()) {
+					traceBatch.get().addEvent("GetValueDebug", entry->debugID.get().first(), "Reader.After");
+				}
+				if (s.ok()) {
+					entry->result.send(Value(toStringRef(values[i])));
+				} else if (s.IsNotFound()) {
+					entry->result.send(Optional<Value>());
+				} else {
+					logRocksDBError(id, s, "ReadValues");
+					entry->result.sendError(statusToError(s));
+				}
+			}
+			if (traceBatch.present()) {
+				traceBatch.get().dump();
+			}
+
+			const double endTime = timer_monotonic();
+			if (a.getHistograms) {
+				metricPromiseStream->send(
+				    std::make_pair(ROCKSDB_READVALUE_ACTION_HISTOGRAM.toString(), endTime - readBeginTime));
+				metricPromiseStream->send(
+				    std::make_pair(ROCKSDB_READVALUE_LATENCY_HISTOGRAM.toString(), endTime - a.startTime));
+			}
+			if (doPerfContextMetrics) {
+				perfContextMetrics->set(threadIndex);
+			}
+			sharedState->readLatency[threadIndex]->addMeasurement(endTime - readBeginTime);
+		}
+
 		struct ReadValuePrefixAction : TypedAction<Reader, ReadValuePrefixAction> {
 			Key key;
 			int maxLength;
@@ -2124,6 +2231,77 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 		return result;
 	}
 
+	// Attempts to complete a point read inline on the calling (network) thread, serving it from
+	// the block cache only. Returns true if the read completed, with result set to the value if
+	// the key was found. Returns false if RocksDB would have to touch disk, in which case the
+	// caller should post the read to the reader thread pool as usual. Any error other than a
+	// cache miss is also deferred to the reader threads, which own error logging for this db.
+	bool tryReadValueInline(KeyRef key, Optional<Value>& result) {
+		rocksdb::ReadOptions readOptions = sharedState->getReadOptions();
+		readOptions.read_tier = rocksdb::kBlockCacheTier;
+		rocksdb::PinnableSlice value;
+		auto s = db->Get(readOptions, defaultFdbCF, toSlice(key), &value);
+		if (s.ok()) {
+			result = Value(toStringRef(value));
+		} else if (s.IsNotFound()) {
+			result = Optional<Value>();
+		} else {
+			++counters.inlineReadMisses;
+			return false;
+		}
+		++counters.inlineReadHits;
+		return true;
+	}
+
+	void flushPendingReads() {
+		if (pendingReads != nullptr && !pendingReads->entries.empty()) {
+			readThreads->post(pendingReads.release());
+		}
+	}
+
+	ACTOR static Future<Void> delayedFlush(RocksDBKeyValueStore* self) {
+		wait(delay(0));
+		self->flushPendingReads();
+		return Void();
+	}
+
+	// Collects point reads arriving in the same run loop iteration into one MultiGet() so RocksDB
+	// can amortize bloom filter and index probes across them. The batch is flushed when it reaches
+	// ROCKSDB_MULTIGET_BATCH_SIZE keys or when the network thread yields, whichever comes first.
+	Future<Optional<Value>> readValueBatched(KeyRef key, Optional<UID> debugID) {
+		if (pendingReads == nullptr) {
+			pendingReads = std::make_unique<Reader::ReadValuesAction>();
+		}
+		auto entry = std::make_unique<Reader::ReadValuesAction::Entry>(Key(key), debugID);
+		auto res = entry->result.getFuture();
+		pendingReads->entries.push_back(std::move(entry));
+		if ((int)pendingReads->entries.size() >= SERVER_KNOBS->ROCKSDB_MULTIGET_BATCH_SIZE) {
+			flushPendingReads();
+		} else if (pendingReads->entries.size() == 1) {
+			// The previous flush actor has either run or posted its batch by the time a new batch
+			// starts, so replacing the future here cannot cancel a flush that is still needed.
+			pendingReadsFlush = delayedFlush(this);
+		}
+		return res;
+	}
+
+	ACTOR static Future<Optional<Value>> readBatched(RocksDBKeyValueStore* self,
+	                                                 Key key,
+	                                                 Optional<UID> debugID,
+	                                                 FlowLock* semaphore,
+	                                                 Counter* counter) {
+		state Optional<Void> slot = wait(timeout(semaphore->take(), SERVER_KNOBS->ROCKSDB_READ_QUEUE_WAIT));
+		if (!slot.present()) {
+			++(*counter);
+			throw server_overloaded();
+		}
+
+		state FlowLock::Releaser release(*semaphore);
+
+		Optional<Value> result = wait(self->readValueBatched(key, debugID));
+		return result;
+	}
+
 	Future<Optional<Value>> readValue(KeyRef key, Optional<ReadOptions> options) override {
 		ReadType type = ReadType::NORMAL;
 		Optional<UID> debugID;
@@ -2133,7 +2311,19 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 			debugID = options.get().debugID;
 		}
 
+		// Skip the inline path for debugged reads so the Reader.Before/After trace events are
+		// still emitted from the reader thread.
+		if (SERVER_KNOBS->ROCKSDB_INLINE_BLOCK_CACHE_READS && !debugID.present()) {
+			Optional<Value> result;
+			if (tryReadValueInline(key, result)) {
+				return result;
+			}
+		}
+
 		if (!shouldThrottle(type, key)) {
+			if (SERVER_KNOBS->ROCKSDB_MULTIGET_BATCH_SIZE > 1) {
+				return readValueBatched(key, debugID);
+			}
 			auto a = new Reader::ReadValueAction(key, debugID);
 			auto res = a->result.getFuture();
 			readThreads->post(a);
@@ -2144,6 +2334,9 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 		int maxWaiters = (type == ReadType::FETCH) ? numFetchWaiters : numReadWaiters;
 
 		checkWaiters(semaphore, maxWaiters);
+		if (SERVER_KNOBS->ROCKSDB_MULTIGET_BATCH_SIZE > 1) {
+			return readBatched(this, key, debugID, &semaphore, &counters.failedToAcquire);
+		}
 		auto a = std::make_unique<Reader::ReadValueAction>(key, debugID);
 		return read(a.release(), &semaphore, readThreads.getPtr(), &counters.failedToAcquire);
 	}
@@ -2299,6 +2492,9 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 	Future<Void> collection;
 	PromiseStream<Future<Void>> addActor;
 	Counters counters;
+	// Point reads awaiting dispatch as a single MultiGet(). See readValueBatched().
+	std::unique_ptr<Reader::ReadValuesAction> pendingReads;
+	Future<Void> pendingReadsFlush;
 };
 
 void RocksDBKeyValueStore::Writer::action(CheckpointAction& a) {
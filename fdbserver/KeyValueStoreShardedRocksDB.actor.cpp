@@ -3056,6 +3056,74 @@ struct ShardedRocksDBKeyValueStore : IKeyValueStore {
 		return result;
 	}
 
+	// Reads a multi-shard range by dispatching single-shard read actions to the reader pool in
+	// waves of up to ROCKSDB_READ_RANGE_PARALLEL_SHARDS shards and concatenating the results in
+	// shard order. Each shard in a wave is given the limits remaining at the start of the wave
+	// because the rows the preceding shards of the wave will contribute are not yet known, so a
+	// wave can read up to wave-size times more than the limits require; waves keep that
+	// over-read bounded while still using the per-shard parallelism the reader pool offers.
+	ACTOR static Future<RangeResult> parallelReadRange(ShardedRocksDBKeyValueStore* self,
+	                                                   KeyRange keys,
+	                                                   std::vector<DataShard*> shards,
+	                                                   int rowLimit,
+	                                                   int byteLimit,
+	                                                   FlowLock* semaphore,
+	                                                   Counter* counter) {
+		state FlowLock::Releaser release;
+		if (semaphore != nullptr) {
+			Optional<Void> slot = wait(timeout(semaphore->take(), SERVER_KNOBS->ROCKSDB_READ_QUEUE_WAIT));
+			if (!slot.present()) {
+				++(*counter);
+				throw server_overloaded();
+			}
+			release = FlowLock::Releaser(*semaphore);
+		}
+
+		// Read shards in key order (reversed for reverse scans) so that per-shard results
+		// concatenate into a sorted result.
+		if (rowLimit < 0) {
+			std::reverse(shards.begin(), shards.end());
+		}
+
+		state RangeResult result;
+		state int accumulatedBytes = 0;
+		state int i = 0;
+		state bool limitsReached = false;
+		while (i < (int)shards.size() && !limitsReached) {
+			state std::vector<Future<RangeResult>> reads;
+			int wave = std::min<int>(SERVER_KNOBS->ROCKSDB_READ_RANGE_PARALLEL_SHARDS, shards.size() - i);
+			int remainingRows = (rowLimit < 0) ? rowLimit + result.size() : rowLimit - result.size();
+			for (int j = 0; j < wave; ++j) {
+				auto a = new Reader::ReadRangeAction(
+				    keys, { shards[i + j] }, remainingRows, byteLimit - accumulatedBytes);
+				reads.push_back(a->result.getFuture());
+				self->readThreads->post(a);
+			}
+			std::vector<RangeResult> partials = wait(getAll(reads));
+			i += partials.size();
+			for (const RangeResult& partial : partials) {
+				for (const KeyValueRef& kv : partial) {
+					accumulatedBytes += sizeof(KeyValueRef) + kv.expectedSize();
+					result.push_back_deep(result.arena(), kv);
+					if (result.size() >= abs(rowLimit) || accumulatedBytes >= byteLimit) {
+						limitsReached = true;
+						break;
+					}
+				}
+				if (limitsReached) {
+					break;
+				}
+			}
+		}
+
+		result.more =
+		    (result.size() == rowLimit) || (result.size() == -rowLimit) || (accumulatedBytes >= byteLimit);
+		if (result.more) {
+			result.readThrough = result[result.size() - 1].key;
+		}
+		return result;
+	}
+
 	Future<RangeResult> readRange(KeyRangeRef keys,
 	                              int rowLimit,
 	                              int byteLimit,
@@ -3068,6 +3136,17 @@ struct ShardedRocksDBKeyValueStore : IKeyValueStore {
 			type = options.get().type;
 		}
 
+		if (SERVER_KNOBS->ROCKSDB_READ_RANGE_PARALLEL_SHARDS > 1 && shards.size() > 1 && rowLimit != 0 &&
+		    byteLimit > 0) {
+			if (!shouldThrottle(type, keys.begin)) {
+				return parallelReadRange(this, keys, shards, rowLimit, byteLimit, nullptr, nullptr);
+			}
+			auto& semaphore = (type == ReadType::FETCH) ? fetchSemaphore : readSemaphore;
+			int maxWaiters = (type == ReadType::FETCH) ? numFetchWaiters : numReadWaiters;
+			checkWaiters(semaphore, maxWaiters);
+			return parallelReadRange(this, keys, shards, rowLimit, byteLimit, &semaphore, &counters.failedToAcquire);
+		}
+
 		if (!shouldThrottle(type, keys.begin)) {
 			auto a = new Reader::ReadRangeAction(keys, shards, rowLimit, byteLimit);
 			auto res = a->result.getFuture();
@@ -31,6 +31,7 @@ public:
 				const auto& [tag, expirableBands] = *it;
 				if (now() - expirableBands.lastUpdated > SERVER_KNOBS->GLOBAL_TAG_THROTTLING_TAG_EXPIRE_AFTER) {
 					CODE_PROBE(true, "LatencyBandsMap erasing expired tag");
+					++self->generation;
 					it = self->map.erase(it);
 				} else {
 					++it;
@@ -43,7 +44,7 @@ public:
 LatencyBandsMap::ExpirableBands::ExpirableBands(LatencyBands&& bands)
   : latencyBands(std::move(bands)), lastUpdated(now()) {}
 
-Optional<LatencyBands*> LatencyBandsMap::getLatencyBands(TransactionTag tag) {
+Optional<LatencyBandsMap::ExpirableBands*> LatencyBandsMap::getLatencyBands(TransactionTag tag) {
 	if (map.size() == maxSize && !map.count(tag)) {
 		CODE_PROBE(true, "LatencyBandsMap reached maxSize");
 		return {};
@@ -57,7 +58,7 @@ Optional<LatencyBands*> LatencyBandsMap::getLatencyBands(TransactionTag tag) {
 		}
 	}
 	expirableBands.lastUpdated = now();
-	return &expirableBands.latencyBands;
+	return &expirableBands;
 }
 
 LatencyBandsMap::LatencyBandsMap(std::string const& name, UID id, double loggingInterval, int maxSize)
@@ -68,10 +69,23 @@ LatencyBandsMap::LatencyBandsMap(std::string const& name, UID id, double logging
 void LatencyBandsMap::addMeasurement(TransactionTag tag, double value, int count) {
 	auto bands = getLatencyBands(tag);
 	if (bands.present()) {
-		bands.get()->addMeasurement(value, count);
+		bands.get()->latencyBands.addMeasurement(value, count);
 	}
 }
 
+void LatencyBandsMap::addMeasurement(TransactionTag tag, Handle& handle, double value, int count) {
+	if (handle.entry == nullptr || handle.generation != generation) {
+		auto bands = getLatencyBands(tag);
+		if (!bands.present()) {
+			return;
+		}
+		handle.entry = bands.get();
+		handle.generation = generation;
+	}
+	handle.entry->lastUpdated = now();
+	handle.entry->latencyBands.addMeasurement(value, count);
+}
+
 void LatencyBandsMap::addThreshold(double value) {
 	thresholds.push_back(value);
 	for (auto& [tag, expirableBands] : map) {
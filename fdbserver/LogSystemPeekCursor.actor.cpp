@@ -23,6 +23,7 @@
 #include "fdbserver/Knobs.h"
 #include "fdbserver/MutationTracking.h"
 #include "fdbrpc/ReplicationUtils.h"
+#include "flow/CompressionUtils.h"
 #include "flow/DebugTrace.h"
 #include "flow/actorcompiler.h" // has to be last include
 
@@ -57,7 +58,7 @@ ILogSystem::ServerPeekCursor::ServerPeekCursor(Reference<AsyncVar<OptionalInterf
     poppedVersion(0), hasMsg(false), randomID(deterministicRandom()->randomUniqueID()),
     returnIfBlocked(returnIfBlocked), onlySpilled(false), parallelGetMore(parallelGetMore),
     usePeekStream(SERVER_KNOBS->PEEK_USING_STREAMING), sequence(0), lastReset(0), resetCheck(Void()), slowReplies(0),
-    fastReplies(0), unknownReplies(0) {
+    fastReplies(0), unknownReplies(0), estReplyBytes(0), estReplyLatency(0), estBytesPerSecond(0), lastReplyTime(0) {
 	this->results.maxKnownVersion = 0;
 	this->results.minKnownCommittedVersion = 0;
 	DebugLogTraceEvent(SevDebug, "SPC_Starting", randomID)
@@ -80,7 +81,7 @@ ILogSystem::ServerPeekCursor::ServerPeekCursor(TLogPeekReply const& results,
     end(end), poppedVersion(poppedVersion), messageAndTags(message), hasMsg(hasMsg),
     randomID(deterministicRandom()->randomUniqueID()), returnIfBlocked(false), onlySpilled(false),
     parallelGetMore(false), usePeekStream(false), sequence(0), lastReset(0), resetCheck(Void()), slowReplies(0),
-    fastReplies(0), unknownReplies(0) {
+    fastReplies(0), unknownReplies(0), estReplyBytes(0), estReplyLatency(0), estBytesPerSecond(0), lastReplyTime(0) {
 	//TraceEvent("SPC_Clone", randomID);
 	this->results.maxKnownVersion = 0;
 	this->results.minKnownCommittedVersion = 0;
@@ -190,6 +191,12 @@ void ILogSystem::ServerPeekCursor::advanceTo(LogMessageVersion n) {
 // in getMore helper functions.
 void updateCursorWithReply(ILogSystem::ServerPeekCursor* self, const TLogPeekReply& res) {
 	self->results = res;
+	if (res.compressionFilter.present()) {
+		// The decompressed copy lives in the results arena alongside the compressed payload it replaces.
+		self->results.messages =
+		    CompressionUtils::decompress(res.compressionFilter.get(), res.messages, self->results.arena);
+		self->results.compressionFilter.reset();
+	}
 	self->onlySpilled = res.onlySpilled;
 	if (res.popped.present())
 		self->poppedVersion = std::min(std::max(self->poppedVersion, res.popped.get()), self->end.version);
@@ -231,6 +238,21 @@ ACTOR Future<TLogPeekReply> recordRequestMetrics(ILogSystem::ServerPeekCursor* s
 	try {
 		state double startTime = now();
 		TLogPeekReply t = wait(in);
+
+		// Fold this reply into the smoothed size, latency, and throughput estimates used to size
+		// the parallel peek pipeline to the link's bandwidth-delay product.
+		double latency = now() - startTime;
+		self->estReplyLatency =
+		    self->estReplyLatency == 0 ? latency : 0.9 * self->estReplyLatency + 0.1 * latency;
+		self->estReplyBytes =
+		    self->estReplyBytes == 0 ? t.messages.size() : 0.9 * self->estReplyBytes + 0.1 * t.messages.size();
+		if (self->lastReplyTime > 0 && now() > self->lastReplyTime) {
+			double rate = t.messages.size() / (now() - self->lastReplyTime);
+			self->estBytesPerSecond =
+			    self->estBytesPerSecond == 0 ? rate : 0.9 * self->estBytesPerSecond + 0.1 * rate;
+		}
+		self->lastReplyTime = now();
+
 		if (now() - self->lastReset > SERVER_KNOBS->PEEK_RESET_INTERVAL) {
 			if (now() - startTime > SERVER_KNOBS->PEEK_MAX_LATENCY) {
 				if (t.messages.size() >= SERVER_KNOBS->DESIRED_TOTAL_BYTES || SERVER_KNOBS->PEEK_COUNT_SMALL_MESSAGES) {
@@ -277,8 +299,22 @@ ACTOR Future<Void> serverPeekParallelGetMore(ILogSystem::ServerPeekCursor* self,
 		state Version expectedBegin = self->messageVersion.version;
 		try {
 			if (self->parallelGetMore || self->onlySpilled) {
-				while (self->futureResults.size() < SERVER_KNOBS->PARALLEL_GET_MORE_REQUESTS &&
-				       self->interf->get().present()) {
+				// By default a fixed number of requests is kept in flight. When a byte window is
+				// configured, grow the pipeline so the outstanding bytes cover the link's
+				// bandwidth-delay product; otherwise a high-latency link (e.g. a log router pulling
+				// across the WAN) is bounded by round trips rather than available bandwidth. The
+				// estimates converge toward DESIRED_TOTAL_BYTES-sized replies under load, and the
+				// window collapses back to the default when the tag goes idle and replies shrink.
+				int maxRequests = SERVER_KNOBS->PARALLEL_GET_MORE_REQUESTS;
+				if (SERVER_KNOBS->PARALLEL_PEEK_WINDOW_BYTES > 0 && self->estReplyBytes > 0) {
+					double windowBytes = std::min<double>(SERVER_KNOBS->PARALLEL_PEEK_WINDOW_BYTES,
+					                                      std::max(self->estBytesPerSecond * self->estReplyLatency,
+					                                               (double)SERVER_KNOBS->DESIRED_TOTAL_BYTES));
+					int byBytes = (int)(windowBytes / std::max<double>(self->estReplyBytes, 1024)) + 1;
+					maxRequests =
+					    std::max(maxRequests, std::min(byBytes, SERVER_KNOBS->PARALLEL_PEEK_MAX_REQUESTS));
+				}
+				while (self->futureResults.size() < maxRequests && self->interf->get().present()) {
 					self->futureResults.push_back(recordRequestMetrics(
 					    self,
 					    self->interf->get().interf().peekMessages.getEndpoint().getPrimaryAddress(),
@@ -756,6 +792,17 @@ ACTOR Future<Void> mergedPeekGetMore(ILogSystem::MergedPeekCursor* self,
 		//TraceEvent("MPC_GetMoreA", self->randomID).detail("Start", startVersion.toString());
 		if (self->bestServer >= 0 && self->serverCursors[self->bestServer]->isActive()) {
 			ASSERT(!self->serverCursors[self->bestServer]->hasMessage());
+			if (SERVER_KNOBS->MERGED_PEEK_PARALLEL_PREFETCH) {
+				// Start fetches on the other cursors so they proceed in parallel with the
+				// best server rather than serially after it is found lacking. The futures
+				// are retained by the cursors themselves; the fetched data is consumed
+				// only if the best server cannot supply the next version.
+				for (int i = 0; i < self->serverCursors.size(); i++) {
+					if (i != self->bestServer && !self->serverCursors[i]->hasMessage()) {
+						self->serverCursors[i]->getMore(taskID);
+					}
+				}
+			}
 			wait(self->serverCursors[self->bestServer]->getMore(taskID) ||
 			     self->serverCursors[self->bestServer]->onFailed());
 		} else {
@@ -1074,6 +1121,15 @@ ACTOR Future<Void> setPeekGetMore(ILogSystem::SetPeekCursor* self,
 		    self->serverCursors[self->bestSet][self->bestServer]->isActive()) {
 			ASSERT(!self->serverCursors[self->bestSet][self->bestServer]->hasMessage());
 			//TraceEvent("LPC_GetMore2", self->randomID).detail("Start", startVersion.toString()).detail("Tag", self->tag.toString());
+			if (SERVER_KNOBS->MERGED_PEEK_PARALLEL_PREFETCH) {
+				// As in mergedPeekGetMore, let the rest of the best set fetch in parallel
+				// with the best server so a fallback finds their data already buffered.
+				for (int i = 0; i < self->serverCursors[self->bestSet].size(); i++) {
+					if (i != self->bestServer && !self->serverCursors[self->bestSet][i]->hasMessage()) {
+						self->serverCursors[self->bestSet][i]->getMore(taskID);
+					}
+				}
+			}
 			wait(self->serverCursors[self->bestSet][self->bestServer]->getMore(taskID) ||
 			     self->serverCursors[self->bestSet][self->bestServer]->onFailed());
 			self->useBestSet = true;
@@ -84,28 +84,42 @@ void UDPMetricClient::send(MetricCollection* metrics) {
 			serialize_vector(vec, buf, f);
 		};
 
+		// Sums are pre-aggregated to one data point each by the collection side; emit them as deltas over
+		// the export interval. The receiver then doesn't need per-process cumulative state, and a lost
+		// packet costs one interval of that counter instead of skewing the series.
 		std::vector<OTEL::OTELSum> currentSums;
 		size_t current_msgpack = 0;
-		for (const auto& [_, s] : metrics->sumMap) {
-			if (current_msgpack < MAX_OTELSUM_PACKET_SIZE) {
-				currentSums.push_back(std::move(s));
-				current_msgpack += s.getMsgpackBytes();
-			} else {
+		for (auto& [id, s] : metrics->sumMap) {
+			if (!s.points.empty() && std::holds_alternative<int64_t>(s.points.back().val)) {
+				OTEL::NumberDataPoint& p = s.points.back();
+				int64_t cumulative = std::get<int64_t>(p.val);
+				int64_t& last = lastSumValue[id];
+				if (cumulative >= last) {
+					p.val = cumulative - last;
+				}
+				// else: the counter was cleared, so the cumulative value already is this interval's delta
+				last = cumulative;
+				s.aggregation = OTEL::AGGREGATION_TEMPORALITY_DELTA;
+			}
+			if (current_msgpack > 0 && current_msgpack + s.getMsgpackBytes() > MAX_OTELSUM_PACKET_SIZE) {
 				sums.push_back(std::move(currentSums));
 				currentSums.clear();
 				current_msgpack = 0;
 			}
+			current_msgpack += s.getMsgpackBytes();
+			currentSums.push_back(std::move(s));
 		}
-		if (!sums.empty()) {
-			for (const auto& currSums : sums) {
-				serialize_ext(currSums, buf, OTEL::OTELMetricType::Sum, f_sums);
-				send_packet(socket_fd, buf.buffer.get(), buf.data_size);
-				int error = errno;
-				TraceEvent("MetricsSumUdpErrno", UID()).detail("Errno", error);
-				buf.reset();
-			}
-			metrics->sumMap.clear();
+		if (!currentSums.empty()) {
+			sums.push_back(std::move(currentSums));
+		}
+		for (const auto& currSums : sums) {
+			serialize_ext(currSums, buf, OTEL::OTELMetricType::Sum, f_sums);
+			send_packet(socket_fd, buf.buffer.get(), buf.data_size);
+			int error = errno;
+			TraceEvent("MetricsSumUdpErrno", UID()).detail("Errno", error);
+			buf.reset();
 		}
+		metrics->sumMap.clear();
 
 		// Each histogram should be in a seperate because of their large sizes
 		// Expected DDSketch size is ~4200 entries * 9 bytes = 37800
@@ -135,11 +149,12 @@ void UDPMetricClient::send(MetricCollection* metrics) {
 		std::string messages;
 		for (const auto& msg : metrics->statsd_message) {
 			// Account for max udp packet size (+1 since we add '\n')
-			if (messages.size() + msg.size() + 1 < IUDPSocket::MAX_PACKET_SIZE) {
-				messages += (std::move(msg) + '\n');
-			} else {
-				send_packet(socket_fd, buf.buffer.get(), buf.data_size);
+			if (messages.size() + msg.size() + 1 > IUDPSocket::MAX_PACKET_SIZE) {
+				send_packet(socket_fd, messages.data(), messages.size());
+				messages.clear();
 			}
+			messages += msg;
+			messages += '\n';
 		}
 		if (!messages.empty()) {
 			send_packet(socket_fd, messages.data(), messages.size());
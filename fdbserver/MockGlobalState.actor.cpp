@@ -741,6 +741,204 @@ int64_t MockGlobalState::clearRange(KeyRangeRef const& range) {
 	return totalSize;
 }
 
+namespace {
+
+// Charge one replica movement to the plan. The bytes flow into dest; the serve load is charged to
+// the plan's currently least-charged member of sources so reads spread across the team, which is
+// how fetchKeys picks sources.
+void chargeMove(TopologyChangePlan& plan, std::vector<UID> const& sources, UID const& dest, int64_t bytes) {
+	plan.movementBytes += bytes;
+	++plan.shardsMoved;
+	plan.inboundBytes[dest] += bytes;
+	if (!sources.empty()) {
+		UID src = sources[0];
+		for (auto const& id : sources) {
+			if (plan.outboundBytes[id] < plan.outboundBytes[src]) {
+				src = id;
+			}
+		}
+		plan.outboundBytes[src] += bytes;
+	}
+}
+
+// Duration follows the mock fetchKeys model: each destination pulls one FETCH_BLOCK_BYTES chunk
+// per ~10ms, and at most DD_MOVE_KEYS_PARALLELISM moves run at once. The estimate is the larger of
+// the busiest destination's fetch time and the cluster-wide throughput bound.
+void estimateDuration(TopologyChangePlan& plan) {
+	if (plan.movementBytes == 0)
+		return;
+	double perServerBytesPerSecond = SERVER_KNOBS->FETCH_BLOCK_BYTES * 100.0;
+	int64_t maxInbound = 0;
+	for (auto const& [id, bytes] : plan.inboundBytes) {
+		maxInbound = std::max(maxInbound, bytes);
+	}
+	int parallelism =
+	    std::max<int>(1, std::min<int>(plan.inboundBytes.size(), SERVER_KNOBS->DD_MOVE_KEYS_PARALLELISM));
+	plan.estimatedSeconds = std::max(maxInbound / perServerBytesPerSecond,
+	                                 plan.movementBytes / (perServerBytesPerSecond * parallelism));
+}
+
+// The least-loaded server in projectedLoad that is neither in the team nor already chosen for it
+Optional<UID> pickLeastLoaded(std::map<UID, int64_t> const& projectedLoad,
+                              ShardsAffectedByTeamFailure::Team const& team,
+                              std::set<UID> const& chosen) {
+	Optional<UID> best;
+	for (auto const& [id, load] : projectedLoad) {
+		if (team.hasServer(id) || chosen.count(id))
+			continue;
+		if (!best.present() || load < projectedLoad.at(best.get())) {
+			best = id;
+		}
+	}
+	return best;
+}
+
+} // namespace
+
+void MockGlobalState::loadShardMapSnapshot(const std::vector<ShardSnapshot>& shards,
+                                           const DatabaseConfiguration& conf,
+                                           uint64_t defaultDiskSpace) {
+	ASSERT(conf.storageTeamSize > 0);
+	configuration = conf;
+	for (auto const& shard : shards) {
+		ASSERT_EQ((int)shard.servers.size(), configuration.storageTeamSize);
+		std::vector<UID> servers = shard.servers;
+		std::sort(servers.begin(), servers.end());
+		for (auto const& id : servers) {
+			if (!allServers.count(id)) {
+				allServers[id] = MockStorageServer(id, defaultDiskSpace);
+				allServers[id].serverKeys.insert(allKeys, { MockShardStatus::UNSET, 0 });
+			}
+			allServers[id].serverKeys.insert(shard.range, { MockShardStatus::COMPLETED, (uint64_t)shard.bytes });
+			allServers[id].usedDiskSpace += shard.bytes;
+		}
+		shardMapping->assignRangeToTeams(shard.range, { Team(servers, true) });
+	}
+}
+
+TopologyChangePlan MockGlobalState::planServerRemoval(const std::vector<UID>& serversToRemove) const {
+	TopologyChangePlan plan;
+	std::set<UID> removed(serversToRemove.begin(), serversToRemove.end());
+	// Projected load of every surviving server, updated as the plan places replacements, so that
+	// successive shards spread across the cluster the way team selection would
+	std::map<UID, int64_t> projectedLoad;
+	for (auto const& [id, server] : allServers) {
+		if (!removed.count(id)) {
+			projectedLoad[id] = server.usedDiskSpace;
+		}
+	}
+	auto allRange = shardMapping->getAllRanges();
+	for (auto it = allRange.begin(); it != allRange.end(); ++it) {
+		KeyRangeRef curRange = it->range();
+		auto teams = shardMapping->getTeamsForFirstShard(curRange);
+		for (auto const& team : teams.first) {
+			std::vector<UID> survivors;
+			for (auto const& id : team.servers) {
+				if (!removed.count(id)) {
+					survivors.push_back(id);
+				}
+			}
+			int lost = team.servers.size() - survivors.size();
+			if (lost == 0)
+				continue;
+			int64_t bytes = team.servers.empty() ? 0 : allServers.at(team.servers[0]).sumRangeSize(curRange);
+			std::set<UID> chosen;
+			for (int i = 0; i < lost; ++i) {
+				Optional<UID> dest = pickLeastLoaded(projectedLoad, team, chosen);
+				if (!dest.present())
+					break; // not enough surviving servers to restore replication
+				chargeMove(plan, survivors, dest.get(), bytes);
+				projectedLoad[dest.get()] += bytes;
+				chosen.insert(dest.get());
+			}
+		}
+	}
+	estimateDuration(plan);
+	return plan;
+}
+
+TopologyChangePlan MockGlobalState::planServerAddition(const std::vector<UID>& newServers) const {
+	TopologyChangePlan plan;
+	ASSERT(!newServers.empty());
+	int64_t totalReplicaBytes = 0;
+	for (auto const& [id, server] : allServers) {
+		totalReplicaBytes += server.usedDiskSpace;
+	}
+	int64_t mean = totalReplicaBytes / (allServers.size() + newServers.size());
+
+	// Fill the newcomers up to the post-change average, taking whole replicas from the most loaded
+	// donors first, the way the rebalance queue drains the largest imbalance
+	std::map<UID, int64_t> need;
+	for (auto const& id : newServers) {
+		ASSERT(!allServers.count(id));
+		need[id] = mean;
+	}
+	std::vector<std::pair<int64_t, UID>> donors;
+	for (auto const& [id, server] : allServers) {
+		if ((int64_t)server.usedDiskSpace > mean) {
+			donors.emplace_back(server.usedDiskSpace, id);
+		}
+	}
+	std::sort(donors.rbegin(), donors.rend());
+
+	for (auto const& [donorLoad, donorId] : donors) {
+		int64_t surplus = donorLoad - mean;
+		auto shards = allServers.at(donorId).serverKeys.ranges();
+		for (auto it = shards.begin(); it != shards.end() && surplus > 0; ++it) {
+			int64_t bytes = it->cvalue().shardSize;
+			if (it->cvalue().status != MockShardStatus::COMPLETED || bytes == 0 || bytes > surplus)
+				continue;
+			UID dest;
+			int64_t destNeed = 0;
+			for (auto const& [id, n] : need) {
+				if (n > destNeed) {
+					dest = id;
+					destNeed = n;
+				}
+			}
+			if (destNeed < bytes)
+				break; // no newcomer wants this much more data
+			chargeMove(plan, { donorId }, dest, bytes);
+			need[dest] -= bytes;
+			surplus -= bytes;
+		}
+	}
+	estimateDuration(plan);
+	return plan;
+}
+
+TopologyChangePlan MockGlobalState::planReplicationChange(int newStorageTeamSize) const {
+	TopologyChangePlan plan;
+	int delta = newStorageTeamSize - configuration.storageTeamSize;
+	if (delta <= 0) {
+		// Dropping replicas deletes data in place; nothing moves
+		return plan;
+	}
+	std::map<UID, int64_t> projectedLoad;
+	for (auto const& [id, server] : allServers) {
+		projectedLoad[id] = server.usedDiskSpace;
+	}
+	auto allRange = shardMapping->getAllRanges();
+	for (auto it = allRange.begin(); it != allRange.end(); ++it) {
+		KeyRangeRef curRange = it->range();
+		auto teams = shardMapping->getTeamsForFirstShard(curRange);
+		for (auto const& team : teams.first) {
+			int64_t bytes = team.servers.empty() ? 0 : allServers.at(team.servers[0]).sumRangeSize(curRange);
+			std::set<UID> chosen;
+			for (int i = 0; i < delta; ++i) {
+				Optional<UID> dest = pickLeastLoaded(projectedLoad, team, chosen);
+				if (!dest.present())
+					break; // not enough servers for the requested replication
+				chargeMove(plan, team.servers, dest.get(), bytes);
+				projectedLoad[dest.get()] += bytes;
+				chosen.insert(dest.get());
+			}
+		}
+	}
+	estimateDuration(plan);
+	return plan;
+}
+
 TEST_CASE("/MockGlobalState/initializeAsEmptyDatabaseMGS/SimpleThree") {
 	BasicTestConfig testConfig;
 	testConfig.simpleConfig = true;
@@ -761,6 +959,51 @@ TEST_CASE("/MockGlobalState/initializeAsEmptyDatabaseMGS/SimpleThree") {
 	return Void();
 }
 
+TEST_CASE("/MockGlobalState/WhatIfPlanner/TopologyChanges") {
+	DatabaseConfiguration dbConfig;
+	dbConfig.storageTeamSize = 2;
+
+	// Four servers, double replication, three shards of known sizes
+	std::vector<ShardSnapshot> shards;
+	shards.push_back({ KeyRangeRef(""_sr, "b"_sr),
+	                   { MockGlobalState::indexToUID(1), MockGlobalState::indexToUID(2) },
+	                   100000000 });
+	shards.push_back({ KeyRangeRef("b"_sr, "m"_sr),
+	                   { MockGlobalState::indexToUID(2), MockGlobalState::indexToUID(3) },
+	                   200000000 });
+	shards.push_back({ KeyRangeRef("m"_sr, allKeys.end),
+	                   { MockGlobalState::indexToUID(3), MockGlobalState::indexToUID(4) },
+	                   300000000 });
+
+	auto mgs = std::make_shared<MockGlobalState>();
+	mgs->loadShardMapSnapshot(shards, dbConfig);
+	ASSERT_EQ(mgs->allServers.size(), 4);
+	ASSERT_EQ(mgs->allServers.at(MockGlobalState::indexToUID(2)).usedDiskSpace, 300000000);
+
+	// Removing server 2 re-replicates both of its shards onto servers outside the original teams
+	TopologyChangePlan removal = mgs->planServerRemoval({ MockGlobalState::indexToUID(2) });
+	ASSERT_EQ(removal.shardsMoved, 2);
+	ASSERT_EQ(removal.movementBytes, 300000000);
+	ASSERT_EQ(removal.inboundBytes.count(MockGlobalState::indexToUID(2)), 0);
+	ASSERT(removal.estimatedSeconds > 0);
+
+	// Adding two empty servers pulls replicas down from donors above the post-change average.
+	// Total replica bytes are 1.2GB over 6 servers, so only the 200MB replica on the most loaded
+	// donor fits under its 300MB surplus.
+	TopologyChangePlan addition =
+	    mgs->planServerAddition({ MockGlobalState::indexToUID(5), MockGlobalState::indexToUID(6) });
+	ASSERT_EQ(addition.shardsMoved, 1);
+	ASSERT_EQ(addition.movementBytes, 200000000);
+
+	// Raising replication from double to triple copies every shard once; lowering it moves nothing
+	TopologyChangePlan triple = mgs->planReplicationChange(3);
+	ASSERT_EQ(triple.shardsMoved, 3);
+	ASSERT_EQ(triple.movementBytes, 600000000);
+	ASSERT_EQ(mgs->planReplicationChange(1).movementBytes, 0);
+
+	return Void();
+}
+
 struct MockGlobalStateTester {
 
 	// expectation [r0.begin, r0.end) => [r0.begin, x1), [x1, x2), [x2, r0.end)
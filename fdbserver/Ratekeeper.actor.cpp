@@ -144,6 +144,9 @@ public:
 				}
 
 				oldServers.swap(newServers);
+				if (self->serverListReady.canBeSet()) {
+					self->serverListReady.send(Void());
+				}
 				tr = Transaction(self->db);
 				wait(delay(SERVER_KNOBS->SERVER_LIST_DELAY));
 			} catch (Error& e) {
@@ -357,7 +360,9 @@ public:
 		}
 	}
 
-	ACTOR static Future<Void> run(RatekeeperInterface rkInterf, Reference<AsyncVar<ServerDBInfo> const> dbInfo) {
+	ACTOR static Future<Void> run(RatekeeperInterface rkInterf,
+	                              Reference<AsyncVar<ServerDBInfo> const> dbInfo,
+	                              ReplyPromise<RatekeeperInterface> recruitReply) {
 		state ActorOwningSelfRef<Ratekeeper> pSelf(
 		    new Ratekeeper(rkInterf.id(), openDBOnServer(dbInfo, TaskPriority::DefaultEndpoint, LockAware::True)));
 		state Ratekeeper& self = *pSelf;
@@ -382,6 +387,12 @@ public:
 		}
 		self.addActor.send(self.refreshStorageServerCommitCosts());
 
+		// Acknowledge recruitment only after the first storage server list fetch, so during a planned move
+		// the cluster controller keeps the previous ratekeeper serving until this one is warm. Bounded so a
+		// slow fetch cannot time out the recruitment request itself.
+		wait(self.serverListReady.getFuture() || delay(SERVER_KNOBS->WAIT_FOR_RATEKEEPER_JOIN_DELAY / 2));
+		recruitReply.send(rkInterf);
+
 		TraceEvent("RkTLogQueueSizeParameters", rkInterf.id())
 		    .detail("Target", SERVER_KNOBS->TARGET_BYTES_PER_TLOG)
 		    .detail("Spring", SERVER_KNOBS->SPRING_BYTES_TLOG)
@@ -704,6 +715,12 @@ void Ratekeeper::updateRate(RatekeeperLimits* limits) {
 
 	// Look at each storage server's write queue and local rate, compute and store the desired rate
 	// ratio
+	double worstProjectedOverageSS = -std::numeric_limits<double>::max();
+	UID predictionSSID;
+	int64_t predictionSSQueue = 0;
+	double predictionSSProjectedQueue = 0;
+	double predictionSSGrowthRate = 0;
+
 	for (auto i = storageQueueInfo.begin(); i != storageQueueInfo.end(); ++i) {
 		auto const& ss = i->value;
 		if (!ss.valid || !ss.acceptingRequests || (remoteDC.present() && ss.locality.dcId() == remoteDC))
@@ -781,6 +798,30 @@ void Ratekeeper::updateRate(RatekeeperLimits* limits) {
 		  .detail("B", b);
 		  }*/
 
+		// Begin limiting before the queue crosses into the spring range: project the queue
+		// forward by RK_PREDICTION_HORIZON seconds at its current net growth rate, and if the
+		// projection breaches the target, raise the rate ratio now. The predictive ratio is
+		// capped at RK_PREDICTION_MAX_RATE_RATIO so prediction alone throttles input to match
+		// durable throughput but never actively drains the queue; a real breach still does.
+		double queueGrowthRate = inputRate - ss.getVerySmoothDurableBytesRate();
+		double projectedQueue = storageQueue;
+		if (SERVER_KNOBS->RK_PREDICTION_HORIZON > 0 && queueGrowthRate > 0) {
+			projectedQueue = storageQueue + queueGrowthRate * SERVER_KNOBS->RK_PREDICTION_HORIZON;
+			double projectedRateRatio = std::min((projectedQueue - targetBytes + springBytes) / (double)springBytes,
+			                                     SERVER_KNOBS->RK_PREDICTION_MAX_RATE_RATIO);
+			if (projectedRateRatio > targetRateRatio) {
+				CODE_PROBE(true, "Ratekeeper predictive storage queue limit");
+				targetRateRatio = projectedRateRatio;
+			}
+		}
+		if (projectedQueue - targetBytes > worstProjectedOverageSS) {
+			worstProjectedOverageSS = projectedQueue - targetBytes;
+			predictionSSID = ss.id;
+			predictionSSQueue = storageQueue;
+			predictionSSProjectedQueue = projectedQueue;
+			predictionSSGrowthRate = queueGrowthRate;
+		}
+
 		// Don't let any storage server use up its target bytes faster than its MVCC window!
 		double maxBytesPerSecond =
 		    (targetBytes - springBytes) /
@@ -1093,6 +1134,11 @@ void Ratekeeper::updateRate(RatekeeperLimits* limits) {
 	int64_t worstFreeSpaceTLog = std::numeric_limits<int64_t>::max();
 	int64_t worstStorageQueueTLog = 0;
 	int tlcount = 0;
+	double worstProjectedOverageTLog = -std::numeric_limits<double>::max();
+	UID predictionTLogID;
+	int64_t predictionTLogQueue = 0;
+	double predictionTLogProjectedQueue = 0;
+	double predictionTLogGrowthRate = 0;
 	for (auto& it : tlogQueueInfo) {
 		auto const& tl = it.value;
 		if (!tl.valid)
@@ -1171,6 +1217,27 @@ void Ratekeeper::updateRate(RatekeeperLimits* limits) {
 
 		double inputRate = tl.getSmoothInputBytesRate();
 
+		// Same predictive term as for storage queues: project the tlog queue forward and begin
+		// limiting before it breaches the target.
+		double tlogQueueGrowthRate = inputRate - tl.getVerySmoothDurableBytesRate();
+		double projectedTlogQueue = queue;
+		if (SERVER_KNOBS->RK_PREDICTION_HORIZON > 0 && tlogQueueGrowthRate > 0) {
+			projectedTlogQueue = queue + tlogQueueGrowthRate * SERVER_KNOBS->RK_PREDICTION_HORIZON;
+			double projectedRateRatio = std::min((projectedTlogQueue - targetBytes + springBytes) / (double)springBytes,
+			                                     SERVER_KNOBS->RK_PREDICTION_MAX_RATE_RATIO);
+			if (projectedRateRatio > targetRateRatio) {
+				CODE_PROBE(true, "Ratekeeper predictive tlog queue limit");
+				targetRateRatio = projectedRateRatio;
+			}
+		}
+		if (projectedTlogQueue - targetBytes > worstProjectedOverageTLog) {
+			worstProjectedOverageTLog = projectedTlogQueue - targetBytes;
+			predictionTLogID = tl.id;
+			predictionTLogQueue = queue;
+			predictionTLogProjectedQueue = projectedTlogQueue;
+			predictionTLogGrowthRate = tlogQueueGrowthRate;
+		}
+
 		if (targetRateRatio > 0) {
 			double smoothedRate =
 			    std::max(tl.getVerySmoothDurableBytesRate(), actualTps / SERVER_KNOBS->MAX_TRANSACTIONS_PER_BYTE);
@@ -1285,6 +1352,21 @@ void Ratekeeper::updateRate(RatekeeperLimits* limits) {
 		    .detail("TagsManuallyThrottled", tagThrottler->manualThrottleCount())
 		    .detail("AutoThrottlingEnabled", tagThrottler->isAutoThrottlingEnabled())
 		    .trackLatest(name);
+
+		if (SERVER_KNOBS->RK_PREDICTION_HORIZON > 0) {
+			TraceEvent(("RkPrediction" + limits->context).c_str(), id)
+			    .detail("Horizon", SERVER_KNOBS->RK_PREDICTION_HORIZON)
+			    .detail("SSID", predictionSSID == UID() ? std::string() : Traceable<UID>::toString(predictionSSID))
+			    .detail("SSQueue", predictionSSQueue)
+			    .detail("SSQueueGrowthRate", predictionSSGrowthRate)
+			    .detail("SSProjectedQueue", predictionSSProjectedQueue)
+			    .detail("TLogID",
+			            predictionTLogID == UID() ? std::string() : Traceable<UID>::toString(predictionTLogID))
+			    .detail("TLogQueue", predictionTLogQueue)
+			    .detail("TLogQueueGrowthRate", predictionTLogGrowthRate)
+			    .detail("TLogProjectedQueue", predictionTLogProjectedQueue)
+			    .detail("TPSLimit", limits->tpsLimit);
+		}
 	}
 }
 
@@ -1292,8 +1374,19 @@ Future<Void> Ratekeeper::refreshStorageServerCommitCosts() {
 	return RatekeeperImpl::refreshStorageServerCommitCosts(this);
 }
 
-ACTOR Future<Void> ratekeeper(RatekeeperInterface rkInterf, Reference<AsyncVar<ServerDBInfo> const> dbInfo) {
-	wait(Ratekeeper::run(rkInterf, dbInfo));
+ACTOR Future<Void> ratekeeper(RatekeeperInterface rkInterf,
+                              Reference<AsyncVar<ServerDBInfo> const> dbInfo,
+                              ReplyPromise<RatekeeperInterface> recruitReply) {
+	try {
+		wait(Ratekeeper::run(rkInterf, dbInfo, recruitReply));
+	} catch (Error& e) {
+		if (e.code() != error_code_actor_cancelled && recruitReply.canBeSet()) {
+			// Failed before the warm-up acknowledgement; reply anyway so the cluster controller observes
+			// this failure through waitFailure rather than a broken recruitment reply
+			recruitReply.send(rkInterf);
+		}
+		throw;
+	}
 	return Void();
 }
 
@@ -110,6 +110,16 @@ ACTOR Future<Void> runIKVS(OpenKVStoreRequest openReq, IKVSInterface ikvsInterfa
 				when(IKVSClearRequest req = waitNext(ikvsInterface.clear.getFuture())) {
 					kvStore->clear(req.range);
 				}
+				when(IKVSMutationsRequest req = waitNext(ikvsInterface.mutations.getFuture())) {
+					for (const auto& m : req.mutations) {
+						if (m.type == MutationRef::SetValue) {
+							kvStore->set(KeyValueRef(m.param1, m.param2));
+						} else {
+							ASSERT(m.type == MutationRef::ClearRange);
+							kvStore->clear(KeyRangeRef(m.param1, m.param2));
+						}
+					}
+				}
 				when(IKVSCommitRequest commitReq = waitNext(ikvsInterface.commit.getFuture())) {
 					sendCommitReply(commitReq, kvStore, onClosed.getFuture());
 				}
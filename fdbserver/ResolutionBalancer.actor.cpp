@@ -118,6 +118,7 @@ ACTOR Future<Void> ResolutionBalancer::resolutionBalancing_impl(ResolutionBalanc
 	state CoalescedKeyRangeMap<int> key_resolver(
 	    0, SERVER_KNOBS->PROXY_USE_RESOLVER_PRIVATE_MUTATIONS ? normalKeys.end : allKeys.end);
 	key_resolver.insert(SERVER_KNOBS->PROXY_USE_RESOLVER_PRIVATE_MUTATIONS ? normalKeys : allKeys, 0);
+	state int imbalancedPolls = 0;
 	loop {
 		wait(delay(SERVER_KNOBS->MIN_BALANCE_TIME, TaskPriority::ResolutionMetrics));
 		while (self->resolverChanges.get().size())
@@ -135,7 +136,19 @@ ACTOR Future<Void> ResolutionBalancer::resolutionBalancing_impl(ResolutionBalanc
 			metrics.insert(std::make_pair(futures[i].get().value, i), NoMetric());
 			//TraceEvent("ResolverMetric").detail("I", i).detail("Metric", futures[i].get());
 		}
-		if (metrics.lastItem()->first - metrics.begin()->first > SERVER_KNOBS->MIN_BALANCE_DIFFERENCE) {
+		// In addition to the absolute threshold, require the difference to be a meaningful
+		// fraction of the mean load, so that a busy cluster does not chase skew that is
+		// insignificant relative to its throughput.  Require the imbalance to persist over
+		// several consecutive polls before moving boundaries, so that a single bursty
+		// sample cannot cause ranges to oscillate between resolvers.
+		int64_t threshold =
+		    std::max<int64_t>(SERVER_KNOBS->MIN_BALANCE_DIFFERENCE,
+		                      SERVER_KNOBS->RESOLUTION_BALANCE_FRACTION * (total / self->resolvers.size()));
+		if (metrics.lastItem()->first - metrics.begin()->first > threshold) {
+			if (++imbalancedPolls < SERVER_KNOBS->RESOLUTION_BALANCE_HYSTERESIS_POLLS) {
+				continue;
+			}
+			imbalancedPolls = 0;
 			try {
 				state int src = metrics.lastItem()->second;
 				state int dest = metrics.begin()->second;
@@ -183,6 +196,8 @@ ACTOR Future<Void> ResolutionBalancer::resolutionBalancing_impl(ResolutionBalanc
 				if (e.code() != error_code_operation_failed)
 					throw;
 			}
+		} else {
+			imbalancedPolls = 0;
 		}
 	}
 }
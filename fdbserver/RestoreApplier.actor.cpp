@@ -595,6 +595,33 @@ ACTOR static Future<Void> applyStagingKeysBatch(std::map<Key, StagingKey>::itera
 	return Void();
 }
 
+typedef std::pair<std::map<Key, StagingKey>::iterator, std::map<Key, StagingKey>::iterator> StagingKeyBatchRange;
+
+// One apply pipeline: repeatedly pulls the next unapplied sub-range off the shared list and
+// commits it. The sub-ranges are disjoint and contiguous by construction, so pipelines can never
+// conflict with each other, and a failed transaction rewinds and retries only its own sub-range.
+ACTOR static Future<Void> applyStagingKeysPipeline(Reference<ApplierBatchData> batchData,
+                                                   Database cx,
+                                                   UID applierID,
+                                                   std::vector<StagingKeyBatchRange>* batches,
+                                                   int* nextBatch) {
+	loop {
+		if (*nextBatch >= (int)batches->size()) {
+			return Void();
+		}
+		StagingKeyBatchRange range = (*batches)[(*nextBatch)++];
+		wait(applyStagingKeysBatch(range.first,
+		                           range.second,
+		                           cx,
+		                           applierID,
+		                           &batchData->counters,
+		                           &batchData->appliedBytes,
+		                           &batchData->applyingDataBytes,
+		                           &batchData->targetWriteRateMB,
+		                           &batchData->releaseTxnTrigger));
+	}
+}
+
 // Apply mutations in stagingKeys in batches in parallel
 ACTOR static Future<Void> applyStagingKeys(Reference<ApplierBatchData> batchData,
                                            UID applierID,
@@ -604,7 +631,7 @@ ACTOR static Future<Void> applyStagingKeys(Reference<ApplierBatchData> batchData
 	std::map<Key, StagingKey>::iterator cur = begin;
 	state int txnBatches = 0;
 	double txnSize = 0;
-	std::vector<Future<Void>> fBatches;
+	state std::vector<StagingKeyBatchRange> batches;
 	TraceEvent("FastRestoreApplerPhaseApplyStagingKeysStart", applierID)
 	    .detail("BatchIndex", batchIndex)
 	    .detail("StagingKeys", batchData->stagingKeys.size());
@@ -612,15 +639,7 @@ ACTOR static Future<Void> applyStagingKeys(Reference<ApplierBatchData> batchData
 	while (cur != batchData->stagingKeys.end()) {
 		txnSize += cur->second.totalSize(); // should be consistent with receivedBytes accounting method
 		if (txnSize > SERVER_KNOBS->FASTRESTORE_TXN_BATCH_MAX_BYTES) {
-			fBatches.push_back(applyStagingKeysBatch(begin,
-			                                         cur,
-			                                         cx,
-			                                         applierID,
-			                                         &batchData->counters,
-			                                         &batchData->appliedBytes,
-			                                         &batchData->applyingDataBytes,
-			                                         &batchData->targetWriteRateMB,
-			                                         &batchData->releaseTxnTrigger));
+			batches.emplace_back(begin, cur);
 			batchData->totalBytesToWrite += txnSize;
 			begin = cur;
 			txnSize = 0;
@@ -629,20 +648,21 @@ ACTOR static Future<Void> applyStagingKeys(Reference<ApplierBatchData> batchData
 		cur++;
 	}
 	if (begin != batchData->stagingKeys.end()) {
-		fBatches.push_back(applyStagingKeysBatch(begin,
-		                                         cur,
-		                                         cx,
-		                                         applierID,
-		                                         &batchData->counters,
-		                                         &batchData->appliedBytes,
-		                                         &batchData->applyingDataBytes,
-		                                         &batchData->targetWriteRateMB,
-		                                         &batchData->releaseTxnTrigger));
+		batches.emplace_back(begin, cur);
 		batchData->totalBytesToWrite += txnSize;
 		txnBatches++;
 	}
 
-	wait(waitForAll(fBatches));
+	// Run the disjoint sub-ranges through a bounded number of concurrent pipelines rather than one
+	// actor (and transaction) per sub-range; write traffic control still paces the commits.
+	state int nextBatch = 0;
+	std::vector<Future<Void>> pipelines;
+	int nPipelines = std::min<int>(SERVER_KNOBS->FASTRESTORE_APPLY_PIPELINES, batches.size());
+	pipelines.reserve(nPipelines);
+	for (int i = 0; i < nPipelines; ++i) {
+		pipelines.push_back(applyStagingKeysPipeline(batchData, cx, applierID, &batches, &nextBatch));
+	}
+	wait(waitForAll(pipelines));
 
 	TraceEvent("FastRestoreApplerPhaseApplyStagingKeysDone", applierID)
 	    .detail("BatchIndex", batchIndex)
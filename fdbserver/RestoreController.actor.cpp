@@ -376,11 +376,18 @@ ACTOR static Future<Version> processRestoreRequest(Reference<RestoreControllerDa
 	self->addActor.send(monitorFinishedVersion(self, request));
 	state std::vector<VersionBatch>::iterator versionBatch = versionBatches.begin();
 	for (; versionBatch != versionBatches.end(); versionBatch++) {
-		while (self->runningVersionBatches.get() >= SERVER_KNOBS->FASTRESTORE_VB_PARALLELISM && !releaseVBOutOfOrder) {
-			// Control how many batches can be processed in parallel. Avoid dead lock due to OOM on loaders
+		while ((self->loadingVersionBatches.get() >= SERVER_KNOBS->FASTRESTORE_VB_PARALLELISM ||
+		        self->runningVersionBatches.get() >=
+		            SERVER_KNOBS->FASTRESTORE_VB_PARALLELISM + SERVER_KNOBS->FASTRESTORE_VB_APPLY_BACKLOG) &&
+		       !releaseVBOutOfOrder) {
+			// Control how many batches can be processed in parallel. Avoid dead lock due to OOM on loaders.
+			// Loaders and appliers use disjoint resources, so a batch only holds a loader slot until its
+			// mutations have been shipped to appliers; afterwards it still counts against the total in-flight
+			// bound, which caps the mutations appliers may buffer behind the serialized apply phase.
 			TraceEvent("FastRestoreControllerDispatchVersionBatches")
+			    .detail("WaitOnLoadingVersionBatches", self->loadingVersionBatches.get())
 			    .detail("WaitOnRunningVersionBatches", self->runningVersionBatches.get());
-			wait(self->runningVersionBatches.onChange());
+			wait(self->loadingVersionBatches.onChange() || self->runningVersionBatches.onChange());
 		}
 		int batchIndex = versionBatch->batchIndex;
 		TraceEvent("FastRestoreControllerDispatchVersionBatches")
@@ -585,6 +592,7 @@ ACTOR static Future<Void> distributeWorkloadPerVersionBatch(Reference<RestoreCon
 	    .detail("RunningVersionBatches", self->runningVersionBatches.get());
 
 	self->runningVersionBatches.set(self->runningVersionBatches.get() + 1);
+	self->loadingVersionBatches.set(self->loadingVersionBatches.get() + 1);
 
 	// In case sampling data takes too much memory on controller
 	wait(isSchedulable(self, batchIndex, __FUNCTION__));
@@ -618,6 +626,10 @@ ACTOR static Future<Void> distributeWorkloadPerVersionBatch(Reference<RestoreCon
 	wait(sendMutationsFromLoaders(batchData, batchStatus, self->loadersInterf, batchIndex, false) &&
 	     sendMutationsFromLoaders(batchData, batchStatus, self->loadersInterf, batchIndex, true));
 
+	// Loaders have parsed this batch and shipped its mutations to appliers. Release the loader slot so the
+	// next version batch can start parsing while this batch waits for (and performs) its serialized apply.
+	self->loadingVersionBatches.set(self->loadingVersionBatches.get() - 1);
+
 	// Synchronization point for version batch pipelining.
 	// self->finishedBatch will continuously increase by 1 per version batch.
 	wait(notifyApplierToApplyMutations(batchData, batchStatus, self->appliersInterf, batchIndex, &self->finishedBatch));
@@ -31,6 +31,7 @@
 #include "fdbserver/RestoreRoleCommon.actor.h"
 #include "fdbserver/MutationTracking.h"
 #include "fdbserver/StorageMetrics.actor.h"
+#include "flow/CompressionUtils.h"
 
 #include "flow/actorcompiler.h" // This must be the last #include.
 
@@ -409,9 +410,22 @@ ACTOR static Future<Void> _parsePartitionedLogFileOnLoader(
 	state Arena tempArena;
 	state StringRefReader reader(buf, restore_corrupted_data());
 	try {
-		// Read block header
-		if (reader.consume<int32_t>() != PARTITIONED_MLOG_VERSION)
+		// Read block header; compressed blocks carry [rawLen][compressedLen][zstd payload] and
+		// are decompressed into the block buffer's arena before decoding
+		uint32_t blockVersion = reader.consume<uint32_t>();
+		if (blockVersion == COMPRESSED_PARTITIONED_MLOG_VERSION) {
+			CODE_PROBE(true, "Decoding compressed partitioned mutation log block");
+			uint32_t rawLen = reader.consume<uint32_t>();
+			uint32_t compressedLen = reader.consume<uint32_t>();
+			const uint8_t* compressedData = reader.consume(compressedLen);
+			StringRef decompressed = CompressionUtils::decompress(
+			    CompressionFilter::ZSTD, StringRef(compressedData, compressedLen), buf.arena());
+			if (decompressed.size() != rawLen)
+				throw restore_corrupted_data();
+			reader = StringRefReader(decompressed, restore_corrupted_data());
+		} else if (blockVersion != PARTITIONED_MLOG_VERSION) {
 			throw restore_unsupported_file_version();
+		}
 
 		state VersionedMutationsMap* kvOps = &kvOpsIter->second;
 		while (1) {
@@ -1113,6 +1127,39 @@ bool concatenateBackupMutationForLogFile(SerializedMutationListMap* pMutationMap
 	return concatenated;
 }
 
+// Decode an encoded_list_of_mutations ([type][kLen][vLen][key][value] repeated) in one batch pass.
+// The first pass walks only the length prefixes to count and validate the records; the second pass
+// materializes shallow MutationRefs that point into `val` and are only valid while it is alive.
+// Decoding in bulk keeps the hot parse loop free of per-mutation actor state-machine bookkeeping,
+// which is what dominates restore CPU on log-heavy backups.
+static Standalone<VectorRef<MutationRef>> decodeMutationList(StringRef val) {
+	Standalone<VectorRef<MutationRef>> mutations;
+
+	StringRefReader counter(val, restore_corrupted_data());
+	int count = 0;
+	while (!counter.eof()) {
+		counter.consume<uint32_t>(); // type
+		uint32_t kLen = counter.consume<uint32_t>();
+		uint32_t vLen = counter.consume<uint32_t>();
+		counter.consume(kLen);
+		counter.consume(vLen);
+		++count;
+	}
+	mutations.reserve(mutations.arena(), count);
+
+	StringRefReader reader(val, restore_corrupted_data());
+	while (!reader.eof()) {
+		uint32_t type = reader.consume<uint32_t>();
+		uint32_t kLen = reader.consume<uint32_t>();
+		uint32_t vLen = reader.consume<uint32_t>();
+		const uint8_t* k = reader.consume(kLen);
+		const uint8_t* v = reader.consume(vLen);
+		mutations.push_back(mutations.arena(),
+		                    MutationRef((MutationRef::Type)type, KeyRef(k, kLen), KeyRef(v, vLen)));
+	}
+	return mutations;
+}
+
 // Parse the kv pair (version, serialized_mutation), which are the results parsed from log file, into
 // (version, <K, V, mutationType>) pair;
 // Put the parsed versioned mutations into *pkvOps.
@@ -1161,20 +1208,17 @@ ACTOR Future<Void> _parseSerializedMutation(KeyRangeMap<Version>* pRangeVersions
 		uint32_t val_length_decoded = vReader.consume<uint32_t>();
 		ASSERT(val_length_decoded == val.size() - sizeof(uint64_t) - sizeof(uint32_t));
 
+		// Batch-decode the entire mutation list up front, then filter and stage the results. The
+		// decode pass is a tight loop over the serialized buffer; the loop below carries the actor
+		// machinery needed for decryption and yields periodically so a large block does not
+		// monopolize the loader's main loop.
+		state Standalone<VectorRef<MutationRef>> decoded =
+		    decodeMutationList(val.substr(sizeof(uint64_t) + sizeof(uint32_t)));
 		state int sub = 0;
-		loop {
-			// stop when reach the end of the string
-			if (vReader.eof()) { //|| *reader.rptr == 0xFF
-				break;
-			}
-
-			state uint32_t type = vReader.consume<uint32_t>();
-			state uint32_t kLen = vReader.consume<uint32_t>();
-			state uint32_t vLen = vReader.consume<uint32_t>();
-			state const uint8_t* k = vReader.consume(kLen);
-			state const uint8_t* v = vReader.consume(vLen);
-
-			state MutationRef mutation((MutationRef::Type)type, KeyRef(k, kLen), KeyRef(v, vLen));
+		state int mIdx = 0;
+		state MutationRef mutation;
+		for (; mIdx < decoded.size(); mIdx++) {
+			mutation = decoded[mIdx];
 			if (mutation.isEncrypted()) {
 				MutationRef decryptedMutation = wait(_decryptMutation(mutation, cx, &tempArena));
 				mutation = decryptedMutation;
@@ -1226,10 +1270,11 @@ ACTOR Future<Void> _parseSerializedMutation(KeyRangeMap<Version>* pRangeVersions
 						samples->push_back_deep(samples->arena(),
 						                        SampledMutation(mutation.param1, sampleInfo.sampledSize));
 					}
-					ASSERT_WE_THINK(kLen >= 0 && kLen < val.size());
-					ASSERT_WE_THINK(vLen >= 0 && vLen < val.size());
 				}
 			}
+			if ((mIdx + 1) % 1024 == 0) {
+				wait(yield());
+			}
 		}
 		mutationMapIterator++;
 	}
@@ -1298,6 +1343,11 @@ ACTOR static Future<Void> _parseRangeFileToMutationsOnLoader(
 		}
 	}
 
+	// Index blocks at the end of an indexed snapshot file decode to no KV pairs and restore nothing
+	if (blockData.empty()) {
+		return Void();
+	}
+
 	// First and last key are the range for this file
 	KeyRange fileRange = KeyRangeRef(blockData.front().key, blockData.back().key);
 
@@ -26,6 +26,7 @@
 #include <rocksdb/options.h>
 #include <rocksdb/slice.h>
 #include <rocksdb/slice_transform.h>
+#include <rocksdb/sst_file_reader.h>
 #include <rocksdb/types.h>
 #include <rocksdb/version.h>
 #endif // SSD_ROCKSDB_EXPERIMENTAL
@@ -614,6 +615,43 @@ bool RocksDBSstFileWriter::finish() {
 	}
 }
 
+// RocksDBSstFileReader iterates the key-value pairs of an sst file created by RocksDBSstFileWriter.
+class RocksDBSstFileReader : public IRocksDBSstFileReader {
+public:
+	RocksDBSstFileReader() : reader(std::make_unique<rocksdb::SstFileReader>(rocksdb::Options())) {}
+
+	void open(const std::string localFile) override;
+
+	bool hasNext() const override { return this->iter != nullptr && this->iter->Valid(); }
+
+	KeyValue next() override;
+
+private:
+	std::unique_ptr<rocksdb::SstFileReader> reader;
+	std::unique_ptr<rocksdb::Iterator> iter;
+	std::string localFile;
+};
+
+void RocksDBSstFileReader::open(const std::string localFile) {
+	this->localFile = abspath(localFile);
+	rocksdb::Status status = this->reader->Open(this->localFile);
+	if (!status.ok()) {
+		TraceEvent(SevError, "RocksDBSstFileReaderWrapperOpenFileError")
+		    .detail("LocalFile", this->localFile)
+		    .detail("Status", status.ToString());
+		throw failed_to_restore_checkpoint();
+	}
+	this->iter.reset(this->reader->NewIterator(rocksdb::ReadOptions()));
+	this->iter->SeekToFirst();
+}
+
+KeyValue RocksDBSstFileReader::next() {
+	ASSERT(hasNext());
+	KeyValue kv(KeyValueRef(toStringRef(this->iter->key()), toStringRef(this->iter->value())));
+	this->iter->Next();
+	return kv;
+}
+
 // RocksDBCFCheckpointReader reads an exported RocksDB Column Family checkpoint, and returns the serialized
 // checkpoint via nextChunk.
 class RocksDBCFCheckpointReader : public ICheckpointReader {
@@ -1115,6 +1153,14 @@ std::unique_ptr<IRocksDBSstFileWriter> newRocksDBSstFileWriter() {
 	return nullptr;
 }
 
+std::unique_ptr<IRocksDBSstFileReader> newRocksDBSstFileReader() {
+#ifdef SSD_ROCKSDB_EXPERIMENTAL
+	std::unique_ptr<IRocksDBSstFileReader> sstReader = std::make_unique<RocksDBSstFileReader>();
+	return sstReader;
+#endif // SSD_ROCKSDB_EXPERIMENTAL
+	return nullptr;
+}
+
 RocksDBColumnFamilyCheckpoint getRocksCF(const CheckpointMetaData& checkpoint) {
 	RocksDBColumnFamilyCheckpoint rocksCF;
 	ObjectReader reader(checkpoint.serializedCheckpoint.begin(), IncludeVersion());
@@ -20,18 +20,28 @@
 
 #include "fdbserver/ShardsAffectedByTeamFailure.h"
 
+namespace {
+// team_shards range vectors are sorted by begin key; two ranges for one team never share a
+// begin key, so begin is the identity of an entry (matching the ordering the flat set used).
+std::vector<KeyRange>::iterator rangePosition(std::vector<KeyRange>& ranges, KeyRef begin) {
+	return std::lower_bound(
+	    ranges.begin(), ranges.end(), begin, [](KeyRange const& r, KeyRef b) { return r.begin < b; });
+}
+std::vector<KeyRange>::const_iterator rangePosition(std::vector<KeyRange> const& ranges, KeyRef begin) {
+	return std::lower_bound(
+	    ranges.begin(), ranges.end(), begin, [](KeyRange const& r, KeyRef b) { return r.begin < b; });
+}
+} // namespace
+
 std::vector<KeyRange> ShardsAffectedByTeamFailure::getShardsFor(Team team) const {
-	std::vector<KeyRange> r;
-	for (auto it = team_shards.lower_bound(std::pair<Team, KeyRange>(team, KeyRangeRef()));
-	     it != team_shards.end() && it->first == team;
-	     ++it)
-		r.push_back(it->second);
-	return r;
+	auto it = team_shards.find(team);
+	if (it == team_shards.end())
+		return std::vector<KeyRange>();
+	return it->second;
 }
 
 bool ShardsAffectedByTeamFailure::hasShards(Team team) const {
-	auto it = team_shards.lower_bound(std::pair<Team, KeyRange>(team, KeyRangeRef()));
-	return it != team_shards.end() && it->first == team;
+	return team_shards.count(team) > 0;
 }
 
 int ShardsAffectedByTeamFailure::getNumberOfShards(UID ssID) const {
@@ -54,7 +64,15 @@ void ShardsAffectedByTeamFailure::erase(Team team, KeyRange const& range) {
 	DisabledTraceEvent(SevDebug, "ShardsAffectedByTeamFailureErase")
 	    .detail("Range", range)
 	    .detail("Team", team.toString());
-	if (team_shards.erase(std::pair<Team, KeyRange>(team, range)) > 0) {
+	auto it = team_shards.find(team);
+	if (it == team_shards.end())
+		return;
+	auto pos = rangePosition(it->second, range.begin);
+	if (pos != it->second.end() && pos->begin == range.begin) {
+		it->second.erase(pos);
+		if (it->second.empty()) {
+			team_shards.erase(it);
+		}
 		for (auto uid = team.servers.begin(); uid != team.servers.end(); ++uid) {
 			// Safeguard against going negative after eraseServer() sets value to 0
 			if (storageServerShards[*uid] > 0) {
@@ -68,12 +86,23 @@ void ShardsAffectedByTeamFailure::insert(Team team, KeyRange const& range) {
 	DisabledTraceEvent(SevDebug, "ShardsAffectedByTeamFailureInsert")
 	    .detail("Range", range)
 	    .detail("Team", team.toString());
-	if (team_shards.insert(std::pair<Team, KeyRange>(team, range)).second) {
+	auto& ranges = team_shards[team];
+	auto pos = rangePosition(ranges, range.begin);
+	if (pos == ranges.end() || pos->begin != range.begin) {
+		ranges.insert(pos, range);
 		for (auto uid = team.servers.begin(); uid != team.servers.end(); ++uid)
 			storageServerShards[*uid]++;
 	}
 }
 
+bool ShardsAffectedByTeamFailure::hasShard(Team const& team, KeyRange const& range) const {
+	auto it = team_shards.find(team);
+	if (it == team_shards.end())
+		return false;
+	auto pos = rangePosition(it->second, range.begin);
+	return pos != it->second.end() && pos->begin == range.begin;
+}
+
 void ShardsAffectedByTeamFailure::defineShard(KeyRangeRef keys) {
 	std::vector<Team> teams;
 	std::vector<Team> prevTeams;
@@ -192,22 +221,26 @@ void ShardsAffectedByTeamFailure::check() const {
 		return;
 	if (EXPENSIVE_VALIDATION || checkMode == CheckMode::ForceCheck) {
 		for (auto t = team_shards.begin(); t != team_shards.end(); ++t) {
-			auto i = shard_teams.rangeContaining(t->second.begin);
-			if (i->range() != t->second || !std::count(i->value().first.begin(), i->value().first.end(), t->first)) {
-				ASSERT(false);
+			for (auto const& range : t->second) {
+				auto i = shard_teams.rangeContaining(range.begin);
+				if (i->range() != range ||
+				    !std::count(i->value().first.begin(), i->value().first.end(), t->first)) {
+					ASSERT(false);
+				}
 			}
 		}
 		auto rs = shard_teams.ranges();
 		for (auto i = rs.begin(); i != rs.end(); ++i) {
 			for (auto t = i->value().first.begin(); t != i->value().first.end(); ++t) {
-				if (!team_shards.count(std::make_pair(*t, i->range()))) {
+				if (!hasShard(*t, i->range())) {
 					std::string teamDesc, shards;
 					for (int k = 0; k < t->servers.size(); k++)
 						teamDesc += format("%llx ", t->servers[k].first());
-					for (auto x = team_shards.lower_bound(std::make_pair(*t, KeyRangeRef()));
-					     x != team_shards.end() && x->first == *t;
-					     ++x)
-						shards += printable(x->second.begin) + "-" + printable(x->second.end) + ",";
+					auto x = team_shards.find(*t);
+					if (x != team_shards.end()) {
+						for (auto const& range : x->second)
+							shards += printable(range.begin) + "-" + printable(range.end) + ",";
+					}
 					TraceEvent(SevError, "SATFInvariantError2")
 					    .detail("KB", i->begin())
 					    .detail("KE", i->end())
@@ -2609,6 +2609,18 @@ bool rocksDBEnabled = false;
 
 } // namespace
 
+// Entry point for a simulation run: boots a fresh simulated cluster (or, when `rebooting`
+// is set, restores one from the disk state a previous run left behind via restartInfo.ini
+// and the per-machine data folders) and then drives the test file against it.
+//
+// Note on amortizing cluster genesis: the only supported way to branch many test runs off
+// one boot is through the restarting-test mechanism (`rebooting` + restartSimulatedSystem),
+// which snapshots exactly the durable state -- IKeyValueStore files, coordinator state and
+// the cluster file. A full in-memory fork of a booted simulation is not possible: live
+// simulator state is held in actor coroutine frames on the native heap, so it can neither
+// be copied nor serialized, and the deterministic RNG and virtual clock are global to the
+// process. Tests that want to skip genesis should therefore be written as the second half
+// of a restarting test pair.
 ACTOR void setupAndRun(std::string dataFolder,
                        const char* testFile,
                        bool rebooting,
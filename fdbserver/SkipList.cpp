@@ -31,6 +31,7 @@
 #include "fdbrpc/PerfMetric.h"
 #include "fdbclient/FDBTypes.h"
 #include "fdbclient/KeyRangeMap.h"
+#include "fdbclient/ServerKnobs.h"
 #include "fdbclient/SystemData.h"
 #include "fdbserver/ConflictSet.h"
 
@@ -309,11 +310,12 @@ private:
 	};
 
 	static force_inline bool less(const uint8_t* a, int aLen, const uint8_t* b, int bLen) {
-		int c = memcmp(a, b, std::min(aLen, bLen));
-		if (c < 0)
-			return true;
-		if (c > 0)
-			return false;
+		// commonPrefixLength compares 16 bytes per step with SIMD equality masks, which beats a memcmp call
+		// on the short, already-packed node keys this comparator sees.
+		int cl = std::min(aLen, bLen);
+		int i = commonPrefixLength(a, b, cl);
+		if (i < cl)
+			return a[i] < b[i];
 		return aLen < bLen;
 	}
 
@@ -783,11 +785,40 @@ private:
 };
 
 struct ConflictSet {
-	ConflictSet() : removalKey(makeString(0)), oldestVersion(0) {}
+	// The version history is sharded into RESOLVER_CONFLICT_SET_SHARDS disjoint key-range parts so that each
+	// skip list stays smaller (and therefore shallower) and the per-part work is independent.  Part p owns keys
+	// in [partBegins[p], partBegins[p+1]); shard boundaries are single-byte keys so routing only looks at the
+	// first byte.  With one part this is exactly the historical single skip list.
+	ConflictSet() : oldestVersion(0) {
+		int shards = std::max(1, SERVER_KNOBS->RESOLVER_CONFLICT_SET_SHARDS);
+		parts.reserve(shards);
+		for (int p = 0; p < shards; p++) {
+			parts.emplace_back();
+			partBegins.push_back(p == 0 ? Key() : Key(StringRef(std::string(1, char((p * 256) / shards)))));
+			removalKeys.push_back(makeString(0));
+		}
+	}
 	~ConflictSet() {}
 
-	SkipList versionHistory;
-	Key removalKey;
+	// The part owning the given key.
+	int partContaining(StringRef key) const {
+		for (int p = parts.size() - 1; p > 0; p--)
+			if (partBegins[p] <= key)
+				return p;
+		return 0;
+	}
+
+	// The part owning the last key strictly before the given exclusive range end.
+	int partContainingEnd(StringRef end) const {
+		for (int p = parts.size() - 1; p > 0; p--)
+			if (partBegins[p] < end)
+				return p;
+		return 0;
+	}
+
+	std::vector<SkipList> parts;
+	std::vector<Key> partBegins;
+	std::vector<Key> removalKeys;
 	Version oldestVersion;
 };
 
@@ -795,7 +826,10 @@ ConflictSet* newConflictSet() {
 	return new ConflictSet;
 }
 void clearConflictSet(ConflictSet* cs, Version v) {
-	SkipList(v).swap(cs->versionHistory);
+	for (int p = 0; p < cs->parts.size(); p++) {
+		SkipList(v).swap(cs->parts[p]);
+		cs->removalKeys[p] = makeString(0);
+	}
 }
 void destroyConflictSet(ConflictSet* cs) {
 	delete cs;
@@ -912,6 +946,9 @@ void ConflictBatch::detectConflicts(Version now,
                                     std::vector<int>* tooOldTransactions) {
 	double t = timer();
 	sortPoints(points);
+	// Probe the skip list in key order: neighboring probes then revisit the same upper-level nodes, so the
+	// cache misses of one descent are amortized across the whole batch.
+	std::sort(combinedReadConflictRanges.begin(), combinedReadConflictRanges.end());
 	g_sort += timer() - t;
 
 	transactionConflictStatus = new bool[transactionCount];
@@ -946,11 +983,14 @@ void ConflictBatch::detectConflicts(Version now,
 	t = timer();
 	if (newOldestVersion > cs->oldestVersion) {
 		cs->oldestVersion = newOldestVersion;
-		SkipList::Finger finger;
-		int temp;
-		cs->versionHistory.find(&cs->removalKey, &finger, &temp, 1);
-		cs->versionHistory.removeBefore(cs->oldestVersion, finger, combinedWriteConflictRanges.size() * 3 + 10);
-		cs->removalKey = finger.getValue();
+		for (int p = 0; p < cs->parts.size(); p++) {
+			SkipList::Finger finger;
+			int temp;
+			cs->parts[p].find(&cs->removalKeys[p], &finger, &temp, 1);
+			cs->parts[p].removeBefore(
+			    cs->oldestVersion, finger, combinedWriteConflictRanges.size() * 3 / cs->parts.size() + 10);
+			cs->removalKeys[p] = finger.getValue();
+		}
 	}
 	g_removeBefore += timer() - t;
 }
@@ -959,8 +999,39 @@ void ConflictBatch::checkReadConflictRanges() {
 	if (combinedReadConflictRanges.empty())
 		return;
 
-	cs->versionHistory.detectConflicts(
-	    &combinedReadConflictRanges[0], combinedReadConflictRanges.size(), transactionConflictStatus);
+	if (cs->parts.size() == 1) {
+		cs->parts[0].detectConflicts(
+		    &combinedReadConflictRanges[0], combinedReadConflictRanges.size(), transactionConflictStatus);
+		return;
+	}
+
+	// Clip each read range to the parts it intersects.  Per-part ranges stay sorted by begin key because
+	// combinedReadConflictRanges is, and clipping preserves the relative order of begin keys.
+	std::vector<std::vector<ReadConflictRange>> partRanges(cs->parts.size());
+	for (const ReadConflictRange& r : combinedReadConflictRanges) {
+		int pBegin = cs->partContaining(r.begin);
+		int pEnd = cs->partContainingEnd(r.end);
+		for (int p = pBegin; p <= pEnd; p++) {
+			partRanges[p].emplace_back(p == pBegin ? r.begin : StringRef(cs->partBegins[p]),
+			                           p == pEnd ? r.end : StringRef(cs->partBegins[p + 1]),
+			                           r.version,
+			                           r.transaction,
+			                           r.indexInTx,
+			                           r.conflictingKeyRange,
+			                           r.cKRArena);
+		}
+	}
+	for (int p = 0; p < cs->parts.size(); p++)
+		if (!partRanges[p].empty())
+			cs->parts[p].detectConflicts(&partRanges[p][0], partRanges[p].size(), transactionConflictStatus);
+
+	// A range clipped into several parts can conflict in more than one of them; report each range at most once.
+	if (conflictingKeyRangeMap) {
+		for (auto& [t, ranges] : *conflictingKeyRangeMap) {
+			std::sort(ranges.begin(), ranges.end());
+			ranges.resize(*resolveBatchReplyArena, std::unique(ranges.begin(), ranges.end()) - ranges.begin());
+		}
+	}
 }
 
 void ConflictBatch::addConflictRanges(Version now,
@@ -990,7 +1061,23 @@ void ConflictBatch::mergeWriteConflictRanges(Version now) {
 	if (combinedWriteConflictRanges.empty())
 		return;
 
-	addConflictRanges(now, combinedWriteConflictRanges.begin(), combinedWriteConflictRanges.end(), &cs->versionHistory);
+	if (cs->parts.size() == 1) {
+		addConflictRanges(now, combinedWriteConflictRanges.begin(), combinedWriteConflictRanges.end(), &cs->parts[0]);
+		return;
+	}
+
+	std::vector<std::vector<std::pair<StringRef, StringRef>>> partRanges(cs->parts.size());
+	for (const auto& range : combinedWriteConflictRanges) {
+		int pBegin = cs->partContaining(range.first);
+		int pEnd = cs->partContainingEnd(range.second);
+		for (int p = pBegin; p <= pEnd; p++) {
+			partRanges[p].emplace_back(p == pBegin ? range.first : StringRef(cs->partBegins[p]),
+			                           p == pEnd ? range.second : StringRef(cs->partBegins[p + 1]));
+		}
+	}
+	for (int p = 0; p < cs->parts.size(); p++)
+		if (!partRanges[p].empty())
+			addConflictRanges(now, partRanges[p].begin(), partRanges[p].end(), &cs->parts[p]);
 }
 
 void ConflictBatch::combineWriteConflictRanges() {
@@ -1173,5 +1260,8 @@ void skipListTest() {
 		printf("%20s: %s\n", counter->getMetric().name().c_str(), counter->getMetric().formatted().c_str());
 	}
 
-	printf("%d entries in version history\n", cs->versionHistory.count());
+	int historyCount = 0;
+	for (const auto& part : cs->parts)
+		historyCount += part.count();
+	printf("%d entries in version history\n", historyCount);
 }
@@ -19,6 +19,7 @@
  */
 
 #include <cinttypes>
+#include "fdbrpc/DDSketch.h"
 #include "fdbclient/BlobGranuleCommon.h"
 #include "fdbserver/BlobGranuleServerCommon.actor.h"
 #include "fmt/format.h"
@@ -107,15 +108,16 @@ extern int limitReasonEnd;
 extern const char* limitReasonName[];
 extern const char* limitReasonDesc[];
 
-typedef std::map<std::string, TraceEventFields> EventMap;
-
-struct StorageServerStatusInfo : public StorageServerInterface {
-	Optional<StorageMetadataType> metadata;
-	EventMap eventMap;
-	StorageServerStatusInfo(const StorageServerInterface& interface,
-	                        Optional<StorageMetadataType> metadata = Optional<StorageMetadataType>())
-	  : StorageServerInterface(interface), metadata(metadata) {}
-};
+// Runs a section gather and stores the successful result in the status section cache, so later status
+// requests within the section's TTL can reuse it
+ACTOR template <class T>
+Future<ErrorOr<T>> storeStatusSection(StatusSectionCache::Section<ErrorOr<T>>* section, Future<ErrorOr<T>> gather) {
+	ErrorOr<T> result = wait(gather);
+	if (result.present()) {
+		section->set(result);
+	}
+	return result;
+}
 
 ACTOR static Future<Optional<TraceEventFields>> latestEventOnWorker(WorkerInterface worker, std::string eventName) {
 	try {
@@ -771,7 +773,8 @@ ACTOR static Future<JsonBuilderObject> processStatusFetcher(
     Database cx,
     Optional<DatabaseConfiguration> configuration,
     Optional<Key> healthyZone,
-    std::set<std::string>* incomplete_reasons) {
+    std::set<std::string>* incomplete_reasons,
+    StatusSectionCache* sectionCache) {
 
 	state JsonBuilderObject processMap;
 
@@ -931,6 +934,12 @@ ACTOR static Future<JsonBuilderObject> processStatusFetcher(
 	for (workerItr = workers.begin(); workerItr != workers.end(); ++workerItr) {
 		wait(yield());
 		state JsonBuilderObject statusObj;
+		if (sectionCache && sectionCache->lastProcessEntrySize > 0) {
+			// Process entries dominate the status document; building one in a
+			// right-sized buffer avoids the growth copies that otherwise stay
+			// allocated in the builder arena for the life of the document.
+			statusObj.reserve(sectionCache->lastProcessEntrySize);
+		}
 		try {
 			ASSERT(pMetrics.count(workerItr->interf.address()));
 
@@ -1123,6 +1132,9 @@ ACTOR static Future<JsonBuilderObject> processStatusFetcher(
 
 		processMap[printable(workerItr->interf.locality.processId())] = statusObj;
 	}
+	if (sectionCache && processMap.size() > 0) {
+		sectionCache->lastProcessEntrySize = processMap.getFinalLength() / processMap.size();
+	}
 	return processMap;
 }
 
@@ -1347,6 +1359,82 @@ ACTOR static Future<double> doCommitProbe(Future<double> grvProbe, Transaction*
 	}
 }
 
+// Continuous synthetic-client probe (LATENCY_PROBE_INTERVAL). The one-shot probes
+// above measure a single transaction per status request, which says little about
+// tail latency. When enabled, a low-rate loop issues GRV + point read + small commit
+// through the real client stack on the cluster controller and accumulates DDSketch
+// distributions over a sliding window, published as the "continuous" object inside
+// latency_probe so SLO percentiles can be read straight from status.
+namespace {
+
+struct ContinuousProbeStats {
+	DDSketch<double> grv;
+	DDSketch<double> read;
+	DDSketch<double> commit;
+	double windowStart = 0;
+	Future<Void> runner;
+
+	void reset(double now) {
+		grv = DDSketch<double>();
+		read = DDSketch<double>();
+		commit = DDSketch<double>();
+		windowStart = now;
+	}
+
+	static JsonBuilderObject sketchToJson(DDSketch<double>& sketch) {
+		JsonBuilderObject obj;
+		obj["count"] = (int64_t)sketch.getPopulationSize();
+		if (sketch.getPopulationSize() > 0) {
+			obj["p50_seconds"] = sketch.percentile(0.5);
+			obj["p95_seconds"] = sketch.percentile(0.95);
+			obj["p99_seconds"] = sketch.percentile(0.99);
+			obj["max_seconds"] = sketch.max();
+		}
+		return obj;
+	}
+
+	JsonBuilderObject toJson() {
+		JsonBuilderObject obj;
+		obj["window_seconds"] = now() - windowStart;
+		obj["transaction_start"] = sketchToJson(grv);
+		obj["read"] = sketchToJson(read);
+		obj["commit"] = sketchToJson(commit);
+		return obj;
+	}
+};
+
+ContinuousProbeStats g_continuousProbe;
+
+} // namespace
+
+ACTOR static Future<Void> continuousLatencyProbeLoop(Database cx) {
+	loop {
+		wait(delayJittered(SERVER_KNOBS->LATENCY_PROBE_INTERVAL));
+		if (now() - g_continuousProbe.windowStart > SERVER_KNOBS->LATENCY_PROBE_WINDOW) {
+			g_continuousProbe.reset(now());
+		}
+
+		state Transaction trProbe(cx);
+		state Transaction trWrite(cx);
+		try {
+			state double grvLatency = wait(timeoutError(doGrvProbe(&trProbe), 5.0));
+			g_continuousProbe.grv.addSample(grvLatency);
+
+			double readLatency = wait(timeoutError(doReadProbe(Future<double>(grvLatency), &trProbe), 5.0));
+			g_continuousProbe.read.addSample(readLatency);
+
+			double commitLatency =
+			    wait(timeoutError(doCommitProbe(Future<double>(grvLatency), &trProbe, &trWrite), 5.0));
+			g_continuousProbe.commit.addSample(commitLatency);
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			TraceEvent(SevWarn, "ContinuousLatencyProbeError").errorUnsuppressed(e).suppressFor(10.0);
+		}
+	}
+}
+
 ACTOR static Future<Void> doProbe(Future<double> probe,
                                   int timeoutSeconds,
                                   const char* prefix,
@@ -1391,6 +1479,14 @@ ACTOR static Future<JsonBuilderObject> latencyProbeFetcher(Database cx,
 
 	state JsonBuilderObject statusObj;
 
+	if (SERVER_KNOBS->LATENCY_PROBE_INTERVAL > 0) {
+		if (!g_continuousProbe.runner.isValid()) {
+			g_continuousProbe.reset(now());
+			g_continuousProbe.runner = continuousLatencyProbeLoop(cx);
+		}
+		statusObj["continuous"] = g_continuousProbe.toJson();
+	}
+
 	try {
 		Future<double> immediateGrvProbe = doGrvProbe(&trImmediate, FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
 		Future<double> defaultGrvProbe = doGrvProbe(&trDefault);
@@ -3013,6 +3109,35 @@ ACTOR Future<Optional<Value>> consistencyScanInfoFetcher(Database cx) {
 }
 
 // constructs the cluster section of the json status output
+StatusReply statusSummaryReply(StatusReply const& full) {
+	json_spirit::mValue mv;
+	// Like StatusReply deserialization, tolerate parse errors outside simulation
+	// because some status data is better than no status data
+	if (g_network->isSimulated()) {
+		mv = readJSONStrictly(full.statusStr);
+	} else {
+		json_spirit::read_string(full.statusStr, mv);
+	}
+	StatusObject summary;
+	if (mv.type() == json_spirit::obj_type) {
+		StatusObject const& fullObj = mv.get_obj();
+		for (const char* field : { "recovery_state",
+		                           "messages",
+		                           "fault_tolerance",
+		                           "database_available",
+		                           "database_lock_state",
+		                           "degraded_processes",
+		                           "full_replication",
+		                           "cluster_controller_timestamp" }) {
+			auto it = fullObj.find(field);
+			if (it != fullObj.end()) {
+				summary[field] = it->second;
+			}
+		}
+	}
+	return StatusReply(summary);
+}
+
 ACTOR Future<StatusReply> clusterGetStatus(
     Reference<AsyncVar<ServerDBInfo>> db,
     Database cx,
@@ -3024,7 +3149,8 @@ ACTOR Future<StatusReply> clusterGetStatus(
     Version datacenterVersionDifference,
     ConfigBroadcaster const* configBroadcaster,
     Optional<MetaclusterRegistrationEntry> metaclusterRegistration,
-    MetaclusterMetrics metaclusterMetrics) {
+    MetaclusterMetrics metaclusterMetrics,
+    StatusSectionCache* sectionCache) {
 	state double tStart = timer();
 
 	state JsonBuilderArray messages;
@@ -3096,17 +3222,24 @@ ACTOR Future<StatusReply> clusterGetStatus(
 		// Get latest events for various event types from ALL workers
 		// WorkerEvents is a map of worker's NetworkAddress to its event string
 		// The pair represents worker responses and a set of worker NetworkAddress strings which did not respond.
-		std::vector<Future<Optional<std::pair<WorkerEvents, std::set<std::string>>>>> futures;
-		futures.push_back(latestEventOnWorkers(workers, "MachineMetrics"));
-		futures.push_back(latestEventOnWorkers(workers, "ProcessMetrics"));
-		futures.push_back(latestEventOnWorkers(workers, "NetworkMetrics"));
-		futures.push_back(latestErrorOnWorkers(workers)); // Get all latest errors.
-		futures.push_back(latestEventOnWorkers(workers, "TraceFileOpenError"));
-		futures.push_back(latestEventOnWorkers(workers, "ProgramStart"));
-
-		// Wait for all response pairs.
-		state std::vector<Optional<std::pair<WorkerEvents, std::set<std::string>>>> workerEventsVec =
-		    wait(getAll(futures));
+		state std::vector<Optional<std::pair<WorkerEvents, std::set<std::string>>>> workerEventsVec;
+		if (sectionCache && sectionCache->workerEvents.fresh(SERVER_KNOBS->STATUS_WORKER_EVENTS_TTL)) {
+			workerEventsVec = sectionCache->workerEvents.data;
+		} else {
+			std::vector<Future<Optional<std::pair<WorkerEvents, std::set<std::string>>>>> futures;
+			futures.push_back(latestEventOnWorkers(workers, "MachineMetrics"));
+			futures.push_back(latestEventOnWorkers(workers, "ProcessMetrics"));
+			futures.push_back(latestEventOnWorkers(workers, "NetworkMetrics"));
+			futures.push_back(latestErrorOnWorkers(workers)); // Get all latest errors.
+			futures.push_back(latestEventOnWorkers(workers, "TraceFileOpenError"));
+			futures.push_back(latestEventOnWorkers(workers, "ProgramStart"));
+
+			// Wait for all response pairs.
+			wait(store(workerEventsVec, getAll(futures)));
+			if (sectionCache) {
+				sectionCache->workerEvents.set(workerEventsVec);
+			}
+		}
 
 		// Create a unique set of all workers who were unreachable for 1 or more of the event requests above.
 		// Since each event request is independent and to all workers, workers can have responded to some
@@ -3249,14 +3382,42 @@ ACTOR Future<StatusReply> clusterGetStatus(
 				address_workers[worker.interf.address()] = worker.interf;
 			}
 
-			state Future<ErrorOr<std::vector<StorageServerStatusInfo>>> storageServerFuture =
-			    errorOr(getStorageServerStatusInfos(cx, address_workers, rkWorker));
-			state Future<ErrorOr<std::vector<std::pair<TLogInterface, EventMap>>>> tLogFuture =
-			    errorOr(getTLogsAndMetrics(db, address_workers));
-			state Future<ErrorOr<std::vector<std::pair<CommitProxyInterface, EventMap>>>> commitProxyFuture =
-			    errorOr(getCommitProxiesAndMetrics(db, address_workers));
-			state Future<ErrorOr<std::vector<std::pair<GrvProxyInterface, EventMap>>>> grvProxyFuture =
-			    errorOr(getGrvProxiesAndMetrics(db, address_workers));
+			state Future<ErrorOr<std::vector<StorageServerStatusInfo>>> storageServerFuture;
+			if (sectionCache && sectionCache->storageServers.fresh(SERVER_KNOBS->STATUS_STORAGE_METRICS_TTL)) {
+				storageServerFuture = sectionCache->storageServers.data;
+			} else {
+				storageServerFuture = errorOr(getStorageServerStatusInfos(cx, address_workers, rkWorker));
+				if (sectionCache) {
+					storageServerFuture = storeStatusSection(&sectionCache->storageServers, storageServerFuture);
+				}
+			}
+			state Future<ErrorOr<std::vector<std::pair<TLogInterface, EventMap>>>> tLogFuture;
+			if (sectionCache && sectionCache->tLogs.fresh(SERVER_KNOBS->STATUS_LOG_METRICS_TTL)) {
+				tLogFuture = sectionCache->tLogs.data;
+			} else {
+				tLogFuture = errorOr(getTLogsAndMetrics(db, address_workers));
+				if (sectionCache) {
+					tLogFuture = storeStatusSection(&sectionCache->tLogs, tLogFuture);
+				}
+			}
+			state Future<ErrorOr<std::vector<std::pair<CommitProxyInterface, EventMap>>>> commitProxyFuture;
+			if (sectionCache && sectionCache->commitProxies.fresh(SERVER_KNOBS->STATUS_PROXY_METRICS_TTL)) {
+				commitProxyFuture = sectionCache->commitProxies.data;
+			} else {
+				commitProxyFuture = errorOr(getCommitProxiesAndMetrics(db, address_workers));
+				if (sectionCache) {
+					commitProxyFuture = storeStatusSection(&sectionCache->commitProxies, commitProxyFuture);
+				}
+			}
+			state Future<ErrorOr<std::vector<std::pair<GrvProxyInterface, EventMap>>>> grvProxyFuture;
+			if (sectionCache && sectionCache->grvProxies.fresh(SERVER_KNOBS->STATUS_PROXY_METRICS_TTL)) {
+				grvProxyFuture = sectionCache->grvProxies.data;
+			} else {
+				grvProxyFuture = errorOr(getGrvProxiesAndMetrics(db, address_workers));
+				if (sectionCache) {
+					grvProxyFuture = storeStatusSection(&sectionCache->grvProxies, grvProxyFuture);
+				}
+			}
 			state Future<ErrorOr<std::vector<BlobWorkerInterface>>> blobWorkersFuture;
 
 			if (configuration.present() && configuration.get().blobGranulesEnabled) {
@@ -3482,7 +3643,8 @@ ACTOR Future<StatusReply> clusterGetStatus(
 		                              cx,
 		                              configuration,
 		                              loadResult.present() ? loadResult.get().healthyZone : Optional<Key>(),
-		                              &status_incomplete_reasons));
+		                              &status_incomplete_reasons,
+		                              sectionCache));
 		statusObj["processes"] = processStatus;
 		statusObj["clients"] = clientStatusFetcher(clientStatus);
 
@@ -570,8 +570,23 @@ void TransientStorageMetricSample::erase(KeyRangeRef keys) {
 	sample.erase(keys.begin, keys.end);
 }
 
-bool TransientStorageMetricSample::roll(int64_t metric) const {
-	return deterministicRandom()->random01() < (double)metric / metricUnitsPerSample; //< SOMEDAY: Better randomInt64?
+bool TransientStorageMetricSample::roll(int64_t metric, int64_t unitsPerSample) const {
+	return deterministicRandom()->random01() < (double)metric / unitsPerSample; //< SOMEDAY: Better randomInt64?
+}
+
+// The granularity at which metrics are currently admitted to the sample. With no target size this
+// is the fixed metricUnitsPerSample. With a target, granularity scales with the sample's occupancy:
+// while the sample is far below target, the (necessarily few) ranges that are receiving traffic are
+// sampled more finely, which gives split-point estimation over hot shards more points to work with;
+// as the sample fills toward its target the granularity coarsens again so that total sample memory
+// stays bounded. Varying the granularity between adds is safe because each queued add records the
+// exact delta it contributed, so expiration always removes what was added.
+int64_t TransientStorageMetricSample::effectiveUnitsPerSample() const {
+	if (targetSampleSize <= 0)
+		return metricUnitsPerSample;
+	double occupancy = (double)queue.size() / targetSampleSize;
+	double scale = std::max(occupancy, 1.0 / std::max(1.0, SERVER_KNOBS->TRANSIENT_SAMPLE_MAX_DENSITY_FACTOR));
+	return std::max<int64_t>(1, metricUnitsPerSample * scale);
 }
 
 void TransientStorageMetricSample::poll(KeyRangeMap<std::vector<PromiseStream<StorageMetrics>>>& waitMap,
@@ -617,10 +632,12 @@ int64_t TransientStorageMetricSample::add(const Key& key, int64_t metric) {
 		return 0;
 	int64_t mag = metric < 0 ? -metric : metric;
 
-	if (mag < metricUnitsPerSample) {
-		if (!roll(mag))
+	int64_t unitsPerSample = effectiveUnitsPerSample();
+	if (mag < unitsPerSample) {
+		if (!roll(mag, unitsPerSample))
 			return 0;
-		metric = metric < 0 ? -metricUnitsPerSample : metricUnitsPerSample;
+		CODE_PROBE(unitsPerSample < metricUnitsPerSample, "Metric sampled at adaptively increased density");
+		metric = metric < 0 ? -unitsPerSample : unitsPerSample;
 	}
 
 	auto [m, it] = sample.addMetric(key, metric);
@@ -648,6 +665,30 @@ TEST_CASE("/fdbserver/StorageMetricSample/simple") {
 	return Void();
 }
 
+TEST_CASE("/fdbserver/StorageMetricSample/adaptiveDensity") {
+	int64_t units = 1000;
+	int64_t target = 100;
+	TransientStorageMetricSample s(units, target);
+
+	// While the sample is empty, metrics are admitted at a granularity no coarser than the default
+	ASSERT_GE(s.effectiveUnitsPerSample(), 1);
+	ASSERT_LE(s.effectiveUnitsPerSample(), units);
+
+	// Fill past the target; the granularity must coarsen back to at least the default
+	double expire = now() + 3600.0;
+	for (int i = 0; i < 1e6 && (int64_t)s.queue.size() < 2 * target; i++) {
+		s.addAndExpire(Key(deterministicRandom()->randomUniqueID().toString()), units / 10, expire);
+	}
+	ASSERT_GE((int64_t)s.queue.size(), 2 * target);
+	ASSERT_GE(s.effectiveUnitsPerSample(), units);
+
+	// A sample without a target keeps the fixed granularity
+	TransientStorageMetricSample fixed(units);
+	ASSERT_EQ(fixed.effectiveUnitsPerSample(), units);
+
+	return Void();
+}
+
 TEST_CASE("/fdbserver/StorageMetricSample/rangeSplitPoints/simple") {
 
 	int64_t sampleUnit = SERVER_KNOBS->BYTES_READ_UNITS_PER_SAMPLE;
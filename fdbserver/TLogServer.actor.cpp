@@ -43,6 +43,7 @@
 #include "fdbserver/WaitFailure.h"
 #include "fdbserver/RecoveryState.h"
 #include "fdbserver/FDBExecHelper.actor.h"
+#include "flow/CompressionUtils.h"
 #include "flow/Histogram.h"
 #include "flow/DebugTrace.h"
 #include "flow/genericactors.actor.h"
@@ -397,9 +398,215 @@ struct TLogData : NonCopyable {
 	}
 };
 
+// A memory-compact replacement for the std::deque<std::pair<Version, LengthPrefixedStringRef>>
+// per-tag message index.  Entries are grouped into fixed-count chunks; the first entry of each
+// chunk is stored explicitly and the rest as variable-length deltas of the version and of the
+// message pointer, which brings the per-message index footprint from 16+ bytes down to a few
+// bytes for the common case of small version gaps and messages adjacent in the message blocks.
+// Supports exactly the operations the tlog performs on the index: append at the back in version
+// order, pop at the front, forward iteration, and version lower/upper bound searches.
+struct VersionMessagesIndex {
+	struct Entry {
+		Version first = 0;
+		LengthPrefixedStringRef second;
+	};
+
+private:
+	constexpr static int ENTRIES_PER_CHUNK = 128;
+
+	struct Chunk {
+		Version firstVersion = 0;
+		Version lastVersion = 0;
+		uint64_t firstPtr = 0;
+		int count = 0;
+		std::string bytes; // delta-encoded entries after the first
+	};
+
+	std::deque<Chunk> chunks;
+	int frontSkip = 0; // entries logically popped from the front chunk
+	size_t frontOffset = 0; // decode offset just past the front entry within the front chunk
+	Entry frontEntry; // decoded front entry, valid when !empty()
+	uint64_t lastPtr = 0;
+	int64_t totalCount = 0;
+	int64_t totalBytes = 0;
+
+	static void putVarint(std::string& out, uint64_t v) {
+		while (v >= 0x80) {
+			out.push_back(char((v & 0x7f) | 0x80));
+			v >>= 7;
+		}
+		out.push_back(char(v));
+	}
+	static uint64_t getVarint(const std::string& in, size_t& offset) {
+		uint64_t v = 0;
+		int shift = 0;
+		uint8_t b;
+		do {
+			b = uint8_t(in[offset++]);
+			v |= uint64_t(b & 0x7f) << shift;
+			shift += 7;
+		} while (b & 0x80);
+		return v;
+	}
+	static uint64_t zigzag(int64_t v) { return (uint64_t(v) << 1) ^ uint64_t(v >> 63); }
+	static int64_t unzigzag(uint64_t v) { return int64_t(v >> 1) ^ -int64_t(v & 1); }
+
+	static void decodeNext(Chunk const& c, size_t& offset, Entry& e) {
+		e.first += Version(getVarint(c.bytes, offset));
+		uint64_t p = uint64_t(e.second.getLengthPtr()) + unzigzag(getVarint(c.bytes, offset));
+		e.second = LengthPrefixedStringRef((uint32_t*)p);
+	}
+
+	static Entry firstEntry(Chunk const& c) {
+		Entry e;
+		e.first = c.firstVersion;
+		e.second = LengthPrefixedStringRef((uint32_t*)c.firstPtr);
+		return e;
+	}
+
+public:
+	// A forward iterator.  Invalidated by pop_front, but appending is safe: entries added behind
+	// the iterator simply become visible to it.
+	struct iterator {
+		VersionMessagesIndex const* index = nullptr;
+		int chunkIdx = 0;
+		int entryIdx = 0; // within chunk
+		size_t offset = 0; // decode offset just past the current entry
+		Entry entry;
+
+		bool operator==(iterator const& r) const { return chunkIdx == r.chunkIdx && entryIdx == r.entryIdx; }
+		bool operator!=(iterator const& r) const { return !(*this == r); }
+		Entry const& operator*() const { return entry; }
+		Entry const* operator->() const { return &entry; }
+		iterator& operator++() {
+			Chunk const& c = index->chunks[chunkIdx];
+			if (++entryIdx == c.count) {
+				++chunkIdx;
+				entryIdx = 0;
+				offset = 0;
+				if (chunkIdx < (int)index->chunks.size()) {
+					entry = firstEntry(index->chunks[chunkIdx]);
+				}
+			} else {
+				decodeNext(c, offset, entry);
+			}
+			return *this;
+		}
+	};
+
+	int64_t size() const { return totalCount; }
+	bool empty() const { return totalCount == 0; }
+
+	// The number of bytes used by the index itself, for memory accounting
+	int64_t indexBytes() const { return totalBytes; }
+
+	Entry const& front() const {
+		ASSERT(totalCount > 0);
+		return frontEntry;
+	}
+
+	Entry back() const {
+		ASSERT(totalCount > 0);
+		Entry e;
+		e.first = chunks.back().lastVersion;
+		e.second = LengthPrefixedStringRef((uint32_t*)lastPtr);
+		return e;
+	}
+
+	void emplace_back(Version v, LengthPrefixedStringRef m) {
+		uint64_t p = uint64_t(m.getLengthPtr());
+		if (chunks.empty() || chunks.back().count == ENTRIES_PER_CHUNK) {
+			chunks.emplace_back();
+			Chunk& c = chunks.back();
+			c.firstVersion = c.lastVersion = v;
+			c.firstPtr = p;
+			c.count = 1;
+			totalBytes += sizeof(Chunk);
+		} else {
+			Chunk& c = chunks.back();
+			ASSERT(v >= c.lastVersion);
+			size_t prior = c.bytes.size();
+			putVarint(c.bytes, uint64_t(v - c.lastVersion));
+			putVarint(c.bytes, zigzag(int64_t(p) - int64_t(lastPtr)));
+			c.lastVersion = v;
+			++c.count;
+			totalBytes += c.bytes.size() - prior;
+		}
+		lastPtr = p;
+		if (++totalCount == 1) {
+			frontEntry = firstEntry(chunks.front());
+			frontOffset = 0;
+		}
+	}
+
+	void pop_front() {
+		ASSERT(totalCount > 0);
+		--totalCount;
+		Chunk const& c = chunks.front();
+		if (++frontSkip == c.count) {
+			totalBytes -= sizeof(Chunk) + c.bytes.size();
+			chunks.pop_front();
+			frontSkip = 0;
+			frontOffset = 0;
+			if (!chunks.empty()) {
+				frontEntry = firstEntry(chunks.front());
+			}
+		} else {
+			decodeNext(c, frontOffset, frontEntry);
+		}
+	}
+
+	iterator begin() const {
+		iterator it;
+		it.index = this;
+		it.chunkIdx = 0;
+		it.entryIdx = frontSkip;
+		it.offset = frontOffset;
+		it.entry = frontEntry;
+		return it;
+	}
+
+	iterator end() const {
+		iterator it;
+		it.index = this;
+		it.chunkIdx = chunks.size();
+		return it;
+	}
+
+	// Returns an iterator to the first entry with version >= v
+	iterator lower_bound(Version v) const {
+		int lo = 0, hi = chunks.size();
+		while (lo < hi) {
+			int mid = (lo + hi) / 2;
+			if (chunks[mid].lastVersion < v) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+		iterator it;
+		if (lo == (int)chunks.size()) {
+			return end();
+		} else if (lo == 0) {
+			it = begin();
+		} else {
+			it.index = this;
+			it.chunkIdx = lo;
+			it.entry = firstEntry(chunks[lo]);
+		}
+		while (it != end() && it->first < v) {
+			++it;
+		}
+		return it;
+	}
+
+	// Returns an iterator to the first entry with version > v
+	iterator upper_bound(Version v) const { return lower_bound(v + 1); }
+};
+
 struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 	struct TagData : NonCopyable, public ReferenceCounted<TagData> {
-		std::deque<std::pair<Version, LengthPrefixedStringRef>> versionMessages;
+		VersionMessagesIndex versionMessages;
 		bool
 		    nothingPersistent; // true means tag is *known* to have no messages in persistentData.  false means nothing.
 		bool poppedRecently; // `popped` has changed since last updatePersistentData
@@ -446,11 +653,10 @@ struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 			while (!self->versionMessages.empty() && self->versionMessages.front().first < before) {
 				Version version = self->versionMessages.front().first;
 				std::pair<int, int>& sizes = logData->version_sizes[version];
-				int64_t messagesErased = 0;
+				int64_t indexBytesBefore = self->versionMessages.indexBytes();
 
 				while (!self->versionMessages.empty() && self->versionMessages.front().first == version) {
 					auto const& m = self->versionMessages.front();
-					++messagesErased;
 
 					if (self->tag.locality != tagLocalityTxs && self->tag != txsTag) {
 						sizes.first -= m.second.expectedSize();
@@ -461,7 +667,7 @@ struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 					self->versionMessages.pop_front();
 				}
 
-				int64_t bytesErased = messagesErased * SERVER_KNOBS->VERSION_MESSAGES_ENTRY_BYTES_WITH_OVERHEAD;
+				int64_t bytesErased = indexBytesBefore - self->versionMessages.indexBytes();
 				logData->bytesDurable += bytesErased;
 				tlogData->bytesDurable += bytesErased;
 				tlogData->overheadBytesDurable += bytesErased;
@@ -562,6 +768,9 @@ struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 	Counter blockingPeekTimeouts;
 	Counter emptyPeeks;
 	Counter nonEmptyPeeks;
+	Counter compressedPeeks;
+	Counter compressedPeekBytesIn;
+	Counter compressedPeekBytesOut;
 	std::map<Tag, LatencySample> blockingPeekLatencies;
 	std::map<Tag, LatencySample> peekVersionCounts;
 
@@ -651,7 +860,9 @@ struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 	    unpoppedRecoveredTagCount(0), cc("TLog", interf.id().toString()), bytesInput("BytesInput", cc),
 	    bytesDurable("BytesDurable", cc), blockingPeeks("BlockingPeeks", cc),
 	    blockingPeekTimeouts("BlockingPeekTimeouts", cc), emptyPeeks("EmptyPeeks", cc),
-	    nonEmptyPeeks("NonEmptyPeeks", cc), logId(interf.id()), protocolVersion(protocolVersion),
+	    nonEmptyPeeks("NonEmptyPeeks", cc), compressedPeeks("CompressedPeeks", cc),
+	    compressedPeekBytesIn("CompressedPeekBytesIn", cc), compressedPeekBytesOut("CompressedPeekBytesOut", cc),
+	    logId(interf.id()), protocolVersion(protocolVersion),
 	    newPersistentDataVersion(invalidVersion), tLogData(tLogData), unrecoveredBefore(1), recoveredAt(1),
 	    recoveryTxnVersion(1), logSystem(new AsyncVar<Reference<ILogSystem>>()), remoteTag(remoteTag),
 	    isPrimary(isPrimary), logRouterTags(logRouterTags), logRouterPoppedVersion(0), logRouterPopToVersion(0),
@@ -1020,8 +1231,7 @@ ACTOR Future<Void> updatePersistentData(TLogData* self, Reference<LogData> logDa
 				state Version lastVersion = std::numeric_limits<Version>::min();
 				state IDiskQueue::location firstLocation = std::numeric_limits<IDiskQueue::location>::max();
 				// Transfer unpopped messages with version numbers less than newPersistentDataVersion to persistentData
-				state std::deque<std::pair<Version, LengthPrefixedStringRef>>::iterator msg =
-				    tagData->versionMessages.begin();
+				state VersionMessagesIndex::iterator msg = tagData->versionMessages.begin();
 				state int refSpilledTagCount = 0;
 				wr = BinaryWriter(AssumeVersion(logData->protocolVersion));
 				// We prefix our spilled locations with a count, so that we can read this back out as a VectorRef.
@@ -1072,11 +1282,7 @@ ACTOR Future<Void> updatePersistentData(TLogData* self, Reference<LogData> logDa
 						Future<Void> f = yield(TaskPriority::UpdateStorage);
 						if (!f.isReady()) {
 							wait(f);
-							msg = std::upper_bound(
-							    tagData->versionMessages.begin(),
-							    tagData->versionMessages.end(),
-							    std::make_pair(currentVersion, LengthPrefixedStringRef()),
-							    [](const auto& l, const auto& r) -> bool { return l.first < r.first; });
+							msg = tagData->versionMessages.upper_bound(currentVersion);
 						}
 					}
 				}
@@ -1540,6 +1746,7 @@ void commitMessages(TLogData* self,
 			}
 
 			if (version >= tagData->popped) {
+				int64_t indexBytesBefore = tagData->versionMessages.indexBytes();
 				tagData->versionMessages.emplace_back(
 				    version, LengthPrefixedStringRef((uint32_t*)(block.end() - msg.message.size())));
 				if (tagData->versionMessages.back().second.expectedSize() > SERVER_KNOBS->MAX_MESSAGE_SIZE) {
@@ -1560,12 +1767,10 @@ void commitMessages(TLogData* self,
 					}
 				}
 
-				// The factor of VERSION_MESSAGES_OVERHEAD is intended to be an overestimate of the actual memory used
-				// to store this data in a std::deque. In practice, this number is probably something like 528/512
-				// ~= 1.03, but this could vary based on the implementation. There will also be a fixed overhead per
-				// std::deque, but its size should be trivial relative to the size of the TLog queue and can be thought
-				// of as increasing the capacity of the queue slightly.
-				overheadBytes += SERVER_KNOBS->VERSION_MESSAGES_ENTRY_BYTES_WITH_OVERHEAD;
+				// Account the actual growth of the compressed index, so that spill decisions track the
+				// memory really held by the index rather than a fixed per-entry estimate.  Entries that
+				// only extend the current chunk cost just their encoded deltas.
+				overheadBytes += tagData->versionMessages.indexBytes() - indexBytesBefore;
 			}
 		}
 
@@ -1605,10 +1810,10 @@ Version poppedVersion(Reference<LogData> self, Tag tag) {
 	return tagData->popped;
 }
 
-std::deque<std::pair<Version, LengthPrefixedStringRef>>& getVersionMessages(Reference<LogData> self, Tag tag) {
+VersionMessagesIndex& getVersionMessages(Reference<LogData> self, Tag tag) {
 	auto tagData = self->getTagData(tag);
 	if (!tagData) {
-		static std::deque<std::pair<Version, LengthPrefixedStringRef>> empty;
+		static VersionMessagesIndex empty;
 		return empty;
 	}
 	return tagData->versionMessages;
@@ -1644,10 +1849,7 @@ void peekMessagesFromMemory(Reference<LogData> self,
 	//TraceEvent("TLogPeekMem", self->dbgid).detail("Tag", req.tag1).detail("PDS", self->persistentDataSequence).detail("PDDS", self->persistentDataDurableSequence).detail("Oldest", map1.empty() ? 0 : map1.begin()->key ).detail("OldestMsgCount", map1.empty() ? 0 : map1.begin()->value.size());
 
 	begin = std::max(begin, self->persistentDataDurableVersion + 1);
-	auto it = std::lower_bound(deque.begin(),
-	                           deque.end(),
-	                           std::make_pair(begin, LengthPrefixedStringRef()),
-	                           [](const auto& l, const auto& r) -> bool { return l.first < r.first; });
+	auto it = deque.lower_bound(begin);
 
 	Version currentVersion = -1;
 	for (; it != deque.end(); ++it) {
@@ -1997,28 +2199,52 @@ Future<Void> tLogPeekMessages(PromiseType replyPromise,
 				earlyEnd = earlyEnd || (kvrefs.size() >= SERVER_KNOBS->TLOG_SPILL_REFERENCE_MAX_BATCHES_PER_PEEK + 1);
 				wait(self->peekMemoryLimiter.take(TaskPriority::TLogSpilledPeekReply, commitBytes));
 				state FlowLock::Releaser memoryReservation(self->peekMemoryLimiter, commitBytes);
-				state std::vector<Future<Standalone<StringRef>>> messageReads;
-				messageReads.reserve(commitLocations.size());
+
+				// Commits for consecutive versions are laid out back to back in the disk queue, so
+				// when a tag has messages in a run of versions the spilled ranges are exactly
+				// adjacent.  Coalesce them so that catching up a lagging tag issues a few large
+				// sequential reads instead of one small read per version.
+				state std::vector<std::pair<IDiskQueue::location, IDiskQueue::location>> readLocations;
 				for (const auto& pair : commitLocations) {
-					messageReads.push_back(self->rawPersistentQueue->read(pair.first, pair.second, CheckHashes::True));
+					if (!readLocations.empty() && readLocations.back().second == pair.first) {
+						readLocations.back().second = pair.second;
+					} else {
+						readLocations.push_back(pair);
+					}
 				}
+				CODE_PROBE(readLocations.size() < commitLocations.size(),
+				           "Coalesced adjacent spilled TLog peek reads");
 				commitLocations.clear();
+
+				state std::vector<Future<Standalone<StringRef>>> messageReads;
+				messageReads.reserve(readLocations.size());
+				for (const auto& pair : readLocations) {
+					messageReads.push_back(self->rawPersistentQueue->read(pair.first, pair.second, CheckHashes::True));
+				}
+				readLocations.clear();
 				wait(waitForAll(messageReads));
 
 				state Version lastRefMessageVersion = 0;
 				state int index = 0;
+				state Standalone<StringRef> queueEntryData;
+				state int entryOffset = 0;
 				loop {
 					if (index >= messageReads.size())
 						break;
-					Standalone<StringRef> queueEntryData = messageReads[index].get();
+					if (entryOffset == 0)
+						queueEntryData = messageReads[index].get();
+					// A coalesced read covers several commits; each is self-framing as
+					// (length, entry, valid), so they can be parsed out back to back.
 					uint8_t valid;
-					const uint32_t length = *(uint32_t*)queueEntryData.begin();
-					queueEntryData = queueEntryData.substr(4, queueEntryData.size() - 4);
-					BinaryReader rd(queueEntryData, IncludeVersion());
+					const uint32_t length = *(uint32_t*)(queueEntryData.begin() + entryOffset);
+					const int entrySize = sizeof(length) + length + sizeof(valid);
+					ASSERT(entryOffset + entrySize <= queueEntryData.size());
+					BinaryReader rd(queueEntryData.substr(entryOffset + sizeof(length), length + sizeof(valid)),
+					                IncludeVersion());
 					state TLogQueueEntry entry;
 					rd >> entry >> valid;
 					ASSERT(valid == 0x01);
-					ASSERT(length + sizeof(valid) == queueEntryData.size());
+					entryOffset += entrySize;
 
 					messages << VERSION_HEADER << entry.version;
 
@@ -2032,7 +2258,10 @@ Future<Void> tLogPeekMessages(PromiseType replyPromise,
 					}
 
 					lastRefMessageVersion = entry.version;
-					index++;
+					if (entryOffset == queueEntryData.size()) {
+						entryOffset = 0;
+						index++;
+					}
 				}
 
 				messageReads.clear();
@@ -2085,6 +2314,26 @@ Future<Void> tLogPeekMessages(PromiseType replyPromise,
 	reply.end = endVersion;
 	reply.onlySpilled = onlySpilled;
 
+	// Log router peeks are the cross-DC replication traffic, so they are the only peeks worth spending CPU
+	// compressing. The compressed form is only shipped if it is actually smaller; the cursor decompresses based on
+	// reply.compressionFilter, so an incompressible reply sent as-is needs no special handling on the read side.
+	if (SERVER_KNOBS->ENABLE_TLOG_PEEK_COMPRESSION && reqTag.locality == tagLocalityLogRouter &&
+	    reply.messages.size() >= SERVER_KNOBS->TLOG_PEEK_COMPRESSION_MIN_BYTES) {
+		CompressionFilter filter = CompressionUtils::fromFilterString(SERVER_KNOBS->TLOG_PEEK_COMPRESSION_FILTER);
+		if (filter != CompressionFilter::NONE &&
+		    CompressionUtils::supportedFilters.find(filter) != CompressionUtils::supportedFilters.end()) {
+			StringRef compressed = CompressionUtils::compress(filter, reply.messages, reply.arena);
+			if (compressed.size() < reply.messages.size()) {
+				CODE_PROBE(true, "tlog peek reply compressed");
+				++logData->compressedPeeks;
+				logData->compressedPeekBytesIn += reply.messages.size();
+				logData->compressedPeekBytesOut += compressed.size();
+				reply.messages = compressed;
+				reply.compressionFilter = filter;
+			}
+		}
+	}
+
 	DebugLogTraceEvent("TLogPeekMessages4", self->dbgid)
 	    .detail("LogId", logData->logId)
 	    .detail("Tag", reqTag.toString())
@@ -3769,7 +4018,7 @@ struct DequeAllocator : std::allocator<T> {
 
 TEST_CASE("Lfdbserver/tlogserver/VersionMessagesOverheadFactor") {
 
-	typedef std::pair<Version, LengthPrefixedStringRef> TestType; // type used by versionMessages
+	typedef std::pair<Version, LengthPrefixedStringRef> TestType; // type used by versionMessages in older tlogs
 
 	for (int i = 1; i < 9; ++i) {
 		for (int j = 0; j < 20; ++j) {
@@ -3802,3 +4051,71 @@ TEST_CASE("Lfdbserver/tlogserver/VersionMessagesOverheadFactor") {
 
 	return Void();
 }
+
+TEST_CASE("/fdbserver/tlogserver/VersionMessagesIndex") {
+	for (int trial = 0; trial < 20; ++trial) {
+		VersionMessagesIndex index;
+		std::deque<std::pair<Version, LengthPrefixedStringRef>> reference;
+
+		// Build a random index resembling a tag's message stream: runs of messages sharing a
+		// version, small pointer deltas within a version, occasional jumps to a new block.
+		Version version = deterministicRandom()->randomInt64(1, 1e12);
+		uint64_t ptr = deterministicRandom()->randomInt64(1 << 20, int64_t(1) << 40) & ~3;
+		int numElements = deterministicRandom()->randomInt(1, 2000);
+		for (int i = 0; i < numElements; ++i) {
+			if (deterministicRandom()->random01() < 0.3) {
+				version += deterministicRandom()->randomInt64(1, 1e6);
+			}
+			if (deterministicRandom()->random01() < 0.05) {
+				ptr = deterministicRandom()->randomInt64(1 << 20, int64_t(1) << 40) & ~3;
+			} else {
+				ptr += deterministicRandom()->randomInt(4, 10000) & ~3;
+			}
+			index.emplace_back(version, LengthPrefixedStringRef((uint32_t*)ptr));
+			reference.emplace_back(version, LengthPrefixedStringRef((uint32_t*)ptr));
+		}
+
+		int removedElements = deterministicRandom()->randomInt(0, numElements);
+		for (int i = 0; i < removedElements; ++i) {
+			ASSERT(index.front().first == reference.front().first);
+			ASSERT(index.front().second.getLengthPtr() == reference.front().second.getLengthPtr());
+			index.pop_front();
+			reference.pop_front();
+		}
+
+		ASSERT(index.size() == (int64_t)reference.size());
+		ASSERT(index.empty() == reference.empty());
+		if (!reference.empty()) {
+			ASSERT(index.back().first == reference.back().first);
+			ASSERT(index.back().second.getLengthPtr() == reference.back().second.getLengthPtr());
+		}
+
+		auto it = index.begin();
+		for (auto const& e : reference) {
+			ASSERT(it != index.end());
+			ASSERT(it->first == e.first);
+			ASSERT(it->second.getLengthPtr() == e.second.getLengthPtr());
+			++it;
+		}
+		ASSERT(it == index.end());
+
+		for (int i = 0; i < 100; ++i) {
+			Version v = deterministicRandom()->randomInt64(0, version + 2);
+			auto indexIter = index.lower_bound(v);
+			auto referenceIter =
+			    std::lower_bound(reference.begin(),
+			                     reference.end(),
+			                     std::make_pair(v, LengthPrefixedStringRef()),
+			                     [](const auto& l, const auto& r) -> bool { return l.first < r.first; });
+			if (referenceIter == reference.end()) {
+				ASSERT(indexIter == index.end());
+			} else {
+				ASSERT(indexIter != index.end());
+				ASSERT(indexIter->first == referenceIter->first);
+				ASSERT(indexIter->second.getLengthPtr() == referenceIter->second.getLengthPtr());
+			}
+		}
+	}
+
+	return Void();
+}
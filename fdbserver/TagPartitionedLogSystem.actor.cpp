@@ -1375,12 +1375,11 @@ void TagPartitionedLogSystem::popLogRouter(Version upTo,
 						    std::make_pair(upTo, durableKnownCommittedVersion);
 					}
 					if (prev == 0) {
-						popActors.add(popFromLog(this,
-						                         log,
-						                         tag,
-						                         /*delayBeforePop=*/0.0,
-						                         /*popLogRouter=*/true)); // Fast pop time because log routers can only
-						                                                  // hold 5 seconds of data.
+						// Fast pop time because log routers can only hold 5 seconds of data. A small
+						// nonzero delay batches the pop versions of several commits into one cross-DC
+						// request.
+						popActors.add(
+						    popFromLog(this, log, tag, SERVER_KNOBS->LOG_ROUTER_POP_FROM_LOG_DELAY, /*popLogRouter=*/true));
 					}
 				}
 			}
@@ -1407,8 +1406,8 @@ void TagPartitionedLogSystem::popLogRouter(Version upTo,
 								    std::make_pair(upTo, durableKnownCommittedVersion);
 							}
 							if (prev == 0) {
-								popActors.add(
-								    popFromLog(this, log, tag, /*delayBeforePop=*/0.0, /*popLogRouter=*/true));
+								popActors.add(popFromLog(
+								    this, log, tag, SERVER_KNOBS->LOG_ROUTER_POP_FROM_LOG_DELAY, /*popLogRouter=*/true));
 							}
 						}
 					}
@@ -25,67 +25,87 @@
 
 namespace {
 
-class TopKTags {
+// Space-saving sketch (Metwally et al.) for transaction tag cost accounting. A bounded set of
+// counters is kept; a tag that is not currently tracked evicts the minimum counter and inherits
+// its count as an error bound. Any tag whose true cost exceeds the minimum counter is guaranteed
+// to be tracked, while memory and per-request work stay constant no matter how many distinct
+// tags pass through in an interval. The hot path for a tracked tag is a single hash lookup and
+// an increment; the eviction scan only runs when an untracked tag arrives with the sketch full.
+class TagCostSketch {
 public:
-	struct TagAndCount {
+	struct Entry {
 		TransactionTag tag;
-		int64_t count;
-		bool operator<(TagAndCount const& other) const { return count < other.count; }
-		explicit TagAndCount(TransactionTag tag, int64_t count) : tag(tag), count(count) {}
+		int64_t count; // upper bound on the tag's true cost
+		int64_t error; // overestimate inherited from the evicted counter
+		explicit Entry(TransactionTag tag, int64_t count, int64_t error) : tag(tag), count(count), error(error) {}
 	};
 
 private:
-	// Because the number of tracked is expected to be small, they can be tracked
-	// in a simple vector. If the number of tracked tags increases, a more sophisticated
-	// data structure will be required.
-	std::vector<TagAndCount> topTags;
-	int limit;
+	std::vector<Entry> entries;
+	TransactionTagMap<int> index; // tag -> position in entries
+	int capacity;
 
 public:
-	explicit TopKTags(int limit) : limit(limit) {
-		ASSERT_GT(limit, 0);
-		topTags.reserve(limit);
+	explicit TagCostSketch(int capacity) : capacity(capacity) {
+		ASSERT_GT(capacity, 0);
+		entries.reserve(capacity);
 	}
 
-	void incrementCount(TransactionTag tag, int previousCount, int increase) {
-		auto iter = std::find_if(topTags.begin(), topTags.end(), [tag](const auto& tc) { return tc.tag == tag; });
-		if (iter != topTags.end()) {
-			ASSERT_EQ(previousCount, iter->count);
-			iter->count += increase;
-		} else if (topTags.size() < limit) {
-			ASSERT_EQ(previousCount, 0);
-			topTags.emplace_back(tag, increase);
-		} else {
-			auto toReplace = std::min_element(topTags.begin(), topTags.end());
-			ASSERT_GE(toReplace->count, previousCount);
-			if (toReplace->count < previousCount + increase) {
-				toReplace->tag = tag;
-				toReplace->count = previousCount + increase;
+	void addCost(TransactionTag const& tag, int64_t cost) {
+		auto iter = index.find(tag);
+		if (iter != index.end()) {
+			entries[iter->second].count += cost;
+			return;
+		}
+		if ((int)entries.size() < capacity) {
+			index[tag] = entries.size();
+			entries.emplace_back(tag, cost, 0);
+			return;
+		}
+		CODE_PROBE(true, "Tag cost sketch evicting minimum counter");
+		int minPos = 0;
+		for (int i = 1; i < (int)entries.size(); ++i) {
+			if (entries[i].count < entries[minPos].count) {
+				minPos = i;
 			}
 		}
+		index.erase(entries[minPos].tag);
+		index[tag] = minPos;
+		entries[minPos].error = entries[minPos].count;
+		entries[minPos].tag = tag;
+		entries[minPos].count += cost;
 	}
 
-	std::vector<StorageQueuingMetricsReply::TagInfo> getBusiestTags(double elapsed, double totalSampleCount) const {
+	std::vector<StorageQueuingMetricsReply::TagInfo> getBusiestTags(double elapsed,
+	                                                                double totalSampleCount,
+	                                                                int k) const {
+		std::vector<Entry> sorted(entries);
+		std::partial_sort(sorted.begin(),
+		                  sorted.begin() + std::min<int>(k, (int)sorted.size()),
+		                  sorted.end(),
+		                  [](Entry const& a, Entry const& b) { return a.count > b.count; });
 		std::vector<StorageQueuingMetricsReply::TagInfo> result;
-		for (auto const& tagAndCounter : topTags) {
-			auto rate = (tagAndCounter.count / CLIENT_KNOBS->READ_TAG_SAMPLE_RATE) / elapsed;
+		for (int i = 0; i < k && i < (int)sorted.size(); ++i) {
+			auto rate = (sorted[i].count / CLIENT_KNOBS->READ_TAG_SAMPLE_RATE) / elapsed;
 			if (rate > SERVER_KNOBS->MIN_TAG_READ_PAGES_RATE) {
-				result.emplace_back(tagAndCounter.tag, rate, tagAndCounter.count / totalSampleCount);
+				result.emplace_back(sorted[i].tag, rate, sorted[i].count / totalSampleCount);
 			}
 		}
 		return result;
 	}
 
-	void clear() { topTags.clear(); }
+	void clear() {
+		entries.clear();
+		index.clear();
+	}
 };
 
 } // namespace
 
 class TransactionTagCounterImpl {
 	UID thisServerID;
-	TransactionTagMap<int64_t> intervalCounts;
 	int64_t intervalTotalSampledCount = 0;
-	TopKTags topTags;
+	TagCostSketch sketch;
 	double intervalStart = 0;
 
 	std::vector<StorageQueuingMetricsReply::TagInfo> previousBusiestTags;
@@ -93,7 +113,8 @@ class TransactionTagCounterImpl {
 
 public:
 	TransactionTagCounterImpl(UID thisServerID)
-	  : thisServerID(thisServerID), topTags(SERVER_KNOBS->SS_THROTTLE_TAGS_TRACKED),
+	  : thisServerID(thisServerID),
+	    sketch(std::max<int>(SERVER_KNOBS->SS_THROTTLE_TAGS_TRACKED, SERVER_KNOBS->SS_THROTTLE_TAG_SKETCH_SIZE)),
 	    busiestReadTagEventHolder(makeReference<EventCacheHolder>(thisServerID.toString() + "/BusiestReadTag")) {}
 
 	void addRequest(Optional<TagSet> const& tags, int64_t bytes) {
@@ -101,9 +122,7 @@ public:
 			CODE_PROBE(true, "Tracking transaction tag in counter");
 			auto const cost = getReadOperationCost(bytes);
 			for (auto& tag : tags.get()) {
-				int64_t& count = intervalCounts[TransactionTag(tag, tags.get().getArena())];
-				topTags.incrementCount(tag, count, cost);
-				count += cost;
+				sketch.addCost(TransactionTag(tag, tags.get().getArena()), cost);
 			}
 
 			intervalTotalSampledCount += cost;
@@ -114,7 +133,8 @@ public:
 		double elapsed = now() - intervalStart;
 		previousBusiestTags.clear();
 		if (intervalStart > 0 && CLIENT_KNOBS->READ_TAG_SAMPLE_RATE > 0 && elapsed > 0) {
-			previousBusiestTags = topTags.getBusiestTags(elapsed, intervalTotalSampledCount);
+			previousBusiestTags =
+			    sketch.getBusiestTags(elapsed, intervalTotalSampledCount, SERVER_KNOBS->SS_THROTTLE_TAGS_TRACKED);
 
 			// For status, report the busiest tag:
 			if (previousBusiestTags.empty()) {
@@ -141,9 +161,8 @@ public:
 			}
 		}
 
-		intervalCounts.clear();
 		intervalTotalSampledCount = 0;
-		topTags.clear();
+		sketch.clear();
 		intervalStart = now();
 	}
 
@@ -167,27 +186,28 @@ std::vector<StorageQueuingMetricsReply::TagInfo> const& TransactionTagCounter::g
 	return impl->getBusiestTags();
 }
 
-TEST_CASE("/TransactionTagCounter/TopKTags") {
-	TopKTags topTags(2);
+TEST_CASE("/TransactionTagCounter/TagCostSketch") {
+	TagCostSketch sketch(2);
 
-	// Ensure that costs are larger enough to show up
+	// Ensure that costs are large enough to show up
 	auto const costMultiplier =
 	    std::max<double>(1.0, 2 * SERVER_KNOBS->MIN_TAG_READ_PAGES_RATE * CLIENT_KNOBS->READ_TAG_SAMPLE_RATE);
 
-	ASSERT_EQ(topTags.getBusiestTags(1.0, 0).size(), 0);
-	topTags.incrementCount("a"_sr, 0, 1 * costMultiplier);
+	ASSERT_EQ(sketch.getBusiestTags(1.0, 0, 2).size(), 0);
+	sketch.addCost("a"_sr, 1 * costMultiplier);
 	{
-		auto const busiestTags = topTags.getBusiestTags(1.0, 1 * costMultiplier);
+		auto const busiestTags = sketch.getBusiestTags(1.0, 1 * costMultiplier, 2);
 		ASSERT_EQ(busiestTags.size(), 1);
 		ASSERT_EQ(std::count_if(busiestTags.begin(),
 		                        busiestTags.end(),
 		                        [](auto const& tagInfo) { return tagInfo.tag == "a"_sr; }),
 		          1);
 	}
-	topTags.incrementCount("b"_sr, 0, 2 * costMultiplier);
-	topTags.incrementCount("c"_sr, 0, 3 * costMultiplier);
+	sketch.addCost("b"_sr, 2 * costMultiplier);
+	// "c" evicts the minimum counter ("a", count 1) and inherits its count as error
+	sketch.addCost("c"_sr, 3 * costMultiplier);
 	{
-		auto busiestTags = topTags.getBusiestTags(1.0, 6 * costMultiplier);
+		auto busiestTags = sketch.getBusiestTags(1.0, 6 * costMultiplier, 2);
 		ASSERT_EQ(busiestTags.size(), 2);
 		ASSERT_EQ(std::count_if(busiestTags.begin(),
 		                        busiestTags.end(),
@@ -202,9 +222,10 @@ TEST_CASE("/TransactionTagCounter/TopKTags") {
 		                        [](auto const& tagInfo) { return tagInfo.tag == "c"_sr; }),
 		          1);
 	}
-	topTags.incrementCount("a"_sr, 1 * costMultiplier, 3 * costMultiplier);
+	// "a" evicts the minimum counter ("b", count 2)
+	sketch.addCost("a"_sr, 3 * costMultiplier);
 	{
-		auto busiestTags = topTags.getBusiestTags(1.0, 9 * costMultiplier);
+		auto busiestTags = sketch.getBusiestTags(1.0, 9 * costMultiplier, 2);
 		ASSERT_EQ(busiestTags.size(), 2);
 		ASSERT_EQ(std::count_if(busiestTags.begin(),
 		                        busiestTags.end(),
@@ -219,7 +240,7 @@ TEST_CASE("/TransactionTagCounter/TopKTags") {
 		                        [](auto const& tagInfo) { return tagInfo.tag == "c"_sr; }),
 		          1);
 	}
-	topTags.clear();
-	ASSERT_EQ(topTags.getBusiestTags(1.0, 0).size(), 0);
+	sketch.clear();
+	ASSERT_EQ(sketch.getBusiestTags(1.0, 0, 2).size(), 0);
 	return Void();
 }
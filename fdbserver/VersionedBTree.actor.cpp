@@ -39,8 +39,10 @@
 #include "flow/IRandom.h"
 #include "flow/Knobs.h"
 #include "flow/ObjectSerializer.h"
+#include "flow/IThreadPool.h"
 #include "flow/PriorityMultiLock.actor.h"
 #include "flow/serialize.h"
+#include "flow/ThreadHelper.actor.h"
 #include "flow/Trace.h"
 #include "flow/UnitTest.h"
 #include "fmt/format.h"
@@ -1412,6 +1414,7 @@ struct RedwoodMetrics {
 			unsigned int pageBuild;
 			unsigned int pageBuildExt;
 			unsigned int pageCommitStart;
+			unsigned int replaceSkipRead;
 			unsigned int pageModify;
 			unsigned int pageModifyExt;
 			unsigned int lazyClearRequeue;
@@ -1449,6 +1452,8 @@ struct RedwoodMetrics {
 		unsigned int pagerRemapFree;
 		unsigned int pagerRemapCopy;
 		unsigned int pagerRemapSkip;
+		unsigned int pagerRemapBackoff;
+		unsigned int lazyClearBackoff;
 		unsigned int pagerCacheHit;
 		unsigned int pagerCacheMiss;
 		unsigned int pagerProbeHit;
@@ -1631,12 +1636,15 @@ class ObjectCache : NonCopyable {
 	typedef std::unordered_map<IndexType, Entry> CacheT;
 
 	struct Entry : public boost::intrusive::list_base_hook<> {
-		Entry() : hits(0), size(0) {}
+		Entry() : hits(0), size(0), inProtectedOrder(false) {}
 		IndexType index;
 		ObjectType item;
 		int hits;
 		int size;
 		bool ownedByEvictor;
+		// When ownedByEvictor, whether the entry is in the protected eviction order rather than
+		// the probationary one
+		bool inProtectedOrder;
 		CacheT* pCache;
 	};
 
@@ -1644,9 +1652,15 @@ class ObjectCache : NonCopyable {
 
 public:
 	// Object evictor, manages the eviction order for one or more ObjectCaches
-	// Not all objects tracked by the Evictor are in its evictionOrder, as ObjectCaches
+	// Not all objects tracked by the Evictor are in its eviction orders, as ObjectCaches
 	// using this Evictor can temporarily remove entries to an external order but they
 	// must eventually give them back with moveIn() or remove them with reclaim().
+	//
+	// Eviction uses a 2Q-style policy for scan resistance:  New entries start in a probationary
+	// order and are only promoted to the protected order when they are hit again, so a large scan
+	// of never-reused pages churns through the probationary segment without displacing the
+	// established working set.  The protected order is capped at a fraction of the size limit and
+	// demotes its least recently used entries back to probation when it grows past the cap.
 	class Evictor : NonCopyable {
 	public:
 		Evictor(int64_t sizeLimit = 0) : sizeLimit(sizeLimit) {}
@@ -1667,19 +1681,30 @@ public:
 		// but the entry size is still counted against the evictor
 		void moveOut(Entry& e, EvictionOrderT& dest) {
 			ASSERT(e.ownedByEvictor);
-			dest.splice(dest.end(), evictionOrder, EvictionOrderT::s_iterator_to(e));
+			dest.splice(dest.end(), order(e), EvictionOrderT::s_iterator_to(e));
+			if (e.inProtectedOrder) {
+				protectedSizeUsed -= e.size;
+				e.inProtectedOrder = false;
+			}
 			e.ownedByEvictor = false;
 			++movedOutCount;
 		}
 
-		// Move an entry to the back of the eviction order if it is in the eviction order
+		// An entry in the eviction orders was hit.  Protected entries move to the back of the
+		// protected order, and probationary entries are promoted to it, demoting the least
+		// recently used protected entries back to probation if the protected cap is exceeded.
 		void moveToBack(Entry& e) {
 			ASSERT(e.ownedByEvictor);
-			evictionOrder.splice(evictionOrder.end(), evictionOrder, EvictionOrderT::s_iterator_to(e));
+			protectedOrder.splice(protectedOrder.end(), order(e), EvictionOrderT::s_iterator_to(e));
+			if (!e.inProtectedOrder) {
+				e.inProtectedOrder = true;
+				protectedSizeUsed += e.size;
+				balanceProtected();
+			}
 		}
 
 		// Move entire contents of an external eviction order containing entries whose size is part of
-		// this Evictor to the front of its eviction order.
+		// this Evictor to the front of its probationary eviction order.
 		void moveIn(EvictionOrderT& otherOrder) {
 			for (auto& e : otherOrder) {
 				ASSERT(!e.ownedByEvictor);
@@ -1689,20 +1714,34 @@ public:
 			evictionOrder.splice(evictionOrder.begin(), otherOrder);
 		}
 
-		// Add a new item to the back of the eviction order
-		void addNew(Entry& e) {
+		// Add a new item to the back of an eviction order.  Entries start in the probationary
+		// order unless the caller knows they are part of the working set, e.g. interior btree
+		// pages, in which case they start protected.
+		void addNew(Entry& e, bool startProtected = false) {
 			sizeUsed += e.size;
-			evictionOrder.push_back(e);
-			e.ownedByEvictor = true;
+			if (startProtected) {
+				protectedOrder.push_back(e);
+				e.inProtectedOrder = true;
+				protectedSizeUsed += e.size;
+				e.ownedByEvictor = true;
+				balanceProtected();
+			} else {
+				evictionOrder.push_back(e);
+				e.ownedByEvictor = true;
+			}
 		}
 
 		// Claim ownership of an entry, removing its size from the current size and removing it
 		// from the eviction order if it exists there
 		void reclaim(Entry& e) {
 			sizeUsed -= e.size;
-			// If e is in evictionOrder then remove it
+			// If e is in an eviction order then remove it
 			if (e.ownedByEvictor) {
-				evictionOrder.erase(EvictionOrderT::s_iterator_to(e));
+				order(e).erase(EvictionOrderT::s_iterator_to(e));
+				if (e.inProtectedOrder) {
+					protectedSizeUsed -= e.size;
+					e.inProtectedOrder = false;
+				}
 				e.ownedByEvictor = false;
 			} else {
 				// Otherwise, it wasn't so it had to be a movedOut item so decrement the count
@@ -1712,14 +1751,16 @@ public:
 
 		void trim(int additionalSpaceNeeded = 0) {
 			int attemptsLeft = FLOW_KNOBS->MAX_EVICT_ATTEMPTS;
-			// While the cache is too big, evict the oldest entry until the oldest entry can't be evicted.
+			// While the cache is too big, evict the oldest probationary entry, or the oldest
+			// protected entry once probation is empty, until the oldest entry can't be evicted.
 			while (attemptsLeft-- > 0 && sizeUsed > (sizeLimit - reservedSize - additionalSpaceNeeded) &&
-			       !evictionOrder.empty()) {
-				Entry& toEvict = evictionOrder.front();
+			       !(evictionOrder.empty() && protectedOrder.empty())) {
+				EvictionOrderT& source = evictionOrder.empty() ? protectedOrder : evictionOrder;
+				Entry& toEvict = source.front();
 
 				debug_printf("Evictor count=%d sizeUsed=%" PRId64 " sizeLimit=%" PRId64 " sizePenalty=%" PRId64
 				             " needed=%d  Trying to evict %s evictable %d\n",
-				             (int)evictionOrder.size(),
+				             (int)(evictionOrder.size() + protectedOrder.size()),
 				             sizeUsed,
 				             sizeLimit,
 				             reservedSize,
@@ -1729,7 +1770,7 @@ public:
 
 				if (!toEvict.item.evictable()) {
 					// shift the front to the back
-					evictionOrder.shift_forward(1);
+					source.shift_forward(1);
 					++g_redwoodMetrics.metric.pagerEvictFail;
 					break;
 				} else {
@@ -1737,14 +1778,18 @@ public:
 						++g_redwoodMetrics.metric.pagerEvictUnhit;
 					}
 					sizeUsed -= toEvict.size;
+					if (toEvict.inProtectedOrder) {
+						protectedSizeUsed -= toEvict.size;
+						toEvict.inProtectedOrder = false;
+					}
 					debug_printf("Evicting %s\n", ::toString(toEvict.index).c_str());
-					evictionOrder.pop_front();
+					source.pop_front();
 					toEvict.pCache->erase(toEvict.index);
 				}
 			}
 		}
 
-		int64_t getCountUsed() const { return evictionOrder.size() + movedOutCount; }
+		int64_t getCountUsed() const { return evictionOrder.size() + protectedOrder.size() + movedOutCount; }
 		int64_t getCountMoved() const { return movedOutCount; }
 		int64_t getSizeUsed() const { return sizeUsed + reservedSize; }
 
@@ -1765,6 +1810,12 @@ public:
 				            entry.size,
 				            entry.item.evictable());
 			}
+			for (auto& entry : protectedOrder) {
+				s += format("\n\tindex %s  size %d  evictable %d  protected\n",
+				            ::toString(entry.index).c_str(),
+				            entry.size,
+				            entry.item.evictable());
+			}
 			s += "}\n";
 			return s;
 		}
@@ -1775,9 +1826,29 @@ public:
 		int64_t sizeLimit;
 
 	private:
+		// The eviction order containing e.  Entries not owned by the evictor are in neither order.
+		EvictionOrderT& order(Entry& e) { return e.inProtectedOrder ? protectedOrder : evictionOrder; }
+
+		// Demote least recently used protected entries to the back of probation until the
+		// protected order is within its share of the size limit.
+		void balanceProtected() {
+			int64_t protectedLimit = SERVER_KNOBS->REDWOOD_PAGE_CACHE_PROTECTED_FRACTION * sizeLimit;
+			while (protectedSizeUsed > protectedLimit && !protectedOrder.empty()) {
+				Entry& demoted = protectedOrder.front();
+				evictionOrder.splice(evictionOrder.end(), protectedOrder, EvictionOrderT::s_iterator_to(demoted));
+				demoted.inProtectedOrder = false;
+				protectedSizeUsed -= demoted.size;
+			}
+		}
+
+		// Probationary eviction order, which new entries enter and eviction drains first
 		EvictionOrderT evictionOrder;
-		// Size of all entries in the eviction order or held in external eviction orders
+		// Protected eviction order for entries hit again after insertion
+		EvictionOrderT protectedOrder;
+		// Size of all entries in the eviction orders or held in external eviction orders
 		int64_t sizeUsed = 0;
+		// Size of the entries in protectedOrder
+		int64_t protectedSizeUsed = 0;
 		// Number of items that have been moveOut()'d to other evictionOrders and aren't back yet
 		int64_t movedOutCount = 0;
 	};
@@ -1814,10 +1885,11 @@ public:
 	}
 
 	// Get the object for i or create a new one.
-	// After a get(), the object for i is the last in evictionOrder.
+	// After a get(), the object for i is the last in its eviction order.
 	// If noHit is set, do not consider this access to be cache hit if the object is present
-	// If noMiss is set, do not consider this access to be a cache miss if the object is not present
-	ObjectType& get(const IndexType& index, int size, bool noHit = false) {
+	// If startProtected is set and the object is not present, the new entry starts in the
+	// protected eviction order instead of the probationary one.
+	ObjectType& get(const IndexType& index, int size, bool noHit = false, bool startProtected = false) {
 		Entry& entry = cache[index];
 
 		// If entry is linked into an evictionOrder
@@ -1840,7 +1912,7 @@ public:
 			entry.size = size;
 
 			pEvictor->trim(entry.size);
-			pEvictor->addNew(entry);
+			pEvictor->addNew(entry, startProtected);
 		}
 
 		return entry.item;
@@ -2030,6 +2102,15 @@ public:
 			g_redwoodMetricsActor = redwoodMetricsLogger();
 		}
 
+		// Page encryption is offloaded to a thread pool so commits of many dirty pages can use
+		// multiple cores.  Simulation stays single threaded for determinism.
+		if (!g_network->isSimulated() && SERVER_KNOBS->REDWOOD_PAGE_ENCODE_THREADS > 0) {
+			encodeThreadPool = createGenericThreadPool();
+			for (int i = 0; i < SERVER_KNOBS->REDWOOD_PAGE_ENCODE_THREADS; ++i) {
+				encodeThreadPool->addThread(new PageEncodeWorker(), "fdb-rdwd-enc");
+			}
+		}
+
 		commitFuture = Void();
 		recoverFuture = forwardError(recover(this), errorPromise);
 	}
@@ -2554,14 +2635,37 @@ public:
 		return Void();
 	}
 
-	// All returned futures are added to the operations vector
-	Future<Void> writePhysicalPage(PagerEventReasons reason,
-	                               unsigned int level,
-	                               Standalone<VectorRef<PhysicalPageID>> pageIDs,
-	                               Reference<ArenaPage> page,
-	                               bool header = false) {
+	// Thread pool worker that runs ArenaPage::preWrite() off the network thread, so page
+	// encryption of a large commit's dirty set can use multiple cores.
+	struct PageEncodeWorker final : IThreadPoolReceiver {
+		void init() override {}
+
+		struct EncodePage final : TypedAction<PageEncodeWorker, EncodePage>, FastAllocated<EncodePage> {
+			EncodePage(Reference<ArenaPage> page, PhysicalPageID pageID) : page(std::move(page)), pageID(pageID) {}
+			double getTimeEstimate() const override { return .0005; }
+			Reference<ArenaPage> page;
+			PhysicalPageID pageID;
+			ThreadReturnPromise<Void> done;
+		};
+
+		void action(EncodePage& a) {
+			try {
+				a.page->preWrite(a.pageID);
+				a.done.send(Void());
+			} catch (Error& e) {
+				a.done.sendError(e);
+			}
+		}
+	};
+
+	ACTOR static Future<Void> writePhysicalPage_impl(DWALPager* self,
+	                                                 PagerEventReasons reason,
+	                                                 unsigned int level,
+	                                                 Standalone<VectorRef<PhysicalPageID>> pageIDs,
+	                                                 Reference<ArenaPage> page,
+	                                                 bool header) {
 		debug_printf("DWALPager(%s) op=%s %s encoding=%d ptr=%p\n",
-		             filename.c_str(),
+		             self->filename.c_str(),
 		             (header ? "writePhysicalHeader" : "writePhysicalPage"),
 		             toString(pageIDs).c_str(),
 		             page->getEncodingType(),
@@ -2570,7 +2674,7 @@ public:
 		// Set metadata before prewrite so it's in the pre-encrypted page in cache if the page is encrypted
 		// The actual next commit version is unknown, so the write version of a page is always the
 		// last committed version + 1
-		page->setWriteInfo(pageIDs.front(), this->getLastCommittedVersion() + 1);
+		page->setWriteInfo(pageIDs.front(), self->getLastCommittedVersion() + 1);
 
 		// Copy the page if preWrite will encrypt/modify the payload
 		bool copy = page->isEncrypted();
@@ -2578,21 +2682,40 @@ public:
 			page = page->clone();
 		}
 
-		page->preWrite(pageIDs.front());
+		// Encryption is the only preWrite work expensive enough to be worth a thread hop, and the
+		// clone above means the encode mutates a private copy, so it is safe off-thread.
+		if (copy && self->encodeThreadPool) {
+			auto a = new PageEncodeWorker::EncodePage(page, pageIDs.front());
+			state Future<Void> encoded = a->done.getFuture();
+			self->encodeThreadPool->post(a);
+			wait(encoded);
+		} else {
+			page->preWrite(pageIDs.front());
+		}
 
-		int blockSize = header ? smallestPhysicalBlock : physicalPageSize;
+		int blockSize = header ? smallestPhysicalBlock : self->physicalPageSize;
 		Future<Void> f;
 		if (pageIDs.size() == 1) {
-			f = writePhysicalBlock(this, page, 0, blockSize, pageIDs.front(), reason, level, header);
+			f = writePhysicalBlock(self, page, 0, blockSize, pageIDs.front(), reason, level, header);
 		} else {
 			std::vector<Future<Void>> writers;
 			for (int i = 0; i < pageIDs.size(); ++i) {
-				Future<Void> p = writePhysicalBlock(this, page, i, blockSize, pageIDs[i], reason, level, header);
+				Future<Void> p = writePhysicalBlock(self, page, i, blockSize, pageIDs[i], reason, level, header);
 				writers.push_back(p);
 			}
 			f = waitForAll(writers);
 		}
+		wait(f);
+		return Void();
+	}
 
+	// All returned futures are added to the operations vector
+	Future<Void> writePhysicalPage(PagerEventReasons reason,
+	                               unsigned int level,
+	                               Standalone<VectorRef<PhysicalPageID>> pageIDs,
+	                               Reference<ArenaPage> page,
+	                               bool header = false) {
+		Future<Void> f = writePhysicalPage_impl(this, reason, level, pageIDs, page, header);
 		operations.push_back(f);
 		return f;
 	}
@@ -2610,7 +2733,7 @@ public:
 		// or as a cache miss because there is no benefit to the page already being in cache
 		// Similarly, this does not count as a point lookup for reason.
 		ASSERT(pageIDs.front() != invalidLogicalPageID);
-		PageCacheEntry& cacheEntry = pageCache.get(pageIDs.front(), pageIDs.size() * physicalPageSize, true);
+		PageCacheEntry& cacheEntry = pageCache.get(pageIDs.front(), pageIDs.size() * physicalPageSize, true, level > 1);
 		debug_printf("DWALPager(%s) op=write %s cached=%d reading=%d writing=%d\n",
 		             filename.c_str(),
 		             toString(pageIDs).c_str(),
@@ -2971,7 +3094,9 @@ public:
 			debug_printf("DWALPager(%s) op=readUncachedMiss %s\n", filename.c_str(), toString(pageID).c_str());
 			return forwardError(readPhysicalPage(this, pageID, priority, false), errorPromise);
 		}
-		PageCacheEntry& cacheEntry = pageCache.get(pageID, physicalPageSize, noHit);
+		// Interior btree pages (level > 1) start in the protected eviction order since they are hit
+		// far more often than the leaves beneath them.
+		PageCacheEntry& cacheEntry = pageCache.get(pageID, physicalPageSize, noHit, level > 1);
 		debug_printf("DWALPager(%s) op=read %s cached=%d reading=%d writing=%d noHit=%d\n",
 		             filename.c_str(),
 		             toString(pageID).c_str(),
@@ -3021,7 +3146,7 @@ public:
 			return forwardError(readPhysicalMultiPage(this, pageIDs, priority), errorPromise);
 		}
 
-		PageCacheEntry& cacheEntry = pageCache.get(pageIDs.front(), pageIDs.size() * physicalPageSize, noHit);
+		PageCacheEntry& cacheEntry = pageCache.get(pageIDs.front(), pageIDs.size() * physicalPageSize, noHit, level > 1);
 		debug_printf("DWALPager(%s) op=read %s cached=%d reading=%d writing=%d noHit=%d\n",
 		             filename.c_str(),
 		             toString(pageIDs).c_str(),
@@ -3472,6 +3597,25 @@ public:
 				tasks.add(task);
 			}
 
+			// Pace cleanup based on foreground IO pressure, unless the remap queue is so far past the target
+			// window that space reuse is falling behind.  Don't pace while a stop has been requested as the
+			// commit path is waiting on this actor.
+			if (!self->remapCleanupStop &&
+			    self->remapQueue.numEntries < maxRemapEntries * SERVER_KNOBS->REDWOOD_REMAP_CLEANUP_URGENT_RATIO) {
+				double backoff =
+				    std::min(self->ioLock->getWaitersCount() * SERVER_KNOBS->REDWOOD_CLEANUP_IO_BACKOFF_PER_WAITER,
+				             SERVER_KNOBS->REDWOOD_CLEANUP_IO_MAX_BACKOFF);
+				if (backoff > 0) {
+					debug_printf("DWALPager(%s) remapCleanup backoff %f ioWaiters=%d items=%" PRId64 "\n",
+					             self->filename.c_str(),
+					             backoff,
+					             self->ioLock->getWaitersCount(),
+					             self->remapQueue.numEntries);
+					++g_redwoodMetrics.metric.pagerRemapBackoff;
+					wait(delay(backoff));
+				}
+			}
+
 			// Yield to prevent slow task in case no IO waits are encountered
 			if (++sinceYield >= 100) {
 				sinceYield = 0;
@@ -3646,6 +3790,11 @@ public:
 		}
 		self->operations.clear();
 
+		if (self->encodeThreadPool) {
+			debug_printf("DWALPager(%s) shutdown stop encode threads\n", self->filename.c_str());
+			wait(self->encodeThreadPool->stop());
+		}
+
 		debug_printf("DWALPager(%s) shutdown cancel queues\n", self->filename.c_str());
 		self->freeList.cancel();
 		self->delayedFreeList.cancel();
@@ -3905,6 +4054,9 @@ private:
 
 	Reference<IAsyncFile> pageFile;
 
+	// Optional thread pool for running page encryption during writes off the network thread
+	Reference<IThreadPool> encodeThreadPool;
+
 	LogicalPageQueueT freeList;
 
 	// The delayed free list will be approximately in Version order.
@@ -4982,6 +5134,7 @@ public:
 	// The new value is not readable until after the next commit is completed.
 	void set(KeyValueRef keyValue) {
 		++m_mutationCount;
+		m_mutationBytes += keyValue.expectedSize();
 		++g_redwoodMetrics.metric.opSet;
 		g_redwoodMetrics.metric.opSetKeyBytes += keyValue.key.size();
 		g_redwoodMetrics.metric.opSetValueBytes += keyValue.value.size();
@@ -4990,6 +5143,7 @@ public:
 
 	void clear(KeyRangeRef clearedRange) {
 		++m_mutationCount;
+		m_mutationBytes += clearedRange.expectedSize();
 		// Optimization for single key clears to create just one mutation boundary instead of two
 		if (clearedRange.begin.size() == clearedRange.end.size() - 1 &&
 		    clearedRange.end[clearedRange.end.size() - 1] == 0 && clearedRange.end.startsWith(clearedRange.begin)) {
@@ -5023,7 +5177,8 @@ public:
 	               EncodingType encodingType = EncodingType::MAX_ENCODING_TYPE,
 	               Reference<IPageEncryptionKeyProvider> keyProvider = {})
 	  : m_pager(pager), m_db(db), m_expectedEncryptionMode(expectedEncryptionMode), m_encodingType(encodingType),
-	    m_enforceEncodingType(false), m_keyProvider(keyProvider), m_pBuffer(nullptr), m_mutationCount(0), m_name(name),
+	    m_enforceEncodingType(false), m_keyProvider(keyProvider), m_pBuffer(nullptr), m_mutationCount(0),
+	    m_mutationBytes(0), m_name(name),
 	    m_logID(logID), m_pBoundaryVerifier(DecodeBoundaryVerifier::getVerifier(name)) {
 		m_pDecodeCacheMemory = m_pager->getPageCachePenaltySource();
 		m_lazyClearActor = 0;
@@ -5146,6 +5301,29 @@ public:
 			    (freedPages >= SERVER_KNOBS->REDWOOD_LAZY_CLEAR_MAX_PAGES)) {
 				break;
 			}
+
+			// Pace the next batch based on foreground IO pressure, unless the queue is deep enough that falling
+			// further behind risks unreclaimed disk space.  Waiters on the pager's IO lock mean foreground
+			// operations are queued behind the disk, so cleanup reads should yield bandwidth to them.  Don't
+			// pace while a stop has been requested as the commit path is waiting on this actor.
+			if (!self->m_lazyClearStop && g_redwoodMetrics.ioLock != nullptr &&
+			    self->m_lazyClearQueue.numEntries < SERVER_KNOBS->REDWOOD_LAZY_CLEAR_URGENT_QUEUE_PAGES) {
+				double backoff = std::min(g_redwoodMetrics.ioLock->getWaitersCount() *
+				                              SERVER_KNOBS->REDWOOD_CLEANUP_IO_BACKOFF_PER_WAITER,
+				                          SERVER_KNOBS->REDWOOD_CLEANUP_IO_MAX_BACKOFF);
+				if (backoff > 0) {
+					debug_printf("LazyClear: backoff %f ioWaiters=%d queueEntries=%" PRId64 "\n",
+					             backoff,
+					             g_redwoodMetrics.ioLock->getWaitersCount(),
+					             self->m_lazyClearQueue.numEntries);
+					++g_redwoodMetrics.metric.lazyClearBackoff;
+					wait(delay(backoff));
+					// A stop may have been requested while waiting
+					if (freedPages >= SERVER_KNOBS->REDWOOD_LAZY_CLEAR_MIN_PAGES && self->m_lazyClearStop) {
+						break;
+					}
+				}
+			}
 		}
 
 		debug_printf("LazyClear: freed %d pages, %s has %" PRId64 " entries\n",
@@ -5370,6 +5548,23 @@ public:
 		return m_latestCommit;
 	}
 
+	ACTOR static Future<Void> canCommit_impl(VersionedBTree* self) {
+		while (self->m_inFlightMutationBytes.get() > SERVER_KNOBS->REDWOOD_COMMIT_PIPELINE_MAX_MUTATION_BYTES) {
+			wait(self->m_inFlightMutationBytes.onChange());
+		}
+		return Void();
+	}
+
+	// Ready when the memory held by mutation buffers owned by in-flight commits is within budget.
+	// Callers that pipeline commits should wait on this before starting another one.  Mutations can
+	// still be added while waiting, they will be part of a later commit.
+	Future<Void> canCommit() {
+		if (m_inFlightMutationBytes.get() <= SERVER_KNOBS->REDWOOD_COMMIT_PIPELINE_MAX_MUTATION_BYTES) {
+			return Void();
+		}
+		return canCommit_impl(this);
+	}
+
 	// Clear all btree data, allow pager remap to fully process its queue, and verify final
 	// page counts in pager and queues.
 	ACTOR static Future<Void> clearAllAndCheckSanity_impl(VersionedBTree* self) {
@@ -5642,6 +5837,12 @@ private:
 	// The mutation buffer currently being written to
 	std::unique_ptr<MutationBuffer> m_pBuffer;
 	int64_t m_mutationCount;
+	int64_t m_mutationBytes;
+
+	// Key and value bytes in mutation buffers owned by commits that have not finished yet.  The commit
+	// pipeline accepts another commit only while this is within the configured budget, which bounds the
+	// memory held by buffers whose page writes are still in flight.
+	AsyncVar<int64_t> m_inFlightMutationBytes;
 	DecodeBoundaryVerifier* m_pBoundaryVerifier;
 
 	struct CommitBatch {
@@ -5650,6 +5851,7 @@ private:
 		Version newOldestVersion;
 		std::unique_ptr<MutationBuffer> mutations;
 		int64_t mutationCount;
+		int64_t mutationBytes;
 		Reference<IPagerSnapshot> snapshot;
 	};
 
@@ -6782,6 +6984,79 @@ private:
 		debug_printf("%s rootID=%s\n", context.c_str(), toString(rootID).c_str());
 		debug_print(addPrefix(context, update->toString()));
 
+		// Bulk replacement fast path:  If the mutation buffer range fully clears this leaf's subtree key
+		// range, then no existing record can survive the merge, so the existing page contents are
+		// irrelevant.  Skip reading the page and build replacement pages bottom-up directly from the
+		// sorted set mutations.  This is the shape fetchKeys produces when a shard moves onto this
+		// storage server over existing data:  a clear of the whole range plus sorted sets of the
+		// incoming records, all in one commit.
+		if (height == 1 && SERVER_KNOBS->REDWOOD_REPLACED_LEAF_SKIP_READ && mBegin != mEnd) {
+			bool fullyCleared = true;
+			{
+				auto i = mBegin;
+				bool first = true;
+				while (i != mEnd) {
+					const RangeMutation& m = i.mutation();
+					// Records after the boundary key survive unless the range is cleared, and the record at
+					// the boundary key itself, if the boundary is within the subtree range, survives unless
+					// the boundary is changed (either cleared or set to a new value).
+					if (!m.clearAfterBoundary ||
+					    ((!first || i.key() == update->subtreeLowerBound.key) && !m.boundaryChanged)) {
+						fullyCleared = false;
+						break;
+					}
+					first = false;
+					++i;
+				}
+				// A record whose key equals the end boundary key can only be in this page if that key is
+				// the subtree upper bound, and it only gets removed if the end boundary is changed.
+				if (mEnd.key() == update->subtreeUpperBound.key && !mEnd.mutation().boundaryChanged) {
+					fullyCleared = false;
+				}
+			}
+
+			if (fullyCleared) {
+				CODE_PROBE(true, "Redwood replaced leaf built without reading the existing page");
+				++g_redwoodMetrics.level(height).metrics.replaceSkipRead;
+
+				state Standalone<VectorRef<RedwoodRecordRef>> replacement;
+				auto i = mBegin;
+				bool first = true;
+				while (i != mEnd) {
+					if (i.mutation().boundarySet() && (!first || i.key() == update->subtreeLowerBound.key)) {
+						replacement.push_back(replacement.arena(),
+						                      RedwoodRecordRef(i.key(), i.mutation().boundaryValue.get()));
+					}
+					first = false;
+					++i;
+				}
+
+				if (replacement.empty()) {
+					update->cleared();
+					self->freeBTreePage(height, rootID, batch->writeVersion);
+					debug_printf("%s Leaf replacement cleared all entries, returning slice:\n", context.c_str());
+					debug_print(addPrefix(context, update->toString()));
+					return Void();
+				}
+
+				// writePages() updates or frees the old page(s) at rootID itself.
+
+				Standalone<VectorRef<RedwoodRecordRef>> newEntries = wait(writePages(self,
+				                                                                     &update->subtreeLowerBound,
+				                                                                     &update->subtreeUpperBound,
+				                                                                     replacement,
+				                                                                     height,
+				                                                                     batch->writeVersion,
+				                                                                     rootID,
+				                                                                     parentID));
+				update->rebuilt(newEntries);
+
+				debug_printf("%s Leaf replacement complete, returning slice:\n", context.c_str());
+				debug_print(addPrefix(context, update->toString()));
+				return Void();
+			}
+		}
+
 		if (REDWOOD_DEBUG) {
 			[[maybe_unused]] int c = 0;
 			auto i = mBegin;
@@ -7548,6 +7823,9 @@ private:
 		self->m_pBuffer.reset(new MutationBuffer());
 		batch.mutationCount = self->m_mutationCount;
 		self->m_mutationCount = 0;
+		batch.mutationBytes = self->m_mutationBytes;
+		self->m_mutationBytes = 0;
+		self->m_inFlightMutationBytes.set(self->m_inFlightMutationBytes.get() + batch.mutationBytes);
 
 		batch.writeVersion = writeVersion;
 		batch.newOldestVersion = self->m_newOldestVersion;
@@ -7560,6 +7838,7 @@ private:
 		if (writeVersion == self->m_pager->getLastCommittedVersion()) {
 			ASSERT(batch.mutationCount == 0);
 			debug_printf("%s: Empty commit at repeat version %" PRId64 "\n", self->m_name.c_str(), batch.writeVersion);
+			self->m_inFlightMutationBytes.set(self->m_inFlightMutationBytes.get() - batch.mutationBytes);
 			return Void();
 		}
 
@@ -7630,6 +7909,9 @@ private:
 		++g_redwoodMetrics.metric.opCommit;
 		self->m_lazyClearActor = forwardError(incrementalLazyClear(self), self->m_errorPromise);
 
+		// This batch's mutation buffer can be freed now, so wake anything waiting on pipeline capacity
+		self->m_inFlightMutationBytes.set(self->m_inFlightMutationBytes.get() - batch.mutationBytes);
+
 		return Void();
 	}
 
@@ -8085,6 +8367,8 @@ public:
 
 	Future<Void> onClosed() const override { return m_closed.getFuture(); }
 
+	Future<Void> canCommit() override { return catchError(m_tree->canCommit()); }
+
 	Future<Void> commit(bool sequential = false) override {
 		m_lastCommit = catchError(m_tree->commit(m_nextCommitVersion));
 		// Currently not keeping history
@@ -8154,7 +8438,8 @@ public:
 			}
 
 			if (self->prefetch) {
-				cur.prefetch(keys.end, true, rowLimit, byteLimit);
+				cur.prefetch(
+				    keys.end, true, rowLimit, std::min(byteLimit, SERVER_KNOBS->REDWOOD_RANGE_PREFETCH_WINDOW_BYTES));
 			}
 
 			while (cur.isValid()) {
@@ -8197,6 +8482,18 @@ public:
 				}
 				cur.popPath();
 				wait(cur.moveNext());
+
+				// Extend the readahead window from the new leaf's position so that sibling reads stay
+				// in flight while this leaf is consumed.  Re-arming on each leaf transition also
+				// carries the readahead across parent page boundaries, which a single prefetch from
+				// the first leaf cannot cross.
+				if (self->prefetch && cur.isValid()) {
+					cur.prefetch(keys.end,
+					             true,
+					             rowLimit,
+					             std::min(byteLimit - accumulatedBytes,
+					                      SERVER_KNOBS->REDWOOD_RANGE_PREFETCH_WINDOW_BYTES));
+				}
 			}
 		} else {
 			f = cur.seekLT(keys.end);
@@ -8209,7 +8506,8 @@ public:
 			}
 
 			if (self->prefetch) {
-				cur.prefetch(keys.begin, false, -rowLimit, byteLimit);
+				cur.prefetch(
+				    keys.begin, false, -rowLimit, std::min(byteLimit, SERVER_KNOBS->REDWOOD_RANGE_PREFETCH_WINDOW_BYTES));
 			}
 
 			while (cur.isValid()) {
@@ -8252,6 +8550,15 @@ public:
 				}
 				cur.popPath();
 				wait(cur.movePrev());
+
+				// As above, keep the readahead window ahead of consumption in the reverse direction.
+				if (self->prefetch && cur.isValid()) {
+					cur.prefetch(keys.begin,
+					             false,
+					             -rowLimit,
+					             std::min(byteLimit - accumulatedBytes,
+					                      SERVER_KNOBS->REDWOOD_RANGE_PREFETCH_WINDOW_BYTES));
+				}
 			}
 		}
 
@@ -8842,6 +9149,8 @@ void RedwoodMetrics::getFields(TraceEvent* e, std::string* s, bool skipZeroes) {
 		                                               { "PagerRemapFree", metric.pagerRemapFree },
 		                                               { "PagerRemapCopy", metric.pagerRemapCopy },
 		                                               { "PagerRemapSkip", metric.pagerRemapSkip },
+		                                               { "PagerRemapBackoff", metric.pagerRemapBackoff },
+		                                               { "LazyClearBackoff", metric.lazyClearBackoff },
 		                                               { "", 0 } };
 
 	double elapsed = now() - startTime;
@@ -8899,6 +9208,7 @@ void RedwoodMetrics::getFields(TraceEvent* e, std::string* s, bool skipZeroes) {
 			{ "PageRead", metric.pageRead },
 			{ "PageReadExt", metric.pageReadExt },
 			{ "PageCommitStart", metric.pageCommitStart },
+			{ "ReplaceSkipRead", metric.replaceSkipRead },
 			{ "", 0 },
 			{ "LazyClearInt", metric.lazyClearRequeue },
 			{ "LazyClearIntExt", metric.lazyClearRequeueExt },
@@ -640,8 +640,8 @@ static void printUsage(const char* name, bool devhelp) {
 	                 " Sets the LogGroup field with the specified value for all"
 	                 " events in the trace output (defaults to `default').");
 	printOptionUsage("--trace-format FORMAT",
-	                 " Select the format of the log files. xml (the default) and json"
-	                 " are supported.");
+	                 " Select the format of the log files. xml (the default), json and"
+	                 " binary are supported.");
 	printOptionUsage("--tracer       TRACER",
 	                 " Select a tracer for transaction tracing. Currently disabled"
 	                 " (the default) and log_file are supported.");
@@ -684,7 +684,8 @@ static void printUsage(const char* name, bool devhelp) {
 		printOptionUsage("-r ROLE, --role ROLE",
 		                 " Server role (valid options are fdbd, test, multitest,"
 		                 " simulation, networktestclient, networktestserver, restore"
-		                 " consistencycheck, kvfileintegritycheck, kvfilegeneratesums, kvfiledump, unittests)."
+		                 " consistencycheck, kvfileintegritycheck, kvfilegeneratesums, kvfiledump,"
+		                 " kvstoretracereplay, unittests)."
 		                 " The default is `fdbd'.");
 #ifdef _WIN32
 		printOptionUsage("-n, --newconsole", " Create a new console.");
@@ -699,7 +700,8 @@ static void printUsage(const char* name, bool devhelp) {
 		printOptionUsage("-k KEY, --key KEY", "Target key for search role.");
 		printOptionUsage("--kvfile FILE",
 		                 "Input file (SQLite database file) for use by the 'kvfilegeneratesums', "
-		                 "'kvfileintegritycheck' and 'kvfiledump' roles.");
+		                 "'kvfileintegritycheck' and 'kvfiledump' roles, or the operation trace file "
+		                 "for the 'kvstoretracereplay' role.");
 		printOptionUsage("-b [on,off], --buggify [on,off]", " Sets Buggify system state, defaults to `off'.");
 		printOptionUsage("-fi [on,off], --fault-injection [on,off]", " Sets fault injection, defaults to `on'.");
 		printOptionUsage("--crash", "Crash on serious errors instead of continuing.");
@@ -753,6 +755,13 @@ static void printUsage(const char* name, bool devhelp) {
 		       " - FDB_DUMP_ENDKEY: end key for the dump, default is \"\\xff\\xff\"\n"
 		       " - FDB_DUMP_DEBUG: print key-values to stderr in escaped format\n");
 
+		printf("\n"
+		       "The 'kvstoretracereplay' role replays an operation trace recorded by setting the\n"
+		       "knob kvstore_op_trace_dir on a storage server, against a fresh store created in\n"
+		       "--datadir, and prints latency histograms per operation type. The engine is chosen\n"
+		       "with the FDB_REPLAY_STORE_TYPE environment variable (e.g. ssd-2, ssd-redwood-1,\n"
+		       "ssd-rocksdb-v1, memory), default ssd-2.\n");
+
 		printf(
 		    "\n"
 		    "The 'changedescription' role replaces the old cluster key in all coordinators' data file to the specified "
@@ -1018,6 +1027,7 @@ enum class ServerRole {
 	KVFileGenerateIOLogChecksums,
 	KVFileIntegrityCheck,
 	KVFileDump,
+	KVStoreTraceReplay,
 	MultiTester,
 	NetworkTestClient,
 	NetworkTestServer,
@@ -1294,6 +1304,8 @@ private:
 					role = ServerRole::KVFileGenerateIOLogChecksums;
 				else if (!strcmp(sRole, "kvfiledump"))
 					role = ServerRole::KVFileDump;
+				else if (!strcmp(sRole, "kvstoretracereplay"))
+					role = ServerRole::KVStoreTraceReplay;
 				else if (!strcmp(sRole, "consistencycheck"))
 					role = ServerRole::ConsistencyCheck;
 				else if (!strcmp(sRole, "unittests"))
@@ -1787,7 +1799,8 @@ private:
 		    });
 		if ((role != ServerRole::Simulation && role != ServerRole::CreateTemplateDatabase &&
 		     role != ServerRole::KVFileIntegrityCheck && role != ServerRole::KVFileGenerateIOLogChecksums &&
-		     role != ServerRole::KVFileDump && role != ServerRole::UnitTests) ||
+		     role != ServerRole::KVFileDump && role != ServerRole::KVStoreTraceReplay &&
+		     role != ServerRole::UnitTests) ||
 		    autoPublicAddress) {
 
 			if (seedSpecified && !fileExists(connFile)) {
@@ -2436,6 +2449,11 @@ int main(int argc, char* argv[]) {
 		} else if (role == ServerRole::KVFileDump) {
 			f = stopAfter(KVFileDump(opts.kvFile));
 			g_network->run();
+		} else if (role == ServerRole::KVStoreTraceReplay) {
+			const char* storeTypeEnv = getenv("FDB_REPLAY_STORE_TYPE");
+			f = stopAfter(KVStoreTraceReplay(
+			    opts.kvFile, storeTypeEnv != nullptr ? storeTypeEnv : "ssd-2", opts.dataFolder));
+			g_network->run();
 		} else if (role == ServerRole::ChangeClusterKey) {
 			Key newClusterKey(opts.newClusterKey);
 			Key oldClusterKey = opts.connectionFile->getConnectionString().clusterKey();
@@ -110,6 +110,9 @@ struct RecruitWorkersInfo : ReferenceCounted<RecruitWorkersInfo> {
 	RecruitFromConfigurationReply rep;
 	AsyncTrigger waitForCompletion;
 	Optional<UID> dbgId;
+	// The recruitmentInputsGeneration at which this request last failed; re-running recruitment before the
+	// generation advances would fail identically, so outstanding request checks skip it
+	int64_t lastEvalGeneration = -1;
 
 	RecruitWorkersInfo(RecruitFromConfigurationRequest const& req) : req(req) {}
 };
@@ -119,6 +122,7 @@ struct RecruitRemoteWorkersInfo : ReferenceCounted<RecruitRemoteWorkersInfo> {
 	RecruitRemoteFromConfigurationReply rep;
 	AsyncTrigger waitForCompletion;
 	Optional<UID> dbgId;
+	int64_t lastEvalGeneration = -1; // see RecruitWorkersInfo::lastEvalGeneration
 
 	RecruitRemoteWorkersInfo(RecruitRemoteFromConfigurationRequest const& req) : req(req) {}
 };
@@ -3360,6 +3364,15 @@ public:
 	Reference<AsyncVar<Optional<UID>>> clusterId;
 	std::vector<Reference<RecruitWorkersInfo>> outstandingRecruitmentRequests;
 	std::vector<Reference<RecruitRemoteWorkersInfo>> outstandingRemoteRecruitmentRequests;
+	// Incremented whenever the inputs to recruitment fitness change (worker arrival/removal, process class,
+	// priority, degradation or exclusion changes); outstanding recruitment requests that already failed at the
+	// current generation are not re-evaluated until it advances
+	int64_t recruitmentInputsGeneration = 0;
+	// Coordinator address resolution cache shared by worker registrations, so a registration storm during a
+	// whole-cluster restart does not resolve the connection string's hostnames once per request
+	std::string cachedCoordinatorAddressesKey;
+	std::vector<NetworkAddress> cachedCoordinatorAddresses;
+	double cachedCoordinatorAddressesTime = -1;
 	std::vector<std::pair<RecruitStorageRequest, double>> outstandingStorageRequests;
 	std::vector<std::pair<RecruitBlobWorkerRequest, double>> outstandingBlobWorkerRequests;
 	ActorCollection ac;
@@ -371,9 +371,6 @@ protected:
 
 	bool isMachineHealthy(Reference<TCMachineInfo> const& machine) const;
 
-	// Return the healthy server with the least number of correct-size server teams
-	Reference<TCServerInfo> findOneLeastUsedServer() const;
-
 	// A server team should always come from servers on a machine team
 	// Check if it is true
 	bool isOnSameMachineTeam(TCTeamInfo const& team) const;
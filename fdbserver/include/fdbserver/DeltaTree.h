@@ -1357,18 +1357,30 @@ public:
 			int nIndex = rootIndex();
 			int cmp = 0;
 
+			// Lengths of the common prefix between s and the tightest lower and upper bounds of the
+			// subtree being descended into.  Every item in that subtree shares the shorter of the two
+			// prefixes with s, so compares can start past those bytes.  The caller's skipLen makes the
+			// same promise for the entire tree.
+			int leftPrefixLen = skipLen;
+			int rightPrefixLen = skipLen;
+
 			while (nIndex != -1) {
 				nodeIndex = nIndex;
 				item.reset();
-				cmp = s.compare(get(), skipLen);
+				int prefixLen = s.getCommonPrefixLen(get(), std::min(leftPrefixLen, rightPrefixLen));
+				cmp = s.compare(get(), prefixLen);
 				deltatree_printf("seek(%s) loop cmp=%d %s\n", s.toString().c_str(), cmp, toString().c_str());
 				if (cmp == 0) {
 					break;
 				}
 
 				if (cmp > 0) {
+					// s is greater, so this node becomes the subtree's lower bound
+					leftPrefixLen = prefixLen;
 					nIndex = getRightChildIndex(nIndex);
 				} else {
+					// s is less, so this node becomes the subtree's upper bound
+					rightPrefixLen = prefixLen;
 					nIndex = getLeftChildIndex(nIndex);
 				}
 			}
@@ -46,13 +46,20 @@ class GrvProxyTagThrottler {
 		explicit DelayedRequest(GetReadVersionRequest const& req)
 		  : req(req), startTime(now()), sequenceNumber(++lastSequenceNumber) {}
 
-		void updateProxyTagThrottledDuration(LatencyBandsMap&);
+		void updateProxyTagThrottledDuration(LatencyBandsMap&, LatencyBandsMap::Handle&);
 		bool isMaxThrottled(double maxThrottleDuration) const;
 	};
 
 	struct TagQueue {
 		Optional<GrvTransactionRateInfo> rateInfo;
 		Deque<DelayedRequest> requests;
+		// Number of transactions released from this queue in the current release window.
+		// Stored here so releaseTransactions can account per-tag releases without any
+		// per-tag map lookups.
+		uint32_t releasedInWindow{ 0 };
+		// Cached reference to this tag's latency bands, so per-release latency
+		// measurements skip the tag hash lookup
+		LatencyBandsMap::Handle bandsHandle;
 
 		TagQueue() = default;
 		explicit TagQueue(double rate) : rateInfo(rate) {}
@@ -168,6 +168,7 @@ extern IKeyValueStore* keyValueStoreMemory(std::string const& basename,
                                            int64_t memoryLimit,
                                            std::string ext = "fdq",
                                            KeyValueStoreType storeType = KeyValueStoreType::MEMORY);
+extern IKeyValueStore* keyValueStoreTraceRecorder(IKeyValueStore* store, std::string const& traceFile);
 extern IKeyValueStore* keyValueStoreLogSystem(class IDiskQueue* queue,
                                               Reference<AsyncVar<ServerDBInfo> const> db,
                                               UID logID,
@@ -204,33 +205,51 @@ inline IKeyValueStore* openKVStore(KeyValueStoreType storeType,
 	if (openRemotely) {
 		return openRemoteKVStore(storeType, filename, logID, memoryLimit, checkChecksums, checkIntegrity);
 	}
+	IKeyValueStore* store = nullptr;
 	switch (storeType) {
 	case KeyValueStoreType::SSD_BTREE_V1:
-		return keyValueStoreSQLite(filename, logID, KeyValueStoreType::SSD_BTREE_V1, false, checkIntegrity);
+		store = keyValueStoreSQLite(filename, logID, KeyValueStoreType::SSD_BTREE_V1, false, checkIntegrity);
+		break;
 	case KeyValueStoreType::SSD_BTREE_V2:
-		return keyValueStoreSQLite(filename, logID, KeyValueStoreType::SSD_BTREE_V2, checkChecksums, checkIntegrity);
+		store = keyValueStoreSQLite(filename, logID, KeyValueStoreType::SSD_BTREE_V2, checkChecksums, checkIntegrity);
+		break;
 	case KeyValueStoreType::MEMORY:
-		return keyValueStoreMemory(filename, logID, memoryLimit);
+		store = keyValueStoreMemory(filename, logID, memoryLimit);
+		break;
 	case KeyValueStoreType::SSD_REDWOOD_V1:
-		return keyValueStoreRedwoodV1(filename, logID, db, encryptionMode);
+		store = keyValueStoreRedwoodV1(filename, logID, db, encryptionMode);
+		break;
 	case KeyValueStoreType::SSD_ROCKSDB_V1:
-		return keyValueStoreRocksDB(filename, logID, storeType);
+		store = keyValueStoreRocksDB(filename, logID, storeType);
+		break;
 	case KeyValueStoreType::SSD_SHARDED_ROCKSDB:
-		return keyValueStoreShardedRocksDB(filename, logID, storeType, checkChecksums, checkIntegrity);
+		store = keyValueStoreShardedRocksDB(filename, logID, storeType, checkChecksums, checkIntegrity);
+		break;
 	case KeyValueStoreType::MEMORY_RADIXTREE:
-		return keyValueStoreMemory(filename,
-		                           logID,
-		                           memoryLimit,
-		                           "fdr",
-		                           KeyValueStoreType::MEMORY_RADIXTREE); // for radixTree type, set file ext to "fdr"
+		store = keyValueStoreMemory(filename,
+		                            logID,
+		                            memoryLimit,
+		                            "fdr",
+		                            KeyValueStoreType::MEMORY_RADIXTREE); // for radixTree type, set file ext to "fdr"
+		break;
 	default:
 		UNREACHABLE();
 	}
-	UNREACHABLE(); // FIXME: is this right?
+	// When an operation trace directory is configured, storage stores record their operation
+	// stream (op types, sizes, think times -- never key or value contents) for later replay
+	// against any engine with the kvstoretracereplay server role.
+	if (!SERVER_KNOBS->KVSTORE_OP_TRACE_DIR.empty() && StringRef(basename(filename)).startsWith("storage-"_sr)) {
+		store = keyValueStoreTraceRecorder(
+		    store, joinPath(SERVER_KNOBS->KVSTORE_OP_TRACE_DIR, basename(filename) + ".optrace"));
+	}
+	return store;
 }
 
 void GenerateIOLogChecksumFile(std::string filename);
 Future<Void> KVFileCheck(std::string const& filename, bool const& integrity);
 Future<Void> KVFileDump(std::string const& filename);
+Future<Void> KVStoreTraceReplay(std::string const& traceFile,
+                                std::string const& storeTypeStr,
+                                std::string const& dataFolder);
 
 #endif
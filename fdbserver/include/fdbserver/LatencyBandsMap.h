@@ -45,16 +45,32 @@ class LatencyBandsMap {
 	// added by LatencyBands)
 	std::vector<double> thresholds;
 
-	// Get or create an LatencyBands object stored in map.
-	// Updates the lastUpdated field corresponding to this LatencyBands object.
+	// Incremented whenever a tag is erased from the map, invalidating cached Handles
+	uint64_t generation = 0;
+
+	// Get or create an ExpirableBands object stored in map.
+	// Updates the lastUpdated field corresponding to this object.
 	// Returns pointer to this object, or an empty optional if object
 	// cannot be created.
-	Optional<LatencyBands*> getLatencyBands(TransactionTag tag);
+	Optional<ExpirableBands*> getLatencyBands(TransactionTag tag);
 
 public:
+	// A cached reference to a tag's latency bands, letting callers that hold one
+	// per tag skip the per-measurement map lookup. Stale handles (the tag expired
+	// from the map) are transparently re-resolved.
+	class Handle {
+		friend class LatencyBandsMap;
+		ExpirableBands* entry = nullptr;
+		uint64_t generation = 0;
+
+	public:
+		Handle() = default;
+	};
+
 	LatencyBandsMap(std::string const& name, UID id, double loggingInterval, int maxSize);
 
 	void addMeasurement(TransactionTag tag, double measurement, int count = 1);
+	void addMeasurement(TransactionTag tag, Handle& handle, double measurement, int count = 1);
 	void addThreshold(double value);
 	int size() const { return map.size(); }
 };
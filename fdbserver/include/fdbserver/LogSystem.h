@@ -226,6 +226,14 @@ struct ILogSystem {
 		int fastReplies;
 		int unknownReplies;
 
+		// Smoothed estimates of reply size, reply latency, and delivered throughput, used by
+		// serverPeekParallelGetMore to size the request pipeline to the link's bandwidth-delay
+		// product when PARALLEL_PEEK_WINDOW_BYTES is set. Zero until the first reply arrives.
+		double estReplyBytes;
+		double estReplyLatency;
+		double estBytesPerSecond;
+		double lastReplyTime;
+
 		ServerPeekCursor(Reference<AsyncVar<OptionalInterface<TLogInterface>>> const& interf,
 		                 Tag tag,
 		                 Version begin,
@@ -741,7 +749,9 @@ struct LogPushData : NonCopyable {
 	// Log subsequences have to start at 1 (the MergedPeekCursor relies on this to make sure we never have !hasMessage()
 	// in the middle of data for a version
 
-	explicit LogPushData(Reference<ILogSystem> logSystem, int tlogCount);
+	// "messageBytesHint", if nonzero, pre-sizes each location's message buffer so that
+	// writing up to that many bytes does not reallocate and copy the buffer.
+	explicit LogPushData(Reference<ILogSystem> logSystem, int tlogCount, int messageBytesHint = 0);
 
 	void addTxsTag();
 
@@ -807,6 +817,16 @@ struct LogPushData : NonCopyable {
 	// Returns the total number of mutations.
 	uint32_t getMutationCount() const { return subsequence; }
 
+	// Returns the size in bytes of the largest single location's message stream,
+	// suitable as a buffer size hint for subsequent version batches.
+	int getMaxMessageBytes() const {
+		int maxBytes = 0;
+		for (const auto& wr : messagesWriter) {
+			maxBytes = std::max(maxBytes, wr.getLength());
+		}
+		return maxBytes;
+	}
+
 	// Sets mutations for all internal writers. "mutations" is the output from
 	// getAllMessages() and is used before writing any other mutations.
 	void setMutations(uint32_t totalMutations, VectorRef<StringRef> mutations);
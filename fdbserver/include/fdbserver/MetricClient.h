@@ -46,6 +46,8 @@ private:
 	MsgpackBuffer buf;
 	std::string address;
 	int port;
+	// Last cumulative value emitted per sum, for delta encoding of the exported series
+	std::unordered_map<UID, int64_t> lastSumValue;
 	void send_packet(int fd, const void* data, size_t len);
 
 public:
@@ -198,6 +198,26 @@ protected:
 	void byteSampleApplyClear(KeyRangeRef const& range);
 };
 
+// One shard of a serialized cluster snapshot: its range, the servers holding a replica, and the
+// per-replica size in bytes. A production shard map and team configuration exported in this form
+// can be loaded into a MockGlobalState to answer what-if questions about planned topology changes
+// offline, instead of discovering the rebalance cost in production.
+struct ShardSnapshot {
+	KeyRange range;
+	std::vector<UID> servers;
+	int64_t bytes;
+};
+
+// The predicted cost of a planned topology change: how much data distribution would move, where
+// the transient fetch and serve load would land, and roughly how long the movement would take.
+struct TopologyChangePlan {
+	int64_t movementBytes = 0;
+	int shardsMoved = 0;
+	double estimatedSeconds = 0;
+	std::map<UID, int64_t> inboundBytes; // transient fetch load per destination server
+	std::map<UID, int64_t> outboundBytes; // transient serve load per source server
+};
+
 class MockGlobalStateImpl;
 
 class MockGlobalState : public IKeyLocationService {
@@ -302,6 +322,25 @@ public:
 	// Similar as getRange, but need to change shardTotalBytes because this is a clear operation.
 	int64_t clearRange(KeyRangeRef const& range);
 
+	// what-if capacity planning
+
+	// Populate servers, shard sizes, and team mapping from a serialized cluster snapshot
+	void loadShardMapSnapshot(const std::vector<ShardSnapshot>& shards,
+	                          const DatabaseConfiguration& conf,
+	                          uint64_t defaultDiskSpace = MockStorageServer::DEFAULT_DISK_SPACE);
+
+	// Predict the re-replication cost of removing the given servers. Replacement replicas are
+	// placed on the least-loaded surviving servers, the way team selection would.
+	TopologyChangePlan planServerRemoval(const std::vector<UID>& serversToRemove) const;
+
+	// Predict the rebalance cost of adding the given empty servers: replicas flow from servers
+	// above the post-change average onto the newcomers, at shard granularity.
+	TopologyChangePlan planServerAddition(const std::vector<UID>& newServers) const;
+
+	// Predict the cost of changing the replication team size. Decreasing replication deletes
+	// replicas in place and needs no movement.
+	TopologyChangePlan planReplicationChange(int newStorageTeamSize) const;
+
 	// convenient shortcuts for test
 	std::vector<Future<Void>> runAllMockServers();
 	Future<Void> runMockServer(const UID& id);
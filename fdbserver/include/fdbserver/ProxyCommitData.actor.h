@@ -228,8 +228,14 @@ struct ProxyCommitData {
 	NotifiedVersion latestLocalCommitBatchResolving;
 	NotifiedVersion latestLocalCommitBatchLogging;
 
+	// Bounds how many commit batches may be between the start of pre-resolution and their reply. The stages
+	// themselves are pipelined through the NotifiedVersions above; this limits the depth of that pipeline.
+	FlowLock commitBatchInFlightLock;
+
 	PublicRequestStream<GetReadVersionRequest> getConsistentReadVersion;
 	PublicRequestStream<CommitTransactionRequest> commit;
+	// Tenantless location requests accumulated by readRequestServer and answered in batches
+	Deque<GetKeyServerLocationsRequest> pendingKeyServerLocationRequests;
 	Database cx;
 	Reference<AsyncVar<ServerDBInfo> const> db;
 	EventMetricHandle<SingleKeyMutation> singleKeyMutationEvent;
@@ -254,6 +260,9 @@ struct ProxyCommitData {
 	double lastMasterReset;
 	double lastResolverReset;
 	int localTLogCount = -1;
+	// Decaying high-water mark of the per-location message bytes pushed to the tlogs,
+	// used to pre-size the next batch's LogPushData buffers.
+	int pushedMessageBytesHint = 0;
 
 	EncryptionAtRestMode encryptMode;
 
@@ -330,12 +339,16 @@ struct ProxyCommitData {
 	    minKnownCommittedVersion(0), version(0), lastVersionTime(0), commitVersionRequestNumber(1),
 	    mostRecentProcessedRequestNumber(0), firstProxy(firstProxy), encryptMode(encryptMode), provisional(provisional),
 	    lastCoalesceTime(0), locked(false), commitBatchInterval(SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_MIN),
-	    localCommitBatchesStarted(0), getConsistentReadVersion(getConsistentReadVersion), commit(commit),
+	    localCommitBatchesStarted(0), commitBatchInFlightLock(SERVER_KNOBS->PROXY_MAX_IN_FLIGHT_COMMIT_BATCHES),
+	    getConsistentReadVersion(getConsistentReadVersion), commit(commit),
 	    cx(openDBOnServer(db, TaskPriority::DefaultEndpoint, LockAware::True)), db(db),
 	    singleKeyMutationEvent("SingleKeyMutation"_sr), lastTxsPop(0), popRemoteTxs(false), lastStartCommit(0),
 	    lastCommitLatency(SERVER_KNOBS->REQUIRED_MIN_RECOVERY_DURATION), lastCommitTime(0), lastMasterReset(now()),
 	    lastResolverReset(now()) {
 		commitComputePerOperation.resize(SERVER_KNOBS->PROXY_COMPUTE_BUCKETS, 0.0);
+		specialCounter(stats.cc, "CommitBatchesInFlight", [this]() {
+			return this->commitBatchInFlightLock.activePermits();
+		});
 	}
 };
 
@@ -191,6 +191,10 @@ class Ratekeeper {
 	double lastWarning;
 	double lastSSListFetchedTimestamp;
 
+	// Set once the first storage server list fetch completes, so recruitment is only acknowledged after
+	// this ratekeeper has warmed its view of the storage fleet
+	Promise<Void> serverListReady;
+
 	std::unique_ptr<class ITagThrottler> tagThrottler;
 
 	// Maps storage server ID to storage server interface
@@ -241,7 +245,9 @@ class Ratekeeper {
 	Future<Void> monitorBlobWorkers(Reference<AsyncVar<ServerDBInfo> const> dbInfo);
 
 public:
-	static Future<Void> run(RatekeeperInterface rkInterf, Reference<AsyncVar<ServerDBInfo> const> dbInfo);
+	static Future<Void> run(RatekeeperInterface rkInterf,
+	                        Reference<AsyncVar<ServerDBInfo> const> dbInfo,
+	                        ReplyPromise<RatekeeperInterface> recruitReply);
 };
 
 #endif // FDBSERVER_RATEKEEPER_H
@@ -35,6 +35,7 @@
 #include "fdbrpc/FlowProcess.actor.h"
 #include "fdbrpc/FlowTransport.h"
 #include "fdbrpc/fdbrpc.h"
+#include "fdbclient/CommitTransaction.h"
 #include "fdbclient/FDBTypes.h"
 #include "fdbserver/FDBExecHelper.actor.h"
 #include "fdbserver/IKeyValueStore.h"
@@ -76,6 +77,7 @@ struct IKVSInterface {
 	RequestStream<struct IKVSGetValueRequest> getValue;
 	RequestStream<struct IKVSSetRequest> set;
 	RequestStream<struct IKVSClearRequest> clear;
+	RequestStream<struct IKVSMutationsRequest> mutations;
 	RequestStream<struct IKVSCommitRequest> commit;
 	RequestStream<struct IKVSReadValuePrefixRequest> readValuePrefix;
 	RequestStream<struct IKVSReadRangeRequest> readRange;
@@ -103,6 +105,7 @@ struct IKVSInterface {
 		           getValue,
 		           set,
 		           clear,
+		           mutations,
 		           commit,
 		           readValuePrefix,
 		           readRange,
@@ -186,6 +189,20 @@ struct IKVSClearRequest {
 	}
 };
 
+// A batch of sets and clears, in the order they were issued against the IKeyValueStore interface. Shipping
+// them one message per batch rather than one message per mutation keeps the serialization and message
+// overhead of the process boundary off the storage write path (see REMOTE_KV_STORE_MUTATION_BATCH_BYTES).
+struct IKVSMutationsRequest {
+	constexpr static FileIdentifier file_identifier = 9862315;
+	Arena arena;
+	VectorRef<MutationRef> mutations;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, mutations, arena);
+	}
+};
+
 struct IKVSCommitRequest {
 	constexpr static FileIdentifier file_identifier = 2985129;
 	bool sequential;
@@ -360,6 +377,10 @@ struct RemoteIKeyValueStore : public IKeyValueStore {
 	Future<int> returnCode;
 	StorageBytes storageBytes;
 
+	// Sets and clears buffered for the next IKVSMutationsRequest (see REMOTE_KV_STORE_MUTATION_BATCH_BYTES)
+	IKVSMutationsRequest pendingMutations;
+	int64_t pendingMutationBytes = 0;
+
 	RemoteIKeyValueStore() : storageBytes(0, 0, 0, 0) {}
 
 	Future<Void> init() override {
@@ -388,27 +409,40 @@ struct RemoteIKeyValueStore : public IKeyValueStore {
 	KeyValueStoreType getType() const override { return interf.type(); }
 
 	void set(KeyValueRef keyValue, const Arena* arena = nullptr) override {
-		interf.set.send(IKVSSetRequest{ keyValue, ReplyPromise<Void>() });
+		if (SERVER_KNOBS->REMOTE_KV_STORE_MUTATION_BATCH_BYTES > 0) {
+			queueMutation(MutationRef(MutationRef::SetValue, keyValue.key, keyValue.value));
+		} else {
+			interf.set.send(IKVSSetRequest{ keyValue, ReplyPromise<Void>() });
+		}
 	}
 	void clear(KeyRangeRef range,
 	           const StorageServerMetrics* storageMetrics = nullptr,
 	           const Arena* arena = nullptr) override {
-		interf.clear.send(IKVSClearRequest{ range, ReplyPromise<Void>() });
+		if (SERVER_KNOBS->REMOTE_KV_STORE_MUTATION_BATCH_BYTES > 0) {
+			queueMutation(MutationRef(MutationRef::ClearRange, range.begin, range.end));
+		} else {
+			interf.clear.send(IKVSClearRequest{ range, ReplyPromise<Void>() });
+		}
 	}
 
 	Future<Void> commit(bool sequential = false) override {
+		flushMutations();
 		Future<IKVSCommitReply> commitReply =
 		    interf.commit.getReply(IKVSCommitRequest{ sequential, ReplyPromise<IKVSCommitReply>() });
 		return commitAndGetStorageBytes(this, commitReply);
 	}
 
 	Future<Optional<Value>> readValue(KeyRef key, Optional<ReadOptions> options = Optional<ReadOptions>()) override {
+		// Flush buffered mutations ahead of any read so the store applies them in the same order as the
+		// unbatched path would have
+		flushMutations();
 		return readValueImpl(this, IKVSGetValueRequest{ key, options, ReplyPromise<Optional<Value>>() });
 	}
 
 	Future<Optional<Value>> readValuePrefix(KeyRef key,
 	                                        int maxLength,
 	                                        Optional<ReadOptions> options = Optional<ReadOptions>()) override {
+		flushMutations();
 		return interf.readValuePrefix.getReply(
 		    IKVSReadValuePrefixRequest{ key, maxLength, options, ReplyPromise<Optional<Value>>() });
 	}
@@ -417,6 +451,7 @@ struct RemoteIKeyValueStore : public IKeyValueStore {
 	                              int rowLimit = 1 << 30,
 	                              int byteLimit = 1 << 30,
 	                              Optional<ReadOptions> options = Optional<ReadOptions>()) override {
+		flushMutations();
 		IKVSReadRangeRequest req{ keys, rowLimit, byteLimit, options, ReplyPromise<IKVSReadRangeReply>() };
 		return fmap([](const IKVSReadRangeReply& reply) { return reply.toRangeResult(); },
 		            interf.readRange.getReply(req));
@@ -428,6 +463,25 @@ struct RemoteIKeyValueStore : public IKeyValueStore {
 		kvsProcess = ObjectReader::fromStringRef<RemoteKVSProcessInterface>(intf, IncludeVersion());
 	}
 
+	// The caller's memory is only guaranteed to live until set()/clear() returns, so the mutation is
+	// copied into the batch arena rather than serialized immediately the way send() would
+	void queueMutation(MutationRef m) {
+		pendingMutations.mutations.push_back_deep(pendingMutations.arena, m);
+		pendingMutationBytes += m.expectedSize();
+		if (pendingMutationBytes >= SERVER_KNOBS->REMOTE_KV_STORE_MUTATION_BATCH_BYTES) {
+			flushMutations();
+		}
+	}
+
+	void flushMutations() {
+		if (pendingMutations.mutations.empty()) {
+			return;
+		}
+		interf.mutations.send(pendingMutations);
+		pendingMutations = IKVSMutationsRequest();
+		pendingMutationBytes = 0;
+	}
+
 	ACTOR static Future<Void> commitAndGetStorageBytes(RemoteIKeyValueStore* self,
 	                                                   Future<IKVSCommitReply> commitReplyFuture) {
 		IKVSCommitReply commitReply = wait(commitReplyFuture);
@@ -146,6 +146,7 @@ struct RestoreControllerData : RestoreRoleData, public ReferenceCounted<RestoreC
 	std::map<int, Reference<ControllerBatchStatus>> batchStatus;
 
 	AsyncVar<int> runningVersionBatches; // Currently running version batches
+	AsyncVar<int> loadingVersionBatches; // Version batches still in the loader parse-and-send phase
 
 	std::map<UID, double> rolesHeartBeatTime; // Key: role id; Value: most recent time controller receives heart beat
 
@@ -160,6 +161,7 @@ struct RestoreControllerData : RestoreRoleData, public ReferenceCounted<RestoreC
 		role = RestoreRole::Controller;
 		nodeID = interfId;
 		runningVersionBatches.set(0);
+		loadingVersionBatches.set(0);
 	}
 
 	~RestoreControllerData() override = default;
@@ -180,6 +182,7 @@ struct RestoreControllerData : RestoreRoleData, public ReferenceCounted<RestoreC
 		finishedBatch = NotifiedVersion(0);
 		versionBatchId = NotifiedVersion(0);
 		ASSERT(runningVersionBatches.get() == 0);
+		ASSERT(loadingVersionBatches.get() == 0);
 	}
 
 	std::string describeNode() const override {
@@ -109,27 +109,24 @@ public:
 	PromiseStream<KeyRange> restartShardTracker;
 
 private:
-	struct OrderByTeamKey {
-		bool operator()(const std::pair<Team, KeyRange>& lhs, const std::pair<Team, KeyRange>& rhs) const {
-			if (lhs.first < rhs.first)
-				return true;
-			if (lhs.first > rhs.first)
-				return false;
-			return lhs.second.begin < rhs.second.begin;
-		}
-	};
-
 	CheckMode checkMode = CheckMode::Normal;
 	KeyRangeMap<std::pair<std::vector<Team>, std::vector<Team>>>
 	    shard_teams; // A shard can be affected by the failure of multiple teams if it is a queued merge, or when
 	                 // usable_regions > 1
-	std::set<std::pair<Team, KeyRange>, OrderByTeamKey> team_shards;
+	// Each team's shard ranges as a flat vector sorted by begin key. Storing the team once per
+	// distinct team (rather than once per team x shard entry, as a flat set of pairs would)
+	// keeps memory proportional to the number of ranges, which is what dominates data
+	// distributor memory on large clusters. Ranges are kept at exact shard granularity, not
+	// coalesced, because check() relies on a one-to-one correspondence with shard_teams.
+	std::map<Team, std::vector<KeyRange>> team_shards;
 	std::map<UID, int> storageServerShards;
 
 	// only erase from team_shards
 	void erase(Team team, KeyRange const& range);
 	// only insert into team_shards
 	void insert(Team team, KeyRange const& range);
+	// whether team_shards has a range for this team starting at range.begin
+	bool hasShard(Team const& team, KeyRange const& range) const;
 
 	bool removeFailedServerForSingleRange(ShardsAffectedByTeamFailure::Team& team, const UID& id, KeyRangeRef keys);
 
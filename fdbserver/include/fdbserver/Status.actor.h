@@ -31,6 +31,8 @@
 #include "fdbserver/MasterInterface.h"
 #include "fdbclient/ClusterInterface.h"
 #include "fdbclient/Metacluster.h"
+#include "fdbclient/StorageServerInterface.h"
+#include "fdbclient/SystemData.h"
 
 #include "flow/actorcompiler.h" // has to be last include
 
@@ -52,9 +54,50 @@ Future<StatusReply> clusterGetStatus(
     Version const& datacenterVersionDifference,
     ConfigBroadcaster const* const& conifgBroadcaster,
     Optional<MetaclusterRegistrationEntry> const& metaclusterRegistration,
-    MetaclusterMetrics const& metaclusterMetrics);
+    MetaclusterMetrics const& metaclusterMetrics,
+    StatusSectionCache* const& sectionCache);
 
 struct WorkerEvents : std::map<NetworkAddress, TraceEventFields> {};
+typedef std::map<std::string, TraceEventFields> EventMap;
+
+struct StorageServerStatusInfo : public StorageServerInterface {
+	Optional<StorageMetadataType> metadata;
+	EventMap eventMap;
+	StorageServerStatusInfo(const StorageServerInterface& interface,
+	                        Optional<StorageMetadataType> metadata = Optional<StorageMetadataType>())
+	  : StorageServerInterface(interface), metadata(metadata) {}
+};
+
+// Cached results of the expensive per-subsystem gathers done by clusterGetStatus(), owned by the status
+// server and reused across requests. Each section records when it was gathered so the sections can be
+// refreshed on independent cadences, controlled by the STATUS_*_TTL knobs. The cached sections are
+// snapshots of the workers' latest metric trace events, which the workers themselves only refresh every
+// SYSTEM_MONITOR_INTERVAL, so serving them slightly stale does not lose information.
+struct StatusSectionCache {
+	template <class T>
+	struct Section {
+		double time = 0;
+		T data;
+		bool fresh(double ttl) const { return time > 0 && now() - time < ttl; }
+		void set(T const& value) {
+			data = value;
+			time = now();
+		}
+	};
+
+	Section<std::vector<Optional<std::pair<WorkerEvents, std::set<std::string>>>>> workerEvents;
+
+	// Serialized size of the previous round's per-process status entries, used
+	// to preallocate the builders for the next round
+	int lastProcessEntrySize = 0;
+	Section<ErrorOr<std::vector<StorageServerStatusInfo>>> storageServers;
+	Section<ErrorOr<std::vector<std::pair<TLogInterface, EventMap>>>> tLogs;
+	Section<ErrorOr<std::vector<std::pair<CommitProxyInterface, EventMap>>>> commitProxies;
+	Section<ErrorOr<std::vector<std::pair<GrvProxyInterface, EventMap>>>> grvProxies;
+};
+
+// Builds the reduced reply for StatusRequest::summaryOnly from a full status reply
+StatusReply statusSummaryReply(StatusReply const& full);
 ACTOR Future<Optional<std::pair<WorkerEvents, std::set<std::string>>>> latestEventOnWorkers(
     std::vector<WorkerDetails> workers,
     std::string eventName);
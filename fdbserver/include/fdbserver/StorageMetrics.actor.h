@@ -61,10 +61,17 @@ struct StorageMetricSample {
 struct TransientStorageMetricSample : StorageMetricSample {
 	Deque<std::pair<double, std::pair<Key, int64_t>>> queue;
 
-	explicit TransientStorageMetricSample(int64_t metricUnitsPerSample) : StorageMetricSample(metricUnitsPerSample) {}
+	// When positive, the granularity at which metrics are admitted adapts to keep the number of
+	// outstanding sampled adds near this target. See effectiveUnitsPerSample().
+	int64_t targetSampleSize;
+
+	explicit TransientStorageMetricSample(int64_t metricUnitsPerSample, int64_t targetSampleSize = 0)
+	  : StorageMetricSample(metricUnitsPerSample), targetSampleSize(targetSampleSize) {}
 
 	int64_t addAndExpire(const Key& key, int64_t metric, double expiration);
 
+	int64_t effectiveUnitsPerSample() const;
+
 	int64_t erase(KeyRef key);
 	void erase(KeyRangeRef keys);
 
@@ -73,7 +80,7 @@ struct TransientStorageMetricSample : StorageMetricSample {
 	void poll();
 
 private:
-	bool roll(int64_t metric) const;
+	bool roll(int64_t metric, int64_t unitsPerSample) const;
 
 	// return the sampled metric delta
 	int64_t add(const Key& key, int64_t metric);
@@ -90,7 +97,8 @@ struct StorageServerMetrics {
 
 	StorageServerMetrics()
 	  : byteSample(0), iopsSample(SERVER_KNOBS->IOPS_UNITS_PER_SAMPLE),
-	    bytesWriteSample(SERVER_KNOBS->BYTES_WRITTEN_UNITS_PER_SAMPLE),
+	    bytesWriteSample(SERVER_KNOBS->BYTES_WRITTEN_UNITS_PER_SAMPLE,
+	                     SERVER_KNOBS->BYTES_WRITTEN_SAMPLE_TARGET_ENTRIES),
 	    bytesReadSample(SERVER_KNOBS->BYTES_READ_UNITS_PER_SAMPLE),
 	    opsReadSample(SERVER_KNOBS->OPS_READ_UNITES_PER_SAMPLE) {}
 
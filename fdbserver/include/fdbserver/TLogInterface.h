@@ -27,6 +27,7 @@
 #include "fdbclient/MutationList.h"
 #include "fdbclient/StorageServerInterface.h"
 #include "fdbrpc/TimedRequest.h"
+#include "flow/CompressionUtils.h"
 #include <iterator>
 
 struct TLogInterface {
@@ -187,10 +188,13 @@ struct TLogPeekReply {
 	Version minKnownCommittedVersion;
 	Optional<Version> begin;
 	bool onlySpilled = false;
+	// If present, messages has been compressed with this filter and must be decompressed before it is read.
+	Optional<CompressionFilter> compressionFilter;
 
 	template <class Ar>
 	void serialize(Ar& ar) {
-		serializer(ar, messages, end, popped, maxKnownVersion, minKnownCommittedVersion, begin, onlySpilled, arena);
+		serializer(
+		    ar, messages, end, popped, maxKnownVersion, minKnownCommittedVersion, begin, onlySpilled, compressionFilter, arena);
 	}
 };
 
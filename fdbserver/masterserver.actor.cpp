@@ -262,7 +262,8 @@ void updateLiveCommittedVersion(Reference<MasterData> self, ReportRawCommittedVe
 		}
 		auto curTime = now();
 		// add debug here to change liveCommittedVersion to time bound of now()
-		debug_advanceVersionTimestamp(self->liveCommittedVersion.get(), curTime + CLIENT_KNOBS->MAX_VERSION_CACHE_LAG);
+		debug_advanceVersionTimestamp(self->liveCommittedVersion.get(),
+		                              curTime + CLIENT_KNOBS->GRV_CACHE_MAX_STALENESS_LIMIT);
 		// also add req.version but with no time bound
 		debug_advanceVersionTimestamp(req.version, std::numeric_limits<double>::max());
 		self->databaseLocked = req.locked;
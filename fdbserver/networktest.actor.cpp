@@ -19,6 +19,7 @@
  */
 
 #include "fmt/format.h"
+#include "fdbrpc/DDSketch.h"
 #include "fdbserver/NetworkTest.h"
 #include "flow/Knobs.h"
 #include "flow/ActorCollection.h"
@@ -284,6 +285,108 @@ static void networkTestnanosleep() {
 	return;
 }
 
+// Parses a comma-separated list of integers, e.g. "1,4,16".
+static std::vector<int> parseIntList(std::string const& str) {
+	std::vector<int> result;
+	StringRef s(str);
+	while (s.size() > 0) {
+		StringRef token = s.eat(",");
+		if (token.size() > 0) {
+			result.push_back(atoi(token.toString().c_str()));
+		}
+	}
+	return result;
+}
+
+ACTOR static Future<Void> matrixClient(std::vector<NetworkTestInterface>* interfs,
+                                       int requestSize,
+                                       int replySize,
+                                       bool* stop,
+                                       int64_t* completed,
+                                       DDSketch<double>* latency) {
+	state std::string request_payload(requestSize, '.');
+	state double start;
+
+	while (!*stop) {
+		start = timer_monotonic();
+		NetworkTestReply rep =
+		    wait(retryBrokenPromise((*interfs)[deterministicRandom()->randomInt(0, interfs->size())].test,
+		                            NetworkTestRequest(StringRef(request_payload), replySize)));
+		latency->addSample(timer_monotonic() - start);
+		++*completed;
+	}
+	return Void();
+}
+
+ACTOR static Future<Void> runMatrixCell(std::vector<NetworkTestInterface>* interfs,
+                                        int clientCount,
+                                        int requestSize,
+                                        int replySize) {
+	state bool stop = false;
+	state int64_t completed = 0;
+	state DDSketch<double> latency;
+	state std::vector<Future<Void>> clients;
+	state double start;
+
+	clients.reserve(clientCount);
+	for (int i = 0; i < clientCount; i++) {
+		clients.push_back(matrixClient(interfs, requestSize, replySize, &stop, &completed, &latency));
+	}
+
+	// Discard the first second of each cell to exclude connection setup and warm-up effects.
+	wait(delay(1.0));
+	latency = DDSketch<double>();
+	completed = 0;
+	start = now();
+
+	wait(delay(FLOW_KNOBS->NETWORK_TEST_CELL_SECONDS));
+	stop = true;
+	wait(waitForAll(clients));
+
+	double elapsed = now() - start;
+	printf("clients %4d  request %8d  reply %8d  %10.0f/s  mean %8.1fus  p50 %8.1fus  p90 %8.1fus  p99 %8.1fus  "
+	       "max %8.1fus\n",
+	       clientCount,
+	       requestSize,
+	       replySize,
+	       completed / elapsed,
+	       latency.mean() * 1e6,
+	       latency.percentile(0.5) * 1e6,
+	       latency.percentile(0.9) * 1e6,
+	       latency.percentile(0.99) * 1e6,
+	       latency.max() * 1e6);
+	return Void();
+}
+
+// Runs one cell per combination of the NETWORK_TEST_SWEEP_* knob lists against the
+// standard networktestserver role, holding each cell for NETWORK_TEST_CELL_SECONDS
+// and printing one line of DDSketch latency output per cell. TLS is selected by the
+// :tls suffix on the server addresses (and the usual --tls_* options), so a TLS
+// sweep is two runs of the client against the same servers.
+ACTOR static Future<Void> networkTestMatrixClient(std::vector<NetworkTestInterface>* interfs) {
+	state std::vector<int> clientCounts = parseIntList(FLOW_KNOBS->NETWORK_TEST_SWEEP_CLIENT_COUNTS);
+	state std::vector<int> requestSizes = parseIntList(FLOW_KNOBS->NETWORK_TEST_SWEEP_REQUEST_SIZES);
+	state std::vector<int> replySizes = parseIntList(FLOW_KNOBS->NETWORK_TEST_SWEEP_REPLY_SIZES);
+	if (requestSizes.empty()) {
+		requestSizes.push_back(FLOW_KNOBS->NETWORK_TEST_REQUEST_SIZE);
+	}
+	if (replySizes.empty()) {
+		replySizes.push_back(FLOW_KNOBS->NETWORK_TEST_REPLY_SIZE);
+	}
+
+	state int ci = 0;
+	state int qi = 0;
+	state int pi = 0;
+	for (ci = 0; ci < clientCounts.size(); ci++) {
+		for (qi = 0; qi < requestSizes.size(); qi++) {
+			for (pi = 0; pi < replySizes.size(); pi++) {
+				wait(runMatrixCell(interfs, clientCounts[ci], requestSizes[qi], replySizes[pi]));
+			}
+		}
+	}
+	return Void();
+}
+
 ACTOR Future<Void> networkTestClient(std::string testServers) {
 	if (testServers == "nanosleep") {
 		networkTestnanosleep();
@@ -301,6 +404,11 @@ ACTOR Future<Void> networkTestClient(std::string testServers) {
 		interfs.push_back(NetworkTestInterface(servers[i]));
 	}
 
+	if (!FLOW_KNOBS->NETWORK_TEST_SWEEP_CLIENT_COUNTS.empty()) {
+		wait(networkTestMatrixClient(&interfs));
+		return Void();
+	}
+
 	state std::vector<Future<Void>> clients;
 	clients.reserve(FLOW_KNOBS->NETWORK_TEST_CLIENT_COUNT);
 	for (int i = 0; i < FLOW_KNOBS->NETWORK_TEST_CLIENT_COUNT; i++) {
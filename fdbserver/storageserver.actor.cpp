@@ -19,9 +19,12 @@
  */
 
 #include <cinttypes>
+#include <deque>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <list>
+#include <map>
 #include <type_traits>
 #include <unordered_map>
 
@@ -49,6 +52,7 @@
 #include "flow/Trace.h"
 #include "fdbclient/Tracing.h"
 #include "flow/Util.h"
+#include "flow/xxhash.h"
 #include "fdbclient/Atomic.h"
 #include "fdbclient/AuditUtils.actor.h"
 #include "fdbclient/BlobConnectionProvider.h"
@@ -187,6 +191,10 @@ static const KeyRangeRef persistShardAvailableKeys =
 static const KeyRangeRef persistByteSampleKeys = KeyRangeRef(PERSIST_PREFIX "BS/"_sr, PERSIST_PREFIX "BS0"_sr);
 static const KeyRangeRef persistByteSampleSampleKeys =
     KeyRangeRef(PERSIST_PREFIX "BS/"_sr PERSIST_PREFIX "BS/"_sr, PERSIST_PREFIX "BS/"_sr PERSIST_PREFIX "BS0"_sr);
+// Periodic compact checkpoint of the whole byte sample, loadable with a few sequential reads at startup
+static const KeyRangeRef persistByteSampleSnapshotKeys =
+    KeyRangeRef(PERSIST_PREFIX "BSSnap/"_sr, PERSIST_PREFIX "BSSnap0"_sr);
+static const KeyRef persistByteSampleSnapshotHeader = PERSIST_PREFIX "BSSnapHeader"_sr;
 static const KeyRef persistLogProtocol = PERSIST_PREFIX "LogProtocol"_sr;
 static const KeyRef persistPrimaryLocality = PERSIST_PREFIX "PrimaryLocality"_sr;
 static const KeyRangeRef persistChangeFeedKeys = KeyRangeRef(PERSIST_PREFIX "CF/"_sr, PERSIST_PREFIX "CF0"_sr);
@@ -435,6 +443,12 @@ struct StorageServerDisk {
 
 	Future<Void> restore(const std::vector<CheckpointMetaData>& checkpoints) { return storage->restore(checkpoints); }
 
+	Future<Void> restore(const std::string& shardId,
+	                     const std::vector<KeyRange>& ranges,
+	                     const std::vector<CheckpointMetaData>& checkpoints) {
+		return storage->restore(shardId, ranges, checkpoints);
+	}
+
 	Future<Void> deleteCheckpoint(const CheckpointMetaData& checkpoint) {
 		return storage->deleteCheckpoint(checkpoint);
 	}
@@ -763,6 +777,181 @@ struct TenantSSInfo {
 	}
 };
 
+// An optional read-through cache of point lookups served by the durable storage engine, for workloads with
+// heavily skewed read distributions where the same keys are fetched from disk repeatedly once they age out of the
+// MVCC window. Entries are invalidated as mutations are applied to versionedData, before any read at a newer
+// version could consult the cache, so a cached entry always matches what the engine would return for a key that
+// has no newer entry in versionedData. Budgeted by SS_HOT_VALUE_CACHE_BYTES and evicted in LRU order.
+struct HotValueCache {
+	struct Entry {
+		Optional<Value> value;
+		std::list<Key>::iterator lruPos;
+	};
+	struct KeyCompare {
+		using is_transparent = void;
+		bool operator()(StringRef a, StringRef b) const { return a < b; }
+	};
+
+	// Ordered so that clear ranges can invalidate with a single range scan
+	std::map<Key, Entry, KeyCompare> entries;
+	std::list<Key> lru; // front is most recently used
+	int64_t bytes = 0;
+
+	static int64_t entryBytes(KeyRef key, Optional<Value> const& value) {
+		// The key is stored twice (map and LRU list), plus node overhead
+		return 2 * key.size() + value.expectedSize() + sizeof(Entry) + 2 * sizeof(Key) + 6 * sizeof(void*);
+	}
+
+	bool enabled() const { return SERVER_KNOBS->SS_HOT_VALUE_CACHE_BYTES > 0; }
+
+	// Returns the cached engine result for key, or an empty Optional if the key is not cached
+	Optional<Optional<Value>> get(KeyRef key) {
+		auto it = entries.find(key);
+		if (it == entries.end()) {
+			return Optional<Optional<Value>>();
+		}
+		lru.splice(lru.begin(), lru, it->second.lruPos);
+		return it->second.value;
+	}
+
+	void insert(KeyRef key, Optional<Value> const& value) {
+		int64_t b = entryBytes(key, value);
+		if (b > SERVER_KNOBS->SS_HOT_VALUE_CACHE_BYTES) {
+			return;
+		}
+		invalidate(key);
+		lru.emplace_front(key);
+		entries.emplace(lru.front(), Entry{ value, lru.begin() });
+		bytes += b;
+		while (bytes > SERVER_KNOBS->SS_HOT_VALUE_CACHE_BYTES) {
+			auto evict = entries.find(lru.back());
+			ASSERT(evict != entries.end());
+			bytes -= entryBytes(evict->first, evict->second.value);
+			entries.erase(evict);
+			lru.pop_back();
+		}
+	}
+
+	void invalidate(KeyRef key) {
+		auto it = entries.find(key);
+		if (it != entries.end()) {
+			bytes -= entryBytes(it->first, it->second.value);
+			lru.erase(it->second.lruPos);
+			entries.erase(it);
+		}
+	}
+
+	void invalidate(KeyRangeRef range) {
+		auto it = entries.lower_bound(range.begin);
+		while (it != entries.end() && it->first < range.end) {
+			bytes -= entryBytes(it->first, it->second.value);
+			lru.erase(it->second.lruPos);
+			it = entries.erase(it);
+		}
+	}
+};
+
+// Index of watched keys on the storage server. Point triggers are average O(1) hash probes and cost nothing at
+// all when nothing is watched, range triggers walk an ordered view of just the watched keys, and fired watch
+// promises are batched and delivered on a deferred task so that applying a batch of mutations wakes each waiter
+// once, after the batch. Watch waiters re-read and compare the watched value whenever they wake, so deferred
+// delivery does not change watch semantics.
+class WatchIndex : NonCopyable {
+public:
+	~WatchIndex() {
+		destructing = true;
+		items.clear();
+	}
+
+	Future<Void> onChange(Key const& key) { // throws broken_promise if this is destroyed
+		auto [it, inserted] = items.emplace(key, Promise<Void>());
+		if (inserted) {
+			ordered.insert(it->first);
+		}
+		return destroyOnCancel(this, key, it->second.getFuture());
+	}
+
+	void trigger(KeyRef const& key) {
+		if (items.empty()) {
+			return;
+		}
+		auto it = items.find(key);
+		if (it == items.end()) {
+			return;
+		}
+		queueTrigger(std::move(it->second));
+		ordered.erase(it->first);
+		items.erase(it);
+	}
+
+	void triggerRange(KeyRef const& begin, KeyRef const& end) {
+		if (begin >= end || items.empty()) {
+			return;
+		}
+		auto it = ordered.lower_bound(begin);
+		while (it != ordered.end() && *it < end) {
+			auto itemIt = items.find(*it);
+			ASSERT(itemIt != items.end());
+			queueTrigger(std::move(itemIt->second));
+			items.erase(itemIt);
+			it = ordered.erase(it);
+		}
+	}
+
+private:
+	struct KeyHash {
+		using is_transparent = void;
+		size_t operator()(StringRef key) const { return std::hash<StringRef>()(key); }
+	};
+	struct KeyEqual {
+		using is_transparent = void;
+		bool operator()(StringRef a, StringRef b) const { return a == b; }
+	};
+	struct KeyLess {
+		using is_transparent = void;
+		bool operator()(StringRef a, StringRef b) const { return a < b; }
+	};
+
+	std::unordered_map<Key, Promise<Void>, KeyHash, KeyEqual> items;
+	std::set<Key, KeyLess> ordered; // the watched keys, for range triggers
+	std::vector<Promise<Void>> pending; // triggered but not yet delivered
+	Future<Void> flusher;
+	bool destructing = false;
+
+	void queueTrigger(Promise<Void>&& p) {
+		pending.push_back(std::move(p));
+		if (pending.size() == 1) {
+			flusher = flushPending(this);
+		}
+	}
+
+	ACTOR static Future<Void> flushPending(WatchIndex* self) {
+		wait(delay(0, TaskPriority::DefaultYield));
+		// Sending can run continuations that touch this index, so detach the batch first
+		std::vector<Promise<Void>> ps;
+		std::swap(ps, self->pending);
+		for (auto& p : ps) {
+			p.send(Void());
+		}
+		return Void();
+	}
+
+	// See AsyncMap::destroyOnCancel: the last waiter cancelling its watch removes the item
+	ACTOR static Future<Void> destroyOnCancel(WatchIndex* self, Key key, Future<Void> change) {
+		try {
+			wait(change);
+			return Void();
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled && !self->destructing && change.getFutureReferenceCount() == 1 &&
+			    change.getPromiseReferenceCount() == 1) {
+				self->items.erase(key);
+				self->ordered.erase(key);
+			}
+			throw;
+		}
+	}
+};
+
 struct StorageServer : public IStorageMetricsService {
 	typedef VersionedMap<KeyRef, ValueOrClearToRef> VersionedData;
 
@@ -821,6 +1010,12 @@ public:
 	std::unordered_map<UID, CheckpointMetaData> checkpoints; // Existing and deleting checkpoints
 	std::unordered_map<UID, ICheckpointReader*> liveCheckpointReaders; // Active checkpoint readers
 	VersionedMap<int64_t, TenantSSInfo> tenantMap;
+	// A flat copy of the latest view of tenantMap, republished synchronously whenever the tenant
+	// map changes. Tenant churn is rare while every tenant request pays the tenant check, so checks
+	// at versions at or after the last tenant map change (i.e. nearly all of them) resolve with a
+	// single hash probe instead of a versioned-map traversal.
+	std::unordered_map<int64_t, TenantSSInfo> latestTenantSnapshot;
+	Version lastTenantMapChangeVersion = 0;
 	std::map<Version, std::vector<PendingNewShard>>
 	    pendingAddRanges; // Pending requests to add ranges to physical shards
 	std::map<Version, std::vector<KeyRange>>
@@ -1054,6 +1249,9 @@ public:
 
 	KeyRangeMap<bool> cachedRangeMap; // indicates if a key-range is being cached
 
+	// Cache of durable engine point lookups, consulted by getValueQ when a key has no entry in the MVCC window
+	HotValueCache hotValueCache;
+
 	KeyRangeMap<std::vector<Reference<ChangeFeedInfo>>> keyChangeFeed;
 	std::unordered_map<Key, Reference<ChangeFeedInfo>> uidChangeFeed;
 	Deque<std::pair<std::vector<Key>, Version>> changeFeedVersions;
@@ -1125,7 +1323,7 @@ public:
 	Future<Void> byteSampleRecovery;
 	Future<Void> durableInProgress;
 
-	AsyncMap<Key, bool> watches;
+	WatchIndex watches;
 	AsyncMap<int64_t, bool> tenantWatches;
 	int64_t watchBytes;
 	int64_t numWatches;
@@ -1250,6 +1448,10 @@ public:
 		// means fallback if fallback is enabled, otherwise means failure (so that another layer could implement
 		// fallback).
 		Counter quickGetValueHit, quickGetValueMiss, quickGetKeyValuesHit, quickGetKeyValuesMiss;
+		// Point reads served from / missed by the hot value cache in front of the storage engine
+		Counter hotValueCacheHits, hotValueCacheMisses;
+		// Atomic op mutations that were folded into the preceding mutation instead of applied individually
+		Counter atomicOpsCoalesced;
 
 		// The number of logical bytes returned from storage engine, in response to readRange operations.
 		Counter kvScanBytes;
@@ -1307,7 +1509,9 @@ public:
 		    wrongShardServer("WrongShardServer", cc), fetchedVersions("FetchedVersions", cc),
 		    fetchesFromLogs("FetchesFromLogs", cc), quickGetValueHit("QuickGetValueHit", cc),
 		    quickGetValueMiss("QuickGetValueMiss", cc), quickGetKeyValuesHit("QuickGetKeyValuesHit", cc),
-		    quickGetKeyValuesMiss("QuickGetKeyValuesMiss", cc), kvScanBytes("KVScanBytes", cc),
+		    quickGetKeyValuesMiss("QuickGetKeyValuesMiss", cc), hotValueCacheHits("HotValueCacheHits", cc),
+		    hotValueCacheMisses("HotValueCacheMisses", cc), atomicOpsCoalesced("AtomicOpsCoalesced", cc),
+		    kvScanBytes("KVScanBytes", cc),
 		    kvGetBytes("KVGetBytes", cc), eagerReadsKeys("EagerReadsKeys", cc), kvGets("KVGets", cc),
 		    kvScans("KVScans", cc), kvCommits("KVCommits", cc), changeFeedDiskReads("ChangeFeedDiskReads", cc),
 		    getMappedRangeBytesQueried("GetMappedRangeBytesQueried", cc),
@@ -2095,14 +2299,28 @@ ACTOR Future<Version> waitForMinVersion(StorageServer* data, Version version) {
 void StorageServer::checkTenantEntry(Version version, TenantInfo tenantInfo, bool lockAware) {
 	if (tenantInfo.hasTenant()) {
 		ASSERT(version == latestVersion || (version >= tenantMap.oldestVersion && version <= this->version.get()));
-		auto view = tenantMap.at(version);
-		auto itr = view.find(tenantInfo.tenantId);
-		if (itr == view.end()) {
+		TenantSSInfo const* info = nullptr;
+		if (version == latestVersion || version >= lastTenantMapChangeVersion) {
+			// The tenant map has not changed between this version and the latest, so the flat
+			// snapshot of the latest view answers the check
+			auto itr = latestTenantSnapshot.find(tenantInfo.tenantId);
+			if (itr != latestTenantSnapshot.end()) {
+				info = &itr->second;
+			}
+		} else {
+			CODE_PROBE(true, "Tenant check at a version before the last tenant map change", probe::decoration::rare);
+			auto view = tenantMap.at(version);
+			auto itr = view.find(tenantInfo.tenantId);
+			if (itr != view.end()) {
+				info = &*itr;
+			}
+		}
+		if (info == nullptr) {
 			TraceEvent(SevWarn, "StorageTenantNotFound", thisServerID)
 			    .detail("Tenant", tenantInfo.tenantId)
 			    .backtrace();
 			throw tenant_not_found();
-		} else if (!lockAware && itr->lockState == TenantAPI::TenantLockState::LOCKED) {
+		} else if (!lockAware && info->lockState == TenantAPI::TenantLockState::LOCKED) {
 			throw tenant_locked();
 		}
 	}
@@ -2173,15 +2391,37 @@ ACTOR Future<Void> getValueQ(StorageServer* data, GetValueRequest req) {
 			path = 1;
 		} else if (!i || !i->isClearTo() || i->getEndKey() <= req.key) {
 			path = 2;
-			Optional<Value> vv = wait(data->storage.readValue(req.key, req.options));
-			data->counters.kvGetBytes += vv.expectedSize();
-			// Validate that while we were reading the data we didn't lose the version or shard
-			if (version < data->storageVersion()) {
-				CODE_PROBE(true, "transaction_too_old after readValue");
-				throw transaction_too_old();
+			state bool hotCacheHit = false;
+			if (data->hotValueCache.enabled()) {
+				Optional<Optional<Value>> cachedValue = data->hotValueCache.get(req.key);
+				if (cachedValue.present()) {
+					++data->counters.hotValueCacheHits;
+					v = cachedValue.get();
+					hotCacheHit = true;
+				} else {
+					++data->counters.hotValueCacheMisses;
+				}
+			}
+			if (!hotCacheHit) {
+				Optional<Value> vv = wait(data->storage.readValue(req.key, req.options));
+				data->counters.kvGetBytes += vv.expectedSize();
+				// Validate that while we were reading the data we didn't lose the version or shard
+				if (version < data->storageVersion()) {
+					CODE_PROBE(true, "transaction_too_old after readValue");
+					throw transaction_too_old();
+				}
+				data->checkChangeCounter(changeCounter, req.key);
+				if (data->hotValueCache.enabled()) {
+					// Only cache the result if the key still has no entry in the MVCC window; a mutation applied
+					// while the read was in flight would otherwise be able to leave a stale entry behind, since
+					// its invalidation ran before this insert
+					auto latest = data->data().atLatest().lastLessOrEqual(req.key);
+					if (!latest || (latest.key() != req.key && (!latest->isClearTo() || latest->getEndKey() <= req.key))) {
+						data->hotValueCache.insert(req.key, vv);
+					}
+				}
+				v = vv;
 			}
-			data->checkChangeCounter(changeCounter, req.key);
-			v = vv;
 		}
 
 		DEBUG_MUTATION("ShardGetValue",
@@ -2286,8 +2526,7 @@ ACTOR Future<Version> watchWaitForValueChange(StorageServer* data, SpanContext p
 	loop {
 		try {
 			if (tenantId != TenantInfo::INVALID_TENANT) {
-				auto view = data->tenantMap.at(latestVersion);
-				if (view.find(tenantId) == view.end()) {
+				if (!data->latestTenantSnapshot.count(tenantId)) {
 					throw tenant_removed();
 				}
 			}
@@ -2999,7 +3238,17 @@ ACTOR Future<std::pair<ChangeFeedStreamReply, bool>> getChangeFeedMutations(Stor
 			wait(delay(0));
 		}
 
-		state PriorityMultiLock::Lock ssReadLock = wait(data->getReadLock(req.options));
+		// Feed disk reads scan version-ordered data that the stream consumes once and never revisits, so
+		// don't let them evict real KV data from the storage engine's cache
+		state Optional<ReadOptions> feedReadOptions = req.options;
+		if (SERVER_KNOBS->STORAGE_FEED_DISK_READS_BYPASS_CACHE) {
+			if (!feedReadOptions.present()) {
+				feedReadOptions = ReadOptions();
+			}
+			feedReadOptions.get().cacheResult = CacheResult::False;
+		}
+
+		state PriorityMultiLock::Lock ssReadLock = wait(data->getReadLock(feedReadOptions));
 		// The assumption of feed ordering is that all atLatest feeds will get processed before the !atLatest ones.
 		// Without this delay(0), there is a case where that can happen:
 		//  - a read request (eg getValueQ) has the read lock and is waiting on ss->version.whenAtLeast(V)
@@ -3021,7 +3270,7 @@ ACTOR Future<std::pair<ChangeFeedStreamReply, bool>> getChangeFeedMutations(Stor
 		                                        changeFeedDurableKey(req.rangeID, req.end)),
 		                            1 << 30,
 		                            remainingDurableBytes,
-		                            req.options));
+		                            feedReadOptions));
 		ssReadLock.release();
 
 		data->counters.kvScanBytes += res.logicalSize();
@@ -3704,10 +3953,13 @@ void merge(Arena& arena,
            bool stopAtEndOfBase,
            int& pos,
            int limitBytes,
-           Optional<KeyRef> tenantPrefix)
+           Optional<KeyRef> tenantPrefix,
+           bool deepCopyVersionedData)
 // Combines data from base (at an older version) with sets from newer versions in [start, end) and appends the first (up
 // to) |limit| rows to output If limit<0, base and output are in descending order, and start->key()>end->key(), but
-// start is still inclusive and end is exclusive
+// start is still inclusive and end is exclusive.
+// If !deepCopyVersionedData the caller has already arranged for the bytes referenced by vm_output to live at
+// least as long as arena, so the versioned data is appended by reference like the base data.
 {
 	ASSERT(limit != 0);
 	// Add a dependency of the new arena on the result from the KVS so that we don't have to copy any of the KVS
@@ -3725,7 +3977,10 @@ void merge(Arena& arena,
 		if (forward ? baseStart->key < vm_output[pos].key : baseStart->key > vm_output[pos].key) {
 			output.push_back(arena, removePrefix(*baseStart++, tenantPrefix));
 		} else {
-			output.push_back_deep(arena, removePrefix(vm_output[pos], tenantPrefix));
+			if (deepCopyVersionedData)
+				output.push_back_deep(arena, removePrefix(vm_output[pos], tenantPrefix));
+			else
+				output.push_back(arena, removePrefix(vm_output[pos], tenantPrefix));
 			if (baseStart->key == vm_output[pos].key)
 				++baseStart;
 			++pos;
@@ -3739,7 +3994,10 @@ void merge(Arena& arena,
 	}
 	if (!stopAtEndOfBase) {
 		while (vCount > 0 && output.size() < adjustedLimit && accumulatedBytes < limitBytes) {
-			output.push_back_deep(arena, removePrefix(vm_output[pos], tenantPrefix));
+			if (deepCopyVersionedData)
+				output.push_back_deep(arena, removePrefix(vm_output[pos], tenantPrefix));
+			else
+				output.push_back(arena, removePrefix(vm_output[pos], tenantPrefix));
 			accumulatedBytes += sizeof(KeyValueRef) + output.end()[-1].expectedSize();
 			++pos;
 			vCount--;
@@ -3842,6 +4100,13 @@ ACTOR Future<GetKeyValuesReply> readRange(StorageServer* data,
 	// for remembering the position in the resultCache
 	state int pos = 0;
 
+	// When enabled, versioned-map entries are appended to the reply by reference instead of being deep
+	// copied. The bytes of an entry live in the mutation log arena of its insert version, so that arena is
+	// pinned by the reply; entries whose log entry is already durable (bytes migrated to data->freeable) are
+	// deep copied as before.
+	state bool referenceVmData = SERVER_KNOBS->SS_ZERO_COPY_RANGE_REPLY;
+	state std::set<Version> pinnedLogVersions;
+
 	// Check if the desired key-range is cached
 	auto containingRange = data->cachedRangeMap.rangeContaining(range.begin);
 	if (containingRange.value() && containingRange->range().end >= range.end) {
@@ -3889,7 +4154,19 @@ ACTOR Future<GetKeyValuesReply> readRange(StorageServer* data,
 				while (vCurrent && vCurrent.key() < range.end && !vCurrent->isClearTo() && vCount < limit &&
 				       vSize < *pLimitBytes) {
 					// Store the versionedData results in resultCache
-					resultCache.emplace_back(result.arena, vCurrent.key(), vCurrent->getValue());
+					if (referenceVmData) {
+						auto log = data->getMutationLog().find(vCurrent.insertVersion());
+						if (log != data->getMutationLog().end()) {
+							if (pinnedLogVersions.insert(log->first).second)
+								result.arena.dependsOn(log->second.arena());
+							resultCache.emplace_back(result.arena, vCurrent.key(), vCurrent->getValue());
+						} else {
+							resultCache.push_back_deep(result.arena,
+							                           KeyValueRef(vCurrent.key(), vCurrent->getValue()));
+						}
+					} else {
+						resultCache.emplace_back(result.arena, vCurrent.key(), vCurrent->getValue());
+					}
 					vSize += sizeof(KeyValueRef) + resultCache.cback().expectedSize() -
 					         (tenantPrefix.present() ? tenantPrefix.get().size() : 0);
 					++vCount;
@@ -3928,7 +4205,8 @@ ACTOR Future<GetKeyValuesReply> readRange(StorageServer* data,
 			      atStorageVersion.more,
 			      pos,
 			      *pLimitBytes,
-			      tenantPrefix);
+			      tenantPrefix,
+			      !referenceVmData);
 			limit -= result.data.size() - prevSize;
 
 			for (auto i = result.data.begin() + prevSize; i != result.data.end(); i++) {
@@ -3991,7 +4269,19 @@ ACTOR Future<GetKeyValuesReply> readRange(StorageServer* data,
 				while (vCurrent && vCurrent.key() >= range.begin && !vCurrent->isClearTo() && vCount < -limit &&
 				       vSize < *pLimitBytes) {
 					// Store the versionedData results in resultCache
-					resultCache.emplace_back(result.arena, vCurrent.key(), vCurrent->getValue());
+					if (referenceVmData) {
+						auto log = data->getMutationLog().find(vCurrent.insertVersion());
+						if (log != data->getMutationLog().end()) {
+							if (pinnedLogVersions.insert(log->first).second)
+								result.arena.dependsOn(log->second.arena());
+							resultCache.emplace_back(result.arena, vCurrent.key(), vCurrent->getValue());
+						} else {
+							resultCache.push_back_deep(result.arena,
+							                           KeyValueRef(vCurrent.key(), vCurrent->getValue()));
+						}
+					} else {
+						resultCache.emplace_back(result.arena, vCurrent.key(), vCurrent->getValue());
+					}
 					vSize += sizeof(KeyValueRef) + resultCache.cback().expectedSize() -
 					         (tenantPrefix.present() ? tenantPrefix.get().size() : 0);
 					++vCount;
@@ -4028,7 +4318,8 @@ ACTOR Future<GetKeyValuesReply> readRange(StorageServer* data,
 			      atStorageVersion.more,
 			      pos,
 			      *pLimitBytes,
-			      tenantPrefix);
+			      tenantPrefix,
+			      !referenceVmData);
 			limit += result.data.size() - prevSize;
 
 			for (auto i = result.data.begin() + prevSize; i != result.data.end(); i++) {
@@ -4066,6 +4357,76 @@ ACTOR Future<GetKeyValuesReply> readRange(StorageServer* data,
 	return result;
 }
 
+// Splits a large forward range read into sub-ranges at byte-sample split points and scans them concurrently.
+// Snapshot reads of the VersionedMap and the durable engine are immutable at a fixed version, so the sub-reads
+// are independent; the replies are stitched back together in key order and clipped to the caller's limits.
+// Each sub-read runs with the caller's full limits, so transient over-read is bounded by the sub-range count.
+ACTOR Future<GetKeyValuesReply> readRangeParallel(StorageServer* data,
+                                                  Version version,
+                                                  KeyRange range,
+                                                  int limit,
+                                                  int* pLimitBytes,
+                                                  SpanContext parentSpan,
+                                                  Optional<ReadOptions> options,
+                                                  Optional<KeyRef> tenantPrefix) {
+	ASSERT(limit > 0);
+	state Span span("SS:readRangeParallel"_loc, parentSpan);
+
+	// Choose split points so that each sub-range covers roughly an even share of the requested bytes. The split
+	// points are returned as references into the byte sample, which can change across waits, so copy them out.
+	state Standalone<VectorRef<KeyRef>> splitPoints;
+	int64_t chunkSize = std::max<int64_t>(SERVER_KNOBS->SS_PARALLEL_READ_RANGE_MIN_BYTES,
+	                                      *pLimitBytes / SERVER_KNOBS->SS_PARALLEL_READ_RANGE_MAX_SUBRANGES);
+	std::vector<KeyRef> points = data->metrics.getSplitPoints(range, chunkSize, Optional<KeyRef>());
+	for (auto const& p : points) {
+		if (splitPoints.size() + 1 >= SERVER_KNOBS->SS_PARALLEL_READ_RANGE_MAX_SUBRANGES) {
+			break;
+		}
+		splitPoints.push_back_deep(splitPoints.arena(), p);
+	}
+
+	if (splitPoints.empty()) {
+		GetKeyValuesReply reply = wait(readRange(data, version, range, limit, pLimitBytes, span.context, options, tenantPrefix));
+		return reply;
+	}
+
+	state std::vector<int> subLimitBytes(splitPoints.size() + 1, *pLimitBytes);
+	state std::vector<Future<GetKeyValuesReply>> subReads;
+	for (int i = 0; i < splitPoints.size() + 1; i++) {
+		KeyRangeRef subRange(i == 0 ? range.begin : splitPoints[i - 1],
+		                     i == splitPoints.size() ? range.end : splitPoints[i]);
+		subReads.push_back(
+		    readRange(data, version, subRange, limit, &subLimitBytes[i], span.context, options, tenantPrefix));
+	}
+	wait(waitForAll(subReads));
+
+	state GetKeyValuesReply result;
+	result.version = version;
+	result.cached = true;
+	for (int i = 0; i < subReads.size(); i++) {
+		GetKeyValuesReply const& sub = subReads[i].get();
+		result.cached = result.cached && sub.cached;
+		result.arena.dependsOn(sub.arena);
+		for (auto const& kv : sub.data) {
+			if (limit <= 0 || *pLimitBytes <= 0) {
+				result.more = true;
+				return result;
+			}
+			result.data.push_back(result.arena, kv);
+			--limit;
+			*pLimitBytes -= sizeof(KeyValueRef) + kv.expectedSize();
+		}
+		// If a sub-read hit its own limits there is a gap before the next sub-range, so nothing past it can be
+		// returned in this reply.
+		if (sub.more) {
+			result.more = true;
+			return result;
+		}
+	}
+	result.more = limit == 0 || *pLimitBytes <= 0;
+	return result;
+}
+
 ACTOR Future<Key> findKey(StorageServer* data,
                           KeySelectorRef sel,
                           Version version,
@@ -4320,14 +4681,26 @@ ACTOR Future<Void> getKeyValuesQ(StorageServer* data, GetKeyValuesRequest req)
 			state int remainingLimitBytes = req.limitBytes;
 
 			state double kvReadRange = g_network->timer();
-			GetKeyValuesReply _r = wait(readRange(data,
-			                                      version,
-			                                      KeyRangeRef(begin, end),
-			                                      req.limit,
-			                                      &remainingLimitBytes,
-			                                      span.context,
-			                                      req.options,
-			                                      req.tenantInfo.prefix));
+			// Large forward scans can be partitioned and served by concurrent sub-range reads; small or reverse
+			// reads take the sequential path.
+			state bool parallelReadRange = SERVER_KNOBS->SS_PARALLEL_READ_RANGE_ENABLED && req.limit > 1 &&
+			                               remainingLimitBytes >= SERVER_KNOBS->SS_PARALLEL_READ_RANGE_MIN_BYTES;
+			GetKeyValuesReply _r = wait(parallelReadRange ? readRangeParallel(data,
+			                                                                 version,
+			                                                                 KeyRangeRef(begin, end),
+			                                                                 req.limit,
+			                                                                 &remainingLimitBytes,
+			                                                                 span.context,
+			                                                                 req.options,
+			                                                                 req.tenantInfo.prefix)
+			                                              : readRange(data,
+			                                                          version,
+			                                                          KeyRangeRef(begin, end),
+			                                                          req.limit,
+			                                                          &remainingLimitBytes,
+			                                                          span.context,
+			                                                          req.options,
+			                                                          req.tenantInfo.prefix));
 			const double duration = g_network->timer() - kvReadRange;
 			data->counters.kvReadRangeLatencySample.addMeasurement(duration);
 			GetKeyValuesReply r = _r;
@@ -4894,6 +5267,62 @@ ACTOR Future<Void> validateRangeAgainstServers(StorageServer* data,
 	return Void();
 }
 
+// Computes a streaming digest over one page of the given range so that the consistency scan can
+// compare replicas without shipping their full content. The page is bounded by the same kind of
+// limits as a getKeyValues request, so replicas with identical content stop at an identical
+// position; a replica whose content differs produces a different digest, count, or end position.
+ACTOR Future<Void> getRangeDigestQ(StorageServer* data, GetRangeDigestRequest req) {
+	state Span span("SS:getRangeDigest"_loc, req.spanContext);
+
+	// Active load balancing runs at a very high priority (to obtain accurate queue lengths)
+	// so we need to downgrade here
+	wait(data->getQueryDelay());
+	state PriorityMultiLock::Lock readLock = wait(data->getReadLock(req.options));
+
+	try {
+		Version commitVersion = getLatestCommitVersion(req.ssLatestCommitVersions, data->tag);
+		state Version version = wait(waitForVersion(data, commitVersion, req.version, span.context));
+
+		state uint64_t changeCounter = data->shardChangeCounter;
+		state KeyRange shard = getShardKeyRange(data, firstGreaterOrEqual(req.range.begin));
+		if (req.range.end > shard.end) {
+			throw wrong_shard_server();
+		}
+
+		state int remainingLimitBytes = req.limitBytes;
+		GetKeyValuesReply r = wait(readRange(
+		    data, version, req.range, req.limit, &remainingLimitBytes, span.context, req.options, Optional<KeyRef>()));
+		data->checkChangeCounter(changeCounter, req.range);
+
+		GetRangeDigestReply reply;
+		reply.version = version;
+		reply.more = r.more;
+		reply.keys = r.data.size();
+		for (auto const& kv : r.data) {
+			reply.digest = XXH3_64bits_withSeed(kv.key.begin(), kv.key.size(), reply.digest);
+			reply.digest = XXH3_64bits_withSeed(kv.value.begin(), kv.value.size(), reply.digest);
+			reply.bytes += kv.expectedSize();
+		}
+		if (r.data.size()) {
+			reply.lastKey = Key(r.data[r.data.size() - 1].key);
+		}
+
+		if (reply.bytes > 0 && SERVER_KNOBS->READ_SAMPLING_ENABLED) {
+			int64_t bytesReadPerKSecond = std::max(reply.bytes, SERVER_KNOBS->EMPTY_READ_PENALTY) / 2;
+			data->metrics.notifyBytesReadPerKSecond(Key(r.data[0].key), bytesReadPerKSecond);
+			data->metrics.notifyBytesReadPerKSecond(Key(r.data[r.data.size() - 1].key), bytesReadPerKSecond);
+		}
+
+		req.reply.send(reply);
+	} catch (Error& e) {
+		if (!canReplyWith(e))
+			throw;
+		req.reply.sendError(e);
+	}
+
+	return Void();
+}
+
 ACTOR Future<Void> auditStorageQ(StorageServer* data, AuditStorageRequest req) {
 	wait(data->serveAuditStorageParallelismLock.take(TaskPriority::DefaultYield));
 	state FlowLock::Releaser holder(data->serveAuditStorageParallelismLock);
@@ -5132,20 +5561,25 @@ ACTOR Future<GetMappedKeyValuesReply> mapKeyValues(StorageServer* data,
 	preprocessMappedKey(mappedKeyFormatTuple, vt, isRangeQuery);
 
 	state int sz = input.data.size();
-	const int k = std::min(sz, SERVER_KNOBS->MAX_PARALLEL_QUICK_GET_VALUE);
+	state int k = std::min(sz, SERVER_KNOBS->MAX_PARALLEL_QUICK_GET_VALUE);
 	state std::vector<MappedKeyValueRef> kvms(k);
-	state std::vector<Future<Void>> subqueries;
-	state int offset = 0;
+	state std::deque<Future<Void>> subqueries;
+	state int nextIssue = 0;
+	state int nextConsume = 0;
 	if (pOriginalReq->options.present() && pOriginalReq->options.get().debugID.present())
 		g_traceBatch.addEvent("TransactionDebug",
 		                      pOriginalReq->options.get().debugID.get().first(),
 		                      "storageserver.mapKeyValues.BeforeLoop");
 
-	for (; offset<sz&& * remainingLimitBytes> 0; offset += SERVER_KNOBS->MAX_PARALLEL_QUICK_GET_VALUE) {
-		// Divide into batches of MAX_PARALLEL_QUICK_GET_VALUE subqueries
-		for (int i = 0; i + offset < sz && i < SERVER_KNOBS->MAX_PARALLEL_QUICK_GET_VALUE; i++) {
-			KeyValueRef* it = &input.data[i + offset];
-			MappedKeyValueRef* kvm = &kvms[i];
+	// Keep up to MAX_PARALLEL_QUICK_GET_VALUE subqueries in flight and consume results in order, so
+	// one slow secondary lookup only delays the entries behind it instead of stalling a whole batch
+	// at a barrier before the next one may start.
+	while (nextConsume < sz && (*remainingLimitBytes > 0 || !subqueries.empty())) {
+		while (nextIssue < sz && *remainingLimitBytes > 0 &&
+		       (int)subqueries.size() < SERVER_KNOBS->MAX_PARALLEL_QUICK_GET_VALUE) {
+			KeyValueRef* it = &input.data[nextIssue];
+			// The slot is free because at most MAX_PARALLEL_QUICK_GET_VALUE results are unconsumed.
+			MappedKeyValueRef* kvm = &kvms[nextIssue % k];
 			// Clear key value to the default.
 			kvm->key = ""_sr;
 			kvm->value = ""_sr;
@@ -5158,22 +5592,18 @@ ACTOR Future<GetMappedKeyValuesReply> mapKeyValues(StorageServer* data,
 
 			subqueries.push_back(mapSubquery(
 			    data, input.version, pOriginalReq, &result.arena, matchIndex, isRangeQuery, it, kvm, mappedKey));
-		}
-		wait(waitForAll(subqueries));
-		if (pOriginalReq->options.present() && pOriginalReq->options.get().debugID.present())
-			g_traceBatch.addEvent("TransactionDebug",
-			                      pOriginalReq->options.get().debugID.get().first(),
-			                      "storageserver.mapKeyValues.AfterBatch");
-		subqueries.clear();
-		for (int i = 0; i + offset < sz && i < SERVER_KNOBS->MAX_PARALLEL_QUICK_GET_VALUE; i++) {
-			// since we always read the index, so always consider the index size
-			int indexSize = sizeof(KeyValueRef) + input.data[i + offset].expectedSize();
-			int size = indexSize + getMappedKeyValueSize(kvms[i]);
-			*remainingLimitBytes -= size;
-			result.data.push_back(result.arena, kvms[i]);
-			if (SERVER_KNOBS->STRICTLY_ENFORCE_BYTE_LIMIT && *remainingLimitBytes <= 0) {
-				break;
-			}
+			nextIssue++;
+		}
+		wait(subqueries.front());
+		subqueries.pop_front();
+		// since we always read the index, so always consider the index size
+		int indexSize = sizeof(KeyValueRef) + input.data[nextConsume].expectedSize();
+		int size = indexSize + getMappedKeyValueSize(kvms[nextConsume % k]);
+		*remainingLimitBytes -= size;
+		result.data.push_back(result.arena, kvms[nextConsume % k]);
+		nextConsume++;
+		if (SERVER_KNOBS->STRICTLY_ENFORCE_BYTE_LIMIT && *remainingLimitBytes <= 0) {
+			break;
 		}
 	}
 
@@ -6113,6 +6543,59 @@ bool convertAtomicOp(MutationRef& m, StorageServer::VersionedData const& data, U
 	return true;
 }
 
+// Returns true if two adjacent mutations of this type on the same key can be replaced by a single mutation
+// whose operand is the fold of their operands. AppendIfFits is excluded because whether it applies depends
+// on the size of the existing value, and CompareAndClear because it is not an operand fold at all. The
+// remaining kernels truncate or zero-extend to the operand's width, so the fold is only exact when both
+// operands have the same width; ByteMin/ByteMax are pure lexicographic selection and have no width rule.
+bool canCoalesceAtomicOps(MutationRef::Type type, ValueRef const& a, ValueRef const& b) {
+	switch (type) {
+	case MutationRef::ByteMin:
+	case MutationRef::ByteMax:
+		return true;
+	case MutationRef::AddValue:
+	case MutationRef::And:
+	case MutationRef::AndV2:
+	case MutationRef::Or:
+	case MutationRef::Xor:
+	case MutationRef::Max:
+	case MutationRef::Min:
+	case MutationRef::MinV2:
+		return a.size() == b.size() && a.size() > 0;
+	default:
+		return false;
+	}
+}
+
+// Folds the operands of two adjacent atomic ops (first applied before second) into one equivalent operand.
+// Only valid for type/operand combinations accepted by canCoalesceAtomicOps.
+ValueRef coalesceAtomicOpOperands(MutationRef::Type type, ValueRef const& first, ValueRef const& second, Arena& ar) {
+	Optional<ValueRef> a = first;
+	switch (type) {
+	case MutationRef::AddValue:
+		return doLittleEndianAdd(a, second, ar);
+	case MutationRef::And:
+	case MutationRef::AndV2:
+		return doAnd(a, second, ar);
+	case MutationRef::Or:
+		return doOr(a, second, ar);
+	case MutationRef::Xor:
+		return doXor(a, second, ar);
+	case MutationRef::Max:
+		return doMax(a, second, ar);
+	case MutationRef::Min:
+	case MutationRef::MinV2:
+		return doMin(a, second, ar);
+	case MutationRef::ByteMin:
+		return doByteMin(a, second, ar);
+	case MutationRef::ByteMax:
+		return doByteMax(a, second, ar);
+	default:
+		ASSERT(false);
+	}
+	return second;
+}
+
 void expandClear(MutationRef& m,
                  StorageServer::VersionedData const& data,
                  UpdateEagerReadInfo* eager,
@@ -6183,12 +6666,18 @@ void applyMutation(StorageServer* self,
 			}
 		}
 		data.insert(m.param1, ValueOrClearToRef::value(m.param2));
+		if (self->hotValueCache.enabled()) {
+			self->hotValueCache.invalidate(m.param1);
+		}
 		self->watches.trigger(m.param1);
 	} else if (m.type == MutationRef::ClearRange) {
 		data.erase(m.param1, m.param2);
 		ASSERT(m.param2 > m.param1);
 		ASSERT(!data.isClearContaining(data.atLatest(), m.param1));
 		data.insert(m.param1, ValueOrClearToRef::clearTo(m.param2));
+		if (self->hotValueCache.enabled()) {
+			self->hotValueCache.invalidate(KeyRangeRef(m.param1, m.param2));
+		}
 		self->watches.triggerRange(m.param1, m.param2);
 	}
 }
@@ -6352,6 +6841,9 @@ void removeDataRange(StorageServer* ss,
 	}
 
 	data.erase(range.begin, range.end);
+	if (ss->hotValueCache.enabled()) {
+		ss->hotValueCache.invalidate(range);
+	}
 }
 
 void setAvailableStatus(StorageServer* self, KeyRangeRef keys, bool available);
@@ -6570,6 +7062,139 @@ ACTOR Future<Void> tryGetRange(PromiseStream<RangeResult> results, Transaction*
 	}
 }
 
+// State for one sub-range of a parallel shard fetch. The reader buffers blocks ahead of the in-order consumer
+// and pauses once it is too far ahead, so buffering per sub-range stays bounded.
+struct SubrangeFetchState : NonCopyable {
+	PromiseStream<RangeResult> results;
+	int64_t bufferedBytes = 0;
+	AsyncVar<bool> tooFarAhead;
+	Future<Void> reader;
+};
+
+ACTOR Future<Void> fetchSubrange(SubrangeFetchState* self, Transaction* tr, KeyRange keys) {
+	state KeySelectorRef begin = firstGreaterOrEqual(keys.begin);
+	state KeySelectorRef end = firstGreaterOrEqual(keys.end);
+	state int attemptsLeft = SERVER_KNOBS->FETCH_KEYS_PARALLEL_SUBRANGE_RETRIES;
+	state RangeResult rep;
+
+	try {
+		loop {
+			while (self->tooFarAhead.get()) {
+				wait(self->tooFarAhead.onChange());
+			}
+			GetRangeLimits limits(GetRangeLimits::ROW_LIMIT_UNLIMITED, SERVER_KNOBS->FETCH_BLOCK_BYTES);
+			limits.minRows = 0;
+			try {
+				RangeResult r = wait(tr->getRange(begin, end, limits, Snapshot::True));
+				rep = r;
+			} catch (Error& e) {
+				// The read repeats at the same version, so retrying a transient failure within this sub-range
+				// cannot observe different data
+				if (attemptsLeft > 0 &&
+				    (e.code() == error_code_connection_failed || e.code() == error_code_server_overloaded ||
+				     e.code() == error_code_process_behind)) {
+					--attemptsLeft;
+					CODE_PROBE(true, "Parallel fetchKeys sub-range retry");
+					wait(delayJittered(FLOW_KNOBS->PREVENT_FAST_SPIN_DELAY));
+					continue;
+				}
+				throw;
+			}
+			if (!rep.more) {
+				rep.readThrough = keys.end;
+			}
+			self->bufferedBytes += rep.expectedSize();
+			self->tooFarAhead.set(self->bufferedBytes >= SERVER_KNOBS->FETCH_KEYS_PARALLEL_BUFFER_BYTES);
+			self->results.send(rep);
+
+			if (!rep.more) {
+				self->results.sendError(end_of_stream());
+				return Void();
+			}
+
+			if (rep.readThrough.present()) {
+				begin = firstGreaterOrEqual(rep.readThrough.get());
+			} else {
+				begin = firstGreaterThan(rep.end()[-1].key);
+			}
+		}
+	} catch (Error& e) {
+		if (e.code() == error_code_actor_cancelled) {
+			throw;
+		}
+		self->results.sendError(e);
+		return Void();
+	}
+}
+
+// Splits a shard fetch into sub-ranges at the source shard's split points and fetches them concurrently, so the
+// read load is spread over the replicas chosen by load balancing rather than bottlenecked on one stream. Blocks
+// are forwarded to the consumer strictly in key order, so the caller's resume-from-readThrough bookkeeping is
+// unchanged; an error in a sub-range surfaces once all blocks before it have been delivered, preserving the
+// partial-progress semantics of the sequential path.
+ACTOR Future<Void> tryGetRangeParallel(PromiseStream<RangeResult> results, Transaction* tr, KeyRange keys) {
+	state Standalone<VectorRef<KeyRef>> boundaries;
+
+	if (SERVER_KNOBS->FETCH_KEYS_PARALLEL_SOURCES > 1 && !SERVER_KNOBS->FETCH_USING_STREAMING) {
+		try {
+			Standalone<VectorRef<KeyRef>> b =
+			    wait(tr->getRangeSplitPoints(keys, SERVER_KNOBS->FETCH_KEYS_PARALLEL_SUBRANGE_BYTES));
+			boundaries = b;
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			// Split point lookup is best effort; fall back to a single stream
+			boundaries = Standalone<VectorRef<KeyRef>>();
+		}
+	}
+
+	if (boundaries.size() <= 2) {
+		wait(tryGetRange(results, tr, keys));
+		return Void();
+	}
+
+	// Reduce to at most FETCH_KEYS_PARALLEL_SOURCES sub-ranges, keeping them roughly even
+	state std::vector<std::unique_ptr<SubrangeFetchState>> subs;
+	int subranges = std::min<int>(boundaries.size() - 1, SERVER_KNOBS->FETCH_KEYS_PARALLEL_SOURCES);
+	state std::vector<Key> subBoundaries;
+	for (int i = 0; i <= subranges; i++) {
+		subBoundaries.push_back(Key(boundaries[i * (boundaries.size() - 1) / subranges], boundaries.arena()));
+	}
+	for (int i = 0; i < subranges; i++) {
+		subs.push_back(std::make_unique<SubrangeFetchState>());
+		subs[i]->reader = fetchSubrange(subs[i].get(), tr, KeyRangeRef(subBoundaries[i], subBoundaries[i + 1]));
+	}
+
+	try {
+		state int idx = 0;
+		for (; idx < subs.size(); idx++) {
+			loop {
+				try {
+					RangeResult r = waitNext(subs[idx]->results.getFuture());
+					subs[idx]->bufferedBytes -= r.expectedSize();
+					subs[idx]->tooFarAhead.set(subs[idx]->bufferedBytes >=
+					                           SERVER_KNOBS->FETCH_KEYS_PARALLEL_BUFFER_BYTES);
+					results.send(r);
+				} catch (Error& e) {
+					if (e.code() == error_code_end_of_stream) {
+						break;
+					}
+					throw;
+				}
+			}
+		}
+		results.sendError(end_of_stream());
+		return Void();
+	} catch (Error& e) {
+		if (e.code() == error_code_actor_cancelled) {
+			throw;
+		}
+		results.sendError(e);
+		throw;
+	}
+}
+
 // Read blob granules mapping from system keyspace. It keeps retrying until reaching maxRetryCount.
 ACTOR Future<Standalone<VectorRef<BlobGranuleChunkRef>>> tryReadBlobGranules(Transaction* tr,
                                                                              KeyRange keys,
@@ -6615,7 +7240,13 @@ ACTOR Future<Void> tryGetRangeFromBlob(PromiseStream<RangeResult> results,
 		state int i;
 		for (i = 0; i < chunks.size(); ++i) {
 			state KeyRangeRef chunkRange = chunks[i].keyRange;
-			state RangeResult rows = wait(readBlobGranule(chunks[i], keys, 0, fetchVersion, blobConn));
+			state RangeResult rows = wait(readBlobGranule(chunks[i],
+			                                              keys,
+			                                              0,
+			                                              fetchVersion,
+			                                              blobConn,
+			                                              Optional<BlobWorkerStats*>(),
+			                                              tr->getDatabase()->getBlobGranuleFileCache()));
 			TraceEvent(SevDebug, "ReadBlobData")
 			    .detail("Rows", rows.size())
 			    .detail("ChunkRange", chunkRange)
@@ -7375,6 +8006,94 @@ ACTOR Future<std::unordered_map<Key, Version>> dispatchChangeFeeds(StorageServer
 	}
 }
 
+// Moves a shard physically: creates a checkpoint of `keys` on the source servers, fetches the
+// checkpoint's SST files, and ingests them directly into the local store, skipping the logical
+// replay of the key-value stream through the commit path.  Returns the version at which the
+// checkpoint was taken; the caller must catch up from that version through the normal update path.
+// The source's checkpoint is cleaned up by the data move teardown in MoveKeys, like any other
+// checkpoint left behind by a data move.
+ACTOR Future<Version> fetchShardCheckpoint(StorageServer* data, KeyRange keys, UID fetchKeysID) {
+	state UID dataMoveId = deterministicRandom()->randomUniqueID();
+	state Version checkpointVersion = invalidVersion;
+	state Transaction tr(data->cx);
+
+	loop {
+		try {
+			tr.setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
+			tr.setOption(FDBTransactionOptions::LOCK_AWARE);
+			tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+			wait(createCheckpoint(&tr, { keys }, DataMoveRocksCF, dataMoveId));
+			wait(tr.commit());
+			checkpointVersion = tr.getCommittedVersion();
+			break;
+		} catch (Error& e) {
+			wait(tr.onError(e));
+		}
+	}
+
+	TraceEvent(SevDebug, "FetchShardCheckpointCreated", data->thisServerID)
+	    .detail("FKID", fetchKeysID)
+	    .detail("Keys", keys)
+	    .detail("Version", checkpointVersion);
+
+	state std::vector<CheckpointMetaData> records = wait(
+	    getCheckpointMetaData(data->cx, { keys }, checkpointVersion, DataMoveRocksCF, Optional<UID>(dataMoveId)));
+
+	// Fetch the checkpoint files to a local staging directory.
+	state std::string checkpointDir =
+	    abspath(data->folder + rocksdbCheckpointDirPrefix + fetchKeysID.toString());
+	platform::eraseDirectoryRecursive(checkpointDir);
+	platform::createDirectory(checkpointDir);
+	state std::vector<CheckpointMetaData> fetchedCheckpoints;
+	state int i = 0;
+	for (; i < records.size(); ++i) {
+		CheckpointMetaData fetched = wait(fetchCheckpoint(data->cx, records[i], checkpointDir));
+		fetchedCheckpoints.push_back(fetched);
+	}
+
+	// Ingest the files into the physical shard this range was added to.
+	wait(data->storage.restore(
+	    format("%016llx", data->shards[keys.begin]->desiredShardId), { keys }, fetchedCheckpoints));
+
+	// Apply the source's persisted byte samples for the moved range.  Byte sampling is a
+	// deterministic function of each key-value pair, so the source's samples are identical to what
+	// sampling the ingested data locally would have produced.
+	state std::unique_ptr<IRocksDBSstFileReader> sstReader = newRocksDBSstFileReader();
+	state int j = 0;
+	state int sinceYield = 0;
+	for (; j < fetchedCheckpoints.size(); ++j) {
+		if (!fetchedCheckpoints[j].bytesSampleFile.present()) {
+			continue;
+		}
+		sstReader->open(fetchedCheckpoints[j].bytesSampleFile.get());
+		while (sstReader->hasNext()) {
+			KeyValue kv = sstReader->next();
+			KeyRef key = kv.key.removePrefix(persistByteSampleKeys.begin);
+			if (keys.contains(key)) {
+				int32_t size = BinaryReader::fromStringRef<int32_t>(kv.value, Unversioned());
+				data->metrics.byteSample.sample.insert(key, size);
+				data->metrics.notifyBytes(key, size);
+				data->addMutationToMutationLogOrStorage(invalidVersion,
+				                                        MutationRef(MutationRef::SetValue, kv.key, kv.value));
+			}
+			if (++sinceYield > 1000) {
+				wait(yield());
+				sinceYield = 0;
+			}
+		}
+	}
+
+	platform::eraseDirectoryRecursive(checkpointDir);
+
+	TraceEvent(SevInfo, "FetchShardCheckpointIngested", data->thisServerID)
+	    .detail("FKID", fetchKeysID)
+	    .detail("Keys", keys)
+	    .detail("Version", checkpointVersion)
+	    .detail("Checkpoints", describe(fetchedCheckpoints));
+
+	return checkpointVersion;
+}
+
 ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 	state const UID fetchKeysID = deterministicRandom()->randomUniqueID();
 	state TraceInterval interval("FetchKeys");
@@ -7484,6 +8203,7 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 		state int debug_getRangeRetries = 0;
 		state int debug_nextRetryToLog = 1;
 		state Error lastError;
+		state bool triedCheckpointFetch = false;
 
 		// FIXME: The client cache does not notice when servers are added to a team. To read from a local storage server
 		// we must refresh the cache manually.
@@ -7544,6 +8264,40 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 				shard->updates.pop_front();
 			tr.setVersion(fetchVersion);
 
+			// For large shards, try to move the data physically: the source exports its column
+			// family SSTs at a checkpoint version and we ingest the files directly.  Any failure
+			// falls back to the streaming fetch below.
+			if (SERVER_KNOBS->FETCH_USING_CHECKPOINT && data->shardAware && !isFullRestore &&
+			    !triedCheckpointFetch &&
+			    data->storage.getKeyValueStoreType() == KeyValueStoreType::SSD_SHARDED_ROCKSDB) {
+				triedCheckpointFetch = true;
+				try {
+					state StorageMetrics fetchEstimate = wait(data->cx->getStorageMetrics(keys, -1));
+					if (fetchEstimate.bytes >= SERVER_KNOBS->FETCH_USING_CHECKPOINT_MIN_BYTES) {
+						CODE_PROBE(true, "Fetching keys by checkpoint ingestion");
+						Version checkpointVersion = wait(fetchShardCheckpoint(data, keys, fetchKeysID));
+						// The checkpoint was committed after fetchVersion was chosen, so it is newer
+						ASSERT(checkpointVersion >= fetchVersion);
+						fetchVersion = checkpointVersion;
+						shard->fetchVersion = fetchVersion;
+						while (!shard->updates.empty() && shard->updates[0].version <= fetchVersion)
+							shard->updates.pop_front();
+						metricReporter.addFetchedBytes(fetchEstimate.bytes, 0);
+						break;
+					}
+				} catch (Error& e) {
+					if (e.code() == error_code_actor_cancelled) {
+						throw;
+					}
+					CODE_PROBE(true, "Fetching keys by checkpoint ingestion failed, falling back");
+					TraceEvent(SevWarnAlways, "FetchKeysCheckpointFallback", data->thisServerID)
+					    .errorUnsuppressed(e)
+					    .detail("FKID", interval.pairID)
+					    .detail("KeyBegin", keys.begin)
+					    .detail("KeyEnd", keys.end);
+				}
+			}
+
 			state PromiseStream<RangeResult> results;
 			state Future<Void> hold;
 			if (isFullRestore) {
@@ -7555,13 +8309,14 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 					Version targetVersion = wait(getRestoreTargetVersion(data->cx, keys, fetchVersion));
 					hold = tryGetRangeFromBlob(results, &tr, rangeStatus.first, targetVersion, data->blobConn);
 				} else {
-					hold = tryGetRange(results, &tr, keys);
+					hold = tryGetRangeParallel(results, &tr, keys);
 				}
 			} else {
-				hold = tryGetRange(results, &tr, keys);
+				hold = tryGetRangeParallel(results, &tr, keys);
 			}
 
 			state Key nfk = keys.begin;
+			state int64_t bytesSinceDurableCheckpoint = 0;
 
 			try {
 				loop {
@@ -7614,6 +8369,22 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 
 					data->fetchKeysBytesBudget -= expectedBlockSize;
 					data->fetchKeysBudgetUsed.set(data->fetchKeysBytesBudget <= 0);
+
+					// Durably checkpoint long fetches: splitting off the fetched prefix as its own
+					// shard (the same path a mid-fetch error takes) lets the prefix finish and
+					// persist its available status, so a rebooted destination resumes fetching
+					// from here instead of from keys.begin.
+					bytesSinceDurableCheckpoint += expectedBlockSize;
+					if (SERVER_KNOBS->FETCH_KEYS_DURABLE_CHECKPOINT_BYTES > 0 &&
+					    bytesSinceDurableCheckpoint >= SERVER_KNOBS->FETCH_KEYS_DURABLE_CHECKPOINT_BYTES &&
+					    nfk < keys.end) {
+						CODE_PROBE(true, "FetchKeys split at durable checkpoint");
+						// Cancel the producer so it doesn't keep streaming the rest of the shard
+						// into results, unconsumed and outside fetchKeysBytesBudget, while the
+						// fetched prefix waits out MVCC and durability
+						hold = Future<Void>();
+						throw end_of_stream();
+					}
 				}
 			} catch (Error& e) {
 				if (e.code() != error_code_end_of_stream && e.code() != error_code_connection_failed &&
@@ -8626,6 +9397,51 @@ public:
 	                   MutationRefAndCipherKeys const& encryptedMutation,
 	                   Version ver,
 	                   bool fromFetch) {
+		if (SERVER_KNOBS->SS_COALESCE_ATOMIC_OPS && !fromFetch) {
+			if (bufferedAtomicCount) {
+				if (ver == bufferedAtomicVersion && m.type == bufferedAtomic.type &&
+				    m.param1 == bufferedAtomic.param1 && !encryptedMutation.mutation.isEncrypted() &&
+				    canCoalesceAtomicOps((MutationRef::Type)m.type, bufferedAtomic.param2, m.param2)) {
+					CODE_PROBE(true, "Coalesced a run of atomic ops on one key");
+					bufferedAtomic.param2 = coalesceAtomicOpOperands(
+					    (MutationRef::Type)m.type, bufferedAtomic.param2, m.param2, bufferedAtomicArena);
+					++bufferedAtomicCount;
+					++data->counters.atomicOpsCoalesced;
+					return;
+				}
+				flushAtomicRun(data);
+			}
+			// Hold back a coalescable atomic op in case the next mutation extends the run. Keys covered by a
+			// change feed are exempted so that feeds observe every mutation they would have without coalescing.
+			if (canCoalesceAtomicOps((MutationRef::Type)m.type, m.param2, m.param2) &&
+			    !encryptedMutation.mutation.isEncrypted() && !m.param1.startsWith(systemKeys.end) &&
+			    data->keyChangeFeed.rangeContaining(m.param1).value().empty()) {
+				bufferedAtomic = MutationRef(bufferedAtomicArena, m);
+				bufferedAtomicVersion = ver;
+				bufferedAtomicCount = 1;
+				return;
+			}
+		}
+		applyMutationImpl(data, m, encryptedMutation, ver, fromFetch);
+	}
+
+	// Applies any held-back atomic op. Must be called after the last applyMutation of an update batch, and in
+	// any case before the batch's version becomes visible to readers.
+	void flushAtomicRun(StorageServer* data) {
+		if (bufferedAtomicCount) {
+			MutationRef m = bufferedAtomic;
+			Version ver = bufferedAtomicVersion;
+			bufferedAtomicCount = 0;
+			applyMutationImpl(data, m, MutationRefAndCipherKeys(), ver, false);
+			bufferedAtomicArena = Arena();
+		}
+	}
+
+	void applyMutationImpl(StorageServer* data,
+	                       MutationRef const& m,
+	                       MutationRefAndCipherKeys const& encryptedMutation,
+	                       Version ver,
+	                       bool fromFetch) {
 		//TraceEvent("SSNewVersion", data->thisServerID).detail("VerWas", data->mutableData().latestVersion).detail("ChVer", ver);
 
 		if (currentVersion != ver) {
@@ -8669,6 +9485,13 @@ private:
 	KeyRef cacheStartKey;
 	bool processedCacheStartKey;
 
+	// One-deep peephole over the mutation stream: a run of coalescable atomic ops on the same key within one
+	// version is folded into a single mutation before it reaches the mutation log and the versioned tree
+	MutationRef bufferedAtomic;
+	Version bufferedAtomicVersion = invalidVersion;
+	int bufferedAtomicCount = 0;
+	Arena bufferedAtomicArena;
+
 	void applyPrivateData(StorageServer* data, Version ver, MutationRef const& m) {
 		TraceEvent(SevDebug, "SSPrivateMutation", data->thisServerID).detail("Mutation", m).detail("Version", ver);
 
@@ -9063,6 +9886,8 @@ void StorageServer::insertTenant(TenantMapEntry const& tenant, Version version,
 		int64_t tenantId = TenantAPI::prefixToId(tenant.prefix);
 		tenantMap.createNewVersion(version);
 		tenantMap.insert(tenant.id, tenantSSInfo);
+		latestTenantSnapshot[tenant.id] = tenantSSInfo;
+		lastTenantMapChangeVersion = version;
 
 		if (persist) {
 			auto& mLV = addVersionToMutationLog(version);
@@ -9101,7 +9926,9 @@ void StorageServer::clearTenants(StringRef startTenant, StringRef endTenant, Ver
 
 		for (auto tenantId : tenantsToClear) {
 			tenantMap.erase(tenantId);
+			latestTenantSnapshot.erase(tenantId);
 		}
+		lastTenantMapChangeVersion = version;
 	}
 }
 
@@ -9492,6 +10319,7 @@ ACTOR Future<Void> update(StorageServer* data, bool* pReceivedUpdate) {
 					    .detail("Version", cloneCursor2->version().toString());
 			}
 		}
+		updater.flushAtomicRun(data);
 		data->tLogMsgsPTreeUpdatesLatencyHistogram->sampleSeconds(now() - beforeTLogMsgsUpdates);
 		if (data->currentChangeFeeds.size()) {
 			data->changeFeedVersions.emplace_back(
@@ -9801,6 +10629,8 @@ ACTOR Future<Void> createCheckpoint(StorageServer* data, CheckpointMetaData meta
 ACTOR Future<Void> updateStorage(StorageServer* data) {
 	state UnlimitedCommitBytes unlimitedCommitBytes = UnlimitedCommitBytes::False;
 	state Future<Void> durableDelay = Void();
+	// Version-window trimming from the previous commit round, still being freed in the background
+	state Future<Void> priorForgetting = Void();
 
 	loop {
 		unlimitedCommitBytes = UnlimitedCommitBytes::False;
@@ -9918,12 +10748,17 @@ ACTOR Future<Void> updateStorage(StorageServer* data) {
 			}
 			// We want to forget things from these data structures atomically with changing oldestVersion (and "before",
 			// since oldestVersion.set() may trigger waiting actors) forgetVersionsBeforeAsync visibly forgets
-			// immediately (without waiting) but asynchronously frees memory.
+			// immediately (without waiting) but asynchronously frees memory. The freeing runs in the background in
+			// bounded low-priority slices; only one round is allowed to be outstanding, so waiting on the previous
+			// round here bounds the trimming backlog without stalling this round's commit on its own cleanup.
 			Future<Void> finishedForgetting =
-			    data->mutableData().forgetVersionsBeforeAsync(newOldestVersion, TaskPriority::UpdateStorage) &&
-			    data->tenantMap.forgetVersionsBeforeAsync(newOldestVersion, TaskPriority::UpdateStorage);
+			    data->mutableData().forgetVersionsBeforeAsync(
+			        newOldestVersion, TaskPriority::Low, SERVER_KNOBS->SS_VERSION_TRIM_NODES_PER_YIELD) &&
+			    data->tenantMap.forgetVersionsBeforeAsync(
+			        newOldestVersion, TaskPriority::Low, SERVER_KNOBS->SS_VERSION_TRIM_NODES_PER_YIELD);
 			data->oldestVersion.set(newOldestVersion);
-			wait(finishedForgetting);
+			wait(priorForgetting);
+			priorForgetting = finishedForgetting;
 			wait(yield(TaskPriority::UpdateStorage));
 			if (done)
 				break;
@@ -10491,6 +11326,209 @@ ACTOR Future<Void> applyByteSampleResult(StorageServer* data,
 	return Void();
 }
 
+// Describes one complete byte sample snapshot generation. The header is staged after the chunks it
+// describes and before the previous generation is cleared, so any commit-consistent prefix of a
+// snapshot's writes either leaves the previous generation loadable or describes a complete new one.
+struct ByteSampleSnapshotHeader {
+	uint64_t generation = 0;
+	int32_t chunkCount = 0;
+	int64_t entryCount = 0;
+	Version version = invalidVersion;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, generation, chunkCount, entryCount, version);
+	}
+};
+
+static Key byteSampleSnapshotGenerationPrefix(uint64_t generation) {
+	return persistByteSampleSnapshotKeys.begin.withSuffix(format("%016llx/", (long long unsigned)generation));
+}
+
+static Key byteSampleSnapshotChunkKey(uint64_t generation, int chunk) {
+	return persistByteSampleSnapshotKeys.begin.withSuffix(format("%016llx/%08x", (long long unsigned)generation, chunk));
+}
+
+// Periodically writes a compact copy of the in-memory byte sample to the storage engine so that the next
+// incarnation of this storage server can reload it with a few sequential reads instead of scanning all of
+// persistByteSampleKeys. The copy is taken incrementally under yields, so it is fuzzy with respect to
+// concurrent mutations; that is fine for a statistical sample, and the version lag check at load time
+// bounds how stale a snapshot we are willing to use.
+ACTOR Future<Void> byteSampleSnapshotter(StorageServer* data) {
+	state uint64_t generation = 0;
+	state BinaryWriter chunk(Unversioned());
+	wait(data->byteSampleRecovery);
+	{
+		Optional<Value> oldHeader = wait(data->storage.readValue(persistByteSampleSnapshotHeader));
+		if (oldHeader.present()) {
+			generation =
+			    BinaryReader::fromStringRef<ByteSampleSnapshotHeader>(oldHeader.get(), Unversioned()).generation;
+		}
+	}
+	loop {
+		wait(delay(SERVER_KNOBS->SS_BYTE_SAMPLE_SNAPSHOT_INTERVAL, TaskPriority::UpdateStorage));
+
+		state uint64_t newGeneration = generation + 1;
+		state int chunkCount = 0;
+		state int64_t entryCount = 0;
+		state Key lastKey;
+		chunk = BinaryWriter(Unversioned());
+
+		// Stale chunks from an interrupted attempt at this generation must not survive alongside the new ones
+		data->storage.clearRange(prefixRange(byteSampleSnapshotGenerationPrefix(newGeneration)));
+
+		loop {
+			auto& sample = data->metrics.byteSample.sample;
+			// Inserts can rebalance the tree across yields, so re-seek rather than holding an iterator
+			auto it = entryCount ? sample.upper_bound(lastKey) : sample.begin();
+			int sinceYield = 0;
+			while (it != sample.end()) {
+				KeyRef key = *it;
+				chunk << (int32_t)key.size();
+				chunk.serializeBytes(key);
+				chunk << (int32_t)sample.getMetric(it);
+				lastKey = key;
+				++entryCount;
+				++it;
+				if (chunk.getLength() >= SERVER_KNOBS->SS_BYTE_SAMPLE_SNAPSHOT_CHUNK_BYTES || ++sinceYield >= 1000)
+					break;
+			}
+			bool done = it == sample.end();
+			if (chunk.getLength() && (done || chunk.getLength() >= SERVER_KNOBS->SS_BYTE_SAMPLE_SNAPSHOT_CHUNK_BYTES)) {
+				data->storage.writeKeyValue(
+				    KeyValueRef(byteSampleSnapshotChunkKey(newGeneration, chunkCount++), chunk.toValue()));
+				chunk = BinaryWriter(Unversioned());
+			}
+			if (done)
+				break;
+			wait(yield(TaskPriority::UpdateStorage));
+		}
+
+		ByteSampleSnapshotHeader header;
+		header.generation = newGeneration;
+		header.chunkCount = chunkCount;
+		header.entryCount = entryCount;
+		header.version = data->version.get();
+		data->storage.writeKeyValue(
+		    KeyValueRef(persistByteSampleSnapshotHeader, BinaryWriter::toValue(header, Unversioned())));
+		// Only cleared after the new header is staged; see ByteSampleSnapshotHeader
+		data->storage.clearRange(prefixRange(byteSampleSnapshotGenerationPrefix(generation)));
+		generation = newGeneration;
+
+		TraceEvent("ByteSampleSnapshotWritten", data->thisServerID)
+		    .detail("Generation", generation)
+		    .detail("Chunks", chunkCount)
+		    .detail("Entries", entryCount)
+		    .detail("Version", header.version);
+	}
+}
+
+// Attempts to load the byte sample from the most recent snapshot generation. Returns false without touching
+// the sample if there is no snapshot, the snapshot is too stale, or it fails validation (e.g. only part of a
+// generation survived a crash), in which case the caller falls back to scanning persistByteSampleKeys.
+ACTOR Future<bool> tryRestoreByteSampleSnapshot(StorageServer* data, IKeyValueStore* storage) {
+	if (SERVER_KNOBS->SS_BYTE_SAMPLE_SNAPSHOT_INTERVAL <= 0)
+		return false;
+
+	state ByteSampleSnapshotHeader header;
+	{
+		Optional<Value> v = wait(storage->readValue(persistByteSampleSnapshotHeader));
+		if (!v.present())
+			return false;
+		header = BinaryReader::fromStringRef<ByteSampleSnapshotHeader>(v.get(), Unversioned());
+	}
+	if (header.chunkCount <= 0 || header.version == invalidVersion ||
+	    data->version.get() - header.version > SERVER_KNOBS->SS_BYTE_SAMPLE_SNAPSHOT_MAX_VERSION_LAG) {
+		TraceEvent("ByteSampleSnapshotStale", data->thisServerID)
+		    .detail("SnapshotVersion", header.version)
+		    .detail("Version", data->version.get());
+		return false;
+	}
+
+	state std::vector<RangeResult> chunks;
+	state Key begin = byteSampleSnapshotGenerationPrefix(header.generation);
+	state Key end = strinc(begin);
+	state ReadOptions readOptions(ReadType::NORMAL, CacheResult::False);
+	loop {
+		RangeResult res = wait(storage->readRange(
+		    KeyRangeRef(begin, end), SERVER_KNOBS->STORAGE_LIMIT_BYTES, SERVER_KNOBS->STORAGE_LIMIT_BYTES, readOptions));
+		data->bytesRestored += res.logicalSize();
+		data->counters.kvScanBytes += res.logicalSize();
+		if (res.size())
+			chunks.push_back(res);
+		if (res.expectedSize() < SERVER_KNOBS->STORAGE_LIMIT_BYTES)
+			break;
+		begin = keyAfter(res.back().key);
+	}
+
+	// Validate the whole snapshot before inserting anything, so that a torn generation never leaves entries
+	// in the sample that would shadow what the fallback scan recovers
+	int64_t chunkKVs = 0;
+	int64_t entries = 0;
+	bool valid = true;
+	for (auto& c : chunks) {
+		for (auto& kv : c) {
+			chunkKVs++;
+			BinaryReader rd(kv.value, Unversioned());
+			while (valid && !rd.empty()) {
+				if (rd.remainingBytes() < sizeof(int32_t)) {
+					valid = false;
+					break;
+				}
+				int32_t keyLen;
+				rd >> keyLen;
+				if (keyLen < 0 || rd.remainingBytes() < keyLen + sizeof(int32_t)) {
+					valid = false;
+					break;
+				}
+				rd.readBytes(keyLen);
+				int32_t metric;
+				rd >> metric;
+				entries++;
+			}
+		}
+	}
+	if (!valid || chunkKVs != header.chunkCount || entries != header.entryCount) {
+		TraceEvent(SevWarn, "ByteSampleSnapshotTorn", data->thisServerID)
+		    .detail("Generation", header.generation)
+		    .detail("Chunks", chunkKVs)
+		    .detail("ExpectedChunks", header.chunkCount)
+		    .detail("Entries", entries)
+		    .detail("ExpectedEntries", header.entryCount);
+		return false;
+	}
+
+	state int64_t inserted = 0;
+	state int ci = 0;
+	for (; ci < chunks.size(); ci++) {
+		state int j = 0;
+		for (; j < chunks[ci].size(); j++) {
+			BinaryReader rd(chunks[ci][j].value, Unversioned());
+			while (!rd.empty()) {
+				int32_t keyLen;
+				rd >> keyLen;
+				KeyRef key((const uint8_t*)rd.readBytes(keyLen), keyLen);
+				int32_t metric;
+				rd >> metric;
+				if (!data->byteSampleClears.rangeContaining(key).value()) {
+					data->metrics.byteSample.sample.insert(key, metric, false);
+					inserted++;
+				}
+			}
+			wait(yield());
+		}
+	}
+	data->byteSampleClears.insert(KeyRangeRef(""_sr, "\xff\xff\xff"_sr), true);
+	data->byteSampleClearsTooLarge.set(data->byteSampleClears.size() > SERVER_KNOBS->MAX_BYTE_SAMPLE_CLEAR_MAP_SIZE);
+
+	TraceEvent("RecoveredByteSampleFromSnapshot", data->thisServerID)
+	    .detail("Generation", header.generation)
+	    .detail("SnapshotVersion", header.version)
+	    .detail("Entries", header.entryCount)
+	    .detail("Inserted", inserted);
+	return true;
+}
+
 ACTOR Future<Void> restoreByteSample(StorageServer* data,
                                      IKeyValueStore* storage,
                                      Promise<Void> byteSampleSampleRecovered,
@@ -10502,6 +11540,11 @@ ACTOR Future<Void> restoreByteSample(StorageServer* data,
 	wait(startRestore);
 	wait(delay(SERVER_KNOBS->BYTE_SAMPLE_START_DELAY));
 
+	bool snapshotLoaded = wait(tryRestoreByteSampleSnapshot(data, storage));
+	if (snapshotLoaded) {
+		return Void();
+	}
+
 	size_t bytes_per_fetch = 0;
 	// Since the expected size also includes (as of now) the space overhead of the container, we calculate our own
 	// number here
@@ -10729,7 +11772,9 @@ ACTOR Future<bool> restoreDurableState(StorageServer* data, IKeyValueStore* stor
 		auto const& result = tenantMap[tenantMapLoc];
 		int64_t tenantId = TenantAPI::prefixToId(result.key.substr(persistTenantMapKeys.begin.size()));
 
-		data->tenantMap.insert(tenantId, ObjectReader::fromStringRef<TenantSSInfo>(result.value, IncludeVersion()));
+		TenantSSInfo tenantSSInfo = ObjectReader::fromStringRef<TenantSSInfo>(result.value, IncludeVersion());
+		data->tenantMap.insert(tenantId, tenantSSInfo);
+		data->latestTenantSnapshot[tenantId] = tenantSSInfo;
 
 		TraceEvent("RestoringTenant", data->thisServerID)
 		    .detail("Key", tenantMap[tenantMapLoc].key)
@@ -11447,6 +12492,9 @@ ACTOR Future<Void> storageServerCore(StorageServer* self, StorageServerInterface
 	self->actors.add(self->otherError.getFuture());
 	self->actors.add(metricsCore(self, ssi));
 	self->actors.add(logLongByteSampleRecovery(self->byteSampleRecovery));
+	if (SERVER_KNOBS->SS_BYTE_SAMPLE_SNAPSHOT_INTERVAL > 0) {
+		self->actors.add(byteSampleSnapshotter(self));
+	}
 	self->actors.add(checkBehind(self));
 	self->actors.add(serveGetValueRequests(self, ssi.getValue.getFuture()));
 	self->actors.add(serveGetKeyValuesRequests(self, ssi.getKeyValues.getFuture()));
@@ -11588,6 +12636,9 @@ ACTOR Future<Void> storageServerCore(StorageServer* self, StorageServerInterface
 			when(AuditStorageRequest req = waitNext(ssi.auditStorage.getFuture())) {
 				self->actors.add(auditStorageQ(self, req));
 			}
+			when(GetRangeDigestRequest req = waitNext(ssi.getRangeDigest.getFuture())) {
+				self->actors.add(getRangeDigestQ(self, req));
+			}
 			when(wait(updateProcessStatsTimer)) {
 				updateProcessStats(self);
 				updateProcessStatsTimer = delay(SERVER_KNOBS->FASTRESTORE_UPDATE_PROCESS_STATS_INTERVAL);
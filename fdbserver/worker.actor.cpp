@@ -2335,6 +2335,8 @@ ACTOR Future<Void> workerServer(Reference<IClusterConnectionRecord> connRecord,
 				if (rkInterf->get().present()) {
 					recruited = rkInterf->get().get();
 					CODE_PROBE(true, "Recruited while already a ratekeeper.");
+					TraceEvent("Ratekeeper_InitRequest", req.reqId).detail("RatekeeperId", recruited.id());
+					req.reply.send(recruited);
 				} else {
 					startRole(Role::RATEKEEPER, recruited.id(), interf.id());
 					DUMPTOKEN(recruited.waitFailure);
@@ -2342,7 +2344,10 @@ ACTOR Future<Void> workerServer(Reference<IClusterConnectionRecord> connRecord,
 					DUMPTOKEN(recruited.haltRatekeeper);
 					DUMPTOKEN(recruited.reportCommitCostEstimation);
 
-					Future<Void> ratekeeperProcess = ratekeeper(recruited, dbInfo);
+					TraceEvent("Ratekeeper_InitRequest", req.reqId).detail("RatekeeperId", recruited.id());
+					// The ratekeeper sends the recruitment reply itself once it has warmed up, so the
+					// cluster controller keeps the previous ratekeeper running until then
+					Future<Void> ratekeeperProcess = ratekeeper(recruited, dbInfo, req.reply);
 					errorForwarders.add(
 					    forwardError(errors,
 					                 Role::RATEKEEPER,
@@ -2350,8 +2355,6 @@ ACTOR Future<Void> workerServer(Reference<IClusterConnectionRecord> connRecord,
 					                 setWhenDoneOrError(ratekeeperProcess, rkInterf, Optional<RatekeeperInterface>())));
 					rkInterf->set(Optional<RatekeeperInterface>(recruited));
 				}
-				TraceEvent("Ratekeeper_InitRequest", req.reqId).detail("RatekeeperId", recruited.id());
-				req.reply.send(recruited);
 			}
 			when(InitializeConsistencyScanRequest req = waitNext(interf.consistencyScan.getFuture())) {
 				LocalLineage _;
@@ -3731,6 +3734,11 @@ ACTOR Future<Void> fdbd(Reference<IClusterConnectionRecord> connRecord,
 		auto serverDBInfo = ServerDBInfo();
 		serverDBInfo.myLocality = localities;
 		auto dbInfo = makeReference<AsyncVar<ServerDBInfo>>(serverDBInfo);
+		if (SERVER_KNOBS->DBINFO_BATCH_NOTIFICATIONS) {
+			// During recovery the broadcast delivers many ServerDBInfo revisions in quick succession and every
+			// change re-runs every dependent actor on this process; coalescing wakes each waiter once per burst
+			dbInfo->batchNotifications();
+		}
 		Reference<AsyncVar<Optional<UID>>> clusterId(
 		    new AsyncVar<Optional<UID>>(readClusterId(joinPath(dataFolder, clusterIdFilename))));
 		TraceEvent("MyLocality").detail("Locality", dbInfo->get().myLocality.toString());
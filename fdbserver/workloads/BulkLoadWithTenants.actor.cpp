@@ -21,7 +21,6 @@
 #include "fdbclient/ClientKnobs.h"
 #include "fdbclient/TenantEntryCache.actor.h"
 #include "fdbclient/TenantManagement.actor.h"
-#include "fdbrpc/ContinuousSample.h"
 #include "fdbrpc/TenantInfo.h"
 #include "fdbserver/Knobs.h"
 #include "fdbserver/TesterInterface.actor.h"
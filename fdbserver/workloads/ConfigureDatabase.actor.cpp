@@ -445,7 +445,8 @@ struct ConfigureDatabaseWorkload : TestWorkload {
 					storeTypeStr = memoryTypes[deterministicRandom()->randomInt(0, 3)];
 					break;
 				case 2:
-					storeTypeStr = "memory-radixtree-beta";
+					// Beta suffix is still supported so test it
+					storeTypeStr = BUGGIFY ? "memory-radixtree" : "memory-radixtree-beta";
 					break;
 				case 3:
 					// Experimental suffix is still supported so test it
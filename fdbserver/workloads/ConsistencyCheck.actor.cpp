@@ -80,6 +80,11 @@ struct ConsistencyCheckWorkload : TestWorkload {
 	// Max number of bytes per second to read from each storage server
 	int rateLimitMax;
 
+	// How many storage teams are checked concurrently when not performing quiescent checks. Each team gets an
+	// independent rate budget derived from its idle capacity, so checking speed scales with cluster size. A value
+	// of 1 preserves the old behavior of a single sequential pass with a global rate limit.
+	int teamParallelism;
+
 	// DataSet Size
 	int64_t bytesReadInPreviousRound;
 
@@ -108,6 +113,7 @@ struct ConsistencyCheckWorkload : TestWorkload {
 		shardSampleFactor = std::max(getOption(options, "shardSampleFactor"_sr, 1), 1);
 		failureIsError = getOption(options, "failureIsError"_sr, false);
 		rateLimitMax = getOption(options, "rateLimitMax"_sr, 0);
+		teamParallelism = std::max(getOption(options, "teamParallelism"_sr, 10), 1);
 		shuffleShards = getOption(options, "shuffleShards"_sr, false);
 		indefinite = getOption(options, "indefinite"_sr, false);
 		suspendConsistencyCheck.set(true);
@@ -342,28 +348,35 @@ struct ConsistencyCheckWorkload : TestWorkload {
 					if (keyLocationResult) {
 						state Standalone<VectorRef<KeyValueRef>> keyLocations = keyLocationPromise.getFuture().get();
 
-						// Check that each shard has the same data on all storage servers that it resides on
-						wait(::success(
-						    checkDataConsistency(cx,
-						                         keyLocations,
-						                         configuration,
-						                         tssMapping,
-						                         self->performQuiescentChecks,
-						                         self->performTSSCheck,
-						                         self->firstClient,
-						                         self->failureIsError,
-						                         self->clientId,
-						                         self->clientCount,
-						                         self->distributed,
-						                         self->shuffleShards,
-						                         self->shardSampleFactor,
-						                         self->sharedRandomNumber,
-						                         self->repetitions,
-						                         &(self->bytesReadInPreviousRound),
-						                         true,
-						                         self->rateLimitMax,
-						                         CLIENT_KNOBS->CONSISTENCY_CHECK_ONE_ROUND_TARGET_COMPLETION_TIME,
-						                         KeyRef())));
+						// Check that each shard has the same data on all storage servers that it resides on.
+						// Quiescent checks keep the sequential pass since they also validate per-shard size
+						// estimates on the first client; otherwise teams are checked in parallel.
+						if (!self->performQuiescentChecks && self->teamParallelism > 1) {
+							wait(::success(self->checkDataConsistencyTeamParallel(
+							    cx, keyServers, keyLocations, configuration, tssMapping, self)));
+						} else {
+							wait(::success(
+							    checkDataConsistency(cx,
+							                         keyLocations,
+							                         configuration,
+							                         tssMapping,
+							                         self->performQuiescentChecks,
+							                         self->performTSSCheck,
+							                         self->firstClient,
+							                         self->failureIsError,
+							                         self->clientId,
+							                         self->clientCount,
+							                         self->distributed,
+							                         self->shuffleShards,
+							                         self->shardSampleFactor,
+							                         self->sharedRandomNumber,
+							                         self->repetitions,
+							                         &(self->bytesReadInPreviousRound),
+							                         true,
+							                         self->rateLimitMax,
+							                         CLIENT_KNOBS->CONSISTENCY_CHECK_ONE_ROUND_TARGET_COMPLETION_TIME,
+							                         KeyRef())));
+						}
 
 						// Cache consistency check
 						if (self->performCacheCheck)
@@ -387,6 +400,150 @@ struct ConsistencyCheckWorkload : TestWorkload {
 		return Void();
 	}
 
+	// Check the shards of one storage team, rate limited by the team's own budget
+	ACTOR Future<bool> checkTeamConsistency(Database cx,
+	                                        VectorRef<KeyValueRef> keyLocations,
+	                                        DatabaseConfiguration configuration,
+	                                        std::map<UID, StorageServerInterface> tssMapping,
+	                                        std::vector<StorageServerInterface> teamInterfaces,
+	                                        std::vector<int> shardIndices,
+	                                        FlowLock* teamLock,
+	                                        int64_t* bytesReadAccumulator,
+	                                        ConsistencyCheckWorkload* self) {
+		wait(teamLock->take());
+		state FlowLock::Releaser releaser(*teamLock);
+
+		// Derive this team's rate budget from the idle capacity of its busiest member, so lightly loaded teams
+		// are checked quickly while busy ones only give up the headroom they can spare
+		state int64_t rateLimit = self->rateLimitMax;
+		if (rateLimit > 0) {
+			state std::vector<Future<ErrorOr<StorageQueuingMetricsReply>>> metrics;
+			for (const auto& ssi : teamInterfaces) {
+				metrics.push_back(ssi.getQueuingMetrics.getReplyUnlessFailedFor(StorageQueuingMetricsRequest(), 2, 0));
+			}
+			wait(waitForAll(metrics));
+			double busiest = 0;
+			for (const auto& m : metrics) {
+				if (m.get().present()) {
+					busiest = std::max({ busiest, m.get().get().cpuUsage, m.get().get().diskUsage });
+				}
+			}
+			double idleFraction = std::clamp(1.0 - busiest / 100.0, 0.1, 1.0);
+			rateLimit = std::max<int64_t>(1, rateLimit * idleFraction);
+		}
+
+		state int64_t bytesRead = 0;
+		bool result = wait(checkDataConsistency(cx,
+		                                        keyLocations,
+		                                        configuration,
+		                                        tssMapping,
+		                                        self->performQuiescentChecks,
+		                                        self->performTSSCheck,
+		                                        false /* firstClient */,
+		                                        self->failureIsError,
+		                                        0 /* clientId */,
+		                                        1 /* clientCount */,
+		                                        false /* distributed */,
+		                                        false /* shuffleShards */,
+		                                        1 /* shardSampleFactor */,
+		                                        self->sharedRandomNumber,
+		                                        self->repetitions,
+		                                        &bytesRead,
+		                                        true,
+		                                        rateLimit,
+		                                        CLIENT_KNOBS->CONSISTENCY_CHECK_ONE_ROUND_TARGET_COMPLETION_TIME,
+		                                        KeyRef(),
+		                                        shardIndices));
+		*bytesReadAccumulator += bytesRead;
+		return result;
+	}
+
+	// Group shards by the storage team that serves them and check teams in parallel, each with an independent
+	// rate budget, so aggregate checking speed scales with the number of teams instead of being a fixed trickle
+	ACTOR Future<bool> checkDataConsistencyTeamParallel(
+	    Database cx,
+	    std::vector<std::pair<KeyRange, std::vector<StorageServerInterface>>> keyServers,
+	    VectorRef<KeyValueRef> keyLocations,
+	    DatabaseConfiguration configuration,
+	    std::map<UID, StorageServerInterface> tssMapping,
+	    ConsistencyCheckWorkload* self) {
+		// Map storage server ids to interfaces for the idle capacity queries
+		state std::map<UID, StorageServerInterface> ssInterfaces;
+		for (const auto& shard : keyServers) {
+			for (const auto& ssi : shard.second) {
+				ssInterfaces[ssi.id()] = ssi;
+			}
+		}
+
+		state Transaction tr(cx);
+		tr.setOption(FDBTransactionOptions::LOCK_AWARE);
+		state RangeResult UIDtoTagMap;
+		loop {
+			try {
+				RangeResult result = wait(tr.getRange(serverTagKeys, CLIENT_KNOBS->TOO_MANY));
+				UIDtoTagMap = result;
+				break;
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+		ASSERT(!UIDtoTagMap.more && UIDtoTagMap.size() < CLIENT_KNOBS->TOO_MANY);
+
+		state std::map<std::vector<UID>, std::vector<int>> teamShards;
+		for (int k = 0; k < keyLocations.size() - 1; k++) {
+			std::vector<UID> src;
+			std::vector<UID> dest;
+			decodeKeyServersValue(UIDtoTagMap, keyLocations[k].value, src, dest, false);
+			// Relocating shards are grouped by their destination team, which is the team that gets checked
+			std::vector<UID> team = dest.size() > 0 ? dest : src;
+			std::sort(team.begin(), team.end());
+			teamShards[team].push_back(k);
+		}
+
+		state FlowLock teamLock(self->teamParallelism);
+		state int64_t bytesRead = 0;
+		state std::vector<Future<bool>> teamChecks;
+		state int teamIndex = 0;
+		for (auto& team : teamShards) {
+			// In a distributed check, spread the teams across the participating clients
+			if (!self->distributed || teamIndex % self->clientCount == self->clientId) {
+				std::vector<int> shardIndices;
+				for (int j = 0; j < team.second.size(); j += self->shardSampleFactor) {
+					shardIndices.push_back(team.second[j]);
+				}
+				std::vector<StorageServerInterface> teamInterfaces;
+				for (const auto& id : team.first) {
+					auto ssi = ssInterfaces.find(id);
+					if (ssi != ssInterfaces.end()) {
+						teamInterfaces.push_back(ssi->second);
+					}
+				}
+				teamChecks.push_back(self->checkTeamConsistency(cx,
+				                                                keyLocations,
+				                                                configuration,
+				                                                tssMapping,
+				                                                teamInterfaces,
+				                                                shardIndices,
+				                                                &teamLock,
+				                                                &bytesRead,
+				                                                self));
+			}
+			++teamIndex;
+		}
+		TraceEvent("ConsistencyCheck_TeamParallelSchedule")
+		    .detail("Teams", teamShards.size())
+		    .detail("TeamsThisClient", teamChecks.size())
+		    .detail("TeamParallelism", self->teamParallelism);
+
+		wait(waitForAll(teamChecks));
+		self->bytesReadInPreviousRound = bytesRead;
+		bool result = true;
+		for (auto& check : teamChecks) {
+			result = result && check.get();
+		}
+		return result;
+	}
+
 	// Check the data consistency between storage cache servers and storage servers
 	// keyLocations: all key/value pairs persisted in the database, reused from previous consistency check on all
 	// storage servers
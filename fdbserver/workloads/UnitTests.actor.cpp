@@ -35,6 +35,8 @@ void forceLinkSimExternalConnectionTests();
 void forceLinkMutationLogReaderTests();
 void forceLinkSimKmsConnectorTests();
 void forceLinkIThreadPoolTests();
+void forceLinkComputeThreadPoolTests();
+void forceLinkBinaryTraceLogFormatterTests();
 void forceLinkTokenSignTests();
 void forceLinkJsonWebKeySetTests();
 void forceLinkVersionVectorTests();
@@ -100,6 +102,8 @@ struct UnitTestWorkload : TestWorkload {
 		forceLinkMutationLogReaderTests();
 		forceLinkSimKmsConnectorTests();
 		forceLinkIThreadPoolTests();
+		forceLinkComputeThreadPoolTests();
+		forceLinkBinaryTraceLogFormatterTests();
 		forceLinkTokenSignTests();
 		forceLinkJsonWebKeySetTests();
 		forceLinkVersionVectorTests();
@@ -24,38 +24,137 @@
 #include <boost/intrusive/list.hpp>
 #include "flow/actorcompiler.h" // This must be the last #include.
 
-struct Runner : public boost::intrusive::list_base_hook<>, FastAllocated<Runner>, NonCopyable {
-	Future<Void> handler;
+struct CollectionState;
+
+// One node per unready task: an intrusive list hook for deterministic cancellation order plus a
+// callback registered directly on the task's SAV.  Completion and failure are handled right here,
+// where the old implementation spawned a runnerHandler actor per task and bounced every completion
+// through a PromiseStream back to the collection's main loop.
+struct Runner final : public boost::intrusive::list_base_hook<>, FastAllocated<Runner>, NonCopyable {
+	struct TaskCallback final : Callback<Void> {
+		Runner* runner;
+		void fire(Void const&) override { runner->completed(); }
+		void fire(Void&&) override { runner->completed(); }
+		void error(Error e) override { runner->failed(e); }
+	} taskCallback;
+	CollectionState* collection;
+
+	explicit Runner(CollectionState* collection) : collection(collection) { taskCallback.runner = this; }
+
+	void completed();
+	void failed(Error e);
 };
 
-// An intrusive list of Runners, which are FastAllocated.  Each runner holds a handler future
+// An intrusive list of Runners, which are FastAllocated
 typedef boost::intrusive::list<Runner, boost::intrusive::constant_time_size<false>> RunnerList;
 
-// The runners list in the ActorCollection must be destroyed when the actor is destructed rather
-// than before returning or throwing
-struct RunnerListDestroyer : NonCopyable {
-	RunnerListDestroyer(RunnerList* list) : list(list) {}
+// State shared between the actorCollection actor and its Runners.  It lives in the actor so it is
+// destroyed when the actor is destructed rather than before returning or throwing, which cancels
+// the remaining tasks in insertion order.
+struct CollectionState : NonCopyable {
+	RunnerList runners;
+	int count;
+	int* pCount;
+	double* lastChangeTime;
+	double* idleTime;
+	double* allTime;
+	bool returnWhenEmptied;
+	// Completed (returnWhenEmptied) or broken with the first task error
+	Promise<Void> result;
+
+	CollectionState(int* pCount, double* lastChangeTime, double* idleTime, double* allTime, bool returnWhenEmptied)
+	  : count(0), pCount(pCount ? pCount : &count), lastChangeTime(lastChangeTime), idleTime(idleTime),
+	    allTime(allTime), returnWhenEmptied(returnWhenEmptied) {}
+
+	~CollectionState() {
+		// Cancelling a task can synchronously fail other tasks in the collection, whose Runners
+		// then erase themselves from this list, so unlink each node before disposing of it
+		// instead of using clear_and_dispose(), which holds an iterator across disposals.
+		while (!runners.empty()) {
+			Runner* r = &runners.front();
+			runners.pop_front();
+			// Detaching the callback releases (and possibly cancels) the task.  Runners whose
+			// tasks were cancelled elsewhere have already detached.
+			if (r->taskCallback.next) {
+				r->taskCallback.remove();
+			}
+			delete r;
+		}
+	}
+
+	void add(Future<Void>&& task) {
+		onTaskAdded();
+		if (task.isReady()) {
+			if (task.isError()) {
+				// As with unready tasks, a cancelled task neither completes nor breaks the
+				// collection, so its count is never returned
+				if (task.getError().code() != error_code_actor_cancelled) {
+					onTaskError(task.getError());
+				}
+			} else {
+				onTaskCompleted();
+			}
+			return;
+		}
+		Runner* runner = new Runner(this);
+		runners.push_back(*runner);
+		task.addCallbackAndClear(&runner->taskCallback);
+	}
+
+	void onTaskAdded() {
+		++*pCount;
+		if (*pCount == 1 && lastChangeTime && idleTime && allTime) {
+			double currentTime = now();
+			*idleTime += currentTime - *lastChangeTime;
+			*allTime += currentTime - *lastChangeTime;
+			*lastChangeTime = currentTime;
+		}
+	}
 
-	~RunnerListDestroyer() {
-		list->clear_and_dispose([](Runner* r) { delete r; });
+	void onTaskCompleted() {
+		if (!--*pCount) {
+			if (lastChangeTime && idleTime && allTime) {
+				double currentTime = now();
+				*allTime += currentTime - *lastChangeTime;
+				*lastChangeTime = currentTime;
+			}
+			if (returnWhenEmptied) {
+				// Completing result may resume and destruct the collection actor (and therefore
+				// this) synchronously, so send through a local reference and touch nothing after
+				Promise<Void> r = result;
+				r.send(Void());
+			}
+		}
 	}
 
-	RunnerList* list;
+	void onTaskError(Error e) {
+		// See onTaskCompleted() regarding synchronous destruction
+		Promise<Void> r = result;
+		r.sendError(e);
+	}
 };
 
-ACTOR Future<Void> runnerHandler(PromiseStream<RunnerList::iterator> output,
-                                 PromiseStream<Error> errors,
-                                 Future<Void> task,
-                                 RunnerList::iterator runner) {
-	try {
-		wait(task);
-		output.send(runner);
-	} catch (Error& e) {
-		if (e.code() == error_code_actor_cancelled)
-			throw;
-		errors.send(e);
+void Runner::completed() {
+	taskCallback.remove();
+	taskCallback.next = nullptr;
+	CollectionState* c = collection;
+	c->runners.erase(c->runners.iterator_to(*this));
+	delete this;
+	c->onTaskCompleted();
+}
+
+void Runner::failed(Error e) {
+	taskCallback.remove();
+	taskCallback.next = nullptr;
+	if (e.code() == error_code_actor_cancelled) {
+		// A task cancelled elsewhere neither completes nor breaks the collection; the node stays
+		// (detached) until the collection is destroyed, as the handler future used to
+		return;
 	}
-	return Void();
+	CollectionState* c = collection;
+	c->runners.erase(c->runners.iterator_to(*this));
+	delete this;
+	c->onTaskError(e);
 }
 
 ACTOR Future<Void> actorCollection(FutureStream<Future<Void>> addActor,
@@ -64,46 +163,14 @@ ACTOR Future<Void> actorCollection(FutureStream<Future<Void>> addActor,
                                    double* idleTime,
                                    double* allTime,
                                    bool returnWhenEmptied) {
-	state RunnerList runners;
-	state RunnerListDestroyer runnersDestroyer(&runners);
-	state PromiseStream<RunnerList::iterator> complete;
-	state PromiseStream<Error> errors;
-	state int count = 0;
-	if (!pCount)
-		pCount = &count;
+	state CollectionState collection(pCount, lastChangeTime, idleTime, allTime, returnWhenEmptied);
 
 	loop choose {
 		when(Future<Void> f = waitNext(addActor)) {
-			// Insert new Runner at the end of the instrusive list and get an iterator to it
-			auto i = runners.insert(runners.end(), *new Runner());
-
-			// Start the handler for completions or errors from f, sending runner to complete stream
-			Future<Void> handler = runnerHandler(complete, errors, f, i);
-			i->handler = handler;
-
-			++*pCount;
-			if (*pCount == 1 && lastChangeTime && idleTime && allTime) {
-				double currentTime = now();
-				*idleTime += currentTime - *lastChangeTime;
-				*allTime += currentTime - *lastChangeTime;
-				*lastChangeTime = currentTime;
-			}
+			collection.add(std::move(f));
 		}
-		when(RunnerList::iterator i = waitNext(complete.getFuture())) {
-			if (!--*pCount) {
-				if (lastChangeTime && idleTime && allTime) {
-					double currentTime = now();
-					*allTime += currentTime - *lastChangeTime;
-					*lastChangeTime = currentTime;
-				}
-				if (returnWhenEmptied)
-					return Void();
-			}
-			// If we didn't return then the entire list wasn't destroyed so erase/destroy i
-			runners.erase_and_dispose(i, [](Runner* r) { delete r; });
-		}
-		when(Error e = waitNext(errors.getFuture())) {
-			throw e;
+		when(wait(collection.result.getFuture())) {
+			return Void();
 		}
 	}
 }
@@ -127,6 +194,52 @@ struct Traceable<std::pair<T, U>> {
 
 void forceLinkActorCollectionTests() {}
 
+TEST_CASE("/flow/actorCollection/basic") {
+	state int count = 0;
+	state PromiseStream<Future<Void>> add;
+	state Future<Void> collection = actorCollection(add.getFuture(), &count);
+	state Promise<Void> a;
+	state Promise<Void> b;
+
+	add.send(a.getFuture());
+	add.send(b.getFuture());
+	add.send(Future<Void>(Void())); // already-ready tasks complete without a Runner
+	wait(delay(0));
+	ASSERT(count == 2);
+
+	a.send(Void());
+	wait(delay(0));
+	ASSERT(count == 1);
+
+	// The first task error breaks the collection, cancelling the remaining tasks
+	add.send(Future<Void>(io_error()));
+	try {
+		wait(collection);
+		ASSERT(false);
+	} catch (Error& e) {
+		ASSERT(e.code() == error_code_io_error);
+	}
+	return Void();
+}
+
+TEST_CASE("/flow/actorCollection/returnWhenEmptied") {
+	state int count = 0;
+	state PromiseStream<Future<Void>> add;
+	state Future<Void> collection =
+	    actorCollection(add.getFuture(), &count, nullptr, nullptr, nullptr, /*returnWhenEmptied*/ true);
+	state Promise<Void> a;
+
+	add.send(a.getFuture());
+	wait(delay(0));
+	ASSERT(count == 1 && !collection.isReady());
+
+	a.send(Void());
+	wait(collection);
+	ASSERT(count == 0);
+
+	return Void();
+}
+
 // The above implementation relies on the behavior that fulfilling a promise
 // that another when clause in the same choose block is waiting on is not fired synchronously.
 TEST_CASE("/flow/actorCollection/chooseWhen") {
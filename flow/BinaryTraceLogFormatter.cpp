@@ -0,0 +1,166 @@
+/*
+ * BinaryTraceLogFormatter.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow/flow.h"
+#include "flow/BinaryTraceLogFormatter.h"
+#include "flow/UnitTest.h"
+
+#include <cstring>
+
+void BinaryTraceLogFormatter::addref() {
+	ReferenceCounted<BinaryTraceLogFormatter>::addref();
+}
+
+void BinaryTraceLogFormatter::delref() {
+	ReferenceCounted<BinaryTraceLogFormatter>::delref();
+}
+
+const char* BinaryTraceLogFormatter::getExtension() const {
+	return "bin";
+}
+
+const char* BinaryTraceLogFormatter::getHeader() const {
+	return "FDBTRACEBIN1\n";
+}
+
+const char* BinaryTraceLogFormatter::getFooter() const {
+	return "";
+}
+
+namespace {
+
+template <class T>
+void appendScalar(std::string& out, T value) {
+	// FDB only runs on little-endian platforms, so raw bytes are the wire format
+	out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <class T>
+bool readScalar(StringRef data, int* offset, T* value) {
+	if (data.size() - *offset < (int)sizeof(T)) {
+		return false;
+	}
+	memcpy(value, data.begin() + *offset, sizeof(T));
+	*offset += sizeof(T);
+	return true;
+}
+
+bool readBytes(StringRef data, int* offset, int length, std::string* value) {
+	if (length < 0 || data.size() - *offset < length) {
+		return false;
+	}
+	value->assign(reinterpret_cast<const char*>(data.begin()) + *offset, length);
+	*offset += length;
+	return true;
+}
+
+} // namespace
+
+std::string BinaryTraceLogFormatter::formatEvent(const TraceEventFields& fields) const {
+	std::string out;
+	out.reserve(sizeof(uint32_t) + fields.sizeBytes());
+	appendScalar(out, uint32_t(0)); // placeholder for the payload length
+	appendScalar(out, uint16_t(fields.size()));
+	for (auto iter = fields.begin(); iter != fields.end(); ++iter) {
+		appendScalar(out, uint16_t(iter->first.size()));
+		out.append(iter->first);
+		appendScalar(out, uint32_t(iter->second.size()));
+		out.append(iter->second);
+	}
+	uint32_t payloadSize = out.size() - sizeof(uint32_t);
+	memcpy(&out[0], &payloadSize, sizeof(payloadSize));
+	return out;
+}
+
+bool BinaryTraceLogFormatter::readEvent(StringRef data, int* offset, TraceEventFields* out) {
+	int pos = *offset;
+	uint32_t payloadSize;
+	if (!readScalar(data, &pos, &payloadSize) || data.size() - pos < (int)payloadSize) {
+		return false;
+	}
+	int end = pos + payloadSize;
+	uint16_t fieldCount;
+	if (!readScalar(data, &pos, &fieldCount)) {
+		return false;
+	}
+	for (int i = 0; i < fieldCount; i++) {
+		uint16_t keySize;
+		uint32_t valueSize;
+		std::string key, value;
+		if (!readScalar(data, &pos, &keySize) || !readBytes(data, &pos, keySize, &key) ||
+		    !readScalar(data, &pos, &valueSize) || !readBytes(data, &pos, valueSize, &value) || pos > end) {
+			return false;
+		}
+		out->addField(std::move(key), std::move(value));
+	}
+	if (pos != end) {
+		return false;
+	}
+	*offset = end;
+	return true;
+}
+
+void forceLinkBinaryTraceLogFormatterTests() {}
+
+TEST_CASE("/flow/BinaryTraceLogFormatter/roundTrip") {
+	BinaryTraceLogFormatter formatter;
+
+	TraceEventFields event;
+	event.addField("Severity", "10");
+	event.addField("Type", "BinaryTraceTest");
+	event.addField("Escaping", "\"<&>\"\n\\embedded\x01markup");
+	event.addField("Empty", "");
+
+	std::string serialized = formatter.formatEvent(event);
+	for (int i = 0; i < 100; i++) {
+		TraceEventFields extra;
+		extra.addField(deterministicRandom()->randomAlphaNumeric(deterministicRandom()->randomInt(1, 64)),
+		               deterministicRandom()->randomAlphaNumeric(deterministicRandom()->randomInt(0, 1000)));
+		serialized += formatter.formatEvent(extra);
+	}
+
+	StringRef data(serialized);
+	int offset = 0;
+	TraceEventFields decoded;
+	ASSERT(BinaryTraceLogFormatter::readEvent(data, &offset, &decoded));
+	ASSERT(decoded.size() == event.size());
+	for (int i = 0; i < event.size(); i++) {
+		ASSERT((decoded.begin() + i)->first == (event.begin() + i)->first);
+		ASSERT((decoded.begin() + i)->second == (event.begin() + i)->second);
+	}
+	int records = 1;
+	while (offset < data.size()) {
+		TraceEventFields f;
+		ASSERT(BinaryTraceLogFormatter::readEvent(data, &offset, &f));
+		ASSERT(f.size() == 1);
+		records++;
+	}
+	ASSERT(records == 101 && offset == data.size());
+
+	// A truncated record is rejected without advancing the offset
+	StringRef truncated = data.substr(0, data.size() - 1);
+	offset = 0;
+	TraceEventFields f;
+	while (BinaryTraceLogFormatter::readEvent(truncated, &offset, &f)) {
+	}
+	ASSERT(offset < truncated.size());
+
+	return Void();
+}
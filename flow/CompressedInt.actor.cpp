@@ -20,6 +20,7 @@
 
 #include "flow/UnitTest.h"
 #include "flow/CompressedInt.h"
+#include "flow/GroupVarint.h"
 
 void printBitsLittle(size_t const size, void const* const ptr) {
 	unsigned char* b = (unsigned char*)ptr;
@@ -104,3 +105,43 @@ TEST_CASE("/flow/compressed_ints") {
 	}
 	return Void();
 }
+
+TEST_CASE("/flow/group_varint") {
+	// Byte length boundaries
+	std::vector<uint32_t> boundaries = { 0,        1,         0xff,      0x100,     0xffff,
+		                                 0x10000,  0xffffff,  0x1000000, 0xfffffffe, 0xffffffff };
+	std::vector<uint8_t> buf(GroupVarint32::maxEncodedSize(boundaries.size()));
+	int len = GroupVarint32::encode(boundaries.data(), boundaries.size(), buf.data());
+	std::vector<uint32_t> decoded(boundaries.size());
+	int consumed = GroupVarint32::decode(buf.data(), buf.data() + len, decoded.data(), decoded.size());
+	ASSERT(consumed == len);
+	ASSERT(decoded == boundaries);
+
+	// Random batches of every size and magnitude mix, decoded from exactly-sized input
+	for (int iteration = 0; iteration < 100000; ++iteration) {
+		int count = deterministicRandom()->randomInt(0, 30);
+		std::vector<uint32_t> values(count);
+		for (auto& v : values) {
+			int bits = deterministicRandom()->randomInt(0, 33);
+			v = uint32_t(deterministicRandom()->randomInt64(0, (int64_t(1) << bits)));
+		}
+		buf.resize(GroupVarint32::maxEncodedSize(count));
+		int encodedLen = GroupVarint32::encode(values.data(), count, buf.data());
+		std::vector<uint32_t> out(count);
+		int bytesRead = GroupVarint32::decode(buf.data(), buf.data() + encodedLen, out.data(), count);
+		ASSERT(bytesRead == encodedLen);
+		ASSERT(out == values);
+
+		// Truncated input must throw rather than read past the end
+		if (encodedLen > 0) {
+			int cut = deterministicRandom()->randomInt(0, encodedLen);
+			try {
+				GroupVarint32::decode(buf.data(), buf.data() + cut, out.data(), count);
+				ASSERT(false);
+			} catch (Error& e) {
+				ASSERT(e.code() == error_code_serialization_failed);
+			}
+		}
+	}
+	return Void();
+}
@@ -0,0 +1,215 @@
+/*
+ * ComputeThreadPool.actor.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow/ComputeThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "flow/UnitTest.h"
+#include "flow/actorcompiler.h" // has to be last include
+
+void forceLinkComputeThreadPoolTests() {}
+
+struct ComputeThreadPool::Impl {
+	struct Task {
+		TaskPriority priority;
+		uint64_t sequence;
+		std::function<void()> fn;
+	};
+	// Highest priority first; FIFO within a priority.
+	struct TaskOrder {
+		bool operator()(Task const& a, Task const& b) const {
+			return a.priority < b.priority || (a.priority == b.priority && a.sequence > b.sequence);
+		}
+	};
+	struct Worker {
+		Impl* impl;
+		int index;
+		std::mutex mutex;
+		std::vector<Task> tasks; // a heap ordered by TaskOrder
+		THREAD_HANDLE handle;
+	};
+
+	std::vector<std::unique_ptr<Worker>> workers;
+	// Tracks queued-but-unclaimed tasks across all workers so idle workers can sleep without
+	// polling victims' queues; a worker that claims a task is guaranteed to find one somewhere.
+	std::mutex wakeMutex;
+	std::condition_variable wake;
+	int64_t unclaimedTasks = 0; // protected by wakeMutex
+	bool stopped = false; // protected by wakeMutex
+	uint64_t nextSequence = 0; // main thread only
+	int nextWorker = 0; // main thread only
+	std::atomic<int64_t> tasksSubmitted{ 0 };
+	std::atomic<int64_t> tasksStolen{ 0 };
+
+	explicit Impl(int numWorkers) {
+		for (int i = 0; i < numWorkers; i++) {
+			workers.push_back(std::make_unique<Worker>());
+			workers[i]->impl = this;
+			workers[i]->index = i;
+		}
+		// Start only after the worker vector is complete, since workers scan each other's queues
+		for (int i = 0; i < numWorkers; i++) {
+			workers[i]->handle = g_network->startThread(start, workers[i].get(), 0, "fdb-compute");
+		}
+	}
+
+	THREAD_FUNC start(void* arg) {
+		Worker* worker = (Worker*)arg;
+		worker->impl->run(worker->index);
+		THREAD_RETURN;
+	}
+
+	void run(int self) {
+		for (;;) {
+			{
+				std::unique_lock<std::mutex> lock(wakeMutex);
+				wake.wait(lock, [this] { return unclaimedTasks > 0 || stopped; });
+				if (unclaimedTasks == 0) // stopped, and every queued task has been claimed
+					return;
+				--unclaimedTasks; // claim one task; it stays queued until taken below
+			}
+			Task task = take(self);
+			task.fn();
+		}
+	}
+
+	// Removes the highest-priority task from this worker's own queue, or failing that steals the
+	// highest-priority task from another worker.  A claimed task exists in some queue and only
+	// other claimants can remove tasks, so retrying the scan always terminates.
+	Task take(int self) {
+		for (;;) {
+			for (int i = 0; i < (int)workers.size(); i++) {
+				Worker& victim = *workers[(self + i) % workers.size()];
+				std::unique_lock<std::mutex> lock(victim.mutex);
+				if (!victim.tasks.empty()) {
+					std::pop_heap(victim.tasks.begin(), victim.tasks.end(), TaskOrder());
+					Task task = std::move(victim.tasks.back());
+					victim.tasks.pop_back();
+					if (i != 0) {
+						tasksStolen.fetch_add(1);
+					}
+					return task;
+				}
+			}
+		}
+	}
+};
+
+ComputeThreadPool::ComputeThreadPool(int numWorkers) {
+	if (numWorkers > 0) {
+		impl = std::make_unique<Impl>(numWorkers);
+	}
+}
+
+ComputeThreadPool::~ComputeThreadPool() {
+	stop();
+}
+
+ComputeThreadPool& ComputeThreadPool::shared() {
+	// Leaked so the workers outlive anything destroyed during static destruction
+	static ComputeThreadPool* pool =
+	    new ComputeThreadPool(g_network->isSimulated() ? 0 : FLOW_KNOBS->COMPUTE_POOL_THREADS);
+	return *pool;
+}
+
+void ComputeThreadPool::dispatch(TaskPriority priority, std::function<void()> fn) {
+	// Round-robin placement keeps queues balanced when tasks are uniform; stealing evens things
+	// out when they are not.
+	Impl::Worker& target = *impl->workers[impl->nextWorker++ % impl->workers.size()];
+	{
+		std::lock_guard<std::mutex> lock(target.mutex);
+		target.tasks.push_back(Impl::Task{ priority, impl->nextSequence++, std::move(fn) });
+		std::push_heap(target.tasks.begin(), target.tasks.end(), Impl::TaskOrder());
+	}
+	{
+		std::lock_guard<std::mutex> lock(impl->wakeMutex);
+		++impl->unclaimedTasks;
+	}
+	impl->wake.notify_one();
+	impl->tasksSubmitted.fetch_add(1);
+}
+
+void ComputeThreadPool::stop() {
+	if (!impl) {
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(impl->wakeMutex);
+		impl->stopped = true;
+	}
+	impl->wake.notify_all();
+	for (auto& worker : impl->workers) {
+		waitThread(worker->handle);
+	}
+	impl.reset();
+}
+
+int64_t ComputeThreadPool::getTasksSubmitted() const {
+	return impl ? impl->tasksSubmitted.load() : 0;
+}
+
+int64_t ComputeThreadPool::getTasksStolen() const {
+	return impl ? impl->tasksStolen.load() : 0;
+}
+
+TEST_CASE("/flow/ComputeThreadPool/Basic") {
+	noUnseed = true;
+
+	state std::unique_ptr<ComputeThreadPool> pool(new ComputeThreadPool(3));
+	state std::vector<Future<int>> results;
+	state int i = 0;
+	for (; i < 100; ++i) {
+		int x = i;
+		results.push_back(pool->submit(i % 2 ? TaskPriority::DefaultOnMainThread : TaskPriority::Low, [x]() {
+			int sum = 0;
+			for (int j = 0; j <= x; j++) {
+				sum += j;
+			}
+			return sum;
+		}));
+	}
+	wait(waitForAll(results));
+	for (i = 0; i < 100; ++i) {
+		ASSERT(results[i].get() == i * (i + 1) / 2);
+	}
+	ASSERT(pool->getTasksSubmitted() == 100);
+
+	// Errors thrown by a task surface through its future
+	state Future<Void> failed = pool->submit(TaskPriority::DefaultOnMainThread, []() -> Void { throw io_error(); });
+	try {
+		wait(failed);
+		ASSERT(false);
+	} catch (Error& e) {
+		ASSERT(e.code() == error_code_io_error);
+	}
+
+	pool->stop();
+
+	// After stop(), submissions run inline
+	Future<int> inline_ = pool->submit(TaskPriority::DefaultOnMainThread, []() { return 42; });
+	ASSERT(inline_.isReady() && inline_.get() == 42);
+
+	return Void();
+}
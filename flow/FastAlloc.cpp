@@ -28,6 +28,7 @@
 #include "crc32/crc32c.h"
 #include "flow/flow.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <unordered_map>
@@ -41,6 +42,8 @@
 #ifdef __linux__
 #include <sys/mman.h>
 #include <linux/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #endif
 
 #ifdef __FreeBSD__
@@ -239,18 +242,115 @@ void recordDeallocation(void* ptr) {
 #endif
 }
 
+// Always-compiled sampling allocation profiler (FAST_ALLOC_SAMPLE_INTERVAL). Unlike
+// ALLOC_INSTRUMENTATION this can be turned on with a knob in production: every Nth
+// allocation per thread records a compact backtrace keyed by (size class, backtrace
+// hash), so during an incident the owners of a growing size class can be read from
+// the periodic FastAllocSampleSite trace events without restarting with a debug
+// build. The sampled slow path costs one raw backtrace plus a spinlocked hash table
+// bump; the unsampled path costs one thread-local decrement.
+namespace {
+
+ThreadSpinLock fastAllocSampleLock;
+thread_local int64_t fastAllocSampleCountdown = 0;
+
+// Leaked deliberately so allocations during static destruction stay safe to sample.
+std::unordered_map<uint64_t, FastAllocSampleSite>& fastAllocSampleTable() {
+	static auto* table = new std::unordered_map<uint64_t, FastAllocSampleSite>();
+	return *table;
+}
+
+} // namespace
+
+void recordFastAllocSample(int sizeClass) {
+	if (--fastAllocSampleCountdown > 0) {
+		return;
+	}
+	fastAllocSampleCountdown = FLOW_KNOBS->FAST_ALLOC_SAMPLE_INTERVAL;
+
+	void* buffer[32];
+	int nptrs = (int)platform::raw_backtrace(buffer, 32);
+	uint32_t hash = 0;
+	if (nptrs > 0) {
+		hash = crc32c_append(0xfdbeefdb, reinterpret_cast<uint8_t*>(buffer), nptrs * sizeof(void*));
+	}
+	uint64_t key = (uint64_t(uint32_t(sizeClass)) << 32) | hash;
+
+	ThreadSpinLockHolder holder(fastAllocSampleLock);
+	auto [it, inserted] = fastAllocSampleTable().try_emplace(key);
+	if (inserted) {
+		it->second.sizeClass = sizeClass;
+		it->second.count = 0;
+		it->second.backtrace.assign(buffer, buffer + nptrs);
+	}
+	++it->second.count;
+}
+
+std::vector<FastAllocSampleSite> getFastAllocSampleSites(int maxSites) {
+	std::vector<FastAllocSampleSite> sites;
+	{
+		ThreadSpinLockHolder holder(fastAllocSampleLock);
+		sites.reserve(fastAllocSampleTable().size());
+		for (const auto& [key, site] : fastAllocSampleTable()) {
+			sites.push_back(site);
+		}
+	}
+	std::sort(sites.begin(), sites.end(), [](FastAllocSampleSite const& a, FastAllocSampleSite const& b) {
+		return a.count > b.count;
+	});
+	if ((int)sites.size() > maxSites) {
+		sites.resize(maxSites);
+	}
+	return sites;
+}
+
+// Global magazine pools are sharded so that a thread normally refills its freelist from memory
+// that was first touched (and so physically placed) on its own NUMA node.  Fresh magazines come
+// from anonymous pages faulted in by the allocating thread, so as long as a magazine stays in the
+// pool of the node that allocated it, refills stay node-local.
+#ifdef __linux__
+constexpr int kFastAllocNumaPools = 8;
+#else
+constexpr int kFastAllocNumaPools = 1;
+#endif
+
+#ifdef __linux__
+// The pool index for the calling thread, from the NUMA node it was running on the first time it
+// touched the global pools.  Flow threads are long-lived and in production are pinned by taskset
+// or numactl, so caching the node once per thread is accurate; if a thread does migrate, a stale
+// index costs locality but not correctness.
+static int localPoolIndex() {
+	static thread_local int pool = []() {
+		unsigned cpu = 0, node = 0;
+		if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+			node = 0;
+		return int(node % kFastAllocNumaPools);
+	}();
+	return pool;
+}
+#else
+static int localPoolIndex() {
+	return 0;
+}
+#endif
+
 template <int Size>
 struct FastAllocator<Size>::GlobalData {
-	CRITICAL_SECTION mutex;
-	std::vector<void*> magazines; // These magazines are always exactly magazine_size ("full")
-	std::vector<std::pair<int, void*>>
-	    partial_magazines; // Magazines that are not "full" and their counts.  Only created by releaseThreadMagazines().
+	struct Pool {
+		CRITICAL_SECTION mutex;
+		std::vector<void*> magazines; // These magazines are always exactly magazine_size ("full")
+		std::vector<std::pair<int, void*>>
+		    partial_magazines; // Magazines that are not "full" and their counts.  Only created by
+		                       // releaseThreadMagazines().
+		long long partialMagazineUnallocatedMemory;
+		Pool() : partialMagazineUnallocatedMemory(0) { InitializeCriticalSection(&mutex); }
+	};
+	Pool pools[kFastAllocNumaPools]; // indexed by localPoolIndex()
 	std::atomic<long long> totalMemory;
-	long long partialMagazineUnallocatedMemory;
 	std::atomic<long long> activeThreads;
-	GlobalData() : totalMemory(0), partialMagazineUnallocatedMemory(0), activeThreads(0) {
-		InitializeCriticalSection(&mutex);
-	}
+	std::atomic<long long> localRefills; // magazine refills served from the caller's node-local pool
+	std::atomic<long long> remoteRefills; // magazine refills stolen from another node's pool
+	GlobalData() : totalMemory(0), activeThreads(0), localRefills(0), remoteRefills(0) {}
 };
 
 template <int Size>
@@ -261,10 +361,12 @@ long long FastAllocator<Size>::getTotalMemory() {
 // This does not include memory held by various threads that's available for allocation
 template <int Size>
 long long FastAllocator<Size>::getApproximateMemoryUnused() {
-	EnterCriticalSection(&globalData()->mutex);
-	long long unused =
-	    globalData()->magazines.size() * magazine_size * Size + globalData()->partialMagazineUnallocatedMemory;
-	LeaveCriticalSection(&globalData()->mutex);
+	long long unused = 0;
+	for (auto& pool : globalData()->pools) {
+		EnterCriticalSection(&pool.mutex);
+		unused += pool.magazines.size() * magazine_size * Size + pool.partialMagazineUnallocatedMemory;
+		LeaveCriticalSection(&pool.mutex);
+	}
 	return unused;
 }
 
@@ -273,6 +375,16 @@ long long FastAllocator<Size>::getActiveThreads() {
 	return globalData()->activeThreads.load();
 }
 
+template <int Size>
+long long FastAllocator<Size>::getLocalMagazineRefills() {
+	return globalData()->localRefills.load();
+}
+
+template <int Size>
+long long FastAllocator<Size>::getRemoteMagazineRefills() {
+	return globalData()->remoteRefills.load();
+}
+
 #if FAST_ALLOCATOR_DEBUG
 static int64_t getSizeCode(int i) {
 	switch (i) {
@@ -354,6 +466,9 @@ void* FastAllocator<Size>::allocate() {
 #if defined(ALLOC_INSTRUMENTATION) || defined(ALLOC_INSTRUMENTATION_STDOUT)
 	recordAllocation(p, Size);
 #endif
+	if (FLOW_KNOBS && FLOW_KNOBS->FAST_ALLOC_SAMPLE_INTERVAL > 0) {
+		recordFastAllocSample(Size);
+	}
 	return p;
 }
 
@@ -464,25 +579,33 @@ void FastAllocator<Size>::getMagazine() {
 	ThreadData& thr = threadData();
 	ASSERT(!thr.freelist && !thr.alternate && thr.count == 0);
 
-	EnterCriticalSection(&globalData()->mutex);
-	if (globalData()->magazines.size()) {
-		void* m = globalData()->magazines.back();
-		globalData()->magazines.pop_back();
-		LeaveCriticalSection(&globalData()->mutex);
-		thr.freelist = m;
-		thr.count = magazine_size;
-		return;
-	} else if (globalData()->partial_magazines.size()) {
-		std::pair<int, void*> p = globalData()->partial_magazines.back();
-		globalData()->partial_magazines.pop_back();
-		globalData()->partialMagazineUnallocatedMemory -= p.first * Size;
-		LeaveCriticalSection(&globalData()->mutex);
-		thr.freelist = p.second;
-		thr.count = p.first;
-		return;
+	// Prefer the pool for this thread's NUMA node, but steal from the other pools before growing
+	// total memory with a fresh magazine.
+	int local = localPoolIndex();
+	for (int attempt = 0; attempt < kFastAllocNumaPools; ++attempt) {
+		auto& pool = globalData()->pools[(local + attempt) % kFastAllocNumaPools];
+		EnterCriticalSection(&pool.mutex);
+		if (pool.magazines.size()) {
+			void* m = pool.magazines.back();
+			pool.magazines.pop_back();
+			LeaveCriticalSection(&pool.mutex);
+			(attempt == 0 ? globalData()->localRefills : globalData()->remoteRefills).fetch_add(1);
+			thr.freelist = m;
+			thr.count = magazine_size;
+			return;
+		} else if (pool.partial_magazines.size()) {
+			std::pair<int, void*> p = pool.partial_magazines.back();
+			pool.partial_magazines.pop_back();
+			pool.partialMagazineUnallocatedMemory -= p.first * Size;
+			LeaveCriticalSection(&pool.mutex);
+			(attempt == 0 ? globalData()->localRefills : globalData()->remoteRefills).fetch_add(1);
+			thr.freelist = p.second;
+			thr.count = p.first;
+			return;
+		}
+		LeaveCriticalSection(&pool.mutex);
 	}
 	globalData()->totalMemory.fetch_add(magazine_size * Size);
-	LeaveCriticalSection(&globalData()->mutex);
 
 // Allocate a new page of data from the system allocator
 #ifdef ALLOC_INSTRUMENTATION
@@ -540,23 +663,27 @@ void FastAllocator<Size>::getMagazine() {
 }
 template <int Size>
 void FastAllocator<Size>::releaseMagazine(void* mag) {
-	EnterCriticalSection(&globalData()->mutex);
-	globalData()->magazines.push_back(mag);
-	LeaveCriticalSection(&globalData()->mutex);
+	// A magazine a thread returns is usually one it filled (or faulted in) itself, so keep it in
+	// the thread's node-local pool.
+	auto& pool = globalData()->pools[localPoolIndex()];
+	EnterCriticalSection(&pool.mutex);
+	pool.magazines.push_back(mag);
+	LeaveCriticalSection(&pool.mutex);
 }
 template <int Size>
 FastAllocator<Size>::ThreadData::~ThreadData() {
-	EnterCriticalSection(&globalData()->mutex);
+	auto& pool = globalData()->pools[localPoolIndex()];
+	EnterCriticalSection(&pool.mutex);
 	if (freelist) {
 		ASSERT_ABORT(count > 0 && count <= magazine_size);
-		globalData()->partial_magazines.emplace_back(count, freelist);
-		globalData()->partialMagazineUnallocatedMemory += count * Size;
+		pool.partial_magazines.emplace_back(count, freelist);
+		pool.partialMagazineUnallocatedMemory += count * Size;
 	}
 	if (alternate) {
-		globalData()->magazines.push_back(alternate);
+		pool.magazines.push_back(alternate);
 	}
+	LeaveCriticalSection(&pool.mutex);
 	globalData()->activeThreads.fetch_add(-1);
-	LeaveCriticalSection(&globalData()->mutex);
 
 	count = 0;
 	alternate = nullptr;
@@ -20,10 +20,12 @@
 
 #include "flow/IAsyncFile.h"
 #include "flow/Error.h"
+#include "flow/Histogram.h"
 #include "flow/Knobs.h"
 #include "flow/Platform.h"
 #include "flow/UnitTest.h"
 #include <iostream>
+#include <map>
 #include "flow/actorcompiler.h" // has to be last include
 
 IAsyncFile::~IAsyncFile() = default;
@@ -116,6 +118,200 @@ Future<Void> IAsyncFileSystem::incrementalDeleteFile(const std::string& filename
 	                                             FLOW_KNOBS->INCREMENTAL_DELETE_INTERVAL));
 }
 
+namespace {
+
+// Shared by all instrumented files of the same class.  Latency and size distributions go to the
+// Histogram registry, which the histogramReport loop logs; the plain counters and the queue depth
+// high-water mark are snapshotted by getAsyncFileInstrumentationStats() for SystemMonitor.
+struct AsyncFileIOStats : ReferenceCounted<AsyncFileIOStats> {
+	std::string fileClass;
+	Reference<Histogram> readLatency, writeLatency, syncLatency, truncateLatency;
+	Reference<Histogram> readBytes, writeBytes;
+	int64_t reads = 0, writes = 0, syncs = 0, truncates = 0;
+	int64_t bytesRead = 0, bytesWritten = 0;
+	int inFlight = 0, inFlightHighWater = 0;
+
+	explicit AsyncFileIOStats(std::string const& fileClass)
+	  : fileClass(fileClass),
+	    readLatency(Histogram::getHistogram(
+	        "AsyncFile" + fileClass, "ReadLatency"_sr, Histogram::Unit::milliseconds)),
+	    writeLatency(Histogram::getHistogram(
+	        "AsyncFile" + fileClass, "WriteLatency"_sr, Histogram::Unit::milliseconds)),
+	    syncLatency(Histogram::getHistogram(
+	        "AsyncFile" + fileClass, "SyncLatency"_sr, Histogram::Unit::milliseconds)),
+	    truncateLatency(Histogram::getHistogram(
+	        "AsyncFile" + fileClass, "TruncateLatency"_sr, Histogram::Unit::milliseconds)),
+	    readBytes(Histogram::getHistogram("AsyncFile" + fileClass, "ReadBytes"_sr, Histogram::Unit::bytes)),
+	    writeBytes(Histogram::getHistogram("AsyncFile" + fileClass, "WriteBytes"_sr, Histogram::Unit::bytes)) {}
+
+	void opBegin() {
+		if (++inFlight > inFlightHighWater)
+			inFlightHighWater = inFlight;
+	}
+	void opEnd() { --inFlight; }
+};
+
+std::map<std::string, Reference<AsyncFileIOStats>>& fileStatsByClass() {
+	static std::map<std::string, Reference<AsyncFileIOStats>> instances;
+	return instances;
+}
+
+// Statistics are aggregated by what the file stores, inferred from the name the caller opened it
+// with, so that a degrading device shows up as a shift in a handful of series rather than one
+// series per file.
+std::string fileClassOf(std::string const& filename) {
+	std::string baseStr = basename(filename);
+	StringRef base(baseStr);
+	if (base.startsWith("storage-"_sr))
+		return "Storage";
+	if (base.startsWith("logqueue-"_sr))
+		return "TLogQueue";
+	if (base.startsWith("log-"_sr))
+		return "TLog";
+	if (base.startsWith("coordination-"_sr))
+		return "Coordination";
+	return "Other";
+}
+
+} // namespace
+
+ACTOR static Future<int> instrumentedRead(Reference<IAsyncFile> file,
+                                          Reference<AsyncFileIOStats> stats,
+                                          void* data,
+                                          int length,
+                                          int64_t offset) {
+	state double begin = timer_monotonic();
+	stats->opBegin();
+	try {
+		int n = wait(file->read(data, length, offset));
+		stats->opEnd();
+		stats->readLatency->sampleSeconds(timer_monotonic() - begin);
+		stats->readBytes->sample(n);
+		++stats->reads;
+		stats->bytesRead += n;
+		return n;
+	} catch (Error& e) {
+		stats->opEnd();
+		throw;
+	}
+}
+
+ACTOR static Future<Void> instrumentedWrite(Reference<IAsyncFile> file,
+                                            Reference<AsyncFileIOStats> stats,
+                                            void const* data,
+                                            int length,
+                                            int64_t offset) {
+	state double begin = timer_monotonic();
+	stats->opBegin();
+	try {
+		wait(file->write(data, length, offset));
+		stats->opEnd();
+		stats->writeLatency->sampleSeconds(timer_monotonic() - begin);
+		stats->writeBytes->sample(length);
+		++stats->writes;
+		stats->bytesWritten += length;
+		return Void();
+	} catch (Error& e) {
+		stats->opEnd();
+		throw;
+	}
+}
+
+ACTOR static Future<Void> instrumentedSync(Reference<IAsyncFile> file, Reference<AsyncFileIOStats> stats) {
+	state double begin = timer_monotonic();
+	stats->opBegin();
+	try {
+		wait(file->sync());
+		stats->opEnd();
+		stats->syncLatency->sampleSeconds(timer_monotonic() - begin);
+		++stats->syncs;
+		return Void();
+	} catch (Error& e) {
+		stats->opEnd();
+		throw;
+	}
+}
+
+ACTOR static Future<Void> instrumentedTruncate(Reference<IAsyncFile> file,
+                                               Reference<AsyncFileIOStats> stats,
+                                               int64_t size) {
+	state double begin = timer_monotonic();
+	stats->opBegin();
+	try {
+		wait(file->truncate(size));
+		stats->opEnd();
+		stats->truncateLatency->sampleSeconds(timer_monotonic() - begin);
+		++stats->truncates;
+		return Void();
+	} catch (Error& e) {
+		stats->opEnd();
+		throw;
+	}
+}
+
+namespace {
+
+// Safe to destroy with pending operations (see the comment at the top of IAsyncFile.h): the actors
+// above hold their own reference to the wrapped file, and the stats object is shared with the
+// per-class registry.
+class AsyncFileInstrumented final : public IAsyncFile, public ReferenceCounted<AsyncFileInstrumented> {
+public:
+	AsyncFileInstrumented(Reference<IAsyncFile> file, Reference<AsyncFileIOStats> stats)
+	  : file(file), stats(stats) {}
+
+	void addref() override { ReferenceCounted<AsyncFileInstrumented>::addref(); }
+	void delref() override { ReferenceCounted<AsyncFileInstrumented>::delref(); }
+
+	Future<int> read(void* data, int length, int64_t offset) override {
+		return instrumentedRead(file, stats, data, length, offset);
+	}
+	Future<Void> write(void const* data, int length, int64_t offset) override {
+		return instrumentedWrite(file, stats, data, length, offset);
+	}
+	Future<Void> truncate(int64_t size) override { return instrumentedTruncate(file, stats, size); }
+	Future<Void> sync() override { return instrumentedSync(file, stats); }
+	Future<Void> flush() override { return file->flush(); }
+	Future<int64_t> size() const override { return file->size(); }
+	Future<Void> readZeroCopy(void** data, int* length, int64_t offset) override {
+		return file->readZeroCopy(data, length, offset);
+	}
+	void releaseZeroCopy(void* data, int length, int64_t offset) override {
+		file->releaseZeroCopy(data, length, offset);
+	}
+	int64_t debugFD() const override { return file->debugFD(); }
+	std::string getFilename() const override { return file->getFilename(); }
+
+private:
+	Reference<IAsyncFile> file;
+	Reference<AsyncFileIOStats> stats;
+};
+
+} // namespace
+
+Reference<IAsyncFile> wrapInstrumentedFile(Reference<IAsyncFile> file) {
+	auto& stats = fileStatsByClass()[fileClassOf(file->getFilename())];
+	if (!stats)
+		stats = makeReference<AsyncFileIOStats>(fileClassOf(file->getFilename()));
+	return makeReference<AsyncFileInstrumented>(file, stats);
+}
+
+std::vector<AsyncFileInstrumentationStats> getAsyncFileInstrumentationStats() {
+	std::vector<AsyncFileInstrumentationStats> result;
+	for (auto& [fileClass, stats] : fileStatsByClass()) {
+		result.push_back(AsyncFileInstrumentationStats{ fileClass,
+		                                                stats->reads,
+		                                                stats->writes,
+		                                                stats->syncs,
+		                                                stats->truncates,
+		                                                stats->bytesRead,
+		                                                stats->bytesWritten,
+		                                                stats->inFlight,
+		                                                stats->inFlightHighWater });
+		stats->inFlightHighWater = stats->inFlight;
+	}
+	return result;
+}
+
 TEST_CASE("/fileio/incrementalDelete") {
 	// about 5GB
 	state int64_t fileSize = 5e9;
@@ -70,14 +70,20 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( SATURATION_PROFILING_LOG_INTERVAL,                   0.5 ); // A value of 0 means use RUN_LOOP_PROFILING_INTERVAL
 	init( SATURATION_PROFILING_MAX_LOG_INTERVAL,               5.0 );
 	init( SATURATION_PROFILING_LOG_BACKOFF,                    2.0 );
+	init( RUN_LOOP_TRACE_INTERVAL,                               0 ); if( randomize && BUGGIFY ) RUN_LOOP_TRACE_INTERVAL = 5.0; // A value of 0 disables the run loop stall tracer
+	init( RUN_LOOP_TRACE_TOP_TASKS,                              5 );
 
 	init( FAST_ALLOC_LOGGING_BYTES,                           10e6 );
+	init( FAST_ALLOC_SAMPLE_INTERVAL,                            0 ); if( randomize && BUGGIFY ) FAST_ALLOC_SAMPLE_INTERVAL = 1000; // A value of 0 disables the sampling allocation profiler
 	init( FAST_ALLOC_ALLOW_GUARD_PAGES,                      false );
 	init( HUGE_ARENA_LOGGING_BYTES,                          100e6 );
 	init( HUGE_ARENA_LOGGING_INTERVAL,                         5.0 );
+	init( HUGE_ARENA_SLAB_RECYCLING,                          true ); if( randomize && BUGGIFY ) HUGE_ARENA_SLAB_RECYCLING = false;
 
 	init( MEMORY_USAGE_CHECK_INTERVAL,                         1.0 );
 
+	init( COMPUTE_POOL_THREADS,                                  0 );
+
 	// Chaos testing - enabled for simulation by default
 	init( ENABLE_CHAOS_FEATURES,                       isSimulated );
 	init( CHAOS_LOGGING_INTERVAL,                              5.0 );
@@ -102,6 +108,7 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( CONNECTION_MONITOR_TIMEOUT,     isSimulated ? 1.50 : 2.0 ); if( randomize && BUGGIFY ) CONNECTION_MONITOR_TIMEOUT = 6.0;
 	init( CONNECTION_MONITOR_IDLE_TIMEOUT,                   180.0 ); if( randomize && BUGGIFY ) CONNECTION_MONITOR_IDLE_TIMEOUT = 5.0;
 	init( CONNECTION_MONITOR_INCOMING_IDLE_MULTIPLIER,         1.2 );
+	init( CONNECTION_MONITOR_BUSY_PING_INTERVAL, isSimulated ? 0.0 : 10.0 ); if( randomize && BUGGIFY ) CONNECTION_MONITOR_BUSY_PING_INTERVAL = 10.0;
 	init( CONNECTION_MONITOR_UNREFERENCED_CLOSE_DELAY,         2.0 );
 
 	//FlowTransport
@@ -131,12 +138,17 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( TLS_HANDSHAKE_THREAD_STACKSIZE,                64 * 1024 );
 	init( TLS_MALLOC_ARENA_MAX,                                  6 );
 	init( TLS_HANDSHAKE_LIMIT,                                1000 );
+	init( TLS_SESSION_CACHE_SIZE,                             1000 );
 
 	init( NETWORK_TEST_CLIENT_COUNT,                            30 );
 	init( NETWORK_TEST_REPLY_SIZE,                           600e3 );
 	init( NETWORK_TEST_REQUEST_COUNT,                            0 ); // 0 -> run forever
 	init( NETWORK_TEST_REQUEST_SIZE,                             1 );
 	init( NETWORK_TEST_SCRIPT_MODE,                          false );
+	init( NETWORK_TEST_SWEEP_CLIENT_COUNTS,                     "" ); // Comma-separated list; non-empty enables the matrix benchmark
+	init( NETWORK_TEST_SWEEP_REQUEST_SIZES,                     "" );
+	init( NETWORK_TEST_SWEEP_REPLY_SIZES,                       "" );
+	init( NETWORK_TEST_CELL_SECONDS,                           5.0 );
 
 	//Authorization
 	init( ALLOW_TOKENLESS_TENANT_ACCESS,                     false );
@@ -155,6 +167,9 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( BUGGIFY_SIM_PAGE_CACHE_64K,                          1e6 );
 	init( MAX_EVICT_ATTEMPTS,                                  100 ); if( randomize && BUGGIFY ) MAX_EVICT_ATTEMPTS = 2;
 	init( CACHE_EVICTION_POLICY,                          "random" );
+	init( CACHE_PROTECTED_FRACTION,                            0.75 );
+	init( CACHE_READAHEAD_BYTES,                                  0 ); if( randomize && BUGGIFY ) CACHE_READAHEAD_BYTES = 4096 * deterministicRandom()->randomInt(0, 65);
+	init( CACHE_READAHEAD_MIN_SEQUENTIAL_READS,                   2 );
 	init( PAGE_CACHE_TRUNCATE_LOOKUP_FRACTION,                 0.1 ); if( randomize && BUGGIFY ) PAGE_CACHE_TRUNCATE_LOOKUP_FRACTION = 0.0; else if( randomize && BUGGIFY ) PAGE_CACHE_TRUNCATE_LOOKUP_FRACTION = 1.0;
 	init( FLOW_CACHEDFILE_WRITE_IO_SIZE,                         0 );
 	if ( randomize && BUGGIFY) {
@@ -169,6 +184,7 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	//AsyncFileEncrypted
 	init( ENCRYPTION_BLOCK_SIZE,                              4096 );
 	init( MAX_DECRYPTED_BLOCKS,                                 10 );
+	init( ENCRYPTION_READAHEAD_BLOCKS,                           8 ); if( randomize && BUGGIFY ) ENCRYPTION_READAHEAD_BLOCKS = deterministicRandom()->randomInt(0, 3);
 
 	//AsyncFileKAIO
 	init( MAX_OUTSTANDING,                                      64 );
@@ -178,7 +194,15 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( KAIO_LATENCY_SKETCH_ACCURACY,                       0.01 );
 
 	init( PAGE_WRITE_CHECKSUM_HISTORY,                           0 ); if( randomize && BUGGIFY ) PAGE_WRITE_CHECKSUM_HISTORY = 10000000;
+	init( INSTRUMENT_ASYNC_FILE_IO,                          false ); if( randomize && BUGGIFY ) INSTRUMENT_ASYNC_FILE_IO = true;
 	init( DISABLE_POSIX_KERNEL_AIO,                              0 );
+	init( ENABLE_IO_URING,                                       0 );
+
+	//AsyncFileIOUring
+	init( IO_URING_REGISTER_FILES,                            true );
+	init( IO_URING_MAX_REGISTERED_FILES,                       256 );
+	init( IO_URING_LATENCY_LOGGING_INTERVAL,                  30.0 );
+	init( IO_URING_LATENCY_SKETCH_ACCURACY,                   0.01 );
 
 	//AsyncFileNonDurable
 	init( NON_DURABLE_MAX_WRITE_DELAY,                         2.0 ); if( randomize && BUGGIFY ) NON_DURABLE_MAX_WRITE_DELAY = 5.0;
@@ -220,6 +244,7 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( MIN_PACKET_BUFFER_FREE_BYTES,                        256 );
 	init( FLOW_TCP_NODELAY,                                      1 );
 	init( FLOW_TCP_QUICKACK,                                     0 );
+	init( ZEROCOPY_SEND_MIN_BYTES,                               0 );  // 0 disables MSG_ZEROCOPY; kernel docs suggest it only pays off above ~10KB per send
 
 	//Sim2
 	init( MIN_OPEN_TIME,                                    0.0002 );
@@ -240,6 +265,8 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( TRACE_RETRY_OPEN_INTERVAL,						  1.00 );
 	init( MIN_TRACE_SEVERITY,                isSimulated ?  1 : 10, Atomic::NO ); // Related to the trace severity in Trace.h
 	init( MAX_TRACE_SUPPRESSIONS,                              1e4 );
+	init( TRACE_SUPPRESSION_BURST,                               1 ); if( randomize && BUGGIFY ) TRACE_SUPPRESSION_BURST = deterministicRandom()->randomInt(1, 5);
+	init( TRACE_SUPPRESSION_ROLLUP_INTERVAL,                  60.0 ); if( randomize && BUGGIFY ) TRACE_SUPPRESSION_ROLLUP_INTERVAL = 5.0;
 	init( TRACE_DATETIME_ENABLED,                             true ); // trace time in human readable format (always real time)
 	init( TRACE_SYNC_ENABLED,                                    0 );
 	init( TRACE_EVENT_METRIC_UNITS_PER_SAMPLE,                 500 );
@@ -285,6 +312,7 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( FUTURE_VERSION_BACKOFF_GROWTH,                       2.0 );
 	init( LOAD_BALANCE_MAX_BAD_OPTIONS,                          1 ); //should be the same as MAX_MACHINES_FALLING_BEHIND
 	init( LOAD_BALANCE_PENALTY_IS_BAD,                        true );
+	init( LOAD_BALANCE_P2C_SELECTION,                         true ); if( randomize && BUGGIFY ) LOAD_BALANCE_P2C_SELECTION = false; // Pick the less loaded of two random healthy replicas instead of always the least loaded one
 	init( BASIC_LOAD_BALANCE_UPDATE_RATE,                     10.0 ); //should be longer than the rate we log network metrics
 	init( BASIC_LOAD_BALANCE_MAX_CHANGE,                      0.10 );
 	init( BASIC_LOAD_BALANCE_MAX_PROB,                         2.0 );
@@ -25,7 +25,14 @@
 #include "flow/Platform.h"
 #include "flow/Trace.h"
 #include <algorithm>
+#include <deque>
 #include <memory>
+
+#ifdef __linux__
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
 #ifndef BOOST_SYSTEM_NO_LIB
 #define BOOST_SYSTEM_NO_LIB
 #endif
@@ -260,6 +267,25 @@ public:
 
 	NetworkMetrics::PriorityStats* lastPriorityStats;
 
+	// Optional run loop stall tracer (RUN_LOOP_TRACE_INTERVAL). Accumulates task run
+	// time bucketed by priority and a log2 histogram of ready-queue depth, plus the
+	// slowest tasks seen, and emits one summary trace event per interval so network
+	// thread saturation can be attributed without correlating individual SlowTask
+	// events.
+	struct RunLoopTraceInterval {
+		static constexpr int DEPTH_BINS = 16;
+		std::map<TaskPriority, double> timeByPriority;
+		int64_t queueDepthBins[DEPTH_BINS] = {};
+		int64_t iterations = 0;
+		struct SlowestTask {
+			double duration;
+			TaskPriority priority;
+			int queueDepth;
+		};
+		std::vector<SlowestTask> slowestTasks;
+		double windowStart = 0;
+	} runLoopTrace;
+
 	struct PromiseTask final : public FastAllocated<PromiseTask> {
 		Promise<Void> promise;
 		PromiseTask() {}
@@ -274,6 +300,9 @@ public:
 	TaskQueue<PromiseTask> taskQueue;
 
 	void checkForSlowTask(int64_t tscBegin, int64_t tscEnd, double duration, TaskPriority priority);
+	void recordRunLoopIterationForTrace(int queueSize);
+	void recordTaskForTrace(TaskPriority priority, double duration, int queueDepth);
+	void emitRunLoopTrace(double now);
 	bool check_yield(TaskPriority taskId, int64_t tscNow);
 	void trackAtPriority(TaskPriority priority, double now);
 	void stopImmediately() {
@@ -469,6 +498,17 @@ public:
 	// Writes as many bytes as possible from the given SendBuffer chain into the write buffer and returns the number of
 	// bytes written (might be 0)
 	int write(SendBuffer const* data, int limit) override {
+#ifdef SO_ZEROCOPY
+		if (zerocopyEnabled) {
+			int available = 0;
+			for (auto p = data; p != nullptr && available < FLOW_KNOBS->ZEROCOPY_SEND_MIN_BYTES; p = p->next) {
+				available += p->bytes_written - p->bytes_sent;
+			}
+			if (available >= FLOW_KNOBS->ZEROCOPY_SEND_MIN_BYTES) {
+				return writeZeroCopy(data, limit);
+			}
+		}
+#endif
 		boost::system::error_code err;
 		++g_net2->countWrites;
 
@@ -508,10 +548,163 @@ public:
 
 	tcp::socket& getSocket() override { return socket; }
 
+#ifdef SO_ZEROCOPY
+	~Connection() {
+		// Cancel the completion watcher before dropping the buffers it is tracking
+		zerocopyCompletionWatcher.cancel();
+		releaseZeroCopySends(zerocopySendCounter);
+	}
+#endif
+
 private:
 	UID id;
 	tcp::socket socket;
 	NetworkAddress peer_address;
+#ifdef SO_ZEROCOPY
+	// Zerocopy send state. The kernel numbers MSG_ZEROCOPY sends on a socket consecutively from
+	// zero; zerocopyInflight holds, in sequence order, references to the PacketBuffers of sends
+	// whose completion notification has not yet arrived on the socket error queue.
+	bool zerocopyEnabled = false;
+	uint32_t zerocopySendCounter = 0;
+	std::deque<std::pair<uint32_t, std::vector<PacketBuffer*>>> zerocopyInflight;
+	Future<Void> zerocopyCompletionWatcher;
+
+	// Sends the chain with MSG_ZEROCOPY. The kernel transmits directly from the buffers' pages,
+	// so references to every buffer overlapping the sent bytes are held until the completion
+	// notification for this send arrives. This is safe because senders only ever append to a
+	// PacketBuffer past bytes_written and never modify bytes that have already been written.
+	int writeZeroCopy(SendBuffer const* data, int limit) {
+		++g_net2->countWrites;
+
+		constexpr int maxIov = 64;
+		struct iovec iov[maxIov];
+		int iovcnt = 0;
+		int queued = 0;
+		for (auto p = data; p != nullptr && limit > 0 && iovcnt < maxIov; p = p->next) {
+			int len = std::min(limit, p->bytes_written - p->bytes_sent);
+			if (len <= 0) {
+				continue;
+			}
+			iov[iovcnt].iov_base = const_cast<uint8_t*>(p->data() + p->bytes_sent);
+			iov[iovcnt].iov_len = len;
+			++iovcnt;
+			limit -= len;
+			queued += len;
+		}
+		ASSERT(queued > 0);
+
+		struct msghdr msg;
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = iov;
+		msg.msg_iovlen = iovcnt;
+		ssize_t sent = ::sendmsg(socket.native_handle(), &msg, MSG_ZEROCOPY | MSG_DONTWAIT | MSG_NOSIGNAL);
+		if (sent < 0) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				++g_net2->countWouldBlock;
+				return 0;
+			}
+			if (errno == ENOBUFS) {
+				// Hit the optmem_max budget for pinned pages. Stop using zerocopy on this
+				// connection; the caller retries through the copying path.
+				TraceEvent(SevWarnAlways, "N2_ZeroCopyDisabled", id)
+				    .suppressFor(1.0)
+				    .detail("PeerAddr", peer_address);
+				zerocopyEnabled = false;
+				return 0;
+			}
+			onWriteError(boost::system::error_code(errno, boost::system::system_category()));
+			throw connection_failed();
+		}
+		ASSERT(sent > 0);
+
+		// The chains passed to IConnection::write are always PacketBuffer chains, so holding a
+		// reference to each buffer covering the sent bytes keeps their pages alive for the kernel.
+		std::vector<PacketBuffer*> held;
+		int remaining = sent;
+		for (auto p = data; p != nullptr && remaining > 0; p = p->next) {
+			int len = std::min(remaining, p->bytes_written - p->bytes_sent);
+			if (len <= 0) {
+				continue;
+			}
+			PacketBuffer* buffer = const_cast<PacketBuffer*>(static_cast<PacketBuffer const*>(p));
+			buffer->addref();
+			held.push_back(buffer);
+			remaining -= len;
+		}
+		zerocopyInflight.emplace_back(zerocopySendCounter++, std::move(held));
+		if (!zerocopyCompletionWatcher.isValid() || zerocopyCompletionWatcher.isReady()) {
+			zerocopyCompletionWatcher = watchZeroCopyCompletions(this);
+		}
+		return sent;
+	}
+
+	// Waits for POLLERR on the socket, which signals a non-empty error queue, then drains the
+	// MSG_ZEROCOPY completion notifications and releases the buffers of completed sends. Runs
+	// while any send is outstanding; writeZeroCopy() restarts it as needed.
+	ACTOR static Future<Void> watchZeroCopyCompletions(Connection* self) {
+		try {
+			while (!self->zerocopyInflight.empty()) {
+				BindPromise p("N2_ZeroCopyWatchError", self->id);
+				Future<Void> onError = p.getFuture();
+				self->socket.async_wait(boost::asio::ip::tcp::socket::wait_error, std::move(p));
+				wait(onError);
+				if (!self->drainZeroCopyCompletions()) {
+					// POLLERR without zerocopy completions is either a stale wakeup or a real
+					// socket error that the read and write paths will surface; back off briefly
+					// rather than spinning on a persistent error condition.
+					wait(delay(0.001));
+				}
+			}
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			// The socket was closed or errored, so no more completions will arrive and the
+			// kernel has dropped its page references; release ours as well.
+			self->releaseZeroCopySends(self->zerocopySendCounter);
+		}
+		return Void();
+	}
+
+	bool drainZeroCopyCompletions() {
+		bool progress = false;
+		while (true) {
+			struct msghdr msg;
+			char control[128];
+			memset(&msg, 0, sizeof(msg));
+			msg.msg_control = control;
+			msg.msg_controllen = sizeof(control);
+			if (::recvmsg(socket.native_handle(), &msg, MSG_ERRQUEUE) < 0) {
+				break;
+			}
+			for (struct cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != nullptr; cm = CMSG_NXTHDR(&msg, cm)) {
+				if ((cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR) ||
+				    (cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR)) {
+					auto* serr = reinterpret_cast<struct sock_extended_err*>(CMSG_DATA(cm));
+					if (serr->ee_errno == 0 && serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY) {
+						// ee_info..ee_data is an inclusive range of completed send numbers;
+						// SO_EE_CODE_ZEROCOPY_COPIED only means the kernel fell back to copying,
+						// the buffers are released either way.
+						releaseZeroCopySends(serr->ee_data);
+						progress = true;
+					}
+				}
+			}
+		}
+		return progress;
+	}
+
+	// Completions arrive oldest-first, so everything up to sequence number hi (modular
+	// comparison) is complete.
+	void releaseZeroCopySends(uint32_t hi) {
+		while (!zerocopyInflight.empty() && int32_t(hi - zerocopyInflight.front().first) >= 0) {
+			for (PacketBuffer* buffer : zerocopyInflight.front().second) {
+				buffer->delref();
+			}
+			zerocopyInflight.pop_front();
+		}
+	}
+#endif
 
 	void init() {
 		// Socket settings that have to be set after connect or accept succeeds
@@ -526,6 +719,16 @@ private:
 			TraceEvent(SevWarn, "N2_InitWarn").detail("Message", "TCP_QUICKACK not supported");
 #endif
 		}
+#ifdef SO_ZEROCOPY
+		if (FLOW_KNOBS->ZEROCOPY_SEND_MIN_BYTES > 0) {
+			int one = 1;
+			if (::setsockopt(socket.native_handle(), SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) == 0) {
+				zerocopyEnabled = true;
+			} else {
+				TraceEvent(SevWarn, "N2_InitWarn").detail("Message", "SO_ZEROCOPY not supported");
+			}
+		}
+#endif
 		platform::setCloseOnExec(socket.native_handle());
 	}
 
@@ -736,6 +939,64 @@ private:
 	}
 };
 
+// fdbmonitor can hold listening sockets open across process restarts and pass them to the child
+// via the FDB_HELD_LISTEN_FDS environment variable ("ip:port=fd[,ip:port=fd]..."). Returns the
+// inherited socket for the given listen address, or -1 if there is none.
+static int inheritedListenSocket(NetworkAddress const& listenAddress) {
+	const char* env = getenv("FDB_HELD_LISTEN_FDS");
+	if (env == nullptr || *env == '\0') {
+		return -1;
+	}
+	std::string entries(env);
+	size_t begin = 0;
+	while (begin < entries.size()) {
+		size_t end = entries.find(',', begin);
+		if (end == std::string::npos) {
+			end = entries.size();
+		}
+		std::string entry = entries.substr(begin, end - begin);
+		begin = end + 1;
+		size_t sep = entry.rfind('=');
+		if (sep == std::string::npos) {
+			continue;
+		}
+		try {
+			NetworkAddress addr = NetworkAddress::parse(entry.substr(0, sep));
+			if (addr.ip == listenAddress.ip && addr.port == listenAddress.port) {
+				return atoi(entry.c_str() + sep + 1);
+			}
+		} catch (Error&) {
+			// Ignore malformed entries; the listener will open a fresh socket below.
+		}
+	}
+	return -1;
+}
+
+// Binds and listens on listenAddress, adopting the listening socket inherited from fdbmonitor
+// when one is available. Adoption keeps the port continuously bound and accepting through a
+// process restart, so peers queue in the listen backlog instead of seeing connection resets and
+// backing off before reconnecting.
+static void openListenSocket(tcp::acceptor& acceptor, NetworkAddress const& listenAddress) {
+	auto endpoint = tcpEndpoint(listenAddress);
+	int fd = inheritedListenSocket(listenAddress);
+	if (fd >= 0) {
+		boost::system::error_code ec;
+		acceptor.assign(endpoint.protocol(), fd, ec);
+		if (!ec) {
+			TraceEvent("ListenerAdoptedHeldSocket").detail("ListenAddress", listenAddress).detail("Fd", fd);
+			return;
+		}
+		TraceEvent(SevWarnAlways, "ListenerAdoptHeldSocketFailed")
+		    .detail("ListenAddress", listenAddress)
+		    .detail("Fd", fd)
+		    .detail("Message", ec.message());
+	}
+	acceptor.open(endpoint.protocol());
+	acceptor.set_option(boost::asio::socket_base::reuse_address(true));
+	acceptor.bind(endpoint);
+	acceptor.listen(boost::asio::socket_base::max_listen_connections);
+}
+
 class Listener final : public IListener, ReferenceCounted<Listener> {
 	boost::asio::io_context& io_service;
 	NetworkAddress listenAddress;
@@ -743,7 +1004,8 @@ class Listener final : public IListener, ReferenceCounted<Listener> {
 
 public:
 	Listener(boost::asio::io_context& io_service, NetworkAddress listenAddress)
-	  : io_service(io_service), listenAddress(listenAddress), acceptor(io_service, tcpEndpoint(listenAddress)) {
+	  : io_service(io_service), listenAddress(listenAddress), acceptor(io_service) {
+		openListenSocket(acceptor, listenAddress);
 		// when port 0 is passed in, a random port will be opened
 		// set listenAddress as the address with the actual port opened instead of port 0
 		if (listenAddress.port == 0) {
@@ -843,7 +1105,7 @@ public:
 
 	explicit SSLConnection(Reference<ReferencedObject<boost::asio::ssl::context>> context, tcp::socket* existingSocket)
 	  : id(nondeterministicRandom()->randomUniqueID()), socket(std::move(*existingSocket)),
-	    ssl_sock(socket, context->mutate()), sslContext(context) {}
+	    ssl_sock(socket, context->mutate()), sslContext(context), has_trusted_peer(false) {}
 
 	// This is not part of the IConnection interface, because it is wrapped by INetwork::connect()
 	ACTOR static Future<Reference<IConnection>> connect(boost::asio::io_service* ios,
@@ -919,6 +1181,18 @@ public:
 			}
 			wait(onHandshook);
 			wait(delay(0, TaskPriority::Handshake));
+			if (FLOW_KNOBS->TLS_SESSION_CACHE_SIZE > 0) {
+				// An abbreviated handshake skips certificate exchange, so the verify
+				// callback never ran; trust carries over from the handshake that
+				// negotiated the resumed session
+				Optional<bool> resumedTrust = TLSResumedSessionTrust(self->ssl_sock);
+				if (resumedTrust.present()) {
+					self->has_trusted_peer = resumedTrust.get();
+				}
+				// Record the outcome for the sessions this handshake hands out, including
+				// those derived from a resumed session for reissued tickets
+				RecordTLSSessionTrust(self->ssl_sock, self->has_trusted_peer);
+			}
 			connected.send(Void());
 		} catch (...) {
 			self->closeSocket();
@@ -984,8 +1258,16 @@ public:
 			Future<Void> onHandshook;
 			ConfigureSSLStream(N2::g_net2->activeTlsPolicy, self->ssl_sock, [conn = self.getPtr()](bool verifyOk) {
 				conn->has_trusted_peer = verifyOk;
+				conn->tlsSessionState.verifiedTrusted = verifyOk;
 			});
 
+			if (FLOW_KNOBS->TLS_SESSION_CACHE_SIZE > 0) {
+				// Resume from any session previously negotiated with this peer, so
+				// reconnect storms mostly skip the full key exchange
+				self->tlsSessionState.peerKey = self->peer_address.toString();
+				PrepareTLSSessionResumption(self->ssl_sock, &self->tlsSessionState);
+			}
+
 			// If the background handshakers are not all busy, use one
 			if (N2::g_net2->sslPoolHandshakesInProgress < N2::g_net2->sslHandshakerThreadsStarted) {
 				holder = Hold(&N2::g_net2->sslPoolHandshakesInProgress);
@@ -1001,6 +1283,16 @@ public:
 			}
 			wait(onHandshook);
 			wait(delay(0, TaskPriority::Handshake));
+			if (FLOW_KNOBS->TLS_SESSION_CACHE_SIZE > 0) {
+				// An abbreviated handshake skips certificate exchange, so the verify
+				// callback never ran; trust carries over from the handshake that
+				// negotiated the resumed session
+				Optional<bool> resumedTrust = TLSResumedSessionTrust(self->ssl_sock);
+				if (resumedTrust.present()) {
+					self->has_trusted_peer = resumedTrust.get();
+					self->tlsSessionState.verifiedTrusted = resumedTrust.get();
+				}
+			}
 			connected.send(Void());
 		} catch (...) {
 			self->closeSocket();
@@ -1138,6 +1430,8 @@ private:
 	NetworkAddress peer_address;
 	Reference<ReferencedObject<boost::asio::ssl::context>> sslContext;
 	bool has_trusted_peer;
+	// Stable storage for the session resumption state; the SSL handle keeps a pointer to it
+	TLSSessionState tlsSessionState;
 
 	void init() {
 		// Socket settings that have to be set after connect or accept succeeds
@@ -1183,8 +1477,8 @@ public:
 	SSLListener(boost::asio::io_context& io_service,
 	            AsyncVar<Reference<ReferencedObject<boost::asio::ssl::context>>>* contextVar,
 	            NetworkAddress listenAddress)
-	  : io_service(io_service), listenAddress(listenAddress), acceptor(io_service, tcpEndpoint(listenAddress)),
-	    contextVar(contextVar) {
+	  : io_service(io_service), listenAddress(listenAddress), acceptor(io_service), contextVar(contextVar) {
+		openListenSocket(acceptor, listenAddress);
 		// when port 0 is passed in, a random port will be opened
 		// set listenAddress as the address with the actual port opened instead of port 0
 		if (listenAddress.port == 0) {
@@ -1510,6 +1804,9 @@ void Net2::run() {
 		[[maybe_unused]] int queueSize = taskQueue.getNumReadyTasks();
 
 		FDB_TRACE_PROBE(run_loop_tasks_start, queueSize);
+		if (FLOW_KNOBS->RUN_LOOP_TRACE_INTERVAL > 0) {
+			recordRunLoopIterationForTrace(queueSize);
+		}
 		while (taskQueue.hasReadyTask()) {
 			++countTasks;
 			currentTaskID = taskQueue.getReadyTaskID();
@@ -1542,6 +1839,9 @@ void Net2::run() {
 
 			double tscNow = timestampCounter();
 			double newTaskBegin = timer_monotonic();
+			if (FLOW_KNOBS->RUN_LOOP_TRACE_INTERVAL > 0) {
+				recordTaskForTrace(currentTaskID, newTaskBegin - taskBegin, taskQueue.getNumReadyTasks());
+			}
 			if (check_yield(TaskPriority::Max, tscNow)) {
 				checkForSlowTask(tscBegin, tscNow, newTaskBegin - taskBegin, currentTaskID);
 				taskBegin = newTaskBegin;
@@ -1605,6 +1905,14 @@ void Net2::run() {
 #endif
 		nnow = timer_monotonic();
 
+		if (FLOW_KNOBS->RUN_LOOP_TRACE_INTERVAL > 0) {
+			if (runLoopTrace.windowStart == 0) {
+				runLoopTrace.windowStart = nnow;
+			} else if (nnow - runLoopTrace.windowStart > FLOW_KNOBS->RUN_LOOP_TRACE_INTERVAL) {
+				emitRunLoopTrace(nnow);
+			}
+		}
+
 		if ((nnow - now) > FLOW_KNOBS->SLOW_LOOP_CUTOFF &&
 		    nondeterministicRandom()->random01() < (nnow - now) * FLOW_KNOBS->SLOW_LOOP_SAMPLING_RATE)
 			TraceEvent("SomewhatSlowRunLoopBottom")
@@ -1671,6 +1979,78 @@ void Net2::trackAtPriority(TaskPriority priority, double now) {
 	}
 }
 
+void Net2::recordRunLoopIterationForTrace(int queueSize) {
+	++runLoopTrace.iterations;
+	int bin = 0;
+	for (int depth = queueSize; depth > 0 && bin < RunLoopTraceInterval::DEPTH_BINS - 1; depth >>= 1) {
+		++bin;
+	}
+	++runLoopTrace.queueDepthBins[bin];
+}
+
+void Net2::recordTaskForTrace(TaskPriority priority, double duration, int queueDepth) {
+	runLoopTrace.timeByPriority[priority] += duration;
+
+	auto slower = [](RunLoopTraceInterval::SlowestTask const& a, RunLoopTraceInterval::SlowestTask const& b) {
+		return a.duration > b.duration;
+	};
+	auto& slowest = runLoopTrace.slowestTasks;
+	if ((int)slowest.size() < std::max(1, FLOW_KNOBS->RUN_LOOP_TRACE_TOP_TASKS)) {
+		slowest.push_back({ duration, priority, queueDepth });
+		std::push_heap(slowest.begin(), slowest.end(), slower);
+	} else if (duration > slowest.front().duration) {
+		std::pop_heap(slowest.begin(), slowest.end(), slower);
+		slowest.back() = { duration, priority, queueDepth };
+		std::push_heap(slowest.begin(), slowest.end(), slower);
+	}
+}
+
+void Net2::emitRunLoopTrace(double now) {
+	auto& interval = runLoopTrace;
+
+	std::string timeByPriority;
+	for (const auto& [priority, duration] : interval.timeByPriority) {
+		timeByPriority += format("%d:%.6f ", static_cast<int>(priority), duration);
+	}
+
+	// Approximate ready-queue depth percentiles from the log2 histogram; bin i covers
+	// depths [2^(i-1), 2^i), so the upper bound of the bin holding the target rank is
+	// reported.
+	auto depthPercentile = [&interval](double p) -> int {
+		int64_t target = (int64_t)(p * interval.iterations);
+		int64_t rank = 0;
+		for (int i = 0; i < RunLoopTraceInterval::DEPTH_BINS; ++i) {
+			rank += interval.queueDepthBins[i];
+			if (rank >= target) {
+				return i == 0 ? 0 : (1 << i) - 1;
+			}
+		}
+		return (1 << RunLoopTraceInterval::DEPTH_BINS) - 1;
+	};
+
+	std::sort(interval.slowestTasks.begin(),
+	          interval.slowestTasks.end(),
+	          [](RunLoopTraceInterval::SlowestTask const& a, RunLoopTraceInterval::SlowestTask const& b) {
+		          return a.duration > b.duration;
+	          });
+	std::string slowestTasks;
+	for (const auto& task : interval.slowestTasks) {
+		slowestTasks += format("%d:%.6f:%d ", static_cast<int>(task.priority), task.duration, task.queueDepth);
+	}
+
+	TraceEvent("RunLoopStallTracer")
+	    .detail("Elapsed", now - interval.windowStart)
+	    .detail("Iterations", interval.iterations)
+	    .detail("BusySecondsByPriority", timeByPriority)
+	    .detail("ReadyQueueDepthP50", depthPercentile(0.5))
+	    .detail("ReadyQueueDepthP90", depthPercentile(0.9))
+	    .detail("ReadyQueueDepthP99", depthPercentile(0.99))
+	    .detail("SlowestTasks", slowestTasks);
+
+	interval = RunLoopTraceInterval();
+	interval.windowStart = now;
+}
+
 void Net2::checkForSlowTask(int64_t tscBegin, int64_t tscEnd, double duration, TaskPriority priority) {
 	int64_t elapsed = tscEnd - tscBegin;
 	if (elapsed > FLOW_KNOBS->TSC_YIELD_TIME && tscBegin > 0) {
@@ -295,17 +295,64 @@ double getProcessorTimeProcess() {
 #endif
 }
 
+#if defined(__linux__)
+// Keeps a /proc file open across samples and rereads it into a caller-supplied reusable buffer
+// with pread(), so that periodic system monitoring costs one syscall per file per interval
+// instead of an open/parse/close cycle with fresh ifstream allocations every time.
+class ProcFileSampler {
+public:
+	explicit ProcFileSampler(const char* path) : path(path), fd(-1) {}
+	~ProcFileSampler() {
+		if (fd >= 0)
+			close(fd);
+	}
+
+	// Rereads the whole file from the beginning. Returns false if the file cannot be opened or
+	// read; the descriptor is dropped on read errors so the next sample retries the open.
+	bool read(std::string& contents) {
+		if (fd < 0) {
+			fd = open(path, O_RDONLY | O_CLOEXEC);
+			if (fd < 0)
+				return false;
+		}
+		size_t length = 0;
+		for (;;) {
+			if (contents.size() < length + 4096)
+				contents.resize(length + 4096);
+			ssize_t n = pread(fd, &contents[length], contents.size() - length, length);
+			if (n < 0) {
+				if (errno == EINTR)
+					continue;
+				close(fd);
+				fd = -1;
+				return false;
+			}
+			if (n == 0)
+				break;
+			length += n;
+		}
+		contents.resize(length);
+		return true;
+	}
+
+private:
+	const char* path;
+	int fd;
+};
+#endif
+
 uint64_t getResidentMemoryUsage() {
 #if defined(__linux__)
 	uint64_t rssize = 0;
 
-	std::ifstream stat_stream("/proc/self/statm", std::ifstream::in);
-	std::string ignore;
-
-	if (!stat_stream.good()) {
+	static thread_local ProcFileSampler statmSampler("/proc/self/statm");
+	static thread_local std::string statmBuffer;
+	if (!statmSampler.read(statmBuffer)) {
 		TraceEvent(SevError, "GetResidentMemoryUsage").GetLastError();
 		throw platform_error();
 	}
+	std::istringstream stat_stream(statmBuffer);
+	std::string ignore;
 
 	stat_stream >> ignore;
 	stat_stream >> rssize;
@@ -361,12 +408,13 @@ uint64_t getMemoryUsage() {
 #if defined(__linux__)
 	uint64_t vmsize = 0;
 
-	std::ifstream stat_stream("/proc/self/statm", std::ifstream::in);
-
-	if (!stat_stream.good()) {
+	static thread_local ProcFileSampler statmSampler("/proc/self/statm");
+	static thread_local std::string statmBuffer;
+	if (!statmSampler.read(statmBuffer)) {
 		TraceEvent(SevError, "GetMemoryUsage").GetLastError();
 		throw platform_error();
 	}
+	std::istringstream stat_stream(statmBuffer);
 
 	stat_stream >> vmsize;
 
@@ -456,18 +504,19 @@ int64_t getLowWatermark(std::stringstream& zoneInfoStream) {
 }
 
 void getMachineRAMInfoImpl(MachineRAMInfo& memInfo) {
-	std::ifstream zoneInfoFileStream("/proc/zoneinfo", std::ifstream::in);
+	static thread_local ProcFileSampler zoneInfoSampler("/proc/zoneinfo");
+	static thread_local std::string zoneInfoBuffer;
 	int64_t lowWatermark = 0;
-	if (!zoneInfoFileStream.good()) {
+	if (!zoneInfoSampler.read(zoneInfoBuffer)) {
 		TraceEvent(SevWarnAlways, "GetMachineZoneInfo").GetLastError();
 	} else {
-		std::stringstream zoneInfoStream;
-		zoneInfoStream << zoneInfoFileStream.rdbuf();
+		std::stringstream zoneInfoStream(zoneInfoBuffer);
 		lowWatermark = getLowWatermark(zoneInfoStream) * 4; // Convert from 4K pages to KB
 	}
 
-	std::ifstream fileStream("/proc/meminfo", std::ifstream::in);
-	if (!fileStream.good()) {
+	static thread_local ProcFileSampler memInfoSampler("/proc/meminfo");
+	static thread_local std::string memInfoBuffer;
+	if (!memInfoSampler.read(memInfoBuffer)) {
 		TraceEvent(SevError, "GetMachineMemInfo").GetLastError();
 		throw platform_error();
 	}
@@ -477,8 +526,7 @@ void getMachineRAMInfoImpl(MachineRAMInfo& memInfo) {
 		{ "Inactive(file):"_sr, 0 }, { "SwapTotal:"_sr, 0 }, { "SwapFree:"_sr, 0 },      { "SReclaimable:"_sr, 0 },
 	};
 
-	std::stringstream memInfoStream;
-	memInfoStream << fileStream.rdbuf();
+	std::stringstream memInfoStream(memInfoBuffer);
 	getMemoryInfo(request, memInfoStream);
 
 	int64_t memFree = request["MemFree:"_sr];
@@ -745,7 +793,11 @@ void getNetworkTraffic(const IPAddress& ip,
 	if (!ifa_name)
 		return;
 
-	std::ifstream dev_stream("/proc/net/dev", std::ifstream::in);
+	static thread_local ProcFileSampler devSampler("/proc/net/dev");
+	static thread_local std::string devBuffer;
+	if (!devSampler.read(devBuffer))
+		devBuffer.clear();
+	std::istringstream dev_stream(devBuffer);
 	dev_stream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 	dev_stream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
@@ -781,7 +833,11 @@ void getNetworkTraffic(const IPAddress& ip,
 		bytesReceived = bytesReceivedSum;
 	}
 
-	std::ifstream snmp_stream("/proc/net/snmp", std::ifstream::in);
+	static thread_local ProcFileSampler snmpSampler("/proc/net/snmp");
+	static thread_local std::string snmpBuffer;
+	if (!snmpSampler.read(snmpBuffer))
+		snmpBuffer.clear();
+	std::istringstream snmp_stream(snmpBuffer);
 
 	std::string label;
 
@@ -804,7 +860,11 @@ void getMachineLoad(uint64_t& idleTime, uint64_t& totalTime, bool logDetails) {
 	INJECT_FAULT(platform_error,
 	             "getMachineLoad"); // getMachineLoad: Even though this function doesn't throw errors, the equivalents
 	                                // for other platforms do, and since all of our simulation testing is on Linux...
-	std::ifstream stat_stream("/proc/stat", std::ifstream::in);
+	static thread_local ProcFileSampler statSampler("/proc/stat");
+	static thread_local std::string statBuffer;
+	if (!statSampler.read(statBuffer))
+		statBuffer.clear();
+	std::istringstream stat_stream(statBuffer);
 
 	std::string ignore;
 	stat_stream >> ignore;
@@ -846,7 +906,13 @@ void getDiskStatistics(std::string const& directory,
 		throw platform_error();
 	}
 
-	std::ifstream proc_stream("/proc/diskstats", std::ifstream::in);
+	static thread_local ProcFileSampler diskStatsSampler("/proc/diskstats");
+	static thread_local std::string diskStatsBuffer;
+	if (!diskStatsSampler.read(diskStatsBuffer)) {
+		TraceEvent(SevError, "GetDiskStatisticsReadError").GetLastError();
+		throw platform_error();
+	}
+	std::istringstream proc_stream(diskStatsBuffer);
 	while (proc_stream.good()) {
 		std::string line;
 		getline(proc_stream, line);
@@ -22,6 +22,7 @@
 
 #include "flow/flow.h"
 #include "flow/Histogram.h"
+#include "flow/IAsyncFile.h"
 #include "flow/Platform.h"
 #include "flow/TDMetric.actor.h"
 #include "flow/SystemMonitor.h"
@@ -71,7 +72,9 @@ SystemStatistics getSystemStatistics() {
 #define DETAILALLOCATORMEMUSAGE(size)                                                                                  \
 	detail("TotalMemory" #size, FastAllocator<size>::getTotalMemory())                                                 \
 	    .detail("ApproximateUnusedMemory" #size, FastAllocator<size>::getApproximateMemoryUnused())                    \
-	    .detail("ActiveThreads" #size, FastAllocator<size>::getActiveThreads())
+	    .detail("ActiveThreads" #size, FastAllocator<size>::getActiveThreads())                                        \
+	    .detail("LocalMagazineRefills" #size, FastAllocator<size>::getLocalMagazineRefills())                          \
+	    .detail("RemoteMagazineRefills" #size, FastAllocator<size>::getRemoteMagazineRefills())
 
 namespace {
 
@@ -230,6 +233,31 @@ SystemStatistics customSystemMonitor(std::string const& eventName, StatisticsSta
 			unused_memory += FastAllocator<8192>::getApproximateMemoryUnused();
 			unused_memory += FastAllocator<16384>::getApproximateMemoryUnused();
 
+			if (FLOW_KNOBS->FAST_ALLOC_SAMPLE_INTERVAL > 0) {
+				auto sites = getFastAllocSampleSites(10);
+				for (auto& site : sites) {
+					TraceEvent("FastAllocSampleSite")
+					    .detail("SizeClass", site.sizeClass)
+					    .detail("SampleCount", site.count)
+					    .detail("Backtrace", platform::format_backtrace(site.backtrace.data(), (int)site.backtrace.size()));
+				}
+			}
+
+			if (FLOW_KNOBS->INSTRUMENT_ASYNC_FILE_IO) {
+				for (const auto& fc : getAsyncFileInstrumentationStats()) {
+					TraceEvent("AsyncFileMetrics")
+					    .detail("FileClass", fc.fileClass)
+					    .detail("Reads", fc.reads)
+					    .detail("Writes", fc.writes)
+					    .detail("Syncs", fc.syncs)
+					    .detail("Truncates", fc.truncates)
+					    .detail("BytesRead", fc.bytesRead)
+					    .detail("BytesWritten", fc.bytesWritten)
+					    .detail("InFlight", fc.inFlight)
+					    .detail("InFlightHighWater", fc.inFlightHighWater);
+				}
+			}
+
 			if (total_memory > 0) {
 				TraceEvent("FastAllocMemoryUsage")
 				    .detail("TotalMemory", total_memory)
@@ -381,16 +381,18 @@ bool verifyStatsdMessage(const std::string& msg) {
 void createOtelGauge(UID id, const std::string& name, double value) {
 	MetricCollection* metrics = MetricCollection::getMetricCollection();
 	if (metrics != nullptr) {
-		NetworkAddress addr = g_network->getLocalAddress();
-		std::string ip_str = addr.ip.toString();
-		std::string port_str = std::to_string(addr.port);
-		if (metrics->gaugeMap.find(id) != metrics->gaugeMap.end()) {
-			metrics->gaugeMap[id].points.emplace_back(value);
+		auto itr = metrics->gaugeMap.find(id);
+		if (itr != metrics->gaugeMap.end() && !itr->second.points.empty()) {
+			// A gauge reports the latest observation, so overwrite the pending data point in place rather
+			// than appending one (with a fresh pair of address attributes) per observation
+			itr->second.points.back().val = value;
+			itr->second.points.back().recordTime = now();
 		} else {
-			metrics->gaugeMap[id] = OTEL::OTELGauge(name, value);
+			NetworkAddress addr = g_network->getLocalAddress();
+			OTEL::OTELGauge& g = metrics->gaugeMap[id] = OTEL::OTELGauge(name, value);
+			g.points.back().addAttribute("ip", addr.ip.toString());
+			g.points.back().addAttribute("port", std::to_string(addr.port));
 		}
-		metrics->gaugeMap[id].points.back().addAttribute("ip", ip_str);
-		metrics->gaugeMap[id].points.back().addAttribute("port", port_str);
 	}
 }
 
@@ -398,8 +400,13 @@ void createOtelGauge(UID id, const std::string& name, double value, const std::v
 	MetricCollection* metrics = MetricCollection::getMetricCollection();
 	createOtelGauge(id, name, value);
 	if (metrics != nullptr) {
-		for (const auto& attr : attrs) {
-			metrics->gaugeMap[id].points.back().addAttribute(attr.key, attr.value);
+		// The address attributes are added when the data point is created; only add the caller's
+		// attributes once, not every time the pending point is updated
+		auto& point = metrics->gaugeMap[id].points.back();
+		if (point.attributes.size() <= 2) {
+			for (const auto& attr : attrs) {
+				point.addAttribute(attr.key, attr.value);
+			}
 		}
 	}
 }
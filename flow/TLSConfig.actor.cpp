@@ -29,12 +29,15 @@ TLSPolicy::~TLSPolicy() {}
 #include <cstring>
 #include <exception>
 #include <map>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #if defined(HAVE_WOLFSSL)
 #include <wolfssl/options.h>
 #endif
 #include <openssl/objects.h>
 #include <openssl/bio.h>
+#include <openssl/ssl.h>
 #include <openssl/err.h>
 #include <openssl/pem.h>
 #include <openssl/x509.h>
@@ -109,6 +112,89 @@ void LoadedTLSConfig::print(FILE* fp) {
 	X509_STORE_CTX_free(store_ctx);
 }
 
+namespace {
+
+// Cache of TLS sessions previously negotiated with each peer, offered on reconnect so
+// that handshakes after a network blip are mostly abbreviated resumptions instead of
+// full key exchanges. OpenSSL delivers resumable TLS 1.3 sessions in NewSessionTicket
+// messages after the handshake completes, so sessions are captured in the context's
+// new-session callback; that callback can run on a handshaker pool thread, so the cache
+// is guarded by a mutex.
+struct TLSSessionCache {
+	std::mutex mutex;
+	std::unordered_map<std::string, SSL_SESSION*> sessions;
+
+	static TLSSessionCache& instance() {
+		static TLSSessionCache cache;
+		return cache;
+	}
+
+	// Takes ownership of session
+	void store(const std::string& peerKey, SSL_SESSION* session) {
+		std::lock_guard<std::mutex> lock(mutex);
+		auto [it, inserted] = sessions.try_emplace(peerKey, session);
+		if (!inserted) {
+			SSL_SESSION_free(it->second);
+			it->second = session;
+		} else if (sessions.size() > (size_t)FLOW_KNOBS->TLS_SESSION_CACHE_SIZE) {
+			auto evict = sessions.begin();
+			if (evict == it) {
+				++evict;
+			}
+			SSL_SESSION_free(evict->second);
+			sessions.erase(evict);
+		}
+	}
+
+	// Returns an owned reference to the cached session for peerKey, or nullptr
+	SSL_SESSION* take(const std::string& peerKey) {
+		std::lock_guard<std::mutex> lock(mutex);
+		auto it = sessions.find(peerKey);
+		if (it == sessions.end()) {
+			return nullptr;
+		}
+		if (SSL_SESSION_get_time(it->second) + SSL_SESSION_get_timeout(it->second) <= ::time(nullptr)) {
+			SSL_SESSION_free(it->second);
+			sessions.erase(it);
+			return nullptr;
+		}
+		SSL_SESSION_up_ref(it->second);
+		return it->second;
+	}
+};
+
+int sessionStateExDataIndex() {
+	static int index = SSL_get_ex_new_index(0, (void*)"FlowTLSSessionState", nullptr, nullptr, nullptr);
+	return index;
+}
+
+// The verify outcome of the handshake that negotiated a session, recorded on the
+// session itself so it survives resumption: abbreviated handshakes skip certificate
+// exchange, so the verify callback never runs on them. Encoded as distinct non-null
+// pointers to distinguish "untrusted" from "never recorded", and copied verbatim when
+// OpenSSL duplicates a session for reissued tickets.
+void* const SESSION_TRUSTED = (void*)1;
+void* const SESSION_UNTRUSTED = (void*)2;
+
+int sessionTrustExDataIndex() {
+	static int index = SSL_SESSION_get_ex_new_index(0, (void*)"FlowTLSSessionTrust", nullptr, nullptr, nullptr);
+	return index;
+}
+
+int newSessionCallback(SSL* ssl, SSL_SESSION* session) {
+	auto state = static_cast<TLSSessionState*>(SSL_get_ex_data(ssl, sessionStateExDataIndex()));
+	if (state == nullptr) {
+		// Server side of a handshake, or a client that did not ask for resumption
+		return 0;
+	}
+	SSL_SESSION_set_ex_data(
+	    session, sessionTrustExDataIndex(), state->verifiedTrusted ? SESSION_TRUSTED : SESSION_UNTRUSTED);
+	TLSSessionCache::instance().store(state->peerKey, session);
+	return 1; // the cache took ownership of the reference
+}
+
+} // namespace
+
 void ConfigureSSLContext(const LoadedTLSConfig& loaded, boost::asio::ssl::context& context) {
 	try {
 		context.set_options(boost::asio::ssl::context::default_workarounds);
@@ -136,6 +222,23 @@ void ConfigureSSLContext(const LoadedTLSConfig& loaded, boost::asio::ssl::contex
 		if (certBytes.size()) {
 			context.use_certificate_chain(boost::asio::buffer(certBytes.data(), certBytes.size()));
 		}
+
+		if (FLOW_KNOBS->TLS_SESSION_CACHE_SIZE > 0) {
+			// Capture negotiated sessions so reconnects can use abbreviated handshakes.
+			// Client sessions live in the flow-level per-peer cache. Server contexts keep
+			// resumable sessions in OpenSSL's internal store instead of stateless tickets,
+			// because the verify outcome recorded on a stored session survives resumption
+			// while a stateless ticket would discard it.
+			SSL_CTX* ctx = context.native_handle();
+			if (loaded.getEndpointType() == TLSEndpointType::SERVER) {
+				SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+				SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_BOTH);
+				SSL_CTX_sess_set_cache_size(ctx, FLOW_KNOBS->TLS_SESSION_CACHE_SIZE);
+			} else {
+				SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+			}
+			SSL_CTX_sess_set_new_cb(ctx, newSessionCallback);
+		}
 	} catch (boost::system::system_error& e) {
 		TraceEvent("TLSContextConfigureError")
 		    .detail("What", e.what())
@@ -168,6 +271,37 @@ void ConfigureSSLStream(Reference<TLSPolicy> policy,
 	}
 }
 
+void PrepareTLSSessionResumption(boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>& stream,
+                                 TLSSessionState* state) {
+	SSL* ssl = stream.native_handle();
+	SSL_set_ex_data(ssl, sessionStateExDataIndex(), state);
+	SSL_SESSION* session = TLSSessionCache::instance().take(state->peerKey);
+	if (session != nullptr) {
+		SSL_set_session(ssl, session);
+		SSL_SESSION_free(session); // SSL_set_session took its own reference
+	}
+}
+
+Optional<bool> TLSResumedSessionTrust(boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>& stream) {
+	SSL* ssl = stream.native_handle();
+	if (!SSL_session_reused(ssl)) {
+		return Optional<bool>();
+	}
+	SSL_SESSION* session = SSL_get_session(ssl);
+	void* trust = session != nullptr ? SSL_SESSION_get_ex_data(session, sessionTrustExDataIndex()) : nullptr;
+	if (trust == nullptr) {
+		return Optional<bool>();
+	}
+	return trust == SESSION_TRUSTED;
+}
+
+void RecordTLSSessionTrust(boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>& stream, bool trusted) {
+	SSL_SESSION* session = SSL_get_session(stream.native_handle());
+	if (session != nullptr) {
+		SSL_SESSION_set_ex_data(session, sessionTrustExDataIndex(), trusted ? SESSION_TRUSTED : SESSION_UNTRUSTED);
+	}
+}
+
 std::string TLSConfig::getCertificatePathSync() const {
 	if (tlsCertPath.size()) {
 		return tlsCertPath;
@@ -22,6 +22,7 @@
 #include "flow/FileTraceLogWriter.h"
 #include "flow/Knobs.h"
 #include "flow/XmlTraceLogFormatter.h"
+#include "flow/BinaryTraceLogFormatter.h"
 #include "flow/JsonTraceLogFormatter.h"
 #include "flow/flow.h"
 #include "flow/DeterministicRandom.h"
@@ -64,31 +65,129 @@ thread_local int failedLineOverflow = 0;
 ITraceLogIssuesReporter::~ITraceLogIssuesReporter() {}
 
 struct SuppressionMap {
+	// Open-addressed table of per-event-type suppression token buckets. The
+	// event name is stored once per slot and later checks only compare on a
+	// hash collision, so the per-event cost is a hash and a short linear probe
+	// instead of the allocation and node walk of the std::map this replaces,
+	// which showed up during event storms when suppression is busiest.
 	struct SuppressionInfo {
-		double endTime;
-		int64_t suppressedEventCount;
-
-		SuppressionInfo() : endTime(0), suppressedEventCount(0) {}
+		std::string type; // empty means the slot is free
+		double tokens = 0;
+		double lastRefillTime = 0;
+		int64_t suppressedEventCount = 0; // reported when the event is next admitted
+		int64_t rollupCount = 0; // reported by the periodic rollup
 	};
 
-	std::map<std::string, SuppressionInfo> suppressionMap;
+	std::vector<SuppressionInfo> table;
+	int entries = 0;
+	int64_t clearedSuppressedCount = 0; // counts dropped by table clears, folded into the next rollup
+	double nextRollupTime = 0;
+
+	SuppressionInfo& find(const std::string& type) {
+		size_t mask = table.size() - 1;
+		size_t i = std::hash<std::string>{}(type) & mask;
+		while (!table[i].type.empty() && table[i].type != type) {
+			i = (i + 1) & mask;
+		}
+		return table[i];
+	}
+
+	void growIfNeeded() {
+		if (table.empty()) {
+			table.resize(256);
+		} else if (entries * 2 >= (int)table.size()) {
+			std::vector<SuppressionInfo> old;
+			old.swap(table);
+			table.resize(old.size() * 2);
+			for (auto& slot : old) {
+				if (!slot.type.empty()) {
+					find(slot.type) = std::move(slot);
+				}
+			}
+		}
+	}
+
+	// Emits at most one event per TRACE_SUPPRESSION_ROLLUP_INTERVAL summarizing
+	// how much was suppressed, so suppression of events that never recur is
+	// still visible in the logs.
+	void maybeRollup() {
+		if (FLOW_KNOBS->TRACE_SUPPRESSION_ROLLUP_INTERVAL <= 0) {
+			return;
+		}
+		double t = now();
+		if (nextRollupTime == 0 || t < nextRollupTime) {
+			if (nextRollupTime == 0) {
+				nextRollupTime = t + FLOW_KNOBS->TRACE_SUPPRESSION_ROLLUP_INTERVAL;
+			}
+			return;
+		}
+		nextRollupTime = t + FLOW_KNOBS->TRACE_SUPPRESSION_ROLLUP_INTERVAL;
+
+		int64_t total = clearedSuppressedCount;
+		clearedSuppressedCount = 0;
+		int suppressedTypes = 0;
+		SuppressionInfo* busiest = nullptr;
+		for (auto& slot : table) {
+			if (slot.rollupCount > 0) {
+				total += slot.rollupCount;
+				++suppressedTypes;
+				if (busiest == nullptr || slot.rollupCount > busiest->rollupCount) {
+					busiest = &slot;
+				}
+			}
+		}
+		if (total == 0) {
+			return;
+		}
+		TraceEvent ev("TraceEventSuppressionRollup");
+		ev.detail("SuppressedEvents", total).detail("SuppressedTypes", suppressedTypes);
+		if (busiest != nullptr) {
+			ev.detail("BusiestType", busiest->type).detail("BusiestTypeCount", busiest->rollupCount);
+		}
+		for (auto& slot : table) {
+			slot.rollupCount = 0;
+		}
+	}
 
 	// Returns -1 if this event is suppressed
 	int64_t checkAndInsertSuppression(std::string type, double duration) {
 		ASSERT(g_network);
-		if (suppressionMap.size() >= FLOW_KNOBS->MAX_TRACE_SUPPRESSIONS) {
+		growIfNeeded();
+		if (entries >= FLOW_KNOBS->MAX_TRACE_SUPPRESSIONS) {
 			TraceEvent(SevWarnAlways, "ClearingTraceSuppressionMap").log();
-			suppressionMap.clear();
+			for (auto& slot : table) {
+				clearedSuppressedCount += slot.suppressedEventCount;
+				slot = SuppressionInfo();
+			}
+			entries = 0;
 		}
 
-		auto insertion = suppressionMap.insert(std::make_pair(type, SuppressionInfo()));
-		if (insertion.second || insertion.first->second.endTime <= now()) {
-			int64_t suppressedEventCount = insertion.first->second.suppressedEventCount;
-			insertion.first->second.endTime = now() + duration;
-			insertion.first->second.suppressedEventCount = 0;
+		maybeRollup();
+
+		double burst = std::max(1, FLOW_KNOBS->TRACE_SUPPRESSION_BURST);
+		SuppressionInfo& slot = find(type);
+		if (slot.type.empty()) {
+			slot.type = std::move(type);
+			slot.tokens = burst;
+			slot.lastRefillTime = now();
+			++entries;
+		} else if (duration > 0) {
+			slot.tokens = std::min(burst, slot.tokens + (now() - slot.lastRefillTime) / duration);
+			slot.lastRefillTime = now();
+		} else {
+			// suppressFor(0) never suppresses
+			slot.tokens = burst;
+			slot.lastRefillTime = now();
+		}
+
+		if (slot.tokens >= 1) {
+			slot.tokens -= 1;
+			int64_t suppressedEventCount = slot.suppressedEventCount;
+			slot.suppressedEventCount = 0;
 			return suppressedEventCount;
 		} else {
-			++insertion.first->second.suppressedEventCount;
+			++slot.suppressedEventCount;
+			++slot.rollupCount;
 			return -1;
 		}
 	}
@@ -690,6 +789,11 @@ bool traceFormatImpl(std::string& format) {
 			g_traceLog.formatter = Reference<ITraceLogFormatter>(new JsonTraceLogFormatter());
 		}
 		return true;
+	} else if (format == "binary") {
+		if (!validate) {
+			g_traceLog.formatter = Reference<ITraceLogFormatter>(new BinaryTraceLogFormatter());
+		}
+		return true;
 	} else {
 		if (!validate) {
 			g_traceLog.formatter = Reference<ITraceLogFormatter>(new XmlTraceLogFormatter());
@@ -202,6 +202,13 @@ static Future<ErrorOr<Void>> badTestFuture(double duration, Error e) {
 	return tag(delay(duration), ErrorOr<Void>(e));
 }
 
+ACTOR static Future<Void> countChanges(Reference<AsyncVar<int>> var, int* count) {
+	loop {
+		wait(var->onChange());
+		++*count;
+	}
+}
+
 } // namespace
 
 TEST_CASE("/flow/genericactors/AsyncListener") {
@@ -248,6 +255,30 @@ TEST_CASE("/flow/genericactors/WaitForMost") {
 	return Void();
 }
 
+TEST_CASE("/flow/genericactors/AsyncVar/batchNotifications") {
+	state Reference<AsyncVar<int>> var = makeReference<AsyncVar<int>>(0);
+	state int changes = 0;
+	state Future<Void> counter = countChanges(var, &changes);
+	var->batchNotifications();
+
+	// A burst of changes within one run loop iteration delivers a single wakeup
+	for (int i = 1; i <= 5; i++) {
+		var->set(i);
+	}
+	wait(delay(0));
+	wait(delay(0));
+	ASSERT(changes == 1 && var->get() == 5);
+
+	// A subscriber between a change and its delivery is woken with the pending batch
+	var->set(6);
+	state Future<Void> late = var->onChange();
+	wait(delay(0));
+	wait(delay(0));
+	ASSERT(changes == 2 && late.isReady());
+
+	return Void();
+}
+
 #if false
 TEST_CASE("/flow/genericactors/generic/storeTuple") {
 	state std::vector<UID> resA;
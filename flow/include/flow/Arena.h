@@ -176,6 +176,8 @@ struct ArenaBlock : NonCopyable, ThreadSafeReferenceCounted<ArenaBlock> {
 	bool secure : 1; // If this is set, block is zero-ed out after use
 	uint8_t tinySize : 7, tinyUsed; // If these == NOT_TINY, use bigSize, bigUsed instead
 	// if tinySize != NOT_TINY, following variables aren't used
+	uint8_t hugeSlab; // Only meaningful when bigSize >= LARGE: nonzero if this block was carved from a
+	                  // recycled huge-page slab rather than allocated from the system allocator
 	uint32_t bigSize, bigUsed; // include block header
 	uint32_t nextBlockOffset;
 	mutable size_t totalSizeEstimate; // Estimate of the minimum total size of arena blocks this one reaches
@@ -802,6 +804,21 @@ typedef uint64_t Word;
 // Get the number of prefix bytes that are the same between a and b, up to their common length of cl
 static inline int commonPrefixLength(uint8_t const* ap, uint8_t const* bp, int cl) {
 	int i = 0;
+#if defined(__SSE2__) || defined(__aarch64__)
+	// 16 bytes at a time using SSE2 (or its NEON translation on aarch64), locating the first mismatch with a
+	// byte-equality mask
+	const int vecEnd = cl - 16 + 1;
+	for (; i < vecEnd; i += 16) {
+		__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ap + i));
+		__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bp + i));
+		int mismatch = _mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) ^ 0xffff;
+		if (mismatch != 0) {
+			return i + ctz(uint32_t(mismatch));
+		}
+	}
+	ap += i;
+	bp += i;
+#endif
 	const int wordEnd = cl - sizeof(Word) + 1;
 
 	for (; i < wordEnd; i += sizeof(Word)) {
@@ -832,6 +849,20 @@ static inline int commonPrefixLength(const StringRef& a, const StringRef& b, int
 	return commonPrefixLength(a.begin() + skipLen, b.begin() + skipLen, std::min(a.size(), b.size()) - skipLen);
 }
 
+// Three-way comparison of a and b that skips their first skipLen bytes, which the caller guarantees are equal in
+// both strings. On return *matchedLen is the total length of the shared prefix of a and b, so a caller comparing
+// against a series of ordered strings can start later comparisons past the bytes already known to match.
+static inline int compareWithPrefixSkip(const StringRef& a, const StringRef& b, int skipLen, int* matchedLen) {
+	const int minSize = std::min(a.size(), b.size());
+	const int skip = std::min(skipLen, minSize);
+	const int cpl = skip + commonPrefixLength(a.begin() + skip, b.begin() + skip, minSize - skip);
+	*matchedLen = cpl;
+	if (cpl < minSize) {
+		return a[cpl] < b[cpl] ? -1 : 1;
+	}
+	return ::compare(a.size(), b.size());
+}
+
 // This trait is used by VectorRef to determine if deep copy constructor should recursively
 // call deep copies of each element.
 //
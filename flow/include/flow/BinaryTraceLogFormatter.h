@@ -0,0 +1,52 @@
+/*
+ * BinaryTraceLogFormatter.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_BINARY_TRACE_LOG_FORMATTER_H
+#define FLOW_BINARY_TRACE_LOG_FORMATTER_H
+#pragma once
+
+#include "flow/FastRef.h"
+#include "flow/Trace.h"
+
+// A compact binary trace format (--trace-format binary).  Events are written as length-prefixed
+// records of raw key/value bytes with no escaping or markup, which makes serialization on the trace
+// writer thread a handful of memcpys instead of the character-at-a-time escaping the xml and json
+// formatters do.  The files are not human readable; convert them with contrib/binary_trace_dump.py
+// or parse records with readEvent().
+//
+// File layout: the magic line returned by getHeader(), then zero or more records.  Each record is a
+// 4 byte little-endian payload length followed by the payload: a 2 byte field count, then for each
+// field a 2 byte key length, the key bytes, a 4 byte value length, and the value bytes.
+struct BinaryTraceLogFormatter final : public ITraceLogFormatter, ReferenceCounted<BinaryTraceLogFormatter> {
+	void addref() override;
+	void delref() override;
+
+	const char* getExtension() const override;
+	const char* getHeader() const override;
+	const char* getFooter() const override;
+
+	std::string formatEvent(const TraceEventFields& fields) const override;
+
+	// Parses the record starting at data[*offset], advancing *offset past it.  Returns false if the
+	// bytes at *offset do not form a complete, well-formed record.
+	static bool readEvent(StringRef data, int* offset, TraceEventFields* out);
+};
+
+#endif
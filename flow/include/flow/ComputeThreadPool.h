@@ -0,0 +1,94 @@
+/*
+ * ComputeThreadPool.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_COMPUTE_THREAD_POOL_H
+#define FLOW_COMPUTE_THREAD_POOL_H
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "flow/flow.h"
+#include "flow/ThreadHelper.actor.h"
+
+// A process-wide work-stealing executor for CPU-bound kernels: checksumming, compression,
+// encryption.  Subsystems that would otherwise run these on the network thread or spin up their
+// own IThreadPool instances -- each tuned independently and together oversubscribing the host --
+// can submit here instead and share FLOW_KNOBS->COMPUTE_POOL_THREADS workers.  Each task carries a
+// TaskPriority: workers run the highest-priority queued task they can find (stealing from each
+// other's queues when their own is empty), and the result is delivered to the main thread at the
+// same priority.
+//
+// With COMPUTE_POOL_THREADS == 0, and always in simulation, submitted tasks run inline on the
+// calling thread, which preserves current behavior and keeps simulation deterministic.
+class ComputeThreadPool : NonCopyable {
+public:
+	// The shared pool, started with FLOW_KNOBS->COMPUTE_POOL_THREADS workers on first use.  Must
+	// be accessed from the main thread.
+	static ComputeThreadPool& shared();
+
+	// A pool with an explicit worker count, for tests.  Production code shares one pool so that
+	// per-subsystem thread counts cannot oversubscribe the host.
+	explicit ComputeThreadPool(int numWorkers);
+	~ComputeThreadPool();
+
+	// Runs fn() on a pool thread and delivers its return value (or the Error it throws) to the
+	// returned future on the main thread at the given priority.  Must be called from the main
+	// thread.  fn runs off the network thread, so it must be self-contained: no flow calls, no
+	// TraceEvents, and it may only touch memory the caller keeps alive until the future is ready.
+	template <class F>
+	auto submit(TaskPriority priority, F fn) -> Future<decltype(fn())> {
+		using T = decltype(fn());
+		if (runsInline()) {
+			try {
+				return Future<T>(fn());
+			} catch (Error& e) {
+				return Future<T>(e);
+			}
+		}
+		// The promise is only touched on the main thread; the worker just moves the shared_ptr
+		// around, and its reference count is thread safe.
+		auto result = std::make_shared<Promise<T>>();
+		Future<T> future = result->getFuture();
+		dispatch(priority, [result, fn = std::move(fn), priority]() mutable {
+			try {
+				onMainThreadVoid([result, value = fn()]() mutable { result->send(std::move(value)); }, priority);
+			} catch (Error& e) {
+				onMainThreadVoid([result, e]() { result->sendError(e); }, priority);
+			}
+		});
+		return future;
+	}
+
+	// Finishes queued tasks and joins the workers.  Further submissions run inline.
+	void stop();
+
+	int64_t getTasksSubmitted() const;
+	int64_t getTasksStolen() const;
+
+private:
+	bool runsInline() const { return !impl; }
+	void dispatch(TaskPriority priority, std::function<void()> fn);
+
+	struct Impl;
+	std::unique_ptr<Impl> impl;
+};
+
+#endif
@@ -24,12 +24,35 @@
 
 #include "flow/Platform.h"
 #include <stdexcept>
+#include <utility>
+
+// Chunks hold a power-of-two number of elements totaling at least a 4KiB page, but always at least
+// four elements for very large T. (A free function because a constexpr static member initializer
+// cannot call member functions of its own, still-incomplete, class.)
+constexpr uint32_t dequeItemsPerChunk(size_t itemSize) {
+	uint32_t items = 4;
+	while (items * itemSize < 4096u)
+		items *= 2;
+	return items;
+}
+
+constexpr uint32_t dequeChunkLog2(uint32_t x) {
+	uint32_t s = 0;
+	while ((uint32_t(1) << s) != x)
+		s++;
+	return s;
+}
 
 template <class T>
 class Deque {
-	// Double ended queue implemented using circular array (and on-demand reallocation, like std::vector)
-	// Interface similar to std::deque, but incomplete (also reallocation invalidates all iterators like std::vector)
-	// Capacity is limited to 2^32-1 items even in 64 bit
+	// Double ended queue implemented as fixed-size chunks of elements addressed through a circular
+	// page table of chunk pointers. Growth allocates one chunk at a time and never moves elements,
+	// so pushing to a very large queue (e.g. a TLog version queue) cannot stall the network thread
+	// the way a doubling-and-copying ring buffer does; only the page table itself is occasionally
+	// doubled, which copies pointers rather than elements. Element addresses are stable for the
+	// lifetime of the element.
+	// Interface similar to std::deque, but incomplete (in particular there is no push_front)
+	// Capacity is limited to 2^30 items even in 64 bit
 
 public:
 	typedef T value_type;
@@ -38,70 +61,55 @@ public:
 	typedef int32_t difference_type;
 	typedef uint32_t size_type;
 
-	Deque() : arr(0), begin(0), end(0), mask(-1) {}
+	Deque() = default;
 
 	// TODO: iterator construction, other constructors
-	Deque(Deque const& r) : arr(nullptr), begin(0), end(r.size()), mask(r.mask) {
-		if (r.capacity() > 0) {
-			arr = (T*)aligned_alloc(std::max(__alignof(T), sizeof(void*)), capacity() * sizeof(T));
-			if (arr == nullptr) {
-				platform::outOfMemory();
-			}
-		}
-		ASSERT(capacity() >= end || end == 0);
-		if (r.end < r.capacity()) {
-			std::copy(r.arr + r.begin, r.arr + r.begin + r.size(), arr);
-		} else {
-			// r.begin is always < capacity(), and r.end is always >= r.begin.  Mask is used for wrapping r.end.
-			// but if r.end >= r.capacity(), the deque wraps around so the
-			// copy must be performed in two parts
-			auto partTwo = std::copy(r.arr + r.begin, r.arr + r.capacity(), arr);
-			std::copy(r.arr, r.arr + (r.end & r.mask), partTwo);
+	Deque(Deque const& r) {
+		try {
+			for (size_type i = 0; i < r.size(); i++)
+				push_back(r[i]);
+		} catch (...) {
+			cleanup();
+			throw;
 		}
 	}
 
 	void operator=(Deque const& r) {
+		if (this == &r)
+			return;
 		cleanup();
-
-		arr = nullptr;
-		begin = 0;
-		end = r.size();
-		mask = r.mask;
-		if (r.capacity() > 0) {
-			arr = (T*)aligned_alloc(std::max(__alignof(T), sizeof(void*)), capacity() * sizeof(T));
-			if (arr == nullptr) {
-				platform::outOfMemory();
-			}
-		}
-		ASSERT(capacity() >= end || end == 0);
-		if (r.end < r.capacity()) {
-			std::copy(r.arr + r.begin, r.arr + r.begin + r.size(), arr);
-		} else {
-			// r.begin is always < capacity(), and r.end is always >= r.begin.  Mask is used for wrapping r.end.
-			// but if r.end >= r.capacity(), the deque wraps around so the
-			// copy must be performed in two parts
-			auto partTwo = std::copy(r.arr + r.begin, r.arr + r.capacity(), arr);
-			std::copy(r.arr, r.arr + (r.end & r.mask), partTwo);
-		}
+		chunks = nullptr;
+		tableMask = -1;
+		firstChunk = nChunks = beginOff = count = 0;
+		spare = nullptr;
+		for (size_type i = 0; i < r.size(); i++)
+			push_back(r[i]);
 	}
 
-	Deque(Deque&& r) noexcept : arr(r.arr), begin(r.begin), end(r.end), mask(r.mask) {
-		r.arr = nullptr;
-		r.begin = r.end = 0;
-		r.mask = -1;
+	Deque(Deque&& r) noexcept
+	  : chunks(r.chunks), spare(r.spare), tableMask(r.tableMask), firstChunk(r.firstChunk), nChunks(r.nChunks),
+	    beginOff(r.beginOff), count(r.count) {
+		r.chunks = nullptr;
+		r.spare = nullptr;
+		r.tableMask = -1;
+		r.firstChunk = r.nChunks = r.beginOff = r.count = 0;
 	}
 
 	void operator=(Deque&& r) noexcept {
 		cleanup();
 
-		begin = r.begin;
-		end = r.end;
-		mask = r.mask;
-		arr = r.arr;
+		chunks = r.chunks;
+		spare = r.spare;
+		tableMask = r.tableMask;
+		firstChunk = r.firstChunk;
+		nChunks = r.nChunks;
+		beginOff = r.beginOff;
+		count = r.count;
 
-		r.arr = nullptr;
-		r.begin = r.end = 0;
-		r.mask = -1;
+		r.chunks = nullptr;
+		r.spare = nullptr;
+		r.tableMask = -1;
+		r.firstChunk = r.nChunks = r.beginOff = r.count = 0;
 	}
 
 	bool operator==(const Deque& r) const {
@@ -117,120 +125,150 @@ public:
 	~Deque() { cleanup(); }
 
 	void push_back(const T& val) {
-		if (full())
-			grow();
-		new (&arr[end & mask]) T(val);
-		end++;
+		ensureBackSlot();
+		new (&slot(count)) T(val);
+		count++;
 	}
 
 	template <class... U>
 	reference emplace_back(U&&... val) {
-		if (full())
-			grow();
-		new (&arr[end & mask]) T(std::forward<U>(val)...);
-		reference result = arr[end & mask];
-		end++;
+		ensureBackSlot();
+		new (&slot(count)) T(std::forward<U>(val)...);
+		reference result = slot(count);
+		count++;
 		return result;
 	}
 
 	void pop_back() {
 		ASSERT(!empty());
-		end--;
-		arr[end & mask].~T();
+		count--;
+		slot(count).~T();
+		if (nChunks > 1 && beginOff + count <= (nChunks - 1) * ITEMS_PER_CHUNK) {
+			nChunks--;
+			releaseChunk((firstChunk + nChunks) & tableMask);
+		}
 	}
 
 	void pop_front() {
 		ASSERT(!empty());
-		arr[begin].~T();
-		if (begin == mask) {
-			begin -= mask;
-			end -= mask + 1;
-		} else
-			begin++;
+		chunks[firstChunk][beginOff].~T();
+		beginOff++;
+		count--;
+		if (beginOff == ITEMS_PER_CHUNK) {
+			releaseChunk(firstChunk);
+			firstChunk = (firstChunk + 1) & tableMask;
+			nChunks--;
+			beginOff = 0;
+		} else if (count == 0) {
+			beginOff = 0;
+		}
 	}
 
 	void clear() {
-		for (uint32_t i = begin; i != end; i++)
-			arr[i & mask].~T();
-		begin = end = 0;
+		// Like the reallocating implementation this replaced, clear() retains capacity; the chunks
+		// stay in the page table for reuse.
+		for (uint32_t i = 0; i < count; i++)
+			slot(i).~T();
+		beginOff = count = 0;
 	}
 
-	size_type size() const { return end - begin; }
-	bool empty() const { return end == begin; }
-	size_type capacity() const { return mask + 1; }
+	size_type size() const { return count; }
+	bool empty() const { return count == 0; }
+	size_type capacity() const { return nChunks * ITEMS_PER_CHUNK; }
 	size_type max_size() const {
 		return 1 << 30;
 	} // All the logic should work at size 2^32, but size() can't return it, and callers might break, and there might be
 	  // bugs...
 
-	T& front() { return arr[begin]; }
-	T const& front() const { return arr[begin]; }
-	T& back() { return arr[(end - 1) & mask]; }
-	T const& back() const { return arr[(end - 1) & mask]; }
+	T& front() { return chunks[firstChunk][beginOff]; }
+	T const& front() const { return chunks[firstChunk][beginOff]; }
+	T& back() { return slot(count - 1); }
+	T const& back() const { return slot(count - 1); }
 
-	T& operator[](int i) { return arr[(begin + i) & mask]; }
-	T const& operator[](int i) const { return arr[(begin + i) & mask]; }
+	T& operator[](int i) { return slot(i); }
+	T const& operator[](int i) const { return slot(i); }
 
 	T& at(int i) {
-		if (i < 0 || i >= end - begin)
+		if (i < 0 || uint32_t(i) >= count)
 			throw std::out_of_range("requires 0 <= i < size");
 		return (*this)[i];
 	}
 	T const& at(int i) const {
-		if (i < 0 || i >= end - begin)
+		if (i < 0 || uint32_t(i) >= count)
 			throw std::out_of_range("requires 0 <= i < size");
 		return (*this)[i];
 	}
 
 private:
-	T* arr;
-	uint32_t begin, end, mask;
+	static constexpr size_type ITEMS_PER_CHUNK = dequeItemsPerChunk(sizeof(T));
+	static constexpr size_type ITEM_MASK = ITEMS_PER_CHUNK - 1;
+	static constexpr size_type CHUNK_SHIFT = dequeChunkLog2(ITEMS_PER_CHUNK);
+
+	T** chunks = nullptr; // circular table of tableMask+1 chunk pointers; entries [firstChunk, firstChunk+nChunks) used
+	T* spare = nullptr; // one cached free chunk, so a queue oscillating across a chunk boundary doesn't churn malloc
+	uint32_t tableMask = -1; // table capacity - 1 (capacity is a power of two; -1 means no table)
+	uint32_t firstChunk = 0; // table index of the chunk holding the front element
+	uint32_t nChunks = 0;
+	uint32_t beginOff = 0; // offset of the front element within its chunk
+	uint32_t count = 0;
 
-	bool full() const { return end == begin + mask + 1; }
-	void grow() {
-		// This doubles capacity (or makes it at least 8), and arbitrarily moves begin to be 0
+	// The element 'i' positions after the front (which must exist, except for the one-past-back
+	// position during push)
+	T& slot(uint32_t i) const {
+		uint32_t g = beginOff + i;
+		return chunks[(firstChunk + (g >> CHUNK_SHIFT)) & tableMask][g & ITEM_MASK];
+	}
 
-		size_t mp1 = arr ? size_t(mask) + 1 : 4;
-		size_t newSize = mp1 * 2;
-		if (newSize > max_size())
+	void ensureBackSlot() {
+		if (count == max_size())
 			throw std::bad_alloc();
-		// printf("Growing to %lld (%u-%u mask %u)\n", (long long)newSize, begin, end, mask);
-		T* newArr = (T*)aligned_alloc(std::max(__alignof(T), sizeof(void*)),
-		                              newSize * sizeof(T)); // SOMEDAY: FastAllocator
-		if (newArr == nullptr) {
-			platform::outOfMemory();
-		}
-		for (int i = begin; i != end; i++) {
-			try {
-				new (&newArr[i - begin]) T(std::move_if_noexcept(arr[i & mask]));
-			} catch (...) {
-				cleanup(newArr, i - begin);
-				throw;
+		if (beginOff + count == nChunks * ITEMS_PER_CHUNK)
+			addChunk();
+	}
+
+	void addChunk() {
+		if (nChunks == tableMask + 1)
+			growTable();
+		T* c = spare;
+		if (c) {
+			spare = nullptr;
+		} else {
+			c = (T*)aligned_alloc(std::max(__alignof(T), sizeof(void*)), ITEMS_PER_CHUNK * sizeof(T));
+			if (c == nullptr) {
+				platform::outOfMemory();
 			}
 		}
-		for (int i = begin; i != end; i++) {
-			static_assert(std::is_nothrow_destructible_v<T>);
-			arr[i & mask].~T();
-		}
-		aligned_free(arr);
-		arr = newArr;
-		end -= begin;
-		begin = 0;
-		mask = uint32_t(newSize - 1);
+		chunks[(firstChunk + nChunks) & tableMask] = c;
+		nChunks++;
 	}
 
-	static void cleanup(T* data, size_t size) noexcept {
-		for (int i = 0; i < size; ++i) {
-			data[i].~T();
-		}
-		aligned_free(data);
+	void growTable() {
+		size_t newCap = chunks ? size_t(tableMask) + 1 : 2;
+		newCap *= 2;
+		T** newTable = new T*[newCap];
+		for (uint32_t i = 0; i < nChunks; i++)
+			newTable[i] = chunks[(firstChunk + i) & tableMask];
+		delete[] chunks;
+		chunks = newTable;
+		firstChunk = 0;
+		tableMask = uint32_t(newCap - 1);
+	}
+
+	void releaseChunk(uint32_t tableIndex) noexcept {
+		if (spare == nullptr)
+			spare = chunks[tableIndex];
+		else
+			aligned_free(chunks[tableIndex]);
 	}
 
 	void cleanup() noexcept {
-		for (int i = begin; i != end; i++)
-			arr[i & mask].~T();
-		if (arr)
-			aligned_free(arr);
+		for (uint32_t i = 0; i < count; i++)
+			slot(i).~T();
+		for (uint32_t i = 0; i < nChunks; i++)
+			aligned_free(chunks[(firstChunk + i) & tableMask]);
+		if (spare)
+			aligned_free(spare);
+		delete[] chunks;
 	}
 };
 
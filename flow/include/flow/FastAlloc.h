@@ -103,6 +103,18 @@ void recordAllocation(void* ptr, size_t size);
 void recordDeallocation(void* ptr);
 #endif
 
+// One aggregated call site from the runtime sampling allocation profiler, which is
+// enabled by the FAST_ALLOC_SAMPLE_INTERVAL knob (see FastAlloc.cpp).
+struct FastAllocSampleSite {
+	int sizeClass;
+	int64_t count;
+	std::vector<void*> backtrace;
+};
+void recordFastAllocSample(int sizeClass);
+// Returns the sampled call sites with the highest sample counts, across all size
+// classes, sorted by descending count.
+std::vector<FastAllocSampleSite> getFastAllocSampleSites(int maxSites);
+
 inline constexpr auto kFastAllocMagazineBytes = 128 << 10;
 
 template <int Size>
@@ -115,6 +127,11 @@ public:
 	static long long getTotalMemory();
 	static long long getApproximateMemoryUnused();
 	static long long getActiveThreads();
+	// Counts of thread magazine refills served from the calling thread's NUMA-node-local pool vs
+	// stolen from another node's pool.  A growing remote count on a multi-socket host means threads
+	// are migrating between nodes or memory is being freed far from where it was allocated.
+	static long long getLocalMagazineRefills();
+	static long long getRemoteMagazineRefills();
 
 #ifdef ALLOC_INSTRUMENTATION
 	static volatile int32_t pageCount;
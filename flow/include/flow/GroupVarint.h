@@ -0,0 +1,100 @@
+/*
+ * GroupVarint.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <stdint.h>
+
+#include "flow/Error.h"
+
+// A group varint codec for batches of 32-bit integers.  Values are encoded four to a group: a tag
+// byte holding four 2-bit byte lengths, followed by the 1-4 significant (little endian) bytes of
+// each value.  Because all four lengths are known from the tag before any value byte is touched,
+// decode is a short branch-free sequence of unaligned loads per group instead of the bit-at-a-time
+// scan CompressedInt does.  Unlike CompressedInt the encoding is not order-preserving, so it is
+// suited to length and count fields, not to encoded keys.
+struct GroupVarint32 {
+	// Bytes that encode() may touch for `count` values: a tag byte per group of four, up to four
+	// bytes per value, and up to three bytes of slack after the last value (encode writes each
+	// value with a full 4-byte store and then advances by its significant length).
+	static int maxEncodedSize(int count) { return (count + 3) / 4 + count * 4 + 3; }
+
+	// Encodes count values into out, which must have room for maxEncodedSize(count) bytes.
+	// Returns the number of encoded bytes.
+	static int encode(const uint32_t* values, int count, uint8_t* out) {
+		uint8_t* p = out;
+		int i = 0;
+		while (i < count) {
+			int n = std::min(4, count - i);
+			uint8_t* tag = p++;
+			*tag = 0;
+			for (int j = 0; j < n; ++j) {
+				uint32_t v = values[i + j];
+				int len = 1 + (v > 0xff) + (v > 0xffff) + (v > 0xffffff);
+				*tag |= (len - 1) << (j * 2);
+				memcpy(p, &v, sizeof(v));
+				p += len;
+			}
+			i += n;
+		}
+		return p - out;
+	}
+
+	// Decodes count values from [in, end).  Throws serialization_failed() if the input is
+	// truncated.  Returns the number of bytes consumed.
+	static int decode(const uint8_t* in, const uint8_t* end, uint32_t* values, int count) {
+		const uint8_t* p = in;
+		int i = 0;
+		// A full group plus decode slack is at most 1 + 4*4 = 17 bytes, so as long as that many
+		// bytes remain the unaligned loads in decodeGroup cannot read past end.
+		while (i + 4 <= count && end - p >= 17) {
+			p = decodeGroup(p, values + i, 4);
+			i += 4;
+		}
+		// Remaining groups are decoded from a zero-padded copy so the overhanging loads stay in
+		// bounds regardless of how close p is to end.
+		while (i < count) {
+			if (p >= end)
+				throw serialization_failed();
+			int n = std::min(4, count - i);
+			uint8_t buf[17] = {};
+			memcpy(buf, p, std::min<ptrdiff_t>(end - p, sizeof(buf)));
+			p += decodeGroup(buf, values + i, n) - buf;
+			i += n;
+		}
+		if (p > end)
+			throw serialization_failed();
+		return p - in;
+	}
+
+private:
+	static const uint8_t* decodeGroup(const uint8_t* p, uint32_t* v, int n) {
+		uint8_t tag = *p++;
+		for (int j = 0; j < n; ++j) {
+			int len = ((tag >> (2 * j)) & 3) + 1;
+			uint32_t x;
+			memcpy(&x, p, sizeof(x));
+			v[j] = x & (0xffffffffu >> ((4 - len) * 8));
+			p += len;
+		}
+		return p;
+	}
+};
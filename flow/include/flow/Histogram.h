@@ -104,8 +104,9 @@ public:
 		}
 	}
 
-	// This histogram buckets samples into powers of two.
-	inline void sample(uint32_t sample) {
+	// This histogram buckets samples into powers of two.  count records a batch of identical
+	// samples with one bucket update, for callers that aggregate locally between samples.
+	inline void sample(uint32_t sample, uint32_t count = 1) {
 		size_t idx;
 #ifdef _WIN32
 		unsigned long index;
@@ -119,37 +120,37 @@ public:
 		idx = sample ? (31 - __builtin_clz(sample)) : 0;
 #endif
 		ASSERT(idx < 32);
-		buckets[idx]++;
+		buckets[idx] += count;
 	}
 
-	inline void sampleSeconds(double delta) {
+	inline void sampleSeconds(double delta, uint32_t count = 1) {
 		uint64_t delta_usec = (delta * 1000000);
 		if (delta_usec > UINT32_MAX) {
-			sample(UINT32_MAX);
+			sample(UINT32_MAX, count);
 		} else {
-			sample((uint32_t)(delta * 1000000)); // convert to microseconds and truncate to integer
+			sample((uint32_t)(delta * 1000000), count); // convert to microseconds and truncate to integer
 		}
 	}
 	// Histogram buckets samples into linear interval of size 4 percent.
-	inline void samplePercentage(double pct) {
+	inline void samplePercentage(double pct, uint32_t count = 1) {
 		ASSERT(pct >= 0.0);
 		if (pct >= 1.28) {
 			pct = 1.24;
 		}
 		size_t idx = (pct * 100) / 4;
 		ASSERT(idx < 32 && idx >= 0);
-		buckets[idx]++;
+		buckets[idx] += count;
 	}
 
 	// Histogram buckets samples into one of the same sized buckets
 	// This is used when the distance b/t upperBound and lowerBound are relativly small
-	inline void sampleRecordCounter(uint32_t sample) {
+	inline void sampleRecordCounter(uint32_t sample, uint32_t count = 1) {
 		if (sample > upperBound) {
 			sample = upperBound;
 		}
 		size_t idx = ((sample - lowerBound) * 31.0) / (upperBound - lowerBound);
 		ASSERT(idx < 32 && idx >= 0);
-		buckets[idx]++;
+		buckets[idx] += count;
 	}
 
 	void updateUpperBound(uint32_t upperBound) {
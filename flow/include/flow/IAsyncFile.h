@@ -103,6 +103,26 @@ public:
 	virtual void setRateControl(Reference<IRateControl> const& rc) { throw unsupported_operation(); }
 };
 
+// Wraps a file in a decorator that records latency and size histograms for each operation type and
+// tracks how many operations are in flight.  Statistics are aggregated by file class (storage, tlog,
+// etc., inferred from the filename) rather than per file, and the latency and size distributions are
+// published through the Histogram registry.  Enabled via FLOW_KNOBS->INSTRUMENT_ASYNC_FILE_IO.
+Reference<IAsyncFile> wrapInstrumentedFile(Reference<IAsyncFile> file);
+
+// A snapshot of the counters the instrumentation wrapper keeps outside of its histograms, suitable
+// for periodic emission by SystemMonitor.
+struct AsyncFileInstrumentationStats {
+	std::string fileClass;
+	int64_t reads, writes, syncs, truncates; // cumulative operation counts
+	int64_t bytesRead, bytesWritten; // cumulative
+	int inFlight;
+	int inFlightHighWater; // since the previous call to getAsyncFileInstrumentationStats()
+};
+
+// Returns one entry per file class which has had an instrumented file opened, and resets the
+// in-flight high-water marks.
+std::vector<AsyncFileInstrumentationStats> getAsyncFileInstrumentationStats();
+
 typedef void (*runCycleFuncPtr)();
 
 class IAsyncFileSystem {
@@ -70,7 +70,7 @@ private: // Forward-declare IndexedSet::Node because Clang is much stricter abou
 		// combinations, but still take advantage of move constructors when available (or required).
 		template <class T_, class Metric_>
 		Node(T_&& data, Metric_&& m, Node* parent = 0)
-		  : data(std::forward<T_>(data)), balance(0), total(std::forward<Metric_>(m)), parent(parent) {
+		  : parent(parent), balance(0), total(std::forward<Metric_>(m)), data(std::forward<T_>(data)) {
 			child[0] = child[1] = nullptr;
 		}
 		Node(Node const&) = delete;
@@ -80,11 +80,14 @@ private: // Forward-declare IndexedSet::Node because Clang is much stricter abou
 			delete child[1];
 		}
 
-		T data;
-		signed char balance; // right height - left height
-		Metric total; // this + child[0] + child[1]
+		// The link fields come first so that a search descent touches the first cache line of every
+		// node regardless of sizeof(T); with data first, the child pointers of a node with a large
+		// payload live past the 64-byte line and each probe costs two misses instead of one.
 		Node* child[2]; // left, right
 		Node* parent;
+		signed char balance; // right height - left height
+		Metric total; // this + child[0] + child[1]
+		T data;
 	};
 
 	template <bool isConst>
@@ -1264,6 +1267,10 @@ typename IndexedSet<T, Metric>::template Impl<isConst>::IteratorT IndexedSet<T,
     const Key& key) {
 	NodeT* t = self.root;
 	while (t) {
+		// Start fetching both children before the comparison; for variable-size keys the compare
+		// itself misses on the key bytes, which hides much of the child's memory latency.
+		_mm_prefetch((const char*)t->child[0], _MM_HINT_T0);
+		_mm_prefetch((const char*)t->child[1], _MM_HINT_T0);
 		int cmp = compare(key, t->data);
 		if (cmp == 0)
 			return IteratorT{ t };
@@ -1284,6 +1291,8 @@ typename IndexedSet<T, Metric>::template Impl<isConst>::IteratorT IndexedSet<T,
 		return self.end();
 	bool less;
 	while (true) {
+		_mm_prefetch((const char*)t->child[0], _MM_HINT_T0);
+		_mm_prefetch((const char*)t->child[1], _MM_HINT_T0);
 		less = t->data < key;
 		NodeT* n = t->child[less];
 		if (!n)
@@ -1309,6 +1318,8 @@ typename IndexedSet<T, Metric>::template Impl<isConst>::IteratorT IndexedSet<T,
 		return self.end();
 	bool not_less;
 	while (true) {
+		_mm_prefetch((const char*)t->child[0], _MM_HINT_T0);
+		_mm_prefetch((const char*)t->child[1], _MM_HINT_T0);
 		not_less = !(key < t->data);
 		NodeT* n = t->child[not_less];
 		if (!n)
@@ -1344,6 +1355,8 @@ typename IndexedSet<T, Metric>::template Impl<isConst>::IteratorT IndexedSet<T,
 	M m = metric;
 	NodeT* t = self.root;
 	while (t) {
+		_mm_prefetch((const char*)t->child[0], _MM_HINT_T0);
+		_mm_prefetch((const char*)t->child[1], _MM_HINT_T0);
 		if (t->child[0] && m < t->child[0]->total)
 			t = t->child[0];
 		else {
@@ -130,12 +130,16 @@ public:
 	double QUEUE_MODEL_SMOOTHING_AMOUNT;
 
 	double FAST_ALLOC_LOGGING_BYTES;
+	int64_t FAST_ALLOC_SAMPLE_INTERVAL;
 	bool FAST_ALLOC_ALLOW_GUARD_PAGES;
 	double HUGE_ARENA_LOGGING_BYTES;
 	double HUGE_ARENA_LOGGING_INTERVAL;
+	bool HUGE_ARENA_SLAB_RECYCLING; // Carve huge ArenaBlocks from recycled 2MB slabs (Linux only)
 
 	double MEMORY_USAGE_CHECK_INTERVAL;
 
+	int COMPUTE_POOL_THREADS; // Workers in the shared compute pool; 0 runs compute tasks inline on the calling thread
+
 	// Chaos testing
 	bool ENABLE_CHAOS_FEATURES;
 	double CHAOS_LOGGING_INTERVAL;
@@ -163,12 +167,16 @@ public:
 	double SATURATION_PROFILING_LOG_INTERVAL;
 	double SATURATION_PROFILING_MAX_LOG_INTERVAL;
 	double SATURATION_PROFILING_LOG_BACKOFF;
+	double RUN_LOOP_TRACE_INTERVAL;
+	int RUN_LOOP_TRACE_TOP_TASKS;
 
 	// connectionMonitor
 	double CONNECTION_MONITOR_LOOP_TIME;
 	double CONNECTION_MONITOR_TIMEOUT;
 	double CONNECTION_MONITOR_IDLE_TIMEOUT;
 	double CONNECTION_MONITOR_INCOMING_IDLE_MULTIPLIER;
+	double CONNECTION_MONITOR_BUSY_PING_INTERVAL; // minimum interval between explicit pings on connections that are
+	                                              // actively receiving data; 0 pings every monitor loop
 	double CONNECTION_MONITOR_UNREFERENCED_CLOSE_DELAY;
 
 	// FlowTransport
@@ -195,12 +203,17 @@ public:
 	int TLS_HANDSHAKE_THREAD_STACKSIZE;
 	int TLS_MALLOC_ARENA_MAX;
 	int TLS_HANDSHAKE_LIMIT;
+	int TLS_SESSION_CACHE_SIZE; // Max peers whose TLS sessions are cached for resumption; 0 disables resumption
 
 	int NETWORK_TEST_CLIENT_COUNT;
 	int NETWORK_TEST_REPLY_SIZE;
 	int NETWORK_TEST_REQUEST_COUNT;
 	int NETWORK_TEST_REQUEST_SIZE;
 	bool NETWORK_TEST_SCRIPT_MODE;
+	std::string NETWORK_TEST_SWEEP_CLIENT_COUNTS;
+	std::string NETWORK_TEST_SWEEP_REQUEST_SIZES;
+	std::string NETWORK_TEST_SWEEP_REPLY_SIZES;
+	double NETWORK_TEST_CELL_SECONDS;
 
 	// Authorization
 	bool ALLOW_TOKENLESS_TENANT_ACCESS;
@@ -217,8 +230,11 @@ public:
 	int64_t SIM_PAGE_CACHE_64K;
 	int64_t BUGGIFY_SIM_PAGE_CACHE_4K;
 	int64_t BUGGIFY_SIM_PAGE_CACHE_64K;
-	std::string CACHE_EVICTION_POLICY; // for now, "random", "lru", are supported
+	std::string CACHE_EVICTION_POLICY; // "random", "lru", and "2q" are supported
 	int MAX_EVICT_ATTEMPTS;
+	double CACHE_PROTECTED_FRACTION; // under "2q", max fraction of the cache the re-referenced segment may hold
+	int64_t CACHE_READAHEAD_BYTES; // read this far ahead of a detected sequential reader; 0 disables readahead
+	int CACHE_READAHEAD_MIN_SEQUENTIAL_READS; // contiguous reads before a file is considered sequential
 	double PAGE_CACHE_TRUNCATE_LOOKUP_FRACTION;
 	double TOO_MANY_CONNECTIONS_CLOSED_RESET_DELAY;
 	int TOO_MANY_CONNECTIONS_CLOSED_TIMEOUT;
@@ -232,6 +248,7 @@ public:
 	// AsyncFileEncrypted
 	int ENCRYPTION_BLOCK_SIZE;
 	int MAX_DECRYPTED_BLOCKS;
+	int ENCRYPTION_READAHEAD_BLOCKS; // number of blocks to read and decrypt ahead of a sequential reader; 0 disables
 
 	// AsyncFileKAIO
 	int MAX_OUTSTANDING;
@@ -241,7 +258,18 @@ public:
 	double KAIO_LATENCY_SKETCH_ACCURACY;
 
 	int PAGE_WRITE_CHECKSUM_HISTORY;
+	bool INSTRUMENT_ASYNC_FILE_IO; // Wrap every uncached file open in the histogram/queue-depth
+	                               // instrumentation decorator (see wrapInstrumentedFile)
 	int DISABLE_POSIX_KERNEL_AIO;
+	int ENABLE_IO_URING; // Use the io_uring backend instead of KAIO for unbuffered files; requires a build
+	                     // with liburing
+
+	// AsyncFileIOUring
+	bool IO_URING_REGISTER_FILES; // Register long-lived file descriptors with the ring so submissions skip
+	                              // per-op fd lookup; falls back silently on kernels without sparse tables
+	int IO_URING_MAX_REGISTERED_FILES;
+	double IO_URING_LATENCY_LOGGING_INTERVAL;
+	double IO_URING_LATENCY_SKETCH_ACCURACY;
 
 	// AsyncFileNonDurable
 	double NON_DURABLE_MAX_WRITE_DELAY;
@@ -284,6 +312,9 @@ public:
 	int MIN_PACKET_BUFFER_FREE_BYTES;
 	int FLOW_TCP_NODELAY;
 	int FLOW_TCP_QUICKACK;
+	// Minimum bytes ready in a SendBuffer chain before a send is issued with MSG_ZEROCOPY
+	// (Linux, non-TLS connections only). 0 disables zerocopy sends.
+	int ZEROCOPY_SEND_MIN_BYTES;
 
 	// Sim2
 	// FIMXE: more parameters could be factored out
@@ -307,6 +338,8 @@ public:
 	double TRACE_RETRY_OPEN_INTERVAL;
 	int MIN_TRACE_SEVERITY;
 	int MAX_TRACE_SUPPRESSIONS;
+	int TRACE_SUPPRESSION_BURST; // Events of one type allowed before suppressFor() begins suppressing
+	double TRACE_SUPPRESSION_ROLLUP_INTERVAL; // How often suppressed-event counts are rolled up into one event; 0 disables
 	bool TRACE_DATETIME_ENABLED;
 	int TRACE_SYNC_ENABLED;
 	int TRACE_EVENT_METRIC_UNITS_PER_SAMPLE;
@@ -350,6 +383,7 @@ public:
 	double FUTURE_VERSION_BACKOFF_GROWTH;
 	int LOAD_BALANCE_MAX_BAD_OPTIONS;
 	bool LOAD_BALANCE_PENALTY_IS_BAD;
+	bool LOAD_BALANCE_P2C_SELECTION;
 	double BASIC_LOAD_BALANCE_UPDATE_RATE;
 	double BASIC_LOAD_BALANCE_MAX_CHANGE;
 	double BASIC_LOAD_BALANCE_MAX_PROB;
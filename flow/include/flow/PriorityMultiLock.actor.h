@@ -108,6 +108,17 @@ public:
 		Priority& p = priorities[priority];
 		Queue& q = p.queue;
 
+		// Fast path: when no priority has waiters, this priority's capacity works out to the full
+		// concurrency, so a free slot means the lock can be granted immediately without touching
+		// the pending weight totals or doing the capacity arithmetic.
+		if (waiting == 0 && available > 0) {
+			Lock lock;
+			addRunner(lock, &p);
+
+			pml_debug_printf("lock fast path priority %d  %s\n", priority, toString().c_str());
+			return lock;
+		}
+
 		// If this priority currently has no waiters
 		if (q.empty()) {
 			// Add this priority's weight to the total for priorities with pending work.  This must be done
@@ -252,31 +263,45 @@ private:
 	Promise<Void> brokenOnDestruct;
 	bool killed;
 
-	ACTOR static void handleRelease(Reference<PriorityMultiLock> self, Priority* priority, Future<Void> holder) {
-		pml_debug_printf("%f handleRelease self=%p start\n", now(), self.getPtr());
-		try {
-			wait(holder);
-			pml_debug_printf("%f handleRelease self=%p success\n", now(), self.getPtr());
-		} catch (Error& e) {
-			pml_debug_printf("%f handleRelease self=%p error %s\n", now(), self.getPtr(), e.what());
+	// Returns a runner's slot when its Lock is released (or dropped), firing directly off the
+	// lock's promise instead of spawning an actor per acquisition.  The held reference keeps the
+	// PML alive until every runner has finished, as the actor it replaces did.
+	struct Runner final : public Callback<Void>, public FastAllocated<Runner> {
+		Reference<PriorityMultiLock> self;
+		Priority* priority;
+
+		Runner(Reference<PriorityMultiLock>&& self, Priority* priority, Future<Void>&& holder)
+		  : self(std::move(self)), priority(priority) {
+			holder.addCallbackAndClear(this);
 		}
 
-		pml_debug_printf("lock release priority %d  %s\n", (int)(priority->priority), self->toString().c_str());
+		void fire(Void const&) override { done(); }
+		void fire(Void&&) override { done(); }
+		void error(Error) override { done(); }
+
+		void done() {
+			Callback<Void>::remove();
+			Callback<Void>::next = 0;
 
-		pml_debug_printf("%f handleRelease self=%p releasing\n", now(), self.getPtr());
-		++self->available;
-		priority->runners -= 1;
+			PriorityMultiLock* pml = self.getPtr();
+			pml_debug_printf("lock release priority %d  %s\n", (int)(priority->priority), pml->toString().c_str());
+			++pml->available;
+			priority->runners -= 1;
 
-		// If there are any waiters or if the runners array is getting large, trigger the runner loop
-		if (self->waiting > 0) {
-			self->wakeRunner.trigger();
+			// If there are any waiters, trigger the runner loop
+			if (pml->waiting > 0) {
+				pml->wakeRunner.trigger();
+			}
+
+			// Drops the PML reference, which may destruct the PML
+			delete this;
 		}
-	}
+	};
 
 	void addRunner(Lock& lock, Priority* priority) {
 		priority->runners += 1;
 		--available;
-		handleRelease(Reference<PriorityMultiLock>::addRef(this), priority, lock.promise.getFuture());
+		new Runner(Reference<PriorityMultiLock>::addRef(this), priority, lock.promise.getFuture());
 	}
 
 	// Current maximum running tasks for the specified priority, which must have waiters
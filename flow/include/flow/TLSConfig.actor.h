@@ -214,6 +214,31 @@ void ConfigureSSLStream(Reference<TLSPolicy> policy,
                         boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>& stream,
                         std::function<void(bool)> callback);
 
+// Per-connection state for TLS session resumption. The context's new-session callback
+// reads it when the peer issues a session ticket, possibly on a handshaker pool thread,
+// so the object must outlive the stream.
+struct TLSSessionState {
+	std::string peerKey;
+	bool verifiedTrusted = false; // verify outcome recorded on sessions cached from this connection
+};
+
+// Offer any cached TLS session previously negotiated with state->peerKey on the
+// stream's next client handshake, and arrange for sessions the peer issues on this
+// connection to be cached under the same key, carrying state->verifiedTrusted.
+void PrepareTLSSessionResumption(boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>& stream,
+                                 TLSSessionState* state);
+
+// Returns the verify outcome recorded with the session that the stream's completed
+// handshake resumed, or an empty Optional for a full handshake (or a resumed session
+// that has no recorded outcome). Abbreviated handshakes skip certificate exchange
+// entirely, so the outcome recorded when the session was first negotiated is the only
+// trust information available for a resumed connection.
+Optional<bool> TLSResumedSessionTrust(boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>& stream);
+
+// Records the verify outcome of a completed handshake on its session, so
+// TLSResumedSessionTrust can restore it when the session is later resumed.
+void RecordTLSSessionTrust(boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>& stream, bool trusted);
+
 class TLSPolicy : ReferenceCounted<TLSPolicy> {
 	void set_verify_peers(std::vector<std::string> verify_peers);
 
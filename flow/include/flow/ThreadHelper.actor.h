@@ -35,30 +35,71 @@
 #include "flow/flow.h"
 #include "flow/actorcompiler.h" // This must be the last #include.
 
-// Helper actor. Do not use directly!
+// Helper callbacks. Do not use directly!
+//
+// These stand in for what would otherwise be a helper actor waiting on the cross-thread signal.
+// onMainThreadVoid is the per-operation handoff for every client API call, so it is worth avoiding
+// the actor frame and its state machine: a single fast-allocated callback node is attached to the
+// signal future on the calling thread and both fires and frees itself on the network thread.
 namespace internal_thread_helper {
 
-ACTOR template <class F>
-void doOnMainThreadVoid(Future<Void> signal, F f) {
-	wait(signal);
-	try {
-		f();
-	} catch (Error& e) {
+template <class F>
+struct OnMainThreadVoidCallback final : Callback<Void> {
+	F f;
+
+	explicit OnMainThreadVoidCallback(F&& f) : f(std::move(f)) {}
+
+	void fire(Void const&) override { run(); }
+	void fire(Void&&) override { run(); }
+	void error(Error) override { destroy(); }
+
+	void run() {
+		try {
+			f();
+		} catch (Error&) {
+		}
+		destroy();
 	}
-}
 
-ACTOR template <class F, class T>
-void doOnMainThreadVoid(Future<Void> signal, F f, T* t, Error T::*member) {
-	wait(signal);
-	if (t && (t->*member).code() != invalid_error_code)
-		return;
-	try {
-		f();
-	} catch (Error& e) {
-		if (t)
-			t->*member = e;
+	void destroy() {
+		Callback<Void>::remove();
+		this->~OnMainThreadVoidCallback();
+		freeFast(sizeof(OnMainThreadVoidCallback), this);
 	}
-}
+};
+
+template <class F, class T>
+struct OnMainThreadVoidMemberCallback final : Callback<Void> {
+	F f;
+	T* t;
+	Error T::*member;
+
+	OnMainThreadVoidMemberCallback(F&& f, T* t, Error T::*member) : f(std::move(f)), t(t), member(member) {}
+
+	void fire(Void const&) override { run(); }
+	void fire(Void&&) override { run(); }
+	void error(Error) override { destroy(); }
+
+	void run() {
+		if (t && (t->*member).code() != invalid_error_code) {
+			destroy();
+			return;
+		}
+		try {
+			f();
+		} catch (Error& e) {
+			if (t)
+				t->*member = e;
+		}
+		destroy();
+	}
+
+	void destroy() {
+		Callback<Void>::remove();
+		this->~OnMainThreadVoidMemberCallback();
+		freeFast(sizeof(OnMainThreadVoidMemberCallback), this);
+	}
+};
 
 } // namespace internal_thread_helper
 
@@ -78,15 +119,17 @@ void doOnMainThreadVoid(Future<Void> signal, F f, T* t, Error T::*member) {
 // `onMainThreadVoid` is defined here because of the dependency in `ThreadSingleAssignmentVarBase`.
 template <class F, class T>
 void onMainThreadVoid(F f, T* t, Error T::*member, TaskPriority taskID = TaskPriority::DefaultOnMainThread) {
+	using CB = internal_thread_helper::OnMainThreadVoidMemberCallback<F, T>;
 	Promise<Void> signal;
-	internal_thread_helper::doOnMainThreadVoid(signal.getFuture(), f, t, member);
+	signal.getFuture().addCallbackAndClear(new (allocateFast(sizeof(CB))) CB(std::move(f), t, member));
 	g_network->onMainThread(std::move(signal), taskID);
 }
 
 template <class F>
 void onMainThreadVoid(F f, TaskPriority taskID = TaskPriority::DefaultOnMainThread) {
+	using CB = internal_thread_helper::OnMainThreadVoidCallback<F>;
 	Promise<Void> signal;
-	internal_thread_helper::doOnMainThreadVoid(signal.getFuture(), f);
+	signal.getFuture().addCallbackAndClear(new (allocateFast(sizeof(CB))) CB(std::move(f)));
 	g_network->onMainThread(std::move(signal), taskID);
 }
 
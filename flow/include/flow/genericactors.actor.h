@@ -752,12 +752,32 @@ private:
 template <class V>
 class AsyncVar : NonCopyable, public ReferenceCounted<AsyncVar<V>> {
 public:
-	AsyncVar() : value() {}
-	AsyncVar(V const& v) : value(v) {}
-	AsyncVar(AsyncVar&& av) : value(std::move(av.value)), nextChange(std::move(av.nextChange)) {}
+	AsyncVar() : value(), batched(false), batchPriority(TaskPriority::DefaultYield), notifyPending(false) {}
+	AsyncVar(V const& v) : value(v), batched(false), batchPriority(TaskPriority::DefaultYield), notifyPending(false) {}
+	AsyncVar(AsyncVar&& av)
+	  : value(std::move(av.value)), nextChange(std::move(av.nextChange)), batched(av.batched),
+	    batchPriority(av.batchPriority), notifyPending(false) {
+		if (av.notifyPending) {
+			// Cancel the pending wakeup (it holds a pointer to av) and re-arm it here
+			av.notifier = Future<Void>();
+			av.notifyPending = false;
+			notifyPending = true;
+			notifier = deferredNotify(this);
+		}
+	}
 	void operator=(AsyncVar&& av) {
 		value = std::move(av.value);
 		nextChange = std::move(av.nextChange);
+		batched = av.batched;
+		batchPriority = av.batchPriority;
+		if (av.notifyPending) {
+			av.notifier = Future<Void>();
+			av.notifyPending = false;
+			if (!notifyPending) {
+				notifyPending = true;
+				notifier = deferredNotify(this);
+			}
+		}
 	}
 
 	V const& get() const { return value; }
@@ -767,20 +787,50 @@ public:
 			setUnconditional(v);
 	}
 	void setUnconditional(V const& v) {
-		Promise<Void> t;
-		this->nextChange.swap(t);
 		this->value = v;
-		t.send(Void());
+		notify();
 	}
-	void trigger() {
-		Promise<Void> t;
-		this->nextChange.swap(t);
-		t.send(Void());
+	void trigger() { notify(); }
+
+	// Coalesce notifications: after calling this, a burst of changes within one run loop iteration
+	// delivers a single wakeup per waiter (at the given priority) after the last change, instead of
+	// re-running every dependent actor once per change.  get() always returns the latest value, and
+	// waiters that subscribe between a change and its delivery are woken with it.  Changes are no
+	// longer observable individually, so this is only suitable for waiters that re-read state on
+	// wakeup (which is how onChange() is nearly always used).
+	void batchNotifications(TaskPriority priority = TaskPriority::DefaultYield) {
+		batched = true;
+		batchPriority = priority;
 	}
 
 private:
 	V value;
 	Promise<Void> nextChange;
+	bool batched;
+	TaskPriority batchPriority;
+	bool notifyPending;
+	Future<Void> notifier;
+
+	void notify() {
+		if (!batched) {
+			Promise<Void> t;
+			this->nextChange.swap(t);
+			t.send(Void());
+		} else if (!notifyPending) {
+			notifyPending = true;
+			notifier = deferredNotify(this);
+		}
+	}
+
+	ACTOR static Future<Void> deferredNotify(AsyncVar* self) {
+		wait(delay(0, self->batchPriority));
+		self->notifyPending = false;
+		Promise<Void> t;
+		self->nextChange.swap(t);
+		// Resumed waiters may destroy self, so this must be last and send through a local promise
+		t.send(Void());
+		return Void();
+	}
 };
 
 class AsyncTrigger : NonCopyable {
@@ -1150,21 +1200,72 @@ Future<Void> onEqual(Future<T> in, T equalTo) {
 	throw internal_error(); // does not happen
 }
 
-ACTOR template <class T>
+// Non-actor implementation backing success() and ready().  These adapters are chained onto
+// futures all over the codebase just to discard a value, and the actor versions paid a full actor
+// frame allocation each time; this is a single small node that is both the Void output SAV and
+// the callback on the input future, following the Quorum/QuorumCallback pattern.
+template <class T, bool IgnoreErrors>
+struct DiscardResult final : SAV<Void> {
+	struct Input final : Callback<T> {
+		DiscardResult* self;
+		void fire(T const&) override { self->finish(); }
+		void fire(T&&) override { self->finish(); }
+		void error(Error e) override { self->inputError(e); }
+	} input;
+
+	// One future ref for the returned future, one promise ref held until the input fires
+	DiscardResult() : SAV<Void>(1, 1) { input.self = this; }
+
+	static Future<Void> convert(Future<T>&& f) {
+		if (f.isReady()) {
+			if (f.isError() && !IgnoreErrors) {
+				return Future<Void>(f.getError());
+			}
+			return Future<Void>(Void());
+		}
+		DiscardResult* self = new (allocateFast(sizeof(DiscardResult))) DiscardResult();
+		f.addCallbackAndClear(&self->input);
+		return Future<Void>(self);
+	}
+
+	void destroy() override {
+		this->~DiscardResult();
+		freeFast(sizeof(DiscardResult), this);
+	}
+
+	// The output future was dropped while the input was still pending: detach from the input
+	// (which cancels it if this held its last reference) and drop this node's own promise ref.
+	void cancel() override {
+		input.remove();
+		this->delPromiseRef();
+	}
+
+	void finish() {
+		input.remove();
+		this->sendAndDelPromiseRef(Void());
+	}
+
+	void inputError(Error e) {
+		input.remove();
+		if (IgnoreErrors) {
+			this->sendAndDelPromiseRef(Void());
+		} else {
+			this->sendErrorAndDelPromiseRef(e);
+		}
+	}
+};
+
+// Returns a Void future which is ready when `of` is ready, discarding its value.  Errors,
+// including cancellation of `of`, still propagate.
+template <class T>
 Future<Void> success(Future<T> of) {
-	T t = wait(of);
-	(void)t;
-	return Void();
+	return DiscardResult<T, false>::convert(std::move(of));
 }
 
-ACTOR template <class T>
+// Like success(), but errors are swallowed too: the result is ready once `f` is ready or failed.
+template <class T>
 Future<Void> ready(Future<T> f) {
-	try {
-		T t = wait(f);
-		(void)t;
-	} catch (...) {
-	}
-	return Void();
+	return DiscardResult<T, true>::convert(std::move(f));
 }
 
 ACTOR template <class T>
@@ -418,6 +418,49 @@ inline _Unversioned Unversioned() {
 	return _Unversioned();
 }
 
+// An adaptor that writes through an underlying writer while reporting a protocol version fixed at
+// compile time. serialize() bodies are instantiated separately against this type, so per-field
+// feature checks of the form ar.protocolVersion().hasFeature() constant-fold away instead of
+// testing a runtime version for every field. The default band is the compiled-in protocol version,
+// which is what every archive in a homogeneous cluster carries in steady state; callers must route
+// any other version (e.g. while talking across a mixed-version upgrade, or re-encoding old disk
+// state) through the generic writer instead. See saveWithVersionSpecialization below.
+template <class Writer, uint64_t VersionValue = defaultProtocolVersionValue>
+class StaticVersionWriter : NonCopyable {
+public:
+	static constexpr int isDeserializing = 0;
+	static constexpr bool isSerializing = true;
+	using WRITER = StaticVersionWriter;
+
+	explicit StaticVersionWriter(Writer& writer) : writer(writer) {
+		ASSERT(writer.protocolVersion() == protocolVersion());
+	}
+
+	void serializeBytes(StringRef bytes) { writer.serializeBytes(bytes); }
+	void serializeBytes(const void* data, int bytes) { writer.serializeBytes(data, bytes); }
+	template <class T>
+	void serializeBinaryItem(const T& t) {
+		writer.serializeBinaryItem(t);
+	}
+	static constexpr ProtocolVersion protocolVersion() { return ProtocolVersion(VersionValue); }
+
+private:
+	Writer& writer;
+};
+
+// Serializes t into wr, taking the compile-time specialized path when wr carries exactly the
+// compiled-in protocol version and falling back to the generic per-field-checked path for any
+// other version. The two paths produce identical bytes for the same version.
+template <class Writer, class T>
+void saveWithVersionSpecialization(Writer& wr, const T& t) {
+	if (wr.protocolVersion() == defaultProtocolVersion) {
+		StaticVersionWriter<Writer> fastWr(wr);
+		fastWr << t;
+	} else {
+		wr << t;
+	}
+}
+
 // static uint64_t size_limits[] = { 0ULL, 255ULL, 65535ULL, 16777215ULL, 4294967295ULL, 1099511627775ULL,
 // 281474976710655ULL, 72057594037927935ULL, 18446744073709551615ULL };
 
@@ -443,6 +486,20 @@ public:
 	}
 	void* getData() { return data; }
 	int getLength() const { return size; }
+	// Pre-allocates at least `bytes` of buffer space, so that writes up to that total
+	// length will not reallocate and copy the data written so far.
+	void reserve(int bytes) {
+		if (bytes > allocated) {
+			Arena newArena;
+			uint8_t* newData = new (newArena) uint8_t[bytes];
+			if (size > 0) {
+				memcpy(newData, data, size);
+			}
+			arena = newArena;
+			data = newData;
+			allocated = bytes;
+		}
+	}
 	Standalone<StringRef> toValue() const { return Standalone<StringRef>(StringRef(data, size), arena); }
 	StringRef toValue(Arena& arena) const { return StringRef(arena, StringRef(data, size)); }
 	template <class VersionOptions>
@@ -470,7 +527,7 @@ public:
 	template <class T, class VersionOptions>
 	static Standalone<StringRef> toValue(T const& t, VersionOptions vo) {
 		BinaryWriter wr(vo);
-		wr << t;
+		saveWithVersionSpecialization(wr, t);
 		return wr.toValue();
 	}
 
@@ -831,6 +888,11 @@ private:
 public:
 	static PacketBuffer* create(size_t size = 0) {
 		size = std::max(size, PACKET_BUFFER_MIN_SIZE - PACKET_BUFFER_OVERHEAD);
+		if (size == PACKET_BUFFER_MIN_SIZE - PACKET_BUFFER_OVERHEAD) {
+			// A default-size buffer is allocated for essentially every packet sent; use FastAllocator's
+			// thread-local magazines so these recycle across packets instead of hitting the general heap
+			return new (FastAllocator<PACKET_BUFFER_MIN_SIZE>::allocate()) PacketBuffer{ size };
+		}
 		uint8_t* mem = new uint8_t[size + PACKET_BUFFER_OVERHEAD];
 		return new (mem) PacketBuffer{ size };
 	}
@@ -838,7 +900,11 @@ public:
 	void addref() { ++reference_count; }
 	void delref() {
 		if (!--reference_count) {
-			delete[] reinterpret_cast<uint8_t*>(this);
+			if (size_ == PACKET_BUFFER_MIN_SIZE - PACKET_BUFFER_OVERHEAD) {
+				FastAllocator<PACKET_BUFFER_MIN_SIZE>::release(this);
+			} else {
+				delete[] reinterpret_cast<uint8_t*>(this);
+			}
 		}
 	}
 	int bytes_unwritten() const { return size_ - bytes_written; }
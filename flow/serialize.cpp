@@ -78,6 +78,19 @@ struct NewStruct : public _Struct {
 	}
 };
 
+struct VersionGatedStruct {
+	int always{ 0 };
+	bool gated{ false };
+
+	template <class Archive>
+	void serialize(Archive& ar) {
+		serializer(ar, always);
+		if (ar.protocolVersion().hasReportConflictingKeys()) {
+			serializer(ar, gated);
+		}
+	}
+};
+
 void verifyData(StringRef value, int numObjects) {
 	{
 		// use BinaryReader
@@ -115,6 +128,35 @@ TEST_CASE("flow/serialize/Downgrade/WriteOld") {
 	return Void();
 }
 
+// The fixed-version fast path must produce exactly the bytes the generic path produces for the
+// same version, since readers cannot tell which writer encoded a value.
+TEST_CASE("flow/serialize/StaticVersionWriter") {
+	VersionGatedStruct object;
+	object.always = deterministicRandom()->randomInt(0, 1000);
+	object.gated = deterministicRandom()->coinflip();
+
+	BinaryWriter generic(AssumeVersion(defaultProtocolVersion));
+	generic << object;
+
+	BinaryWriter specialized(AssumeVersion(defaultProtocolVersion));
+	saveWithVersionSpecialization(specialized, object);
+
+	ASSERT(generic.toValue() == specialized.toValue());
+
+	// A pre-ReportConflictingKeys version must fall back to the generic path and omit the gated
+	// field.
+	BinaryWriter old(AssumeVersion(ProtocolVersion::withWatches()));
+	saveWithVersionSpecialization(old, object);
+	ASSERT_EQ(old.getLength(), sizeof(int));
+
+	VersionGatedStruct readBack;
+	BinaryReader reader(specialized.toValue(), AssumeVersion(defaultProtocolVersion));
+	reader >> readBack;
+	ASSERT_EQ(readBack.always, object.always);
+	ASSERT_EQ(readBack.gated, object.gated);
+	return Void();
+}
+
 // Verify that old code will still be able to read the values of the struct it knows about, even if we add a new field
 // and write a message with new code.
 TEST_CASE("flow/serialize/Downgrade/WriteNew") {
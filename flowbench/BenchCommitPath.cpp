@@ -0,0 +1,164 @@
+/*
+ * BenchCommitPath.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "fdbclient/CommitTransaction.h"
+#include "fdbclient/FDBTypes.h"
+#include "fdbserver/ResolverInterface.h"
+#include "flow/Arena.h"
+#include "flow/Hash3.h"
+#include "flow/ObjectSerializer.h"
+#include "flow/serialize.h"
+#include "flowbench/GlobalData.h"
+
+// Benchmarks the data-plane stages of the proxy commit pipeline against synthetic
+// batches: transaction payload (de)serialization, resolver request building, and
+// mutation serialization for the log push. The routing tables that drive the real
+// stages (keyResolvers, tagsForKey) live in fdbserver translation units that
+// flowbench does not link, so resolver fan-out is modeled with a hash split; the
+// per-byte arena and serialization work being measured is the same.
+
+// CommitTransactionRef has no file identifier of its own (it always travels inside a
+// request), so batches are wrapped in this payload struct to use the same object
+// serializer the wire uses. CommitTransactionRequest itself is not serialized here
+// because its ReplyPromise cannot be serialized off the network thread.
+struct CommitBatchPayload {
+	constexpr static FileIdentifier file_identifier = 13332341;
+	Arena arena;
+	VectorRef<CommitTransactionRef> transactions;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, transactions, arena);
+	}
+};
+
+static Standalone<VectorRef<CommitTransactionRef>> makeTransactionBatch(int numTransactions,
+                                                                        int mutationsPerTransaction,
+                                                                        int keySize,
+                                                                        int valueSize) {
+	Standalone<VectorRef<CommitTransactionRef>> batch;
+	for (int t = 0; t < numTransactions; ++t) {
+		CommitTransactionRef tr;
+		for (int m = 0; m < mutationsPerTransaction; ++m) {
+			KeyValueRef kv = getKV(keySize, valueSize);
+			std::string suffix = format("/%d/%d", t, m);
+			KeyRef key = kv.key.withSuffix(StringRef(suffix), batch.arena());
+			tr.mutations.push_back(batch.arena(), MutationRef(MutationRef::Type::SetValue, key, kv.value));
+			tr.write_conflict_ranges.push_back(batch.arena(), singleKeyRange(key, batch.arena()));
+			tr.read_conflict_ranges.push_back(batch.arena(), singleKeyRange(key, batch.arena()));
+		}
+		batch.push_back(batch.arena(), tr);
+	}
+	return batch;
+}
+
+// Serialization and deserialization of a batch of commit transaction payloads, the
+// work done once per transaction on the client and once per batch member when the
+// proxy unpacks commit requests.
+static void bench_commit_batch_serde(benchmark::State& state) {
+	int numTransactions = state.range(0);
+	int mutationsPerTransaction = state.range(1);
+	auto batch = makeTransactionBatch(numTransactions, mutationsPerTransaction, 32, 128);
+	size_t size = 0;
+	for (auto _ : state) {
+		CommitBatchPayload payload;
+		payload.transactions = batch;
+		Standalone<StringRef> msg = ObjectWriter::toValue(payload, IncludeVersion());
+		size = msg.size();
+		ObjectReader rd(msg.begin(), IncludeVersion());
+		CommitBatchPayload out;
+		rd.deserialize(out);
+		benchmark::DoNotOptimize(out);
+	}
+	state.SetItemsProcessed(numTransactions * static_cast<long>(state.iterations()));
+	state.counters.insert({ { "Size", size } });
+}
+
+// Building per-resolver ResolveTransactionBatchRequests from a batch, as
+// ResolutionRequestBuilder does: each conflict range is copied into the arena of
+// every resolver request it routes to. Routing is a hash split instead of the
+// proxy's keyResolvers map.
+static void bench_resolution_request_build(benchmark::State& state) {
+	int numTransactions = state.range(0);
+	int numResolvers = state.range(1);
+	auto batch = makeTransactionBatch(numTransactions, 10, 32, 128);
+	for (auto _ : state) {
+		std::vector<ResolveTransactionBatchRequest> requests(numResolvers);
+		std::vector<CommitTransactionRef*> outTr(numResolvers);
+		for (const auto& trIn : batch) {
+			std::fill(outTr.begin(), outTr.end(), nullptr);
+			auto getOutTransaction = [&](int resolver) -> CommitTransactionRef& {
+				CommitTransactionRef*& out = outTr[resolver];
+				if (!out) {
+					ResolveTransactionBatchRequest& request = requests[resolver];
+					request.transactions.resize(request.arena, request.transactions.size() + 1);
+					out = &request.transactions.back();
+					out->read_snapshot = trIn.read_snapshot;
+				}
+				return *out;
+			};
+			for (const auto& r : trIn.read_conflict_ranges) {
+				int resolver = hashlittle(r.begin.begin(), r.begin.size(), 0) % numResolvers;
+				getOutTransaction(resolver).read_conflict_ranges.push_back(requests[resolver].arena, r);
+			}
+			for (const auto& r : trIn.write_conflict_ranges) {
+				int resolver = hashlittle(r.begin.begin(), r.begin.size(), 0) % numResolvers;
+				getOutTransaction(resolver).write_conflict_ranges.push_back(requests[resolver].arena, r);
+			}
+		}
+		benchmark::DoNotOptimize(requests);
+	}
+	state.SetItemsProcessed(numTransactions * static_cast<long>(state.iterations()));
+}
+
+// Serializing a batch's mutations with their tags, the per-mutation work
+// LogPushData::writeTypedMessage performs when filling TLog pushes.
+static void bench_log_push_serialize(benchmark::State& state) {
+	int numTransactions = state.range(0);
+	int numTags = state.range(1);
+	auto batch = makeTransactionBatch(numTransactions, 10, 32, 128);
+	std::vector<Tag> tags;
+	for (int i = 0; i < numTags; ++i) {
+		tags.push_back(Tag(0, i));
+	}
+	size_t size = 0;
+	for (auto _ : state) {
+		BinaryWriter wr(AssumeVersion(g_network->protocolVersion()));
+		for (const auto& tr : batch) {
+			for (const auto& m : tr.mutations) {
+				wr << uint16_t(tags.size());
+				for (const auto& tag : tags) {
+					wr << tag;
+				}
+				wr << m;
+			}
+		}
+		size = wr.getLength();
+		benchmark::DoNotOptimize(wr);
+	}
+	state.SetItemsProcessed(numTransactions * static_cast<long>(state.iterations()));
+	state.counters.insert({ { "Size", size } });
+}
+
+BENCHMARK(bench_commit_batch_serde)->Ranges({ { 1, 1 << 10 }, { 1, 1 << 6 } })->ReportAggregatesOnly(true);
+BENCHMARK(bench_resolution_request_build)->Ranges({ { 1, 1 << 10 }, { 1, 8 } })->ReportAggregatesOnly(true);
+BENCHMARK(bench_log_push_serialize)->Ranges({ { 1, 1 << 10 }, { 1, 8 } })->ReportAggregatesOnly(true);
@@ -0,0 +1,94 @@
+/*
+ * BenchCompressedInt.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "flow/Arena.h"
+#include "flow/CompressedInt.h"
+#include "flow/GroupVarint.h"
+#include "flow/IRandom.h"
+#include "flow/serialize.h"
+
+#include <vector>
+
+// Values with the magnitude mix of length/count fields in mutation streams: mostly small, some large
+static std::vector<uint32_t> makeValues(int count) {
+	std::vector<uint32_t> values(count);
+	for (auto& v : values) {
+		int bits = deterministicRandom()->randomInt(0, 25);
+		v = uint32_t(deterministicRandom()->randomInt64(0, (int64_t(1) << bits)));
+	}
+	return values;
+}
+
+static void bench_compressedIntEncode(benchmark::State& state) {
+	auto values = makeValues(state.range(0));
+	for (auto _ : state) {
+		BinaryWriter w(AssumeVersion(g_network->protocolVersion()));
+		for (uint32_t v : values) {
+			w << CompressedInt<int32_t>(v);
+		}
+		benchmark::DoNotOptimize(w.getLength());
+	}
+	state.SetItemsProcessed(state.range(0) * static_cast<long>(state.iterations()));
+}
+
+static void bench_compressedIntDecode(benchmark::State& state) {
+	auto values = makeValues(state.range(0));
+	BinaryWriter w(AssumeVersion(g_network->protocolVersion()));
+	for (uint32_t v : values) {
+		w << CompressedInt<int32_t>(v);
+	}
+	Standalone<StringRef> encoded = w.toValue();
+	for (auto _ : state) {
+		BinaryReader r(encoded, AssumeVersion(g_network->protocolVersion()));
+		CompressedInt<int32_t> ci;
+		for (int i = 0; i < state.range(0); ++i) {
+			r >> ci;
+		}
+		benchmark::DoNotOptimize(ci.value);
+	}
+	state.SetItemsProcessed(state.range(0) * static_cast<long>(state.iterations()));
+}
+
+static void bench_groupVarintEncode(benchmark::State& state) {
+	auto values = makeValues(state.range(0));
+	std::vector<uint8_t> buf(GroupVarint32::maxEncodedSize(values.size()));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(GroupVarint32::encode(values.data(), values.size(), buf.data()));
+	}
+	state.SetItemsProcessed(state.range(0) * static_cast<long>(state.iterations()));
+}
+
+static void bench_groupVarintDecode(benchmark::State& state) {
+	auto values = makeValues(state.range(0));
+	std::vector<uint8_t> buf(GroupVarint32::maxEncodedSize(values.size()));
+	int len = GroupVarint32::encode(values.data(), values.size(), buf.data());
+	std::vector<uint32_t> out(values.size());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(GroupVarint32::decode(buf.data(), buf.data() + len, out.data(), out.size()));
+	}
+	state.SetItemsProcessed(state.range(0) * static_cast<long>(state.iterations()));
+}
+
+BENCHMARK(bench_compressedIntEncode)->Range(1 << 4, 1 << 14)->ReportAggregatesOnly(true);
+BENCHMARK(bench_compressedIntDecode)->Range(1 << 4, 1 << 14)->ReportAggregatesOnly(true);
+BENCHMARK(bench_groupVarintEncode)->Range(1 << 4, 1 << 14)->ReportAggregatesOnly(true);
+BENCHMARK(bench_groupVarintDecode)->Range(1 << 4, 1 << 14)->ReportAggregatesOnly(true);
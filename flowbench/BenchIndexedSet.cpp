@@ -0,0 +1,54 @@
+/*
+ * BenchIndexedSet.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "flow/IRandom.h"
+#include "flow/IndexedSet.h"
+
+// Benchmarks point lookups in an IndexedSet large enough that the upper levels of the tree fall out
+// of cache, which is the access pattern of the storage server byte sample.
+static void bench_indexedset_find(benchmark::State& state) {
+	int64_t items = state.range(0);
+	IndexedSet<int64_t, int64_t> set;
+	for (int64_t i = 0; i < items; ++i) {
+		set.insert(i, 1);
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(set.find(deterministicRandom()->randomInt64(0, items)));
+	}
+	state.SetItemsProcessed(static_cast<long>(state.iterations()));
+}
+
+// Benchmarks metric-weighted selection, as used to pick shard split points from the byte sample.
+static void bench_indexedset_index(benchmark::State& state) {
+	int64_t items = state.range(0);
+	IndexedSet<int64_t, int64_t> set;
+	for (int64_t i = 0; i < items; ++i) {
+		set.insert(i, 1);
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(set.index(deterministicRandom()->randomInt64(0, items)));
+	}
+	state.SetItemsProcessed(static_cast<long>(state.iterations()));
+}
+
+BENCHMARK(bench_indexedset_find)->Range(1 << 10, 1 << 22)->ReportAggregatesOnly(true);
+BENCHMARK(bench_indexedset_index)->Range(1 << 10, 1 << 22)->ReportAggregatesOnly(true);
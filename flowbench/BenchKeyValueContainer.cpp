@@ -0,0 +1,94 @@
+/*
+ * BenchKeyValueContainer.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "fdbclient/FDBTypes.h"
+#include "fdbserver/IKeyValueContainer.h"
+#include "fdbserver/RadixTree.h"
+#include "flow/Arena.h"
+#include "flow/IRandom.h"
+#include "flowbench/GlobalData.h"
+
+// Builds keys of the shape <shared prefix><8 digit suffix>, which is the long-common-prefix
+// workload where the radix tree should shine: the shared prefix is stored once near the root
+// instead of being re-compared on every probe of a balanced binary tree.
+static std::vector<Key> makeKeys(int items, int prefixLen) {
+	std::string prefix = getKey(prefixLen).toString();
+	std::vector<Key> keys;
+	keys.reserve(items);
+	for (int i = 0; i < items; ++i) {
+		keys.push_back(Key(StringRef(prefix + format("%08d", i))));
+	}
+	return keys;
+}
+
+// Benchmarks point reads through the container types selectable for KeyValueStoreMemory
+// (IKeyValueContainer is "memory", radix_tree is "memory-radixtree").
+template <class Container>
+static void bench_container_point_read(benchmark::State& state) {
+	int items = state.range(0);
+	int prefixLen = state.range(1);
+
+	std::vector<Key> keys = makeKeys(items, prefixLen);
+	ValueRef value = getKV(prefixLen, 100).value;
+	Container data;
+	for (const auto& key : keys) {
+		data.insert(key, value);
+	}
+
+	for (auto _ : state) {
+		auto it = data.find(keys[deterministicRandom()->randomInt(0, items)]);
+		benchmark::DoNotOptimize(it);
+	}
+	state.SetItemsProcessed(static_cast<long>(state.iterations()));
+}
+
+// Benchmarks building the container, the dominant cost of the memory engine's recovery replay.
+template <class Container>
+static void bench_container_insert(benchmark::State& state) {
+	int items = state.range(0);
+	int prefixLen = state.range(1);
+
+	std::vector<Key> keys = makeKeys(items, prefixLen);
+	ValueRef value = getKV(prefixLen, 100).value;
+
+	for (auto _ : state) {
+		Container data;
+		for (const auto& key : keys) {
+			data.insert(key, value);
+		}
+		benchmark::DoNotOptimize(data);
+	}
+	state.SetItemsProcessed(items * static_cast<long>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(bench_container_point_read, IKeyValueContainer)
+    ->Ranges({ { 1 << 10, 1 << 20 }, { 16, 128 } })
+    ->ReportAggregatesOnly(true);
+BENCHMARK_TEMPLATE(bench_container_point_read, radix_tree)
+    ->Ranges({ { 1 << 10, 1 << 20 }, { 16, 128 } })
+    ->ReportAggregatesOnly(true);
+BENCHMARK_TEMPLATE(bench_container_insert, IKeyValueContainer)
+    ->Ranges({ { 1 << 10, 1 << 18 }, { 16, 128 } })
+    ->ReportAggregatesOnly(true);
+BENCHMARK_TEMPLATE(bench_container_insert, radix_tree)
+    ->Ranges({ { 1 << 10, 1 << 18 }, { 16, 128 } })
+    ->ReportAggregatesOnly(true);
@@ -118,6 +118,18 @@ static void bench_latencyBands(benchmark::State& state) {
 }
 BENCHMARK(bench_latencyBands)->Arg(1)->Arg(4)->Arg(7)->Arg(10)->ReportAggregatesOnly(true);
 
+static void bench_counter(benchmark::State& state) {
+	CounterCollection cc("CounterTest");
+	Counter c("ops", cc);
+
+	for (auto _ : state) {
+		c += state.range(0);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(bench_counter)->Arg(1)->Arg(100)->ReportAggregatesOnly(true);
+
 static void bench_histogramInt(benchmark::State& state) {
 	Reference<Histogram> h = Histogram::getHistogram("histogramTest"_sr, "bytes"_sr, Histogram::Unit::bytes);
 	InputGenerator<int32_t> data(1e6, []() { return deterministicRandom()->randomInt64(0, 1e9); });
@@ -130,6 +142,19 @@ static void bench_histogramInt(benchmark::State& state) {
 }
 BENCHMARK(bench_histogramInt)->ReportAggregatesOnly(true);
 
+static void bench_histogramIntBatched(benchmark::State& state) {
+	Reference<Histogram> h = Histogram::getHistogram("histogramTest"_sr, "bytesBatched"_sr, Histogram::Unit::bytes);
+	InputGenerator<int32_t> data(1e6, []() { return deterministicRandom()->randomInt64(0, 1e9); });
+	const uint32_t batch = state.range(0);
+
+	for (auto _ : state) {
+		h->sample(data.next(), batch);
+	}
+
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(bench_histogramIntBatched)->Arg(8)->Arg(64)->ReportAggregatesOnly(true);
+
 static void bench_histogramPct(benchmark::State& state) {
 	Reference<Histogram> h = Histogram::getHistogram("histogramTest"_sr, "pct"_sr, Histogram::Unit::percentageLinear);
 	InputGenerator<double> data(1e6, []() { return deterministicRandom()->random01() * 1.5; });
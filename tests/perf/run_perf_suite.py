@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+#
+# run_perf_suite.py
+#
+# This source file is part of the FoundationDB open source project
+#
+# Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Workload-level performance regression suite.
+
+Runs each test spec in this directory against a fixed-size local cluster
+(via tests/TestRunner/tmp_cluster.py), collects the Metric trace events the
+tester emits for each workload's PerfMetrics, and compares the metrics named
+in baselines.json against their checked-in baselines with per-metric
+tolerance bands. Exits non-zero if any checked metric falls outside its band.
+
+Baselines are absolute numbers and therefore only meaningful on the host
+class they were recorded on; the default tolerances are deliberately wide so
+the suite catches large regressions rather than noise. Use --record to
+re-measure the baselines for a new reference host (tolerances and directions
+are preserved).
+"""
+
+import argparse
+import glob
+import json
+import subprocess
+import sys
+from pathlib import Path
+
+sys.path.append(str(Path(__file__).resolve().parent.parent.joinpath("TestRunner")))
+
+from tmp_cluster import TempCluster
+
+
+def collect_metrics(log_dir):
+    metrics = {}
+    for trace_file in glob.glob(str(Path(log_dir).joinpath("*.json"))):
+        with open(trace_file) as f:
+            for line in f:
+                try:
+                    event = json.loads(line)
+                except json.JSONDecodeError:
+                    continue
+                if event.get("Type") == "Metric":
+                    metrics[event["Name"]] = float(event["Value"])
+    return metrics
+
+
+def run_test(cluster, fdbserver, spec, log_dir):
+    log_dir.mkdir(parents=True, exist_ok=True)
+    command = [
+        str(fdbserver),
+        "-r",
+        "test",
+        "-C",
+        str(cluster.cluster_file),
+        "-f",
+        str(spec),
+        "--log",
+        "--logdir",
+        str(log_dir),
+        "--trace-format",
+        "json",
+    ]
+    subprocess.run(command, check=True)
+    return collect_metrics(log_dir)
+
+
+def check_metrics(test_name, metrics, checks):
+    failures = []
+    for name, check in checks.items():
+        if name not in metrics:
+            failures.append("{}: metric '{}' not reported by the test".format(test_name, name))
+            continue
+        value = metrics[name]
+        baseline = check["baseline"]
+        tolerance = check["tolerance"]
+        if check["direction"] == "higher":
+            bound = baseline * (1 - tolerance)
+            ok = value >= bound
+            relation = ">="
+        else:
+            bound = baseline * (1 + tolerance)
+            ok = value <= bound
+            relation = "<="
+        print(
+            "{} {}: {} {:.2f} (required {} {:.2f}, baseline {:.2f})".format(
+                "PASS" if ok else "FAIL", test_name, name, value, relation, bound, baseline
+            )
+        )
+        if not ok:
+            failures.append("{}: {} = {:.2f}, required {} {:.2f}".format(test_name, name, value, relation, bound))
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--build-dir", required=True, help="FDB build directory")
+    parser.add_argument(
+        "--baselines",
+        default=str(Path(__file__).resolve().parent.joinpath("baselines.json")),
+        help="Path to the baselines file",
+    )
+    parser.add_argument(
+        "--tests",
+        nargs="*",
+        default=None,
+        help="Test spec files to run (defaults to every spec named in the baselines file)",
+    )
+    parser.add_argument("--process-number", type=int, default=4, help="Number of fdbserver processes in the cluster")
+    parser.add_argument(
+        "--record",
+        action="store_true",
+        help="Rewrite the baselines file with the measured values instead of checking against it",
+    )
+    args = parser.parse_args()
+
+    spec_dir = Path(__file__).resolve().parent
+    with open(args.baselines) as f:
+        baselines = json.load(f)
+
+    if args.tests:
+        specs = [Path(t).resolve() for t in args.tests]
+    else:
+        specs = [spec_dir.joinpath(name + ".txt") for name in sorted(baselines.keys())]
+
+    failures = []
+    fdbserver = Path(args.build_dir).resolve().joinpath("bin", "fdbserver")
+    with TempCluster(args.build_dir, args.process_number) as cluster:
+        for spec in specs:
+            test_name = spec.stem
+            print("Running {} ...".format(test_name))
+            log_dir = Path(cluster.tmp_dir).joinpath("perf_logs", test_name)
+            metrics = run_test(cluster, fdbserver, spec, log_dir)
+            if test_name not in baselines:
+                print("No baselines for {}, reported metrics:".format(test_name))
+                for name, value in sorted(metrics.items()):
+                    print("    {} = {:.2f}".format(name, value))
+                continue
+            if args.record:
+                for name, check in baselines[test_name].items():
+                    if name in metrics:
+                        check["baseline"] = metrics[name]
+            else:
+                failures.extend(check_metrics(test_name, metrics, baselines[test_name]))
+
+    if args.record:
+        with open(args.baselines, "w") as f:
+            json.dump(baselines, f, indent=4)
+            f.write("\n")
+        print("Recorded baselines to {}".format(args.baselines))
+        return 0
+
+    if failures:
+        print("\n{} performance check(s) failed:".format(len(failures)))
+        for failure in failures:
+            print("    " + failure)
+        return 1
+    print("\nAll performance checks passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())